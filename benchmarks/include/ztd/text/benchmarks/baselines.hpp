@@ -0,0 +1,222 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#pragma once
+
+#ifndef ZTD_TEXT_BENCHMARKS_BASELINES_HPP
+#define ZTD_TEXT_BENCHMARKS_BASELINES_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/char8_t.hpp>
+
+#include <cstddef>
+
+// Straightforward, hand-written, one-code-point-at-a-time conversions that validate their input and write U+FFFD
+// for every ill-formed sequence, the way ztd.text does with a replacement_handler. They are the kind of loop people
+// write when they do not have a library, and serve as the "how much does the abstraction cost" reference point.
+namespace ztd { namespace text { namespace benchmarks { namespace baseline {
+
+	inline constexpr char32_t replacement = 0xFFFD;
+	inline constexpr char32_t ill_formed  = 0xFFFFFFFF;
+
+	//////
+	/// @brief Decodes one UTF-8 code point starting at @p input, advancing @p input past it. Ill-formed sequences
+	/// yield #ill_formed and are skipped by their maximal subpart.
+	//////
+	inline char32_t decode_utf8_one(const uchar8_t*& input, const uchar8_t* last) noexcept {
+		unsigned char lead = static_cast<unsigned char>(*input++);
+		if (lead < 0x80) {
+			return lead;
+		}
+		std::size_t length;
+		char32_t code_point;
+		unsigned char lower = 0x80, upper = 0xBF;
+		if (lead >= 0xC2 && lead <= 0xDF) {
+			length     = 1;
+			code_point = lead & 0x1F;
+		}
+		else if (lead >= 0xE0 && lead <= 0xEF) {
+			length     = 2;
+			code_point = lead & 0x0F;
+			lower      = lead == 0xE0 ? 0xA0 : 0x80;
+			upper      = lead == 0xED ? 0x9F : 0xBF;
+		}
+		else if (lead >= 0xF0 && lead <= 0xF4) {
+			length     = 3;
+			code_point = lead & 0x07;
+			lower      = lead == 0xF0 ? 0x90 : 0x80;
+			upper      = lead == 0xF4 ? 0x8F : 0xBF;
+		}
+		else {
+			return ill_formed;
+		}
+		for (std::size_t index = 0; index < length; ++index) {
+			if (input == last) {
+				return ill_formed;
+			}
+			unsigned char trail = static_cast<unsigned char>(*input);
+			if (trail < lower || trail > upper) {
+				return ill_formed;
+			}
+			lower      = 0x80;
+			upper      = 0xBF;
+			code_point = (code_point << 6) | (trail & 0x3F);
+			++input;
+		}
+		return code_point;
+	}
+
+	//////
+	/// @brief Decodes one UTF-16 code point starting at @p input, advancing @p input past it. Unpaired surrogates
+	/// yield #ill_formed.
+	//////
+	inline char32_t decode_utf16_one(const char16_t*& input, const char16_t* last) noexcept {
+		char32_t lead = *input++;
+		if (lead < 0xD800 || lead > 0xDFFF) {
+			return lead;
+		}
+		if (lead > 0xDBFF || input == last || *input < 0xDC00 || *input > 0xDFFF) {
+			return ill_formed;
+		}
+		char32_t trail = *input++;
+		return 0x10000 + ((lead - 0xD800) << 10) + (trail - 0xDC00);
+	}
+
+	inline char32_t check_utf32(char32_t code_point) noexcept {
+		return (code_point > 0x10FFFF || (code_point >= 0xD800 && code_point <= 0xDFFF)) ? ill_formed : code_point;
+	}
+
+	inline uchar8_t* encode_utf8_one(char32_t code_point, uchar8_t* output) noexcept {
+		if (code_point < 0x80) {
+			*output++ = static_cast<uchar8_t>(code_point);
+		}
+		else if (code_point < 0x800) {
+			*output++ = static_cast<uchar8_t>(0xC0 | (code_point >> 6));
+			*output++ = static_cast<uchar8_t>(0x80 | (code_point & 0x3F));
+		}
+		else if (code_point < 0x10000) {
+			*output++ = static_cast<uchar8_t>(0xE0 | (code_point >> 12));
+			*output++ = static_cast<uchar8_t>(0x80 | ((code_point >> 6) & 0x3F));
+			*output++ = static_cast<uchar8_t>(0x80 | (code_point & 0x3F));
+		}
+		else {
+			*output++ = static_cast<uchar8_t>(0xF0 | (code_point >> 18));
+			*output++ = static_cast<uchar8_t>(0x80 | ((code_point >> 12) & 0x3F));
+			*output++ = static_cast<uchar8_t>(0x80 | ((code_point >> 6) & 0x3F));
+			*output++ = static_cast<uchar8_t>(0x80 | (code_point & 0x3F));
+		}
+		return output;
+	}
+
+	inline char16_t* encode_utf16_one(char32_t code_point, char16_t* output) noexcept {
+		if (code_point < 0x10000) {
+			*output++ = static_cast<char16_t>(code_point);
+		}
+		else {
+			char32_t offset = code_point - 0x10000;
+			*output++       = static_cast<char16_t>(0xD800 + (offset >> 10));
+			*output++       = static_cast<char16_t>(0xDC00 + (offset & 0x3FF));
+		}
+		return output;
+	}
+
+	inline char32_t* encode_utf32_one(char32_t code_point, char32_t* output) noexcept {
+		*output++ = code_point;
+		return output;
+	}
+
+	inline char32_t decode_one(const uchar8_t*& input, const uchar8_t* last) noexcept {
+		return decode_utf8_one(input, last);
+	}
+
+	inline char32_t decode_one(const char16_t*& input, const char16_t* last) noexcept {
+		return decode_utf16_one(input, last);
+	}
+
+	inline char32_t decode_one(const char32_t*& input, const char32_t*) noexcept {
+		return check_utf32(*input++);
+	}
+
+	inline uchar8_t* encode_one(char32_t code_point, uchar8_t* output) noexcept {
+		return encode_utf8_one(code_point, output);
+	}
+
+	inline char16_t* encode_one(char32_t code_point, char16_t* output) noexcept {
+		return encode_utf16_one(code_point, output);
+	}
+
+	inline char32_t* encode_one(char32_t code_point, char32_t* output) noexcept {
+		return encode_utf32_one(code_point, output);
+	}
+
+	//////
+	/// @brief Transcodes [ @p first, @p last ) into @p output, returning one past the last written code unit. The
+	/// output must be large enough.
+	//////
+	template <typename FromCodeUnit, typename ToCodeUnit>
+	inline ToCodeUnit* transcode(const FromCodeUnit* first, const FromCodeUnit* last, ToCodeUnit* output) noexcept {
+		while (first != last) {
+			char32_t code_point = decode_one(first, last);
+			output              = encode_one(code_point == ill_formed ? replacement : code_point, output);
+		}
+		return output;
+	}
+
+	//////
+	/// @brief Counts the code points in [ @p first, @p last ), counting every ill-formed sequence as one.
+	//////
+	template <typename CodeUnit>
+	inline std::size_t count(const CodeUnit* first, const CodeUnit* last) noexcept {
+		std::size_t code_points = 0;
+		for (; first != last; ++code_points) {
+			(void)decode_one(first, last);
+		}
+		return code_points;
+	}
+
+	//////
+	/// @brief Returns a pointer to the first ill-formed sequence in [ @p first, @p last ), or @p last if there is
+	/// none.
+	//////
+	template <typename CodeUnit>
+	inline const CodeUnit* validate(const CodeUnit* first, const CodeUnit* last) noexcept {
+		while (first != last) {
+			const CodeUnit* start = first;
+			if (decode_one(first, last) == ill_formed) {
+				return start;
+			}
+		}
+		return last;
+	}
+
+}}}} // namespace ztd::text::benchmarks::baseline
+
+#endif // ZTD_TEXT_BENCHMARKS_BASELINES_HPP
@@ -0,0 +1,253 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#pragma once
+
+#ifndef ZTD_TEXT_BENCHMARKS_CORPORA_HPP
+#define ZTD_TEXT_BENCHMARKS_CORPORA_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/char8_t.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace ztd { namespace text { namespace benchmarks {
+
+	//////
+	/// @brief The kinds of text every benchmark is run over.
+	//////
+	enum class corpus_kind {
+		//////
+		/// @brief Mostly ASCII, as found in source code, markup and logs, with the odd accented letter.
+		//////
+		ascii,
+		//////
+		/// @brief Latin-script prose with a heavy mix of accented letters (2-byte UTF-8 sequences).
+		//////
+		latin,
+		//////
+		/// @brief Chinese / Japanese text (3-byte UTF-8 sequences) with some ASCII punctuation.
+		//////
+		cjk,
+		//////
+		/// @brief Chat-like text where roughly half of the characters are emoji (4-byte UTF-8 sequences, UTF-16
+		/// surrogate pairs).
+		//////
+		emoji,
+		//////
+		/// @brief Latin-script prose where about one in every fifty characters is an invalid code unit sequence.
+		//////
+		invalid
+	};
+
+	inline constexpr std::array<corpus_kind, 5> corpus_kinds
+		= { corpus_kind::ascii, corpus_kind::latin, corpus_kind::cjk, corpus_kind::emoji, corpus_kind::invalid };
+
+	inline constexpr const char* corpus_name(corpus_kind kind) noexcept {
+		switch (kind) {
+		case corpus_kind::ascii:
+			return "ascii";
+		case corpus_kind::latin:
+			return "latin";
+		case corpus_kind::cjk:
+			return "cjk";
+		case corpus_kind::emoji:
+			return "emoji";
+		case corpus_kind::invalid:
+		default:
+			return "invalid";
+		}
+	}
+
+	//////
+	/// @brief The same text, in each of the Unicode encoding forms.
+	///
+	/// @remarks For the invalid corpus, every invalid spot is a single bad code unit in each encoding form (a stray
+	/// continuation byte, a lone surrogate and an out-of-range value, respectively), so that decoding any of them with
+	/// a replacement handler produces exactly #code_points code points.
+	//////
+	struct corpus {
+		std::basic_string<uchar8_t> utf8;
+		std::u16string utf16;
+		std::u32string utf32;
+		std::size_t code_points;
+		std::size_t invalid_sequences;
+
+		template <typename CodeUnit>
+		const std::basic_string<CodeUnit>& text() const noexcept {
+			if constexpr (sizeof(CodeUnit) == sizeof(char32_t)) {
+				return this->utf32;
+			}
+			else if constexpr (sizeof(CodeUnit) == sizeof(char16_t)) {
+				return this->utf16;
+			}
+			else {
+				return this->utf8;
+			}
+		}
+	};
+
+	namespace detail {
+		inline constexpr std::size_t corpus_code_points = 1 << 16;
+		inline constexpr char32_t invalid_marker        = 0xFFFFFFFF;
+
+		inline char32_t pick(std::minstd_rand& engine, char32_t first, char32_t last) {
+			return static_cast<char32_t>(first + (engine() % (last - first + 1)));
+		}
+
+		inline char32_t ascii_text(std::minstd_rand& engine) {
+			std::uint_fast32_t roll = engine() % 32;
+			if (roll < 5) {
+				return U' ';
+			}
+			if (roll == 5) {
+				return U'\n';
+			}
+			if (roll < 8) {
+				return pick(engine, U'!', U'/');
+			}
+			return pick(engine, U'a', U'z');
+		}
+
+		inline char32_t next_code_point(std::minstd_rand& engine, corpus_kind kind) {
+			std::uint_fast32_t roll = engine() % 100;
+			switch (kind) {
+			case corpus_kind::ascii:
+				return roll < 98 ? ascii_text(engine) : pick(engine, 0xC0, 0xFF);
+			case corpus_kind::cjk:
+				if (roll < 85) {
+					return pick(engine, 0x4E00, 0x9FFF);
+				}
+				if (roll < 93) {
+					return pick(engine, 0x3040, 0x30FF);
+				}
+				return roll < 97 ? pick(engine, 0x3000, 0x3002) : ascii_text(engine);
+			case corpus_kind::emoji:
+				if (roll < 35) {
+					return pick(engine, 0x1F300, 0x1F64F);
+				}
+				if (roll < 50) {
+					return pick(engine, 0x1F900, 0x1F9FF);
+				}
+				return ascii_text(engine);
+			case corpus_kind::invalid:
+				if (roll < 2) {
+					return invalid_marker;
+				}
+				[[fallthrough]];
+			case corpus_kind::latin:
+			default:
+				return roll < 70 ? ascii_text(engine) : pick(engine, 0xC0, 0x17F);
+			}
+		}
+
+		inline void append_utf8(std::basic_string<uchar8_t>& output, char32_t code_point) {
+			if (code_point == invalid_marker) {
+				output.push_back(static_cast<uchar8_t>(0x80));
+			}
+			else if (code_point < 0x80) {
+				output.push_back(static_cast<uchar8_t>(code_point));
+			}
+			else if (code_point < 0x800) {
+				output.push_back(static_cast<uchar8_t>(0xC0 | (code_point >> 6)));
+				output.push_back(static_cast<uchar8_t>(0x80 | (code_point & 0x3F)));
+			}
+			else if (code_point < 0x10000) {
+				output.push_back(static_cast<uchar8_t>(0xE0 | (code_point >> 12)));
+				output.push_back(static_cast<uchar8_t>(0x80 | ((code_point >> 6) & 0x3F)));
+				output.push_back(static_cast<uchar8_t>(0x80 | (code_point & 0x3F)));
+			}
+			else {
+				output.push_back(static_cast<uchar8_t>(0xF0 | (code_point >> 18)));
+				output.push_back(static_cast<uchar8_t>(0x80 | ((code_point >> 12) & 0x3F)));
+				output.push_back(static_cast<uchar8_t>(0x80 | ((code_point >> 6) & 0x3F)));
+				output.push_back(static_cast<uchar8_t>(0x80 | (code_point & 0x3F)));
+			}
+		}
+
+		inline void append_utf16(std::u16string& output, char32_t code_point) {
+			if (code_point == invalid_marker) {
+				output.push_back(static_cast<char16_t>(0xDC00));
+			}
+			else if (code_point < 0x10000) {
+				output.push_back(static_cast<char16_t>(code_point));
+			}
+			else {
+				char32_t offset = code_point - 0x10000;
+				output.push_back(static_cast<char16_t>(0xD800 + (offset >> 10)));
+				output.push_back(static_cast<char16_t>(0xDC00 + (offset & 0x3FF)));
+			}
+		}
+
+		inline corpus make_corpus(corpus_kind kind) {
+			// a fixed seed: every run, on every machine, measures the same text
+			std::minstd_rand engine(0x7E47 + static_cast<unsigned>(kind));
+			corpus result {};
+			result.code_points = corpus_code_points;
+			result.utf32.reserve(corpus_code_points);
+			for (std::size_t index = 0; index < corpus_code_points; ++index) {
+				char32_t code_point = next_code_point(engine, kind);
+				append_utf8(result.utf8, code_point);
+				append_utf16(result.utf16, code_point);
+				if (code_point == invalid_marker) {
+					++result.invalid_sequences;
+					result.utf32.push_back(static_cast<char32_t>(0x110000));
+				}
+				else {
+					result.utf32.push_back(code_point);
+				}
+			}
+			return result;
+		}
+	} // namespace detail
+
+	//////
+	/// @brief Returns the (lazily generated, then cached) corpus for the given kind of text.
+	//////
+	inline const corpus& get_corpus(corpus_kind kind) {
+		static const std::array<corpus, corpus_kinds.size()> corpora = []() {
+			std::array<corpus, corpus_kinds.size()> generated {};
+			for (std::size_t index = 0; index < corpus_kinds.size(); ++index) {
+				generated[index] = detail::make_corpus(corpus_kinds[index]);
+			}
+			return generated;
+		}();
+		return corpora[static_cast<std::size_t>(kind)];
+	}
+
+}}} // namespace ztd::text::benchmarks
+
+#endif // ZTD_TEXT_BENCHMARKS_CORPORA_HPP
@@ -0,0 +1,73 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#pragma once
+
+#ifndef ZTD_TEXT_BENCHMARKS_THROUGHPUT_HPP
+#define ZTD_TEXT_BENCHMARKS_THROUGHPUT_HPP
+
+#include <ztd/text/benchmarks/corpora.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+namespace ztd { namespace text { namespace benchmarks {
+
+	//////
+	/// @brief Reports input bytes per second and code points per second for a benchmark that went over @p bytes
+	/// bytes of input, representing @p code_points code points, on every iteration.
+	//////
+	inline void set_throughput(benchmark::State& state, std::size_t bytes, std::size_t code_points) {
+		state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bytes));
+		state.counters["code_points"] = benchmark::Counter(
+			static_cast<double>(state.iterations()) * static_cast<double>(code_points), benchmark::Counter::kIsRate);
+	}
+
+	//////
+	/// @brief Registers @p function once per corpus, as "<name>/<corpus name>". @p function is called with the
+	/// benchmark state and the corpus.
+	//////
+	template <typename Function>
+	inline bool register_for_all_corpora(const std::string& name, Function function) {
+		for (corpus_kind kind : corpus_kinds) {
+			std::string full_name = name + "/" + corpus_name(kind);
+			benchmark::RegisterBenchmark(full_name.c_str(),
+				[function, kind](benchmark::State& state) { function(state, get_corpus(kind)); });
+		}
+		return true;
+	}
+
+}}} // namespace ztd::text::benchmarks
+
+#endif // ZTD_TEXT_BENCHMARKS_THROUGHPUT_HPP
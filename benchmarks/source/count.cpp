@@ -0,0 +1,106 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#include <ztd/text/count_code_points.hpp>
+#include <ztd/text/count_code_units.hpp>
+#include <ztd/text/encoding.hpp>
+#include <ztd/text/error_handler.hpp>
+
+#include <ztd/text/benchmarks/baselines.hpp>
+#include <ztd/text/benchmarks/corpora.hpp>
+#include <ztd/text/benchmarks/throughput.hpp>
+
+#include <string_view>
+#include <vector>
+
+inline namespace ztd_text_benchmarks_count {
+	// count_code_units: how many code points decoding the code units produces
+	template <typename Encoding>
+	void count_code_units(benchmark::State& state, const ztd::text::benchmarks::corpus& corpus) {
+		using code_unit = ztd::text::code_unit_t<Encoding>;
+		Encoding encoding {};
+		std::basic_string_view<code_unit> input(corpus.text<code_unit>());
+		auto check = ztd::text::count_code_units(input, encoding, ztd::text::replacement_handler {});
+		if (check.count != corpus.code_points) {
+			state.SkipWithError("count_code_units gave the wrong count");
+			return;
+		}
+		for (auto _ : state) {
+			auto result = ztd::text::count_code_units(input, encoding, ztd::text::replacement_handler {});
+			benchmark::DoNotOptimize(result.count);
+		}
+		ztd::text::benchmarks::set_throughput(state, input.size() * sizeof(code_unit), corpus.code_points);
+	}
+
+	// count_code_points: how many code units encoding the code points produces
+	template <typename Encoding>
+	void count_code_points(benchmark::State& state, const ztd::text::benchmarks::corpus& corpus) {
+		using code_unit = ztd::text::code_unit_t<Encoding>;
+		Encoding encoding {};
+		std::u32string_view input(corpus.utf32);
+		std::vector<code_unit> expected(corpus.code_points * 4);
+		std::size_t expected_count = static_cast<std::size_t>(
+			ztd::text::benchmarks::baseline::transcode(input.data(), input.data() + input.size(), expected.data())
+			- expected.data());
+		auto check = ztd::text::count_code_points(input, encoding, ztd::text::replacement_handler {});
+		if (check.count != expected_count) {
+			state.SkipWithError("count_code_points gave the wrong count");
+			return;
+		}
+		for (auto _ : state) {
+			auto result = ztd::text::count_code_points(input, encoding, ztd::text::replacement_handler {});
+			benchmark::DoNotOptimize(result.count);
+		}
+		ztd::text::benchmarks::set_throughput(state, input.size() * sizeof(char32_t), corpus.code_points);
+	}
+
+	template <typename CodeUnit>
+	void baseline_count(benchmark::State& state, const ztd::text::benchmarks::corpus& corpus) {
+		const std::basic_string<CodeUnit>& input = corpus.text<CodeUnit>();
+		for (auto _ : state) {
+			std::size_t count = ztd::text::benchmarks::baseline::count(input.data(), input.data() + input.size());
+			benchmark::DoNotOptimize(count);
+		}
+		ztd::text::benchmarks::set_throughput(state, input.size() * sizeof(CodeUnit), corpus.code_points);
+	}
+
+	template <typename Encoding>
+	bool register_encoding(const std::string& name) {
+		using code_unit = ztd::text::code_unit_t<Encoding>;
+		return ztd::text::benchmarks::register_for_all_corpora(
+		            "count_code_units/" + name, &count_code_units<Encoding>)
+		     && ztd::text::benchmarks::register_for_all_corpora(
+		          "count_code_points/" + name, &count_code_points<Encoding>)
+		     && ztd::text::benchmarks::register_for_all_corpora("baseline/count/" + name, &baseline_count<code_unit>);
+	}
+
+	[[maybe_unused]] const bool registered = register_encoding<ztd::text::utf8>("utf8")
+		&& register_encoding<ztd::text::utf16>("utf16") && register_encoding<ztd::text::utf32>("utf32");
+} // namespace ztd_text_benchmarks_count
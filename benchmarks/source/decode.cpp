@@ -0,0 +1,110 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#include <ztd/text/decode.hpp>
+#include <ztd/text/decode_view.hpp>
+#include <ztd/text/encoding.hpp>
+#include <ztd/text/error_handler.hpp>
+
+#include <ztd/text/benchmarks/baselines.hpp>
+#include <ztd/text/benchmarks/corpora.hpp>
+#include <ztd/text/benchmarks/throughput.hpp>
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+inline namespace ztd_text_benchmarks_decode {
+	template <typename Encoding>
+	void decode_into(benchmark::State& state, const ztd::text::benchmarks::corpus& corpus) {
+		using code_unit  = ztd::text::code_unit_t<Encoding>;
+		using code_point = ztd::text::code_point_t<Encoding>;
+		Encoding encoding {};
+		std::basic_string_view<code_unit> input(corpus.text<code_unit>());
+		std::vector<code_point> output(corpus.code_points);
+		ztd::text::span<code_point> output_view(output.data(), output.size());
+		auto check = ztd::text::decode_into(input, encoding, output_view, ztd::text::replacement_handler {});
+		if (!check.input.empty() || !check.output.empty()) {
+			state.SkipWithError("decode_into did not produce one code point per corpus code point");
+			return;
+		}
+		for (auto _ : state) {
+			auto result = ztd::text::decode_into(input, encoding, output_view, ztd::text::replacement_handler {});
+			benchmark::DoNotOptimize(result.output.data());
+			benchmark::ClobberMemory();
+		}
+		ztd::text::benchmarks::set_throughput(state, input.size() * sizeof(code_unit), corpus.code_points);
+	}
+
+	template <typename Encoding, std::size_t BufferSize>
+	void decode_view(benchmark::State& state, const ztd::text::benchmarks::corpus& corpus) {
+		using code_unit  = ztd::text::code_unit_t<Encoding>;
+		using code_point = ztd::text::code_point_t<Encoding>;
+		using view       = ztd::text::decode_view<Encoding, std::basic_string_view<code_unit>,
+		     ztd::text::replacement_handler, ztd::text::decode_state_t<Encoding>, BufferSize>;
+		std::basic_string_view<code_unit> input(corpus.text<code_unit>());
+		std::vector<code_point> output(corpus.code_points);
+		for (auto _ : state) {
+			code_point* out = output.data();
+			for (code_point code_point_value : view(input)) {
+				*out = code_point_value;
+				++out;
+			}
+			benchmark::DoNotOptimize(out);
+			benchmark::ClobberMemory();
+		}
+		ztd::text::benchmarks::set_throughput(state, input.size() * sizeof(code_unit), corpus.code_points);
+	}
+
+	template <typename CodeUnit>
+	void baseline_decode(benchmark::State& state, const ztd::text::benchmarks::corpus& corpus) {
+		const std::basic_string<CodeUnit>& input = corpus.text<CodeUnit>();
+		std::vector<char32_t> output(corpus.code_points);
+		for (auto _ : state) {
+			char32_t* last = ztd::text::benchmarks::baseline::transcode(
+				input.data(), input.data() + input.size(), output.data());
+			benchmark::DoNotOptimize(last);
+			benchmark::ClobberMemory();
+		}
+		ztd::text::benchmarks::set_throughput(state, input.size() * sizeof(CodeUnit), corpus.code_points);
+	}
+
+	[[maybe_unused]] const bool registered
+		= ztd::text::benchmarks::register_for_all_corpora("decode_into/utf8", &decode_into<ztd::text::utf8>)
+		&& ztd::text::benchmarks::register_for_all_corpora("decode_into/utf16", &decode_into<ztd::text::utf16>)
+		&& ztd::text::benchmarks::register_for_all_corpora("decode_into/utf32", &decode_into<ztd::text::utf32>)
+		&& ztd::text::benchmarks::register_for_all_corpora("decode_view/utf8", &decode_view<ztd::text::utf8, 0>)
+		&& ztd::text::benchmarks::register_for_all_corpora(
+			"decode_view/buffered/utf8", &decode_view<ztd::text::utf8, 64>)
+		&& ztd::text::benchmarks::register_for_all_corpora(
+			"baseline/decode/utf8", &baseline_decode<ztd::text::uchar8_t>)
+		&& ztd::text::benchmarks::register_for_all_corpora("baseline/decode/utf16", &baseline_decode<char16_t>)
+		&& ztd::text::benchmarks::register_for_all_corpora("baseline/decode/utf32", &baseline_decode<char32_t>);
+} // namespace ztd_text_benchmarks_decode
@@ -0,0 +1,84 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#include <ztd/text/encode.hpp>
+#include <ztd/text/encoding.hpp>
+#include <ztd/text/error_handler.hpp>
+
+#include <ztd/text/benchmarks/baselines.hpp>
+#include <ztd/text/benchmarks/corpora.hpp>
+#include <ztd/text/benchmarks/throughput.hpp>
+
+#include <string_view>
+#include <vector>
+
+inline namespace ztd_text_benchmarks_encode {
+	template <typename Encoding>
+	void encode_into(benchmark::State& state, const ztd::text::benchmarks::corpus& corpus) {
+		using code_unit = ztd::text::code_unit_t<Encoding>;
+		Encoding encoding {};
+		std::u32string_view input(corpus.utf32);
+		std::vector<code_unit> output(corpus.code_points * ztd::text::max_code_units_v<Encoding>);
+		ztd::text::span<code_unit> output_view(output.data(), output.size());
+		auto check = ztd::text::encode_into(input, encoding, output_view, ztd::text::replacement_handler {});
+		if (!check.input.empty()) {
+			state.SkipWithError("encode_into did not encode the whole corpus");
+			return;
+		}
+		for (auto _ : state) {
+			auto result = ztd::text::encode_into(input, encoding, output_view, ztd::text::replacement_handler {});
+			benchmark::DoNotOptimize(result.output.data());
+			benchmark::ClobberMemory();
+		}
+		ztd::text::benchmarks::set_throughput(state, input.size() * sizeof(char32_t), corpus.code_points);
+	}
+
+	template <typename CodeUnit>
+	void baseline_encode(benchmark::State& state, const ztd::text::benchmarks::corpus& corpus) {
+		const std::u32string& input = corpus.utf32;
+		std::vector<CodeUnit> output(corpus.code_points * 4);
+		for (auto _ : state) {
+			CodeUnit* last = ztd::text::benchmarks::baseline::transcode(
+				input.data(), input.data() + input.size(), output.data());
+			benchmark::DoNotOptimize(last);
+			benchmark::ClobberMemory();
+		}
+		ztd::text::benchmarks::set_throughput(state, input.size() * sizeof(char32_t), corpus.code_points);
+	}
+
+	[[maybe_unused]] const bool registered
+		= ztd::text::benchmarks::register_for_all_corpora("encode_into/utf8", &encode_into<ztd::text::utf8>)
+		&& ztd::text::benchmarks::register_for_all_corpora("encode_into/utf16", &encode_into<ztd::text::utf16>)
+		&& ztd::text::benchmarks::register_for_all_corpora("encode_into/utf32", &encode_into<ztd::text::utf32>)
+		&& ztd::text::benchmarks::register_for_all_corpora(
+			"baseline/encode/utf8", &baseline_encode<ztd::text::uchar8_t>)
+		&& ztd::text::benchmarks::register_for_all_corpora("baseline/encode/utf16", &baseline_encode<char16_t>)
+		&& ztd::text::benchmarks::register_for_all_corpora("baseline/encode/utf32", &baseline_encode<char32_t>);
+} // namespace ztd_text_benchmarks_encode
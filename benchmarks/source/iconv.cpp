@@ -0,0 +1,137 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#include <ztd/text/version.hpp>
+
+#if defined(ZTD_TEXT_BENCHMARKS_ICONV) && ZTD_TEXT_BENCHMARKS_ICONV != 0
+
+#include <ztd/text/endian.hpp>
+#include <ztd/text/char8_t.hpp>
+
+#include <ztd/text/benchmarks/baselines.hpp>
+#include <ztd/text/benchmarks/corpora.hpp>
+#include <ztd/text/benchmarks/throughput.hpp>
+
+#include <iconv.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+inline namespace ztd_text_benchmarks_iconv {
+	template <typename CodeUnit>
+	const char* iconv_name() noexcept {
+		constexpr bool is_little = ztd::text::endian::native == ztd::text::endian::little;
+		if constexpr (sizeof(CodeUnit) == sizeof(char32_t)) {
+			return is_little ? "UTF-32LE" : "UTF-32BE";
+		}
+		else if constexpr (sizeof(CodeUnit) == sizeof(char16_t)) {
+			return is_little ? "UTF-16LE" : "UTF-16BE";
+		}
+		else {
+			return "UTF-8";
+		}
+	}
+
+	// iconv stops at the first invalid sequence: skip one code unit and write U+FFFD, the same as a
+	// replacement_handler does for the (single code unit) errors in the invalid corpus. Returns the number of code
+	// units written, or -1 if something else went wrong.
+	template <typename FromCodeUnit, typename ToCodeUnit>
+	std::size_t iconv_transcode(iconv_t converter, const std::basic_string<FromCodeUnit>& input,
+		std::vector<ToCodeUnit>& output) noexcept {
+		char* input_bytes       = const_cast<char*>(reinterpret_cast<const char*>(input.data()));
+		std::size_t input_left  = input.size() * sizeof(FromCodeUnit);
+		char* output_bytes      = reinterpret_cast<char*>(output.data());
+		std::size_t output_left = output.size() * sizeof(ToCodeUnit);
+		iconv(converter, nullptr, nullptr, nullptr, nullptr);
+		while (input_left != 0) {
+			std::size_t converted = iconv(converter, &input_bytes, &input_left, &output_bytes, &output_left);
+			if (converted != static_cast<std::size_t>(-1)) {
+				break;
+			}
+			if (errno != EILSEQ && errno != EINVAL) {
+				return static_cast<std::size_t>(-1);
+			}
+			input_bytes += sizeof(FromCodeUnit);
+			input_left -= sizeof(FromCodeUnit);
+			ToCodeUnit* first = reinterpret_cast<ToCodeUnit*>(output_bytes);
+			ToCodeUnit* last  = ztd::text::benchmarks::baseline::encode_one(
+				ztd::text::benchmarks::baseline::replacement, first);
+			output_bytes = reinterpret_cast<char*>(last);
+			output_left -= static_cast<std::size_t>(last - first) * sizeof(ToCodeUnit);
+		}
+		return output.size() - (output_left / sizeof(ToCodeUnit));
+	}
+
+	template <typename FromCodeUnit, typename ToCodeUnit>
+	void iconv_benchmark(benchmark::State& state, const ztd::text::benchmarks::corpus& corpus) {
+		iconv_t converter = iconv_open(iconv_name<ToCodeUnit>(), iconv_name<FromCodeUnit>());
+		if (converter == reinterpret_cast<iconv_t>(-1)) {
+			state.SkipWithError("iconv does not support this conversion");
+			return;
+		}
+		const std::basic_string<FromCodeUnit>& input = corpus.text<FromCodeUnit>();
+		std::vector<ToCodeUnit> output(corpus.code_points * 4);
+		if (iconv_transcode(converter, input, output) == static_cast<std::size_t>(-1)) {
+			state.SkipWithError("iconv failed to convert the corpus");
+			iconv_close(converter);
+			return;
+		}
+		for (auto _ : state) {
+			std::size_t written = iconv_transcode(converter, input, output);
+			benchmark::DoNotOptimize(written);
+			benchmark::ClobberMemory();
+		}
+		iconv_close(converter);
+		ztd::text::benchmarks::set_throughput(state, input.size() * sizeof(FromCodeUnit), corpus.code_points);
+	}
+
+	template <typename FromCodeUnit, typename ToCodeUnit>
+	bool register_iconv(const std::string& name) {
+		return ztd::text::benchmarks::register_for_all_corpora(
+			"iconv/" + name, &iconv_benchmark<FromCodeUnit, ToCodeUnit>);
+	}
+
+	using ztd::text::uchar8_t;
+
+	[[maybe_unused]] const bool registered = register_iconv<uchar8_t, char32_t>("decode/utf8")
+		&& register_iconv<char16_t, char32_t>("decode/utf16")
+		&& register_iconv<char32_t, uchar8_t>("encode/utf8")
+		&& register_iconv<char32_t, char16_t>("encode/utf16")
+		&& register_iconv<uchar8_t, char16_t>("transcode/utf8/utf16")
+		&& register_iconv<uchar8_t, char32_t>("transcode/utf8/utf32")
+		&& register_iconv<char16_t, uchar8_t>("transcode/utf16/utf8")
+		&& register_iconv<char16_t, char32_t>("transcode/utf16/utf32")
+		&& register_iconv<char32_t, uchar8_t>("transcode/utf32/utf8")
+		&& register_iconv<char32_t, char16_t>("transcode/utf32/utf16");
+} // namespace ztd_text_benchmarks_iconv
+
+#endif
@@ -0,0 +1,113 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#include <ztd/text/transcode.hpp>
+#include <ztd/text/encoding.hpp>
+#include <ztd/text/error_handler.hpp>
+
+#include <ztd/text/benchmarks/baselines.hpp>
+#include <ztd/text/benchmarks/corpora.hpp>
+#include <ztd/text/benchmarks/throughput.hpp>
+
+#include <string_view>
+#include <vector>
+
+inline namespace ztd_text_benchmarks_transcode {
+	template <typename FromEncoding, typename ToEncoding>
+	void transcode_into(benchmark::State& state, const ztd::text::benchmarks::corpus& corpus) {
+		using from_code_unit = ztd::text::code_unit_t<FromEncoding>;
+		using to_code_unit   = ztd::text::code_unit_t<ToEncoding>;
+		FromEncoding from_encoding {};
+		ToEncoding to_encoding {};
+		std::basic_string_view<from_code_unit> input(corpus.text<from_code_unit>());
+		std::vector<to_code_unit> output(corpus.code_points * ztd::text::max_code_units_v<ToEncoding>);
+		ztd::text::span<to_code_unit> output_view(output.data(), output.size());
+		auto check = ztd::text::transcode_into(input, from_encoding, output_view, to_encoding,
+			ztd::text::replacement_handler {}, ztd::text::replacement_handler {});
+		if (!check.input.empty()) {
+			state.SkipWithError("transcode_into did not transcode the whole corpus");
+			return;
+		}
+		for (auto _ : state) {
+			auto result = ztd::text::transcode_into(input, from_encoding, output_view, to_encoding,
+				ztd::text::replacement_handler {}, ztd::text::replacement_handler {});
+			benchmark::DoNotOptimize(result.output.data());
+			benchmark::ClobberMemory();
+		}
+		ztd::text::benchmarks::set_throughput(state, input.size() * sizeof(from_code_unit), corpus.code_points);
+	}
+
+	template <typename FromEncoding, typename ToEncoding>
+	void transcode(benchmark::State& state, const ztd::text::benchmarks::corpus& corpus) {
+		using from_code_unit = ztd::text::code_unit_t<FromEncoding>;
+		FromEncoding from_encoding {};
+		ToEncoding to_encoding {};
+		std::basic_string_view<from_code_unit> input(corpus.text<from_code_unit>());
+		for (auto _ : state) {
+			auto result = ztd::text::transcode(input, from_encoding, to_encoding, ztd::text::replacement_handler {},
+				ztd::text::replacement_handler {});
+			benchmark::DoNotOptimize(result.data());
+		}
+		ztd::text::benchmarks::set_throughput(state, input.size() * sizeof(from_code_unit), corpus.code_points);
+	}
+
+	template <typename FromCodeUnit, typename ToCodeUnit>
+	void baseline_transcode(benchmark::State& state, const ztd::text::benchmarks::corpus& corpus) {
+		const std::basic_string<FromCodeUnit>& input = corpus.text<FromCodeUnit>();
+		std::vector<ToCodeUnit> output(corpus.code_points * 4);
+		for (auto _ : state) {
+			ToCodeUnit* last = ztd::text::benchmarks::baseline::transcode(
+				input.data(), input.data() + input.size(), output.data());
+			benchmark::DoNotOptimize(last);
+			benchmark::ClobberMemory();
+		}
+		ztd::text::benchmarks::set_throughput(state, input.size() * sizeof(FromCodeUnit), corpus.code_points);
+	}
+
+	template <typename FromEncoding, typename ToEncoding>
+	bool register_pair(const std::string& from_name, const std::string& to_name) {
+		using from_code_unit = ztd::text::code_unit_t<FromEncoding>;
+		using to_code_unit   = ztd::text::code_unit_t<ToEncoding>;
+		std::string pair_name = from_name + "/" + to_name;
+		return ztd::text::benchmarks::register_for_all_corpora(
+		            "transcode_into/" + pair_name, &transcode_into<FromEncoding, ToEncoding>)
+		     && ztd::text::benchmarks::register_for_all_corpora(
+		          "transcode/" + pair_name, &transcode<FromEncoding, ToEncoding>)
+		     && ztd::text::benchmarks::register_for_all_corpora(
+		          "baseline/transcode/" + pair_name, &baseline_transcode<from_code_unit, to_code_unit>);
+	}
+
+	[[maybe_unused]] const bool registered = register_pair<ztd::text::utf8, ztd::text::utf16>("utf8", "utf16")
+		&& register_pair<ztd::text::utf8, ztd::text::utf32>("utf8", "utf32")
+		&& register_pair<ztd::text::utf16, ztd::text::utf8>("utf16", "utf8")
+		&& register_pair<ztd::text::utf16, ztd::text::utf32>("utf16", "utf32")
+		&& register_pair<ztd::text::utf32, ztd::text::utf8>("utf32", "utf8")
+		&& register_pair<ztd::text::utf32, ztd::text::utf16>("utf32", "utf16");
+} // namespace ztd_text_benchmarks_transcode
@@ -0,0 +1,107 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#include <ztd/text/validate_code_units.hpp>
+#include <ztd/text/encoding.hpp>
+
+#include <ztd/text/benchmarks/baselines.hpp>
+#include <ztd/text/benchmarks/corpora.hpp>
+#include <ztd/text/benchmarks/throughput.hpp>
+
+#include <string_view>
+
+// Validation stops at the first error. To measure something meaningful for the invalid corpus too, each iteration
+// finds every error: it validates, steps over the offending code unit, and validates the rest again, until it gets
+// to the end.
+inline namespace ztd_text_benchmarks_validate {
+	template <typename Encoding>
+	std::size_t find_all_errors(std::basic_string_view<ztd::text::code_unit_t<Encoding>> input, Encoding& encoding) {
+		std::size_t errors = 0;
+		for (;;) {
+			auto result = ztd::text::validate_code_units(input, encoding);
+			if (result.valid) {
+				return errors;
+			}
+			++errors;
+			input = result.input.substr(1);
+		}
+	}
+
+	template <typename CodeUnit>
+	std::size_t baseline_find_all_errors(const CodeUnit* first, const CodeUnit* last) {
+		std::size_t errors = 0;
+		for (;;) {
+			first = ztd::text::benchmarks::baseline::validate(first, last);
+			if (first == last) {
+				return errors;
+			}
+			++errors;
+			++first;
+		}
+	}
+
+	template <typename Encoding>
+	void validate_code_units(benchmark::State& state, const ztd::text::benchmarks::corpus& corpus) {
+		using code_unit = ztd::text::code_unit_t<Encoding>;
+		Encoding encoding {};
+		std::basic_string_view<code_unit> input(corpus.text<code_unit>());
+		if (find_all_errors(input, encoding) != corpus.invalid_sequences) {
+			state.SkipWithError("validate_code_units found the wrong number of errors");
+			return;
+		}
+		for (auto _ : state) {
+			std::size_t errors = find_all_errors(input, encoding);
+			benchmark::DoNotOptimize(errors);
+		}
+		ztd::text::benchmarks::set_throughput(state, input.size() * sizeof(code_unit), corpus.code_points);
+	}
+
+	template <typename CodeUnit>
+	void baseline_validate(benchmark::State& state, const ztd::text::benchmarks::corpus& corpus) {
+		const std::basic_string<CodeUnit>& input = corpus.text<CodeUnit>();
+		for (auto _ : state) {
+			std::size_t errors = baseline_find_all_errors(input.data(), input.data() + input.size());
+			benchmark::DoNotOptimize(errors);
+		}
+		ztd::text::benchmarks::set_throughput(state, input.size() * sizeof(CodeUnit), corpus.code_points);
+	}
+
+	template <typename Encoding>
+	bool register_encoding(const std::string& name) {
+		using code_unit = ztd::text::code_unit_t<Encoding>;
+		return ztd::text::benchmarks::register_for_all_corpora(
+		            "validate_code_units/" + name, &validate_code_units<Encoding>)
+		     && ztd::text::benchmarks::register_for_all_corpora(
+		          "baseline/validate/" + name, &baseline_validate<code_unit>);
+	}
+
+	[[maybe_unused]] const bool registered = register_encoding<ztd::text::utf8>("utf8")
+		&& register_encoding<ztd::text::utf16>("utf16") && register_encoding<ztd::text::utf32>("utf32");
+} // namespace ztd_text_benchmarks_validate
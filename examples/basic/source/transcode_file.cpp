@@ -0,0 +1,114 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+#include <ztd/text/encoding_registry.hpp>
+#include <ztd/text/transcode_file.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+// Transcodes a file from one encoding to another, by name:
+//
+//     transcode_file <from-encoding> <to-encoding> <input-file> <output-file> [repetitions]
+//
+// The conversion is run the given number of times, and the fastest run is reported, so that this also works as a
+// benchmark driver for whole-file conversions. Run without any arguments, it makes up a file of its own, converts it
+// from UTF-8 to UTF-16LE and back, and checks that it got back what it started with.
+
+static bool run(const char* from_name, const char* to_name, const char* input_path, const char* output_path,
+	int repetitions) {
+	auto encodings = ztd::text::default_encoding_registry().find_pair(from_name, to_name);
+	if (!encodings) {
+		std::fprintf(stderr, "unknown encoding: %s\n", encodings.from == nullptr ? from_name : to_name);
+		return false;
+	}
+	double best_seconds = 0;
+	for (int repetition = 0; repetition < repetitions; ++repetition) {
+		auto start  = std::chrono::steady_clock::now();
+		auto result = ztd::text::transcode_file(input_path, *encodings.from, output_path, *encodings.to,
+			ztd::text::replacement_handler {}, ztd::text::replacement_handler {});
+		std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+		if (result.file_error) {
+			std::fprintf(stderr, "%s\n", result.file_error.message().c_str());
+			return false;
+		}
+		if (result.error_code != ztd::text::encoding_error::ok) {
+			std::fprintf(stderr, "stopped after %zu bytes: %s\n", result.input_size,
+				std::string(ztd::text::to_name(result.error_code)).c_str());
+			return false;
+		}
+		if (repetition == 0 || seconds.count() < best_seconds) {
+			best_seconds = seconds.count();
+		}
+		if (repetition == repetitions - 1) {
+			std::printf("%s -> %s: %zu bytes in, %zu bytes out, %zu errors replaced, %.3f ms (%.1f MiB/s)\n",
+				from_name, to_name, result.input_size, result.output_size, result.handled_errors,
+				best_seconds * 1000, static_cast<double>(result.input_size) / (1024 * 1024) / best_seconds);
+		}
+	}
+	return true;
+}
+
+static std::string read_file(const char* path) {
+	std::ifstream file(path, std::ios::binary);
+	return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+int main(int argc, char* argv[]) {
+	if (argc == 5 || argc == 6) {
+		int repetitions = argc == 6 ? std::atoi(argv[5]) : 1;
+		return run(argv[1], argv[2], argv[3], argv[4], repetitions < 1 ? 1 : repetitions) ? 0 : 1;
+	}
+	if (argc != 1) {
+		std::fprintf(stderr,
+			"usage: %s <from-encoding> <to-encoding> <input-file> <output-file> [repetitions]\n", argv[0]);
+		return 1;
+	}
+
+	const char* utf8_path       = "ztd.text.examples.transcode_file.utf8.txt";
+	const char* utf16_path      = "ztd.text.examples.transcode_file.utf16le.txt";
+	const char* round_trip_path = "ztd.text.examples.transcode_file.round_trip.txt";
+	std::string text;
+	while (text.size() < 8 * 1024 * 1024) {
+		text += "Hello, world! \xC3\x89t\xC3\xA9 \xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82 "
+		        "\xE4\xBD\xA0\xE5\xA5\xBD \xF0\x9F\x90\x88\xF0\x9F\x90\xB1\n";
+	}
+	std::ofstream(utf8_path, std::ios::binary) << text;
+	bool ok = run("UTF-8", "UTF-16LE", utf8_path, utf16_path, 5)
+		&& run("UTF-16LE", "UTF-8", utf16_path, round_trip_path, 5) && read_file(round_trip_path) == text;
+	std::remove(utf8_path);
+	std::remove(utf16_path);
+	std::remove(round_trip_path);
+	return ok ? 0 : 1;
+}
@@ -38,14 +38,22 @@
 #include <ztd/text/forward.hpp>
 #include <ztd/text/char8_t.hpp>
 #include <ztd/text/encoding.hpp>
+#include <ztd/text/encoding_registry.hpp>
 #include <ztd/text/c_string_view.hpp>
 
 #include <ztd/text/encode.hpp>
 #include <ztd/text/decode.hpp>
 #include <ztd/text/transcode.hpp>
+#include <ztd/text/parallel_transcode.hpp>
+#include <ztd/text/streaming_transcoder.hpp>
+#include <ztd/text/basic_transcoding_streambuf.hpp>
+#include <ztd/text/transcode_file.hpp>
 #include <ztd/text/count_code_points.hpp>
 #include <ztd/text/count_code_points.hpp>
 #include <ztd/text/validate_code_units.hpp>
+#include <ztd/text/parallel_count_code_units.hpp>
+#include <ztd/text/parallel_count_code_points.hpp>
+#include <ztd/text/parallel_validate_code_units.hpp>
 #include <ztd/text/validate_code_points.hpp>
 
 #include <ztd/text/encode_view.hpp>
@@ -54,5 +62,6 @@
 
 #include <ztd/text/text_view.hpp>
 #include <ztd/text/text.hpp>
+#include <ztd/text/code_point_index.hpp>
 
 #endif // ZTD_TEXT_HPP
@@ -53,15 +53,21 @@
 #include <ztd/text/validate_code_points.hpp>
 #include <ztd/text/count_code_points.hpp>
 #include <ztd/text/count_code_units.hpp>
+#include <ztd/text/transcode.hpp>
 #include <ztd/text/tag.hpp>
 
 #include <ztd/text/detail/transcode_one.hpp>
+#include <ztd/text/detail/bulk_transcode.hpp>
+#include <ztd/text/detail/chunked_transcode.hpp>
+#include <ztd/text/detail/pass_through_handler.hpp>
 #include <ztd/text/detail/range.hpp>
 #include <ztd/text/detail/ebco.hpp>
+#include <ztd/text/detail/inline_erased.hpp>
 #include <ztd/text/detail/span.hpp>
 
 #include <cstdint>
 #include <cstddef>
+#include <type_traits>
 #include <utility>
 #include <functional>
 #include <memory>
@@ -75,6 +81,79 @@ namespace ztd { namespace text {
 	namespace __txt_detail {
 		inline constexpr ::std::size_t __default_max_code_points_any_encoding = 32;
 		inline constexpr ::std::size_t __default_max_code_units_any_encoding  = 128;
+
+		//////
+		/// @brief A unique address for every type, used to tell which encoding a type-erased encoding is holding.
+		//////
+		template <typename _Type>
+		inline constexpr char __erased_identity = 0;
+
+		template <typename _Encoding>
+		constexpr const _Encoding& __unwrap_native_scheme(const _Encoding& __encoding) noexcept {
+			return __encoding;
+		}
+
+		template <typename _Encoding, typename _Byte,
+			::std::enable_if_t<::std::is_same_v<_Encoding, __remove_cvref_t<__unwrap_t<_Encoding>>>>* = nullptr>
+		constexpr const _Encoding& __unwrap_native_scheme(
+			const encoding_scheme<_Encoding, endian::native, _Byte>& __encoding) noexcept {
+			return __encoding.base();
+		}
+
+		template <typename _Encoding>
+		using __unwrap_native_scheme_t
+			= __remove_cvref_t<decltype(__unwrap_native_scheme(::std::declval<const _Encoding&>()))>;
+
+		//////
+		/// @brief Whether a type-erased encoding holding @p _FromEncoding can transcode straight into one holding
+		/// @p _ToEncoding with ztd::text::__txt_detail::__erased_transcode_to, over buffers of @p _CodeUnit s.
+		///
+		/// @remarks Both states must be empty, as the direct transcode runs with fresh ones. Native-endian
+		/// ztd::text::encoding_scheme s are looked through so that the wrapped encodings' own fast paths are used,
+		/// which needs their code units to be made of a whole number of @p _CodeUnit s.
+		//////
+		template <typename _FromEncoding, typename _ToEncoding, typename _CodeUnit,
+			typename _UFromEncoding = __unwrap_native_scheme_t<_FromEncoding>,
+			typename _UToEncoding   = __unwrap_native_scheme_t<_ToEncoding>>
+		inline constexpr bool __is_erased_transcode_to_viable_v
+			= ::std::is_empty_v<decode_state_t<_FromEncoding>> && ::std::is_empty_v<encode_state_t<_ToEncoding>>
+			&& ::std::is_same_v<code_point_t<_UFromEncoding>, code_point_t<_UToEncoding>>
+			&& (sizeof(code_unit_t<_UFromEncoding>) % sizeof(_CodeUnit) == 0)
+			&& (sizeof(code_unit_t<_UToEncoding>) % sizeof(_CodeUnit) == 0);
+
+		//////
+		/// @brief Transcodes the code units in [ @p __in, @p __in_last ) from @p __from into [ @p __out, @p
+		/// __out_last ) with @p __to, with one call to ztd::text::transcode_into on the concrete encodings.
+		///
+		/// @remarks This has the same requirements as the kernel of ztd::text::__txt_detail::__bulk_transcode_into:
+		/// it stops at the first sequence that is invalid, incomplete, or does not fit, and leaves it alone. If the
+		/// buffers are not suitably aligned for the wrapped encodings' code units, nothing is done at all.
+		//////
+		template <typename _FromEncoding, typename _ToEncoding, typename _CodeUnit>
+		void __erased_transcode_to(const void* __from_encoding, const void* __to_encoding, const _CodeUnit*& __in,
+			const _CodeUnit* __in_last, _CodeUnit*& __out, _CodeUnit* __out_last) {
+			const auto& __from = __unwrap_native_scheme(*static_cast<const _FromEncoding*>(__from_encoding));
+			const auto& __to   = __unwrap_native_scheme(*static_cast<const _ToEncoding*>(__to_encoding));
+			using _FromCodeUnit = code_unit_t<__unwrap_native_scheme_t<_FromEncoding>>;
+			using _ToCodeUnit   = code_unit_t<__unwrap_native_scheme_t<_ToEncoding>>;
+			if ((reinterpret_cast<::std::uintptr_t>(__in) % alignof(_FromCodeUnit)) != 0
+				|| (reinterpret_cast<::std::uintptr_t>(__out) % alignof(_ToCodeUnit)) != 0) {
+				return;
+			}
+			const ::std::size_t __in_size
+				= static_cast<::std::size_t>(__in_last - __in) * sizeof(_CodeUnit) / sizeof(_FromCodeUnit);
+			const ::std::size_t __out_size
+				= static_cast<::std::size_t>(__out_last - __out) * sizeof(_CodeUnit) / sizeof(_ToCodeUnit);
+			decode_state_t<__unwrap_native_scheme_t<_FromEncoding>> __from_state = make_decode_state(__from);
+			encode_state_t<__unwrap_native_scheme_t<_ToEncoding>> __to_state     = make_encode_state(__to);
+			__pass_through_handler __pass_handler;
+			auto __result = transcode_into(
+				::ztd::text::span<const _FromCodeUnit>(reinterpret_cast<const _FromCodeUnit*>(__in), __in_size),
+				__from, ::ztd::text::span<_ToCodeUnit>(reinterpret_cast<_ToCodeUnit*>(__out), __out_size), __to,
+				__pass_handler, __pass_handler, __from_state, __to_state);
+			__in  = reinterpret_cast<const _CodeUnit*>(__adl::__adl_data(__result.input));
+			__out = reinterpret_cast<_CodeUnit*>(__adl::__adl_data(__result.output));
+		}
 	} // namespace __txt_detail
 
 	//////
@@ -99,7 +178,12 @@ namespace ztd { namespace text {
 	/// its convenience alias, ztd::text::any_encoding. This class's use is recommended only for power users who have
 	/// encoding ranges that cannot be interacted with through @c ztd::text::span and therefore need other ways. We are
 	/// looking into ways to produce a subrange<any_iterator> as a completely generic range to aid those individuals
-	/// who do not want to deal in just @c ztd::text::span s.
+	/// who do not want to deal in just @c ztd::text::span s. The wrapped encoding and its states are stored inside
+	/// the ztd::text::any_encoding_with and its state objects when they fit in
+	/// @c ZTD_TEXT_ANY_ENCODING_INLINE_SIZE bytes, and are only allocated on the heap when they do not. When
+	/// transcoding from one ztd::text::any_encoding_with to another, the two wrapped encodings are checked once per
+	/// call: if they are the same encoding, or are both Unicode encodings with stateless conversions, contiguous
+	/// buffers are transcoded with the wrapped encodings directly rather than one code point at a time.
 	//////
 	template <typename _EncodeCodeUnits, typename _EncodeCodePoints, typename _DecodeCodeUnits,
 		typename _DecodeCodePoints, ::std::size_t _MaxCodeUnits = __txt_detail::__default_max_code_units_any_encoding,
@@ -179,7 +263,28 @@ namespace ztd { namespace text {
 		using __count_code_points_error_handler = ::std::function<__encode_result(
 			const any_encoding_with&, __encode_result, const ::ztd::text::span<const code_unit>&)>;
 
+		struct __erased_state;
+
+		using __state_storage = __txt_detail::__inline_erased<__erased_state>;
+
+		using __erased_transcode_to_function = void (*)(
+			const void*, const void*, const code_unit*&, const code_unit*, code_unit*&, code_unit*);
+
+		struct __erased_transcode_to {
+			__erased_transcode_to_function _M_function;
+			const void* _M_from;
+			const void* _M_to;
+		};
+
+		struct __erased_transcode_to_entry {
+			const void* _M_identity;
+			__erased_transcode_to_function _M_function;
+		};
+
 		struct __erased_state {
+			virtual __erased_state* __move_into(void* __destination) noexcept = 0;
+			virtual bool __copy_into(__state_storage& __destination) const   = 0;
+
 			virtual ~__erased_state() {
 			}
 		};
@@ -217,8 +322,14 @@ namespace ztd { namespace text {
 			virtual __count_code_units_result __count_code_units(_DecodeCodeUnits __input,
 				__count_code_units_error_handler __error_handler, decode_state& __state) const  = 0;
 
-			virtual std::unique_ptr<__erased_state> __create_encode_state() const = 0;
-			virtual std::unique_ptr<__erased_state> __create_decode_state() const = 0;
+			virtual void __create_encode_state(__state_storage& __storage) const = 0;
+			virtual void __create_decode_state(__state_storage& __storage) const = 0;
+
+			virtual const void* __identity() const noexcept                                         = 0;
+			virtual const void* __encoding_address() const noexcept                                 = 0;
+			virtual __erased_transcode_to __find_transcode_to(const __erased& __to) const noexcept = 0;
+
+			virtual __erased* __move_into(void* __destination) noexcept = 0;
 
 			virtual ~__erased() {
 			}
@@ -235,8 +346,8 @@ namespace ztd { namespace text {
 			/// @brief Creates a state properly initialized from the stored encoding.
 			///
 			//////
-			any_decode_state(const any_encoding_with& __encoding)
-			: _M_state(__encoding._M_storage->__create_decode_state()) {
+			any_decode_state(const any_encoding_with& __encoding) : _M_state() {
+				__encoding._M_storage->__create_decode_state(this->_M_state);
 			}
 
 			//////
@@ -264,14 +375,18 @@ namespace ztd { namespace text {
 			any_decode_state& operator=(any_decode_state&&) = default;
 
 			__erased_state* _M_get_erased_state() const noexcept {
-				return _M_state.get();
+				return _M_state._M_get();
 			}
 
 		private:
 			template <typename>
 			friend struct __typed;
 
-			std::unique_ptr<__erased_state> _M_state;
+			friend bool __copy_state_into(const any_decode_state& __source, any_decode_state& __destination) {
+				return __source._M_state->__copy_into(__destination._M_state);
+			}
+
+			__state_storage _M_state;
 		};
 
 		//////
@@ -284,8 +399,8 @@ namespace ztd { namespace text {
 			/// @brief Creates a state properly initialized from the stored encoding.
 			///
 			//////
-			any_encode_state(const any_encoding_with& __encoding)
-			: _M_state(__encoding._M_storage->__create_encode_state()) {
+			any_encode_state(const any_encoding_with& __encoding) : _M_state() {
+				__encoding._M_storage->__create_encode_state(this->_M_state);
 			}
 
 			//////
@@ -313,7 +428,7 @@ namespace ztd { namespace text {
 			any_encode_state& operator=(any_encode_state&&) = default;
 
 			__erased_state* _M_get_erased_state() const noexcept {
-				return _M_state.get();
+				return _M_state._M_get();
 			}
 
 		private:
@@ -321,7 +436,11 @@ namespace ztd { namespace text {
 			template <typename>
 			friend struct __typed;
 
-			std::unique_ptr<__erased_state> _M_state;
+			friend bool __copy_state_into(const any_encode_state& __source, any_encode_state& __destination) {
+				return __source._M_state->__copy_into(__destination._M_state);
+			}
+
+			__state_storage _M_state;
 		};
 
 	private:
@@ -332,6 +451,21 @@ namespace ztd { namespace text {
 
 		public:
 			using __base_t::__base_t;
+
+			virtual __erased_state* __move_into(void* __destination) noexcept override {
+				return ::new (__destination) __typed_state(::std::move(*this));
+			}
+
+			virtual bool __copy_into(__state_storage& __destination) const override {
+				if constexpr (::std::is_copy_constructible_v<_State>) {
+					__destination.template _M_emplace<__typed_state>(this->__base_t::get_value());
+					return true;
+				}
+				else {
+					(void)__destination;
+					return false;
+				}
+			}
 		};
 
 		template <typename _Encoding>
@@ -542,17 +676,65 @@ namespace ztd { namespace text {
 					__raw_result.error_code, __raw_result.handled_errors);
 			}
 
-			virtual std::unique_ptr<__erased_state> __create_encode_state() const override {
+			virtual void __create_encode_state(__state_storage& __storage) const override {
 				auto& __encoding = this->__base_t::get_value();
-				return std::make_unique<__typed_state<__real_encode_state>>(make_encode_state(__encoding));
+				__storage.template _M_emplace<__typed_state<__real_encode_state>>(make_encode_state(__encoding));
 			}
 
-			virtual std::unique_ptr<__erased_state> __create_decode_state() const override {
+			virtual void __create_decode_state(__state_storage& __storage) const override {
 				auto& __encoding = this->__base_t::get_value();
-				return std::make_unique<__typed_state<__real_decode_state>>(make_decode_state(__encoding));
+				__storage.template _M_emplace<__typed_state<__real_decode_state>>(make_decode_state(__encoding));
+			}
+
+			virtual const void* __identity() const noexcept override {
+				return &__txt_detail::__erased_identity<_Encoding>;
+			}
+
+			virtual const void* __encoding_address() const noexcept override {
+				return ::std::addressof(this->__base_t::get_value());
+			}
+
+			virtual __erased_transcode_to __find_transcode_to(const __erased& __to) const noexcept override {
+				const void* __to_identity = __to.__identity();
+				for (const __erased_transcode_to_entry& __entry : _S_transcode_to_table) {
+					if (__entry._M_function != nullptr && __entry._M_identity == __to_identity) {
+						return { __entry._M_function, ::std::addressof(this->__base_t::get_value()),
+							__to.__encoding_address() };
+					}
+				}
+				return { nullptr, nullptr, nullptr };
+			}
+
+			virtual __erased* __move_into(void* __destination) noexcept override {
+				return ::new (__destination) __typed(::std::move(*this));
 			}
 
 		private:
+			template <typename _ToEncoding>
+			static constexpr __erased_transcode_to_entry _S_transcode_to_entry() noexcept {
+				if constexpr (__txt_detail::__is_erased_transcode_to_viable_v<_Encoding, _ToEncoding, code_unit>) {
+					return { &__txt_detail::__erased_identity<_ToEncoding>,
+						&__txt_detail::__erased_transcode_to<_Encoding, _ToEncoding, code_unit> };
+				}
+				else {
+					return { nullptr, nullptr };
+				}
+			}
+
+			template <typename _UnicodeEncoding>
+			using __native_scheme_t = ::std::conditional_t<sizeof(code_unit) == 1,
+				encoding_scheme<_UnicodeEncoding, endian::native, code_unit>, _Encoding>;
+
+			// What this encoding can transcode straight into, without going through code points one at a time:
+			// another copy of itself, and the Unicode encodings that ztd::text::any_byte_encoding wraps up in
+			// native-endian encoding schemes.
+			inline static constexpr __erased_transcode_to_entry _S_transcode_to_table[] = {
+				_S_transcode_to_entry<_Encoding>(),
+				_S_transcode_to_entry<__native_scheme_t<utf8>>(),
+				_S_transcode_to_entry<__native_scheme_t<utf16>>(),
+				_S_transcode_to_entry<__native_scheme_t<utf32>>(),
+			};
+
 			__real_encode_state& _M_get_state(encode_state& __state) const {
 				__erased_state* __erased_ptr = __state._M_get_erased_state();
 				__typed_state<__real_encode_state>* __typed_ptr
@@ -568,7 +750,7 @@ namespace ztd { namespace text {
 			}
 		};
 
-		::std::unique_ptr<__erased> _M_storage;
+		__txt_detail::__inline_erased<__erased> _M_storage;
 
 	public:
 		//////
@@ -607,8 +789,9 @@ namespace ztd { namespace text {
 		//////
 		template <typename _Encoding, typename... _Args>
 		any_encoding_with(::std::in_place_type_t<_Encoding> __tag, _Args&&... __args)
-		: _M_storage(::std::make_unique<__typed<_Encoding>>(::std::forward<_Args>(__args)...)) {
+		: _M_storage() {
 			(void)__tag;
+			this->_M_storage.template _M_emplace<__typed<_Encoding>>(::std::forward<_Args>(__args)...);
 		}
 
 		//////
@@ -765,40 +948,68 @@ namespace ztd { namespace text {
 				::std::move(__input), ::std::move(__output), ::std::move(__error_handler), __state);
 		}
 
-		__validate_code_units_result __validate_code_units(
-			_DecodeCodeUnits __input, __decode_error_handler __error_handler, decode_state& __state) const {
-			return this->_M_storage->__validate_code_units(
-				::std::move(__input), ::std::move(__error_handler), __state);
+		__validate_code_units_result __validate_code_units(_DecodeCodeUnits __input, decode_state& __state) const {
+			return this->_M_storage->__validate_code_units(::std::move(__input), __state);
 		}
 
 		__validate_code_points_result __validate_code_points(
-			_EncodeCodePoints __input, __encode_error_handler __error_handler, encode_state& __state) const {
-			return this->_M_storage->__validate_code_points(
-				::std::move(__input), ::std::move(__error_handler), __state);
+			_EncodeCodePoints __input, encode_state& __state) const {
+			return this->_M_storage->__validate_code_points(::std::move(__input), __state);
 		}
 
-		__count_code_points_result __count_code_points(
-			_EncodeCodePoints __input, __decode_error_handler __error_handler, encode_state& __state) const {
+		__count_code_points_result __count_code_points(_EncodeCodePoints __input,
+			__count_code_points_error_handler __error_handler, encode_state& __state) const {
 			return this->_M_storage->__count_code_points(
 				::std::move(__input), ::std::move(__error_handler), __state);
 		}
 
-		__count_code_units_result __count_code_units(
-			_DecodeCodeUnits __input, __encode_error_handler __error_handler, decode_state& __state) const {
+		__count_code_units_result __count_code_units(_DecodeCodeUnits __input,
+			__count_code_units_error_handler __error_handler, decode_state& __state) const {
 			return this->_M_storage->__count_code_units(::std::move(__input), ::std::move(__error_handler), __state);
 		}
 
+		// The bulk hooks below are picked up for any_encoding_with and everything derived from it (e.g.
+		// ztd::text::any_byte_encoding), and go through the stored encoding's own bulk decode_into / encode_into /
+		// validate / count once per call, rather than once per code point. They only apply when the input (and
+		// output) can be handed to the erased operations directly: anything else uses the usual one-by-one loop.
+		template <typename _Encoding>
+		inline static constexpr bool _S_is_self_v = ::std::is_base_of_v<any_encoding_with, _Encoding>;
+
+		template <typename _Input>
+		using __working_input_t = __txt_detail::__string_view_or_span_or_reconstruct_t<_Input>;
+
+		template <typename _Output>
+		using __working_output_t = __txt_detail::__reconstruct_t<__txt_detail::__remove_cvref_t<_Output>>;
+
+		template <typename _WorkingInput, typename _ErasedInput>
+		static _WorkingInput _S_rebuild_input(
+			_WorkingInput& __working_input, const _ErasedInput& __erased_input, const _ErasedInput& __erased_rest) {
+			auto __first = __txt_detail::__adl::__adl_begin(__working_input);
+			::std::advance(__first,
+				__txt_detail::__adl::__adl_size(__erased_input) - __txt_detail::__adl::__adl_size(__erased_rest));
+			return __txt_detail::__reconstruct(::std::in_place_type<_WorkingInput>, ::std::move(__first),
+				__txt_detail::__adl::__adl_end(__working_input));
+		}
+
 
 		//////
 		/// @internal
 		///
 		/// @brief Extension point hooks for the implementation-side only.
 		//////
-		template <typename _Output, typename _ErrorHandler, typename _State>
-		constexpr friend auto __text_decode(tag<any_encoding_with>, _DecodeCodeUnits __input,
-			__txt_detail::__type_identity_t<const any_encoding_with&> __encoding, _Output&& __output,
-			_ErrorHandler&& __error_handler, _State& __state) {
-			return __encoding.__decode(::std::move(__input), ::std::forward<_Output>(__output),
+		template <typename _AnyEncoding, typename _Input, typename _Output, typename _ErrorHandler,
+			::std::enable_if_t<_S_is_self_v<_AnyEncoding>
+			     && ::std::is_convertible_v<__working_input_t<_Input>, _DecodeCodeUnits>
+			     && ::std::is_convertible_v<__working_output_t<_Output>, _DecodeCodePoints>
+			     && ::std::is_constructible_v<__decode_error_handler, _ErrorHandler>>* = nullptr>
+		friend __decode_result __text_decode(tag<_AnyEncoding>, _Input&& __input,
+			const any_encoding_with& __encoding, _Output&& __output, _ErrorHandler&& __error_handler,
+			decode_state& __state) {
+			__working_input_t<_Input> __working_input(__txt_detail::__reconstruct(
+				::std::in_place_type<__working_input_t<_Input>>, ::std::forward<_Input>(__input)));
+			__working_output_t<_Output> __working_output(__txt_detail::__reconstruct(
+				::std::in_place_type<__working_output_t<_Output>>, ::std::forward<_Output>(__output)));
+			return __encoding.__decode(::std::move(__working_input), ::std::move(__working_output),
 				::std::forward<_ErrorHandler>(__error_handler), __state);
 		}
 
@@ -807,11 +1018,19 @@ namespace ztd { namespace text {
 		///
 		/// @brief Extension point hooks for the implementation-side only.
 		//////
-		template <typename _Output, typename _ErrorHandler, typename _State>
-		constexpr friend auto __text_encode(tag<any_encoding_with>, _EncodeCodePoints __input,
-			__txt_detail::__type_identity_t<const any_encoding_with&> __encoding, _Output&& __output,
-			_ErrorHandler&& __error_handler, _State& __state) {
-			return __encoding.__encode(::std::move(__input), ::std::forward<_Output>(__output),
+		template <typename _AnyEncoding, typename _Input, typename _Output, typename _ErrorHandler,
+			::std::enable_if_t<_S_is_self_v<_AnyEncoding>
+			     && ::std::is_convertible_v<__working_input_t<_Input>, _EncodeCodePoints>
+			     && ::std::is_convertible_v<__working_output_t<_Output>, _EncodeCodeUnits>
+			     && ::std::is_constructible_v<__encode_error_handler, _ErrorHandler>>* = nullptr>
+		friend __encode_result __text_encode(tag<_AnyEncoding>, _Input&& __input,
+			const any_encoding_with& __encoding, _Output&& __output, _ErrorHandler&& __error_handler,
+			encode_state& __state) {
+			__working_input_t<_Input> __working_input(__txt_detail::__reconstruct(
+				::std::in_place_type<__working_input_t<_Input>>, ::std::forward<_Input>(__input)));
+			__working_output_t<_Output> __working_output(__txt_detail::__reconstruct(
+				::std::in_place_type<__working_output_t<_Output>>, ::std::forward<_Output>(__output)));
+			return __encoding.__encode(::std::move(__working_input), ::std::move(__working_output),
 				::std::forward<_ErrorHandler>(__error_handler), __state);
 		}
 
@@ -820,6 +1039,43 @@ namespace ztd { namespace text {
 		///
 		/// @brief Extension point hooks for the implementation-side only.
 		//////
+		// When both encodings are erased, the concrete pair is looked up once, and if the from encoding knows how to
+		// transcode into the to encoding directly, that is done with one call into the concrete encodings per
+		// buffer (stopping only to hand errors over to the one-by-one loop and the real error handlers).
+		template <typename _AnyFromEncoding, typename _AnyToEncoding, typename _Input, typename _Output,
+			typename _FromErrorHandler, typename _ToErrorHandler,
+			::std::enable_if_t<_S_is_self_v<_AnyFromEncoding> && _S_is_self_v<_AnyToEncoding>
+			     && __txt_detail::__is_bulk_transcodable_v<_Input, sizeof(code_unit), _Output, sizeof(code_unit)>
+			     && ::std::is_same_v<__txt_detail::__range_value_type_t<__working_input_t<_Input>>, code_unit>
+			     && ::std::is_same_v<__txt_detail::__range_value_type_t<__working_output_t<_Output>>,
+			          code_unit>>* = nullptr>
+		friend auto __text_transcode(tag<_AnyFromEncoding, _AnyToEncoding>, _Input&& __input,
+			const any_encoding_with& __from_encoding, _Output&& __output, const any_encoding_with& __to_encoding,
+			_FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler,
+			decode_state& __from_state, encode_state& __to_state) {
+			const __erased_transcode_to __transcode_to
+				= __from_encoding._M_storage->__find_transcode_to(*__to_encoding._M_storage._M_get());
+			if constexpr (__txt_detail::__is_chunked_transcodable_v<__working_input_t<_Input>,
+				              const any_encoding_with&, __working_output_t<_Output>, const any_encoding_with&,
+				              decode_state, encode_state>) {
+				if (__transcode_to._M_function == nullptr) {
+					return __txt_detail::__chunked_transcode_into(::std::forward<_Input>(__input), __from_encoding,
+						::std::forward<_Output>(__output), __to_encoding, __from_error_handler,
+						__to_error_handler, __from_state, __to_state);
+				}
+			}
+			auto __kernel = [&__transcode_to](const code_unit*& __in, const code_unit* __in_last, code_unit*& __out,
+				                code_unit* __out_last) {
+				if (__transcode_to._M_function != nullptr) {
+					__transcode_to._M_function(
+						__transcode_to._M_from, __transcode_to._M_to, __in, __in_last, __out, __out_last);
+				}
+			};
+			return __txt_detail::__bulk_transcode_into(__kernel, ::std::forward<_Input>(__input), __from_encoding,
+				::std::forward<_Output>(__output), __to_encoding, __from_error_handler, __to_error_handler,
+				__from_state, __to_state);
+		}
+
 		template <typename _EncodeState>
 		constexpr friend auto __text_validate_code_points_one(tag<any_encoding_with>, _DecodeCodeUnits __input,
 			__txt_detail::__type_identity_t<const any_encoding_with&> __encoding, _EncodeState& __state) {
@@ -842,10 +1098,18 @@ namespace ztd { namespace text {
 		///
 		/// @brief Extension point hooks for the implementation-side only.
 		//////
-		template <typename _EncodeState>
-		constexpr friend auto __text_validate_code_points(tag<any_encoding_with>, _DecodeCodeUnits __input,
-			__txt_detail::__type_identity_t<const any_encoding_with&> __encoding, _EncodeState& __state) {
-			return __encoding.__validate_code_points(::std::move(__input), __state);
+		template <typename _AnyEncoding, typename _Input,
+			::std::enable_if_t<_S_is_self_v<_AnyEncoding>
+			     && ::std::is_convertible_v<__working_input_t<_Input>&, _EncodeCodePoints>>* = nullptr>
+		friend auto __text_validate_code_points(
+			tag<_AnyEncoding>, _Input&& __input, const any_encoding_with& __encoding, encode_state& __state) {
+			using _WorkingInput = __working_input_t<_Input>;
+			_WorkingInput __working_input(
+				__txt_detail::__reconstruct(::std::in_place_type<_WorkingInput>, ::std::forward<_Input>(__input)));
+			_EncodeCodePoints __erased_input(__working_input);
+			auto __result = __encoding.__validate_code_points(__erased_input, __state);
+			return validate_result<_WorkingInput, encode_state>(
+				_S_rebuild_input(__working_input, __erased_input, __result.input), __result.valid, __state);
 		}
 
 		//////
@@ -853,10 +1117,18 @@ namespace ztd { namespace text {
 		///
 		/// @brief Extension point hooks for the implementation-side only.
 		//////
-		template <typename _Input, typename _DecodeState>
-		constexpr friend auto __text_validate_code_units(tag<any_encoding_with>, _EncodeCodePoints __input,
-			__txt_detail::__type_identity_t<const any_encoding_with&> __encoding, _DecodeState& __state) {
-			return __encoding.__validate_code_units(::std::move(__input), __state);
+		template <typename _AnyEncoding, typename _Input,
+			::std::enable_if_t<_S_is_self_v<_AnyEncoding>
+			     && ::std::is_convertible_v<__working_input_t<_Input>&, _DecodeCodeUnits>>* = nullptr>
+		friend auto __text_validate_code_units(
+			tag<_AnyEncoding>, _Input&& __input, const any_encoding_with& __encoding, decode_state& __state) {
+			using _WorkingInput = __working_input_t<_Input>;
+			_WorkingInput __working_input(
+				__txt_detail::__reconstruct(::std::in_place_type<_WorkingInput>, ::std::forward<_Input>(__input)));
+			_DecodeCodeUnits __erased_input(__working_input);
+			auto __result = __encoding.__validate_code_units(__erased_input, __state);
+			return validate_result<_WorkingInput, decode_state>(
+				_S_rebuild_input(__working_input, __erased_input, __result.input), __result.valid, __state);
 		}
 
 		//////
@@ -890,11 +1162,23 @@ namespace ztd { namespace text {
 		///
 		/// @brief Extension point hooks for the implementation-side only.
 		//////
-		template <typename _ErrorHandler, typename _State>
-		constexpr friend auto __text_count_code_points(tag<any_encoding_with>, _EncodeCodePoints __input,
-			__txt_detail::__type_identity_t<const any_encoding_with&> __encoding, _ErrorHandler&& __error_handler,
-			_State& __state) {
-			return __encoding.__count_code_points(::std::move(__input), ::std::move(__error_handler), __state);
+		template <typename _AnyEncoding, typename _Input, typename _ErrorHandler,
+			::std::enable_if_t<_S_is_self_v<_AnyEncoding>
+			     && ::std::is_convertible_v<__working_input_t<_Input>&, _EncodeCodePoints>>* = nullptr>
+		friend auto __text_count_code_points(tag<_AnyEncoding>, _Input&& __input,
+			const any_encoding_with& __encoding, _ErrorHandler&& __error_handler, encode_state& __state) {
+			using _WorkingInput = __working_input_t<_Input>;
+			_WorkingInput __working_input(
+				__txt_detail::__reconstruct(::std::in_place_type<_WorkingInput>, ::std::forward<_Input>(__input)));
+			_EncodeCodePoints __erased_input(__working_input);
+			// the erased count does not call back into the handler, and the handler types it is written
+			// against are not ones every handler can be made into
+			(void)__error_handler;
+			auto __result = __encoding.__count_code_points(
+				__erased_input, __count_code_points_error_handler(), __state);
+			return count_result<_WorkingInput, encode_state>(
+				_S_rebuild_input(__working_input, __erased_input, __result.input), __result.count, __state,
+				__result.error_code, __result.handled_errors);
 		}
 
 		//////
@@ -902,12 +1186,23 @@ namespace ztd { namespace text {
 		///
 		/// @brief Extension point hooks for the implementation-side only.
 		//////
-		template <typename _ErrorHandler, typename _State>
-		constexpr friend auto __text_count_code_units(tag<any_encoding_with>, _DecodeCodeUnits __input,
-			__txt_detail::__type_identity_t<const any_encoding_with&> __encoding, _ErrorHandler&& __error_handler,
-			_State& __state) {
-			return __encoding.__count_code_units(
-				::std::move(__input), ::std::forward<_ErrorHandler>(__error_handler), __state);
+		template <typename _AnyEncoding, typename _Input, typename _ErrorHandler,
+			::std::enable_if_t<_S_is_self_v<_AnyEncoding>
+			     && ::std::is_convertible_v<__working_input_t<_Input>&, _DecodeCodeUnits>>* = nullptr>
+		friend auto __text_count_code_units(tag<_AnyEncoding>, _Input&& __input,
+			const any_encoding_with& __encoding, _ErrorHandler&& __error_handler, decode_state& __state) {
+			using _WorkingInput = __working_input_t<_Input>;
+			_WorkingInput __working_input(
+				__txt_detail::__reconstruct(::std::in_place_type<_WorkingInput>, ::std::forward<_Input>(__input)));
+			_DecodeCodeUnits __erased_input(__working_input);
+			// the erased count does not call back into the handler, and the handler types it is written
+			// against are not ones every handler can be made into
+			(void)__error_handler;
+			auto __result = __encoding.__count_code_units(
+				__erased_input, __count_code_units_error_handler(), __state);
+			return count_result<_WorkingInput, decode_state>(
+				_S_rebuild_input(__working_input, __erased_input, __result.input), __result.count, __state,
+				__result.error_code, __result.handled_errors);
 		}
 	};
 
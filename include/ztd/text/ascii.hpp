@@ -42,9 +42,15 @@
 #include <ztd/text/decode_result.hpp>
 #include <ztd/text/error_handler.hpp>
 #include <ztd/text/is_ignorable_error_handler.hpp>
+#include <ztd/text/validate_result.hpp>
+#include <ztd/text/tag.hpp>
 
 #include <ztd/text/detail/empty_state.hpp>
 #include <ztd/text/detail/range.hpp>
+#include <ztd/text/detail/reconstruct.hpp>
+#include <ztd/text/detail/memory.hpp>
+#include <ztd/text/detail/type_traits.hpp>
+#include <ztd/text/detail/skip_ascii.hpp>
 
 #include <array>
 
@@ -123,6 +129,35 @@ namespace ztd { namespace text {
 			return __txt_detail::__question_mark_replacement_units<code_unit>;
 		}
 
+		//////
+		/// @internal
+		///
+		/// @brief Extension point hooks for the implementation-side only.
+		///
+		/// @remarks Validates contiguous input by skipping over whole runs of 7-bit code units at a time. The failing
+		/// position is the same as the one given by decoding and re-encoding each code point in turn.
+		//////
+		template <typename _Input,
+			::std::enable_if_t<__txt_detail::__is_contiguous_byte_range_v<
+			     __txt_detail::__string_view_or_span_or_reconstruct_t<_Input>>>* = nullptr>
+		constexpr friend auto __text_validate_code_units(
+			tag<basic_ascii>, _Input&& __input, __txt_detail::__type_identity_t<const basic_ascii&>, state& __s) {
+			using _WorkingInput = __txt_detail::__string_view_or_span_or_reconstruct_t<_Input>;
+			using _Result       = validate_result<_WorkingInput, state>;
+
+			_WorkingInput __working_input(
+				__txt_detail::__reconstruct(::std::in_place_type<_WorkingInput>, ::std::forward<_Input>(__input)));
+			auto __first         = __txt_detail::__adl::__adl_begin(__working_input);
+			auto __last          = __txt_detail::__adl::__adl_end(__working_input);
+			const auto* __pfirst = __txt_detail::__adl::__adl_to_address(__first);
+			const auto* __plast  = __pfirst + (__last - __first);
+			const auto* __pfail  = __txt_detail::__skip_ascii(__pfirst, __plast);
+			__first += (__pfail - __pfirst);
+			return _Result(__txt_detail::__reconstruct(::std::in_place_type<_WorkingInput>, ::std::move(__first),
+				               ::std::move(__last)),
+				__pfail == __plast, __s);
+		}
+
 		//////
 		/// @brief Decodes a single complete unit of information as code points and produces a result with the
 		/// input and output ranges moved past what was successfully read and written; or, produces an error and
@@ -192,8 +227,9 @@ namespace ztd { namespace text {
 			__txt_detail::__dereference(__outit) = __unit;
 			__outit                          = __txt_detail::__next(__outit);
 
-			return _Result(::std::move(__init), ::std::move(__inlast), ::std::move(__outit), ::std::move(__outlast),
-				__s, encoding_error::ok);
+			return _Result(__txt_detail::__reconstruct(::std::in_place_type<_UInputRange>, __init, __inlast),
+				__txt_detail::__reconstruct(::std::in_place_type<_UOutputRange>, __outit, __outlast), __s,
+				encoding_error::ok);
 		}
 
 		//////
@@ -90,8 +90,14 @@ namespace ztd { namespace text {
 		//////
 		using error_handler_type = typename __base_t::error_handler_type;
 
+		using __base_t::__base_t;
+
 		using __base_t::code_points;
 
+		using __base_t::encoding;
+
+		using __base_t::error_handler;
+
 		using __base_t::base;
 	};
 
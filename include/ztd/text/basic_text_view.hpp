@@ -43,6 +43,7 @@
 #include <ztd/text/state.hpp>
 
 #include <string_view>
+#include <utility>
 
 namespace ztd { namespace text {
 	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
@@ -108,6 +109,54 @@ namespace ztd { namespace text {
 		error_handler_type _M_error_handler;
 
 	public:
+		//////
+		/// @brief Default constructs a ztd::text::basic_text_view.
+		///
+		/// @remarks The stored range, encoding, error handler, and state are default-constructed.
+		//////
+		constexpr basic_text_view() = default;
+
+		//////
+		/// @brief Constructs a ztd::text::basic_text_view over the given range.
+		///
+		/// @param[in] __range The range of code units to view.
+		///
+		/// @remarks The stored encoding and error handler are default-constructed. The state is created with
+		/// ztd::text::make_encode_state from the encoding.
+		//////
+		constexpr basic_text_view(range_type __range)
+		: basic_text_view(::std::move(__range), encoding_type {}, error_handler_type {}) {
+		}
+
+		//////
+		/// @brief Constructs a ztd::text::basic_text_view over the given range.
+		///
+		/// @param[in] __range The range of code units to view.
+		/// @param[in] __encoding The encoding the code units are in.
+		///
+		/// @remarks The state is created with ztd::text::make_encode_state from @p __encoding.
+		//////
+		constexpr basic_text_view(range_type __range, encoding_type __encoding)
+		: basic_text_view(::std::move(__range), ::std::move(__encoding), error_handler_type {}) {
+		}
+
+		//////
+		/// @brief Constructs a ztd::text::basic_text_view over the given range.
+		///
+		/// @param[in] __range The range of code units to view.
+		/// @param[in] __encoding The encoding the code units are in.
+		/// @param[in] __error_handler The default error handler for operations on this view.
+		///
+		/// @remarks The state is created with ztd::text::make_encode_state from @p __encoding.
+		//////
+		constexpr basic_text_view(range_type __range, encoding_type __encoding, error_handler_type __error_handler)
+		: _M_storage(::std::move(__range))
+		, _M_encoding(::std::move(__encoding))
+		, _M_state(make_encode_state(this->_M_encoding))
+		, _M_normalization()
+		, _M_error_handler(::std::move(__error_handler)) {
+		}
+
 		//////
 		/// @brief Returns a view over the code points of this type, decoding "on the fly"/"lazily".
 		///
@@ -147,6 +196,22 @@ namespace ztd { namespace text {
 				::std::forward<_ViewErrorHandler>(__error_handler), ::std::move(__state));
 		}
 
+		//////
+		/// @brief The encoding the viewed code units are in.
+		///
+		//////
+		constexpr const encoding_type& encoding() const noexcept {
+			return this->_M_encoding;
+		}
+
+		//////
+		/// @brief The default error handler for operations on this view.
+		///
+		//////
+		constexpr const error_handler_type& error_handler() const noexcept {
+			return this->_M_error_handler;
+		}
+
 		//////
 		/// @brief Access the storage as an r-value reference.
 		///
@@ -0,0 +1,387 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+#pragma once
+
+#ifndef ZTD_TEXT_BASIC_TRANSCODING_STREAMBUF_HPP
+#define ZTD_TEXT_BASIC_TRANSCODING_STREAMBUF_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/encoding_error.hpp>
+#include <ztd/text/error_handler.hpp>
+#include <ztd/text/streaming_transcoder.hpp>
+
+#include <ztd/text/detail/span.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <streambuf>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	//////
+	/// @brief A stream buffer that transcodes between the bytes of an underlying stream buffer and the characters of
+	/// a stream, in both the get and put directions. It serves the same purpose as the deprecated @c
+	/// std::wbuffer_convert , but works with any pair of encodings.
+	///
+	/// @tparam _ExternalEncoding The encoding of the bytes in the underlying stream buffer.
+	/// @tparam _InternalEncoding The encoding of the characters read from and written to this stream buffer.
+	/// @tparam _CharT The character type of this stream buffer.
+	/// @tparam _Traits The character traits type of this stream buffer.
+	/// @tparam _ErrorHandler The error handler for the decode and encode steps, in both directions.
+	///
+	/// @remarks Input is read from the underlying stream buffer, and output is written to it, a whole buffer at a
+	/// time, and transcoded in bulk (see ztd::text::streaming_transcoder), so sequences may be split across buffer
+	/// refills and the decode and encode states carry over from one buffer to the next. Characters written to this
+	/// stream buffer only reach the underlying one when the put area is full, on @c sync (e.g., @c std::flush ), or
+	/// on destruction; a sequence that is split across a @c sync is held back until the rest of it is written. An
+	/// error the error handler does not handle makes reads return end-of-file and writes fail, like a conversion
+	/// failure does for @c std::wbuffer_convert . Seeking is not supported.
+	//////
+	template <typename _ExternalEncoding, typename _InternalEncoding, typename _CharT = code_unit_t<_InternalEncoding>,
+		typename _Traits = ::std::char_traits<_CharT>, typename _ErrorHandler = default_handler>
+	class basic_transcoding_streambuf : public ::std::basic_streambuf<_CharT, _Traits> {
+	private:
+		using __base_t = ::std::basic_streambuf<_CharT, _Traits>;
+
+	public:
+		//////
+		/// @brief The character type of this stream buffer.
+		///
+		//////
+		using char_type = _CharT;
+		//////
+		/// @brief The character traits type of this stream buffer.
+		///
+		//////
+		using traits_type = _Traits;
+		//////
+		/// @brief The integer type used to represent a character or end-of-file.
+		///
+		//////
+		using int_type = typename traits_type::int_type;
+		//////
+		/// @brief The stream position type.
+		///
+		//////
+		using pos_type = typename traits_type::pos_type;
+		//////
+		/// @brief The stream offset type.
+		///
+		//////
+		using off_type = typename traits_type::off_type;
+		//////
+		/// @brief The type of the underlying stream buffer, which holds the encoded bytes.
+		///
+		//////
+		using byte_streambuf_type = ::std::basic_streambuf<char>;
+		//////
+		/// @brief The transcoder used to turn the bytes read from the underlying stream buffer into characters.
+		///
+		//////
+		using get_transcoder_type
+			= streaming_transcoder<_ExternalEncoding, _InternalEncoding, _ErrorHandler, _ErrorHandler>;
+		//////
+		/// @brief The transcoder used to turn the characters written to this stream buffer into bytes.
+		///
+		//////
+		using put_transcoder_type
+			= streaming_transcoder<_InternalEncoding, _ExternalEncoding, _ErrorHandler, _ErrorHandler>;
+
+		//////
+		/// @brief The default size, in code units, of each of the internal buffers.
+		///
+		//////
+		static constexpr ::std::size_t default_buffer_size = 8192;
+
+		//////
+		/// @brief Constructs a basic_transcoding_streambuf.
+		///
+		/// @param[in] __byte_streambuf The underlying stream buffer to read bytes from and write bytes to. May be @c
+		/// nullptr , in which case every read and write fails until one is set with @c rdbuf .
+		/// @param[in] __external_encoding The encoding of the bytes in the underlying stream buffer.
+		/// @param[in] __internal_encoding The encoding of the characters of this stream buffer.
+		/// @param[in] __error_handler The error handler for the decode and encode steps, in both directions.
+		/// @param[in] __buffer_size The size, in code units, of each of the internal buffers.
+		//////
+		basic_transcoding_streambuf(byte_streambuf_type* __byte_streambuf = nullptr,
+			_ExternalEncoding __external_encoding = _ExternalEncoding {},
+			_InternalEncoding __internal_encoding = _InternalEncoding {},
+			_ErrorHandler __error_handler = _ErrorHandler {}, ::std::size_t __buffer_size = default_buffer_size)
+		: __base_t()
+		, _M_byte_streambuf(__byte_streambuf)
+		, _M_get_transcoder(__external_encoding, __internal_encoding, __error_handler, __error_handler)
+		, _M_put_transcoder(
+			  ::std::move(__internal_encoding), ::std::move(__external_encoding), __error_handler, __error_handler)
+		, _M_get_bytes(_S_buffer_size(__buffer_size))
+		, _M_get_bytes_first(0)
+		, _M_get_bytes_last(0)
+		, _M_get_finished(false)
+		, _M_get_chars(_S_buffer_size(__buffer_size))
+		, _M_put_chars(_S_buffer_size(__buffer_size))
+		, _M_put_bytes(_S_buffer_size(__buffer_size)) {
+			this->setg(this->_M_get_chars.data(), this->_M_get_chars.data(), this->_M_get_chars.data());
+			this->_M_reset_put_area();
+		}
+
+		basic_transcoding_streambuf(const basic_transcoding_streambuf&) = delete;
+		basic_transcoding_streambuf& operator=(const basic_transcoding_streambuf&) = delete;
+
+		//////
+		/// @brief Writes out anything left in the put area, including a sequence that was split across a @c sync ,
+		/// which is given to the error handler as incomplete.
+		///
+		/// @remarks Like any destructor, this must not throw: with a throwing error handler, call @c pubsync first
+		/// and make sure the last sequence written is complete.
+		//////
+		~basic_transcoding_streambuf() override {
+			if (this->_M_byte_streambuf != nullptr) {
+				this->_M_write_put_area(true);
+			}
+		}
+
+		//////
+		/// @brief The underlying stream buffer.
+		///
+		//////
+		byte_streambuf_type* rdbuf() const noexcept {
+			return this->_M_byte_streambuf;
+		}
+
+		//////
+		/// @brief Replaces the underlying stream buffer.
+		///
+		/// @param[in] __byte_streambuf The new underlying stream buffer.
+		///
+		/// @returns The previous underlying stream buffer.
+		///
+		/// @remarks Neither direction is flushed or reset: do that first, if needed.
+		//////
+		byte_streambuf_type* rdbuf(byte_streambuf_type* __byte_streambuf) noexcept {
+			byte_streambuf_type* __previous = this->_M_byte_streambuf;
+			this->_M_byte_streambuf         = __byte_streambuf;
+			return __previous;
+		}
+
+		//////
+		/// @brief The transcoder (and its states) used for the get direction.
+		///
+		//////
+		get_transcoder_type& get_transcoder() noexcept {
+			return this->_M_get_transcoder;
+		}
+
+		//////
+		/// @brief The transcoder (and its states) used for the get direction.
+		///
+		//////
+		const get_transcoder_type& get_transcoder() const noexcept {
+			return this->_M_get_transcoder;
+		}
+
+		//////
+		/// @brief The transcoder (and its states) used for the put direction.
+		///
+		//////
+		put_transcoder_type& put_transcoder() noexcept {
+			return this->_M_put_transcoder;
+		}
+
+		//////
+		/// @brief The transcoder (and its states) used for the put direction.
+		///
+		//////
+		const put_transcoder_type& put_transcoder() const noexcept {
+			return this->_M_put_transcoder;
+		}
+
+	protected:
+		//////
+		/// @brief Refills the get area by reading a buffer of bytes from the underlying stream buffer and transcoding
+		/// all of it at once.
+		///
+		//////
+		int_type underflow() override {
+			if (this->gptr() != this->egptr()) {
+				return traits_type::to_int_type(*this->gptr());
+			}
+			if (this->_M_byte_streambuf == nullptr) {
+				return traits_type::eof();
+			}
+			char_type* __chars_first = this->_M_get_chars.data();
+			::ztd::text::span<char_type> __chars(__chars_first, this->_M_get_chars.size());
+			for (;;) {
+				if (this->_M_get_bytes_first == this->_M_get_bytes_last) {
+					if (this->_M_get_finished) {
+						return traits_type::eof();
+					}
+					::std::streamsize __read = this->_M_byte_streambuf->sgetn(
+						this->_M_get_bytes.data(), static_cast<::std::streamsize>(this->_M_get_bytes.size()));
+					if (__read <= 0) {
+						// end of the bytes: a sequence left hanging goes to the error handler as incomplete
+						auto __result = this->_M_get_transcoder.finish(__chars);
+						if (__result.error_code == encoding_error::ok) {
+							this->_M_get_finished = true;
+						}
+						::std::size_t __written = __chars.size() - static_cast<::std::size_t>(__result.output.size());
+						if (__written == 0) {
+							return traits_type::eof();
+						}
+						this->setg(__chars_first, __chars_first, __chars_first + __written);
+						return traits_type::to_int_type(*this->gptr());
+					}
+					this->_M_get_bytes_first = 0;
+					this->_M_get_bytes_last  = static_cast<::std::size_t>(__read);
+				}
+				const char* __bytes_first = this->_M_get_bytes.data() + this->_M_get_bytes_first;
+				auto __result             = this->_M_get_transcoder.transcode_into(
+                         ::ztd::text::span<const char>(
+                              __bytes_first, this->_M_get_bytes_last - this->_M_get_bytes_first),
+                         __chars);
+				this->_M_get_bytes_first
+					= this->_M_get_bytes_last - static_cast<::std::size_t>(__result.input.size());
+				::std::size_t __written = __chars.size() - static_cast<::std::size_t>(__result.output.size());
+				if (__written != 0) {
+					this->setg(__chars_first, __chars_first, __chars_first + __written);
+					return traits_type::to_int_type(*this->gptr());
+				}
+				if (__result.error_code != encoding_error::ok) {
+					// the error handler did not handle an error: stop reading here
+					return traits_type::eof();
+				}
+				// every byte read so far is part of an unfinished sequence: read some more
+			}
+		}
+
+		//////
+		/// @brief Transcodes the whole put area at once, writes the bytes to the underlying stream buffer, and then
+		/// puts @p __ch into the emptied put area.
+		///
+		//////
+		int_type overflow(int_type __ch = traits_type::eof()) override {
+			if (this->_M_byte_streambuf == nullptr || !this->_M_write_put_area(false)) {
+				return traits_type::eof();
+			}
+			if (traits_type::eq_int_type(__ch, traits_type::eof())) {
+				return traits_type::not_eof(__ch);
+			}
+			*this->pptr() = traits_type::to_char_type(__ch);
+			this->pbump(1);
+			return __ch;
+		}
+
+		//////
+		/// @brief Writes out the put area and synchronizes the underlying stream buffer.
+		///
+		//////
+		int sync() override {
+			if (this->_M_byte_streambuf == nullptr || !this->_M_write_put_area(false)) {
+				return -1;
+			}
+			return this->_M_byte_streambuf->pubsync();
+		}
+
+	private:
+		static ::std::size_t _S_buffer_size(::std::size_t __buffer_size) noexcept {
+			// every buffer must be able to hold at least one whole sequence
+			constexpr ::std::size_t __minimum_size = 32;
+			return __buffer_size < __minimum_size ? __minimum_size : __buffer_size;
+		}
+
+		void _M_reset_put_area() noexcept {
+			char_type* __first = this->_M_put_chars.data();
+			this->setp(__first, __first + this->_M_put_chars.size());
+		}
+
+		bool _M_write_bytes(::std::size_t __size) {
+			return this->_M_byte_streambuf->sputn(this->_M_put_bytes.data(), static_cast<::std::streamsize>(__size))
+				== static_cast<::std::streamsize>(__size);
+		}
+
+		bool _M_write_put_area(bool __finish) {
+			::ztd::text::span<char> __bytes(this->_M_put_bytes.data(), this->_M_put_bytes.size());
+			::ztd::text::span<const char_type> __chars(
+				this->pbase(), static_cast<::std::size_t>(this->pptr() - this->pbase()));
+			while (!__chars.empty()) {
+				auto __result = this->_M_put_transcoder.transcode_into(__chars, __bytes);
+				if (!this->_M_write_bytes(__bytes.size() - static_cast<::std::size_t>(__result.output.size()))) {
+					return false;
+				}
+				if (__result.error_code == encoding_error::ok) {
+					break;
+				}
+				if (__result.error_code != encoding_error::insufficient_output_space) {
+					// keep only what was not written, for the next try
+					char_type* __first = this->_M_put_chars.data();
+					::std::size_t __kept = static_cast<::std::size_t>(__result.input.size());
+					::std::copy(__result.input.data(), __result.input.data() + __kept, __first);
+					this->_M_reset_put_area();
+					this->pbump(static_cast<int>(__kept));
+					return false;
+				}
+				__chars = __result.input;
+			}
+			this->_M_reset_put_area();
+			while (__finish) {
+				auto __result = this->_M_put_transcoder.finish(__bytes);
+				if (!this->_M_write_bytes(__bytes.size() - static_cast<::std::size_t>(__result.output.size()))) {
+					return false;
+				}
+				if (__result.error_code == encoding_error::ok) {
+					break;
+				}
+				if (__result.error_code != encoding_error::insufficient_output_space) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		byte_streambuf_type* _M_byte_streambuf;
+		get_transcoder_type _M_get_transcoder;
+		put_transcoder_type _M_put_transcoder;
+		::std::vector<char> _M_get_bytes;
+		::std::size_t _M_get_bytes_first;
+		::std::size_t _M_get_bytes_last;
+		bool _M_get_finished;
+		::std::vector<char_type> _M_get_chars;
+		::std::vector<char_type> _M_put_chars;
+		::std::vector<char> _M_put_bytes;
+	};
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#endif // ZTD_TEXT_BASIC_TRANSCODING_STREAMBUF_HPP
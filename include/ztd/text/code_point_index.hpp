@@ -0,0 +1,352 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+#pragma once
+
+#ifndef ZTD_TEXT_CODE_POINT_INDEX_HPP
+#define ZTD_TEXT_CODE_POINT_INDEX_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/forward.hpp>
+#include <ztd/text/code_point.hpp>
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/encoding_error.hpp>
+#include <ztd/text/state.hpp>
+
+#include <ztd/text/detail/adl.hpp>
+#include <ztd/text/detail/assert.hpp>
+#include <ztd/text/detail/range.hpp>
+#include <ztd/text/detail/ebco.hpp>
+#include <ztd/text/detail/reconstruct.hpp>
+#include <ztd/text/detail/sample_code_points.hpp>
+#include <ztd/text/detail/span.hpp>
+#include <ztd/text/detail/transcode_one.hpp>
+#include <ztd/text/detail/type_traits.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+		//////
+		/// @brief A decoding step the index can restart from: where it starts in the code units, the index of the
+		/// first code point it produces, and the decode state before it.
+		//////
+		template <typename _State>
+		class __code_point_sample : private __ebco<_State> {
+		private:
+			using __base_state_t = __ebco<_State>;
+
+		public:
+			::std::size_t _M_offset;
+			::std::size_t _M_index;
+
+			constexpr __code_point_sample(::std::size_t __offset, ::std::size_t __index, const _State& __state)
+			: __base_state_t(__state), _M_offset(__offset), _M_index(__index) {
+			}
+
+			constexpr const _State& _M_state() const noexcept {
+				return this->__base_state_t::get_value();
+			}
+		};
+	} // namespace __txt_detail
+
+	//////
+	/// @brief A sampled index over the code points of a ztd::text::basic_text_view or ztd::text::basic_text, giving
+	/// quick access to the code point at a given index and to where it starts in the code units.
+	///
+	/// @tparam _Text The ztd::text::basic_text_view or ztd::text::basic_text type to index.
+	/// @tparam _SampleInterval The distance, in code points, between two recorded positions.
+	///
+	/// @remarks The index is built lazily, in a single pass, the first time it is asked anything. It records where
+	/// every @p _SampleInterval th code point starts, so a lookup decodes at most @p _SampleInterval code points from
+	/// the closest recorded position. Well-formed UTF-8 and UTF-16 stored contiguously are walked without decoding;
+	/// UTF-8 is validated in bulk and then counted 8 code units at a time. Everything else (and any ill-formed
+	/// sequence) is decoded one step at a time with the text's encoding and error handler, so the code points seen
+	/// through the index are the same as those seen through <tt>code_points()</tt>. The index refers to the text it
+	/// was made from: the text must outlive it, and the index must be told about any change to the code units with
+	/// ztd::text::code_point_index::invalidate or ztd::text::code_point_index::invalidate_from. The index is not
+	/// safe to use from multiple threads at once, even through @c const member functions.
+	//////
+	template <typename _Text, ::std::size_t _SampleInterval = 256>
+	class code_point_index {
+	public:
+		static_assert(_SampleInterval > 0, "the sample interval must be at least 1");
+
+		//////
+		/// @brief The text type being indexed.
+		///
+		//////
+		using text_type = _Text;
+		//////
+		/// @brief The encoding type the indexed code units are in.
+		///
+		//////
+		using encoding_type = typename text_type::encoding_type;
+		//////
+		/// @brief The code point type produced by the lookups.
+		///
+		//////
+		using code_point = code_point_t<encoding_type>;
+		//////
+		/// @brief The type used for code point indices and code unit offsets.
+		///
+		//////
+		using size_type = ::std::size_t;
+
+		//////
+		/// @brief The distance, in code points, between two recorded positions.
+		///
+		//////
+		inline static constexpr size_type sample_interval = _SampleInterval;
+
+	private:
+		using _URange       = __txt_detail::__remove_cvref_t<typename text_type::range_type>;
+		using _WorkingInput = __txt_detail::__reconstruct_t<_URange, __txt_detail::__range_iterator_t<const _URange>,
+			__txt_detail::__range_sentinel_t<const _URange>>;
+		using _State        = decode_state_t<encoding_type>;
+		using _Sample       = __txt_detail::__code_point_sample<_State>;
+
+		inline static constexpr bool _S_is_utf8_walkable
+			= __txt_detail::__is_specialization_of_v<encoding_type, basic_utf8>
+			&& __txt_detail::__is_contiguous_code_unit_range_v<_WorkingInput, sizeof(code_unit_t<encoding_type>)>;
+		inline static constexpr bool _S_is_utf16_walkable
+			= __txt_detail::__is_specialization_of_v<encoding_type, basic_utf16>
+			&& __txt_detail::__is_contiguous_code_unit_range_v<_WorkingInput, sizeof(code_unit_t<encoding_type>)>;
+
+		struct _Step {
+			size_type _M_units;
+			size_type _M_code_points;
+		};
+
+		const text_type* _M_text;
+		mutable ::std::vector<_Sample> _M_samples;
+		mutable size_type _M_size;
+		mutable size_type _M_units;
+		mutable bool _M_complete;
+
+	public:
+		//////
+		/// @brief Constructs an index over the given text. Nothing is computed until the index is first used.
+		///
+		/// @param[in] __text The text to index. It must outlive this index.
+		//////
+		constexpr code_point_index(const text_type& __text) noexcept
+		: _M_text(::std::addressof(__text)), _M_samples(), _M_size(0), _M_units(0), _M_complete(false) {
+		}
+
+		//////
+		/// @brief The text this index refers to.
+		///
+		//////
+		constexpr const text_type& text() const noexcept {
+			return *this->_M_text;
+		}
+
+		//////
+		/// @brief The number of code points in the text.
+		///
+		//////
+		size_type size() const {
+			this->_M_build();
+			return this->_M_size;
+		}
+
+		//////
+		/// @brief Returns the code point at the given index.
+		///
+		/// @param[in] __code_point_index The index of the code point. Must be less than size().
+		//////
+		code_point code_point_at(size_type __code_point_index) const {
+			this->_M_build();
+			ZTD_TEXT_ASSERT_MESSAGE_I_(
+				"the code point index must be less than the size of the text", __code_point_index < this->_M_size);
+			code_point __code_point {};
+			this->_M_find(__code_point_index, &__code_point);
+			return __code_point;
+		}
+
+		//////
+		/// @brief Returns the offset, in code units, at which the code point at the given index starts.
+		///
+		/// @param[in] __code_point_index The index of the code point. Must be at most size(); size() gives the number
+		/// of code units decoded in total.
+		///
+		/// @remarks If the code point is one of several produced by a single decoding step, this is where that step
+		/// starts.
+		//////
+		size_type offset_of(size_type __code_point_index) const {
+			this->_M_build();
+			ZTD_TEXT_ASSERT_MESSAGE_I_("the code point index must be at most the size of the text",
+				__code_point_index <= this->_M_size);
+			if (__code_point_index == this->_M_size) {
+				return this->_M_units;
+			}
+			return this->_M_find(__code_point_index, nullptr);
+		}
+
+		//////
+		/// @brief Throws away everything recorded, so that the next use rebuilds the index from the beginning.
+		///
+		//////
+		void invalidate() noexcept {
+			this->_M_samples.clear();
+			this->_M_complete = false;
+		}
+
+		//////
+		/// @brief Throws away everything recorded at or after the given code unit offset, so that the next use
+		/// resumes building the index from the closest position still known to be good.
+		///
+		/// @param[in] __code_unit_offset The offset of the first code unit that was changed, inserted, or removed.
+		///
+		/// @remarks Decoding a code point never looks at code units past the first one following it, so positions
+		/// before the first changed code unit stay valid.
+		//////
+		void invalidate_from(size_type __code_unit_offset) noexcept {
+			while (!this->_M_samples.empty() && this->_M_samples.back()._M_offset >= __code_unit_offset) {
+				this->_M_samples.pop_back();
+			}
+			this->_M_complete = false;
+		}
+
+	private:
+		_WorkingInput _M_input() const {
+			return __txt_detail::__reconstruct(::std::in_place_type<_WorkingInput>, this->_M_text->base());
+		}
+
+		template <typename _Iterator, typename _Sentinel, typename _ErrorHandler>
+		_Step _M_step(_Iterator __first, _Sentinel __last, _ErrorHandler& __error_handler, _State& __state,
+			code_point* __code_points) const {
+			constexpr ::std::size_t __output_size = max_code_points_v<encoding_type>;
+			span<code_point, __output_size> __output(__code_points, __output_size);
+			auto __result = __txt_detail::__basic_decode_one<__txt_detail::__consume::__no>(
+				__txt_detail::__reconstruct(::std::in_place_type<_WorkingInput>, __first, ::std::move(__last)),
+				this->_M_text->encoding(), __output, __error_handler, __state);
+			const auto __units    = ::std::distance(__first, __txt_detail::__adl::__adl_begin(__result.input));
+			const auto __produced = __txt_detail::__adl::__adl_begin(__result.output) - __output.begin();
+			return _Step { static_cast<size_type>(__units), static_cast<size_type>(__produced) };
+		}
+
+		void _M_build() const {
+			if (this->_M_complete) {
+				return;
+			}
+			_WorkingInput __input = this->_M_input();
+			auto __first          = __txt_detail::__adl::__adl_begin(__input);
+			auto __last           = __txt_detail::__adl::__adl_end(__input);
+			size_type __offset    = 0;
+			size_type __index     = 0;
+			_State __state        = make_decode_state(this->_M_text->encoding());
+			if (!this->_M_samples.empty()) {
+				const _Sample& __resume = this->_M_samples.back();
+				__offset                = __resume._M_offset;
+				__index                 = __resume._M_index;
+				__state                 = __resume._M_state();
+				this->_M_samples.pop_back();
+			}
+			auto __error_handler = this->_M_text->error_handler();
+			auto __it            = ::std::next(__first, static_cast<::std::ptrdiff_t>(__offset));
+			code_point __code_points[max_code_points_v<encoding_type>] {};
+			for (;;) {
+				if constexpr (_S_is_utf8_walkable || _S_is_utf16_walkable) {
+					const auto* __pfirst = __txt_detail::__adl::__adl_to_address(__first);
+					const auto* __pin    = __pfirst + __offset;
+					auto __sink          = [&](const auto* __at, size_type __at_index) {
+						const size_type __at_offset = static_cast<size_type>(__at - __pfirst);
+						this->_M_samples.emplace_back(__at_offset, __at_index, __state);
+					};
+					if constexpr (_S_is_utf8_walkable) {
+						__index += __txt_detail::__utf8_sample_code_points(
+							__pin, __pfirst + (__last - __first), __index, _SampleInterval, __sink);
+					}
+					else {
+						__index += __txt_detail::__utf16_sample_code_points(
+							__pin, __pfirst + (__last - __first), __index, _SampleInterval, __sink);
+					}
+					__it += (__pin - __pfirst) - static_cast<::std::ptrdiff_t>(__offset);
+					__offset = static_cast<size_type>(__pin - __pfirst);
+				}
+				if (__it == __last) {
+					break;
+				}
+				const _State __step_state = __state;
+				_Step __step              = this->_M_step(__it, __last, __error_handler, __state, __code_points);
+				if (__step._M_units == 0 && __step._M_code_points == 0) {
+					// no progress can be made: treat whatever is left as not being part of the text
+					break;
+				}
+				for (size_type __next = this->_M_samples.size() * _SampleInterval;
+					__next < __index + __step._M_code_points; __next += _SampleInterval) {
+					this->_M_samples.emplace_back(__offset, __index, __step_state);
+				}
+				::std::advance(__it, static_cast<::std::ptrdiff_t>(__step._M_units));
+				__offset += __step._M_units;
+				__index += __step._M_code_points;
+			}
+			this->_M_size     = __index;
+			this->_M_units    = __offset;
+			this->_M_complete = true;
+		}
+
+		size_type _M_find(size_type __code_point_index, code_point* __output) const {
+			const _Sample& __sample = this->_M_samples[__code_point_index / _SampleInterval];
+			_WorkingInput __input   = this->_M_input();
+			auto __first            = __txt_detail::__adl::__adl_begin(__input);
+			auto __last             = __txt_detail::__adl::__adl_end(__input);
+			size_type __offset      = __sample._M_offset;
+			auto __it               = ::std::next(__first, static_cast<::std::ptrdiff_t>(__offset));
+			size_type __index       = __sample._M_index;
+			_State __state          = __sample._M_state();
+			auto __error_handler    = this->_M_text->error_handler();
+			code_point __code_points[max_code_points_v<encoding_type>] {};
+			for (;;) {
+				_Step __step = this->_M_step(__it, __last, __error_handler, __state, __code_points);
+				if (__code_point_index < __index + __step._M_code_points) {
+					if (__output != nullptr) {
+						*__output = __code_points[__code_point_index - __index];
+					}
+					return __offset;
+				}
+				::std::advance(__it, static_cast<::std::ptrdiff_t>(__step._M_units));
+				__offset += __step._M_units;
+				__index += __step._M_code_points;
+			}
+		}
+	};
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#endif // ZTD_TEXT_CODE_POINT_INDEX_HPP
@@ -0,0 +1,151 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_BITWISE_TRANSCODE_HPP
+#define ZTD_TEXT_DETAIL_BITWISE_TRANSCODE_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/state.hpp>
+#include <ztd/text/is_transcoding_compatible.hpp>
+#include <ztd/text/validate_code_units.hpp>
+
+#include <ztd/text/detail/bulk_transcode.hpp>
+#include <ztd/text/detail/encoding_range.hpp>
+#include <ztd/text/detail/reconstruct.hpp>
+#include <ztd/text/detail/range.hpp>
+#include <ztd/text/detail/adl.hpp>
+#include <ztd/text/detail/span.hpp>
+#include <ztd/text/detail/type_traits.hpp>
+
+#include <cstddef>
+#include <cstring>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		template <typename _Input, typename _Encoding, typename _State>
+		inline constexpr bool __is_bulk_validatable_v
+			= __is_detected_v<__detect_adl_text_validate_code_units, _Input, _Encoding, _State>
+			|| __is_detected_v<__detect_adl_internal_text_validate_code_units, _Input, _Encoding, _State>;
+
+		//////
+		/// @brief Whether transcoding from @p _Input to @p _Output can be done by validating the input and then
+		/// copying the code units over as-is.
+		///
+		/// @remarks This requires the two encodings to be bitwise compatible (which includes being the same
+		/// encoding), both ranges to be contiguous with code units of the same size, both states to be empty, and the
+		/// from encoding to have a bulk validation extension point. Without the latter, validation is a decode and
+		/// re-encode of every code point, which is no faster than transcoding.
+		//////
+		template <typename _Input, typename _FromEncoding, typename _Output, typename _ToEncoding,
+			typename _FromState, typename _ToState>
+		inline constexpr bool __is_bitwise_transcodable_v
+			= __is_bitwise_transcoding_compatible_v<__remove_cvref_t<_FromEncoding>, __remove_cvref_t<_ToEncoding>>
+			&& (sizeof(code_unit_t<__remove_cvref_t<_FromEncoding>>)
+			     == sizeof(code_unit_t<__remove_cvref_t<_ToEncoding>>))
+			&& __is_bulk_transcodable_v<_Input, sizeof(code_unit_t<__remove_cvref_t<_FromEncoding>>), _Output,
+			     sizeof(code_unit_t<__remove_cvref_t<_ToEncoding>>)>
+			&& ::std::is_empty_v<__remove_cvref_t<_FromState>> && ::std::is_empty_v<__remove_cvref_t<_ToState>>
+			&& __is_bulk_validatable_v<
+			     ::ztd::text::span<const __range_value_type_t<__string_view_or_span_or_reconstruct_t<_Input>>>,
+			     const __remove_cvref_t<_FromEncoding>&, decode_state_t<__remove_cvref_t<_FromEncoding>>>;
+
+		//////
+		/// @brief Copies the code units in [ @p __first, @p __last ) to @p __out , with @c std::memmove when not in a
+		/// constant expression.
+		///
+		/// @remarks The input and output may be the same buffer when sanitizing text in-place.
+		//////
+		template <typename _InCodeUnit, typename _OutCodeUnit>
+		constexpr _OutCodeUnit* __bitwise_copy(
+			const _InCodeUnit* __first, const _InCodeUnit* __last, _OutCodeUnit* __out) noexcept {
+			static_assert(sizeof(_InCodeUnit) == sizeof(_OutCodeUnit),
+				"the input and output code units must be the same size to be copied bit for bit");
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_STD_LIBRARY_IS_CONSTANT_EVALUATED_I_)
+			if (!::std::is_constant_evaluated()) {
+				const ::std::size_t __size = static_cast<::std::size_t>(__last - __first);
+				if (__size != 0) {
+					::std::memmove(__out, __first, __size * sizeof(_InCodeUnit));
+				}
+				return __out + __size;
+			}
+#endif
+			for (; __first != __last; ++__first, ++__out) {
+				*__out = static_cast<_OutCodeUnit>(*__first);
+			}
+			return __out;
+		}
+
+		//////
+		/// @brief Transcodes between two bitwise compatible encodings by running the from encoding's bulk validation
+		/// over as much input as fits in the output, and copying the valid prefix over in one go.
+		///
+		/// @remarks Anything that stops validation (an invalid or incomplete sequence, or a sequence cut in half by
+		/// the end of the output space) goes through one step of the normal decode-then-encode loop, so the result
+		/// and what error handlers see are identical to those of ztd::text::basic_transcode_into.
+		//////
+		template <typename _Input, typename _FromEncoding, typename _Output, typename _ToEncoding,
+			typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState, typename _ToState>
+		constexpr auto __bitwise_transcode_into(_Input&& __input, _FromEncoding& __from_encoding, _Output&& __output,
+			_ToEncoding& __to_encoding, _FromErrorHandler& __from_error_handler, _ToErrorHandler& __to_error_handler,
+			_FromState& __from_state, _ToState& __to_state) {
+			using _UFromEncoding = __remove_cvref_t<_FromEncoding>;
+			const _UFromEncoding& __validating_encoding = __from_encoding;
+			auto __kernel = [&__validating_encoding](const auto*& __in, const auto* __in_last, auto*& __out,
+				                auto* __out_last) {
+				using _InCodeUnit          = __remove_cvref_t<decltype(*__in)>;
+				const ::std::size_t __size = static_cast<::std::size_t>(
+					(__in_last - __in) < (__out_last - __out) ? (__in_last - __in) : (__out_last - __out));
+				decode_state_t<_UFromEncoding> __decode_state = make_decode_state(__validating_encoding);
+				encode_state_t<_UFromEncoding> __encode_state = make_encode_state(__validating_encoding);
+				auto __result = validate_code_units(::ztd::text::span<const _InCodeUnit>(__in, __size),
+					__validating_encoding, __decode_state, __encode_state);
+				const ::std::size_t __invalid_size = static_cast<::std::size_t>(__adl::__adl_size(__result.input));
+				const auto* __valid_last           = __in + (__size - __invalid_size);
+				__out                              = __bitwise_copy(__in, __valid_last, __out);
+				__in                               = __valid_last;
+			};
+			return __bulk_transcode_into(__kernel, ::std::forward<_Input>(__input), __from_encoding,
+				::std::forward<_Output>(__output), __to_encoding, __from_error_handler, __to_error_handler,
+				__from_state, __to_state);
+		}
+
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#endif // ZTD_TEXT_DETAIL_BITWISE_TRANSCODE_HPP
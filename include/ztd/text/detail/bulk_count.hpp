@@ -0,0 +1,197 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_BULK_COUNT_HPP
+#define ZTD_TEXT_DETAIL_BULK_COUNT_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/code_point.hpp>
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/count_result.hpp>
+#include <ztd/text/encoding_error.hpp>
+
+#include <ztd/text/detail/transcode_one.hpp>
+#include <ztd/text/detail/encoding_range.hpp>
+#include <ztd/text/detail/reconstruct.hpp>
+#include <ztd/text/detail/adl.hpp>
+#include <ztd/text/detail/type_traits.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		template <typename _Input, ::std::size_t _InputUnitSize>
+		inline constexpr bool __is_bulk_countable_v
+			= __is_contiguous_code_unit_range_v<__string_view_or_span_or_reconstruct_t<_Input>, _InputUnitSize>;
+
+		//////
+		/// @brief Counts over contiguous input by alternating between a pointer-based bulk counting kernel and a
+		/// single step of the normal counting loop.
+		///
+		/// @param[in] __kernel A function object taking <tt>(const _InUnit*& in, const _InUnit* in_last)</tt> and
+		/// returning the count for everything it moved @c in past. It must stop at the first sequence it cannot
+		/// handle.
+		/// @param[in] __step A function object taking the rest of the input and performing one step of the normal
+		/// counting loop, returning a ztd::text::count_result.
+		///
+		/// @remarks The result is identical to that of the normal counting loop.
+		//////
+		template <typename _Kernel, typename _Step, typename _Input, typename _State>
+		constexpr auto __bulk_count(_Kernel&& __kernel, _Step&& __step, _Input&& __input, _State& __state) {
+			using _WorkingInput = __string_view_or_span_or_reconstruct_t<_Input>;
+			using _Result       = count_result<_WorkingInput, _State>;
+
+			_WorkingInput __working_input(
+				__reconstruct(::std::in_place_type<_WorkingInput>, ::std::forward<_Input>(__input)));
+
+			::std::size_t __count = 0;
+			for (;;) {
+				auto __in_first         = __adl::__adl_begin(__working_input);
+				auto __in_last          = __adl::__adl_end(__working_input);
+				const auto* __pin_first = __adl::__adl_to_address(__in_first);
+				const auto* __pin       = __pin_first;
+				__count += __kernel(__pin, __pin_first + (__in_last - __in_first));
+				__in_first += (__pin - __pin_first);
+				__working_input = __reconstruct(
+					::std::in_place_type<_WorkingInput>, ::std::move(__in_first), ::std::move(__in_last));
+				if (__adl::__adl_empty(__working_input)) {
+					break;
+				}
+				auto __result = __step(::std::move(__working_input));
+				if (__result.error_code != encoding_error::ok) {
+					return _Result(::std::move(__result.input), __count, __state, __result.error_code, false);
+				}
+				__count += __result.count;
+				__working_input = ::std::move(__result.input);
+				if (__adl::__adl_empty(__working_input)) {
+					break;
+				}
+			}
+			return _Result(::std::move(__working_input), __count, __state, encoding_error::ok, false);
+		}
+
+		//////
+		/// @brief Counts the code points that decoding contiguous input produces, with the same result as
+		/// ztd::text::basic_count_code_units .
+		//////
+		template <typename _Kernel, typename _Input, typename _Encoding, typename _ErrorHandler, typename _State>
+		constexpr auto __bulk_count_code_units(_Kernel&& __kernel, _Input&& __input, _Encoding& __encoding,
+			_ErrorHandler& __error_handler, _State& __state) {
+			using _WorkingInput = __string_view_or_span_or_reconstruct_t<_Input>;
+			using _CodePoint    = code_point_t<__remove_cvref_t<_Encoding>>;
+
+			_CodePoint __code_point_buf[max_code_points_v<__remove_cvref_t<_Encoding>>] {};
+			return __bulk_count(
+				::std::forward<_Kernel>(__kernel),
+				[&](_WorkingInput&& __working_input) {
+					if constexpr (__is_detected_v<__detect_object_count_code_units_one, _Encoding&, _WorkingInput,
+						              _ErrorHandler&, _State>) {
+						return __encoding.count_code_units_one(
+							::std::move(__working_input), __error_handler, __state);
+					}
+					else {
+						return __basic_count_code_units_one(::std::move(__working_input), __encoding,
+							__code_point_buf, __error_handler, __state);
+					}
+				},
+				::std::forward<_Input>(__input), __state);
+		}
+
+		//////
+		/// @brief Counts the code units that encoding contiguous input produces, with the same result as
+		/// ztd::text::basic_count_code_points .
+		//////
+		template <typename _Kernel, typename _Input, typename _Encoding, typename _ErrorHandler, typename _State>
+		constexpr auto __bulk_count_code_points(_Kernel&& __kernel, _Input&& __input, _Encoding& __encoding,
+			_ErrorHandler& __error_handler, _State& __state) {
+			using _WorkingInput = __string_view_or_span_or_reconstruct_t<_Input>;
+			using _CodeUnit     = code_unit_t<__remove_cvref_t<_Encoding>>;
+
+			_CodeUnit __code_unit_buf[max_code_units_v<__remove_cvref_t<_Encoding>>] {};
+			return __bulk_count(
+				::std::forward<_Kernel>(__kernel),
+				[&](_WorkingInput&& __working_input) {
+					if constexpr (__is_detected_v<__detect_object_count_code_points_one, _Encoding&, _WorkingInput,
+						              _ErrorHandler&, _State>) {
+						return __encoding.count_code_points_one(
+							::std::move(__working_input), __error_handler, __state);
+					}
+					else {
+						return __basic_count_code_points_one(::std::move(__working_input), __encoding,
+							__code_unit_buf, __error_handler, __state);
+					}
+				},
+				::std::forward<_Input>(__input), __state);
+		}
+
+		//////
+		/// @brief Counts over the leading valid part of contiguous input with a pointer-based bulk counting kernel,
+		/// without ever calling an error handler.
+		///
+		/// @param[in] __kernel A function object with the same requirements as for
+		/// ztd::text::__txt_detail::__bulk_count.
+		///
+		/// @returns A ztd::text::stateless_count_result whose @c input is what the kernel stopped at. If that is not
+		/// empty, the error code is ztd::text::encoding_error::invalid_sequence and the count only covers what came
+		/// before it.
+		//////
+		template <typename _Kernel, typename _Input>
+		constexpr auto __bulk_count_prefix(_Kernel&& __kernel, _Input&& __input) {
+			using _WorkingInput = __string_view_or_span_or_reconstruct_t<_Input>;
+			using _Result       = stateless_count_result<_WorkingInput>;
+
+			_WorkingInput __working_input(
+				__reconstruct(::std::in_place_type<_WorkingInput>, ::std::forward<_Input>(__input)));
+			auto __in_first             = __adl::__adl_begin(__working_input);
+			auto __in_last              = __adl::__adl_end(__working_input);
+			const auto* __pin_first     = __adl::__adl_to_address(__in_first);
+			const auto* __pin           = __pin_first;
+			const ::std::size_t __count = __kernel(__pin, __pin_first + (__in_last - __in_first));
+			__in_first += (__pin - __pin_first);
+			const encoding_error __error_code
+				= __in_first == __in_last ? encoding_error::ok : encoding_error::invalid_sequence;
+			return _Result(
+				__reconstruct(::std::in_place_type<_WorkingInput>, ::std::move(__in_first), ::std::move(__in_last)),
+				__count, __error_code, 0);
+		}
+
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#endif // ZTD_TEXT_DETAIL_BULK_COUNT_HPP
@@ -0,0 +1,261 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_BULK_TRANSCODE_HPP
+#define ZTD_TEXT_DETAIL_BULK_TRANSCODE_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/code_point.hpp>
+#include <ztd/text/transcode_result.hpp>
+#include <ztd/text/error_handler.hpp>
+
+#include <ztd/text/detail/transcode_one.hpp>
+#include <ztd/text/detail/reconstruct.hpp>
+#include <ztd/text/detail/memory.hpp>
+#include <ztd/text/detail/adl.hpp>
+#include <ztd/text/detail/type_traits.hpp>
+
+#include <utility>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		template <typename _Input, ::std::size_t _InputUnitSize, typename _Output, ::std::size_t _OutputUnitSize>
+		inline constexpr bool __is_bulk_transcodable_v
+			= __is_contiguous_code_unit_range_v<__string_view_or_span_or_reconstruct_t<_Input>, _InputUnitSize>
+			&& __is_contiguous_writable_code_unit_range_v<__reconstruct_t<__remove_cvref_t<_Output>>,
+			     _OutputUnitSize>;
+
+		//////
+		/// @brief Transcodes contiguous input into contiguous output by alternating between a pointer-based bulk
+		/// kernel and a single step of the normal decode-then-encode loop.
+		///
+		/// @param[in] __kernel A function object taking <tt>(const _InUnit*& in, const _InUnit* in_last, _OutUnit*&
+		/// out, _OutUnit* out_last)</tt>. It must only convert what is valid and fits, leaving both pointers at the
+		/// first sequence it did not handle.
+		///
+		/// @remarks Everything the kernel stops on (errors, incomplete input, not enough output space) is given to
+		/// ztd::text::__txt_detail::__basic_transcode_one, so error handlers see the exact same sequences, in the
+		/// same order, as they would in ztd::text::basic_transcode_into. The result is identical as well.
+		//////
+		template <typename _Kernel, typename _Input, typename _FromEncoding, typename _Output, typename _ToEncoding,
+			typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState, typename _ToState>
+		constexpr auto __bulk_transcode_into(_Kernel&& __kernel, _Input&& __input, _FromEncoding& __from_encoding,
+			_Output&& __output, _ToEncoding& __to_encoding, _FromErrorHandler& __from_error_handler,
+			_ToErrorHandler& __to_error_handler, _FromState& __from_state, _ToState& __to_state) {
+			using _WorkingInput          = __string_view_or_span_or_reconstruct_t<_Input>;
+			using _WorkingOutput         = __reconstruct_t<__remove_cvref_t<_Output>>;
+			using _UFromEncoding         = __remove_cvref_t<_FromEncoding>;
+			using _IntermediateCodePoint = code_point_t<_UFromEncoding>;
+			using _Result = __reconstruct_transcode_result_t<_WorkingInput, _WorkingOutput, _FromState, _ToState>;
+
+			_WorkingInput __working_input(
+				__reconstruct(::std::in_place_type<_WorkingInput>, ::std::forward<_Input>(__input)));
+			_WorkingOutput __working_output(
+				__reconstruct(::std::in_place_type<_WorkingOutput>, ::std::forward<_Output>(__output)));
+
+			_IntermediateCodePoint __intermediate[max_code_points_v<_UFromEncoding>];
+			::std::size_t __handled_errors = 0;
+			for (;;) {
+				auto __in_first            = __adl::__adl_begin(__working_input);
+				auto __in_last             = __adl::__adl_end(__working_input);
+				auto __out_first           = __adl::__adl_begin(__working_output);
+				auto __out_last            = __adl::__adl_end(__working_output);
+				const auto* __pin_first    = __adl::__adl_to_address(__in_first);
+				const auto* __pin          = __pin_first;
+				auto* __pout_first         = __adl::__adl_to_address(__out_first);
+				auto* __pout               = __pout_first;
+				__kernel(__pin, __pin_first + (__in_last - __in_first), __pout,
+					__pout_first + (__out_last - __out_first));
+				__in_first += (__pin - __pin_first);
+				__out_first += (__pout - __pout_first);
+				__working_input  = __reconstruct(
+					::std::in_place_type<_WorkingInput>, ::std::move(__in_first), ::std::move(__in_last));
+				__working_output = __reconstruct(
+					::std::in_place_type<_WorkingOutput>, ::std::move(__out_first), ::std::move(__out_last));
+				if (__adl::__adl_empty(__working_input)) {
+					break;
+				}
+				auto __transcode_result = __basic_transcode_one<__consume::__no>(::std::move(__working_input),
+					__from_encoding, __intermediate, ::std::move(__working_output), __to_encoding,
+					__from_error_handler, __to_error_handler, __from_state, __to_state);
+				if (__transcode_result.error_code != encoding_error::ok) {
+					return _Result(::std::move(__working_input), ::std::move(__working_output), __from_state,
+						__to_state, __transcode_result.error_code, __transcode_result.handled_errors);
+				}
+				__handled_errors += __transcode_result.handled_errors;
+				__working_input  = ::std::move(__transcode_result.input);
+				__working_output = ::std::move(__transcode_result.output);
+				if (__adl::__adl_empty(__working_input)) {
+					break;
+				}
+			}
+			return _Result(::std::move(__working_input), ::std::move(__working_output), __from_state, __to_state,
+				encoding_error::ok, __handled_errors);
+		}
+
+		//////
+		/// @brief Decodes contiguous input into contiguous output by alternating between a pointer-based bulk
+		/// kernel and a single call to the encoding's @c decode_one .
+		///
+		/// @param[in] __kernel A function object with the same requirements as for
+		/// ztd::text::__txt_detail::__bulk_transcode_into, writing code points.
+		///
+		/// @remarks The result (including what error handlers see) is identical to that of
+		/// ztd::text::basic_decode_into.
+		//////
+		template <typename _Kernel, typename _Input, typename _Encoding, typename _Output, typename _ErrorHandler,
+			typename _State>
+		constexpr auto __bulk_decode_into(_Kernel&& __kernel, _Input&& __input, _Encoding& __encoding,
+			_Output&& __output, _ErrorHandler& __error_handler, _State& __state) {
+			using _IntermediateInput  = __string_view_or_span_or_reconstruct_t<_Input>;
+			using _IntermediateOutput = __reconstruct_t<__remove_cvref_t<_Output>>;
+			using _Result             = decltype(__encoding.decode_one(::std::declval<_IntermediateInput>(),
+                    ::std::declval<_IntermediateOutput>(), __error_handler, __state));
+			using _WorkingInput       = __remove_cvref_t<decltype(::std::declval<_Result>().input)>;
+			using _WorkingOutput      = __remove_cvref_t<decltype(::std::declval<_Result>().output)>;
+
+			_WorkingInput __working_input(
+				__reconstruct(::std::in_place_type<_WorkingInput>, ::std::forward<_Input>(__input)));
+			_WorkingOutput __working_output(
+				__reconstruct(::std::in_place_type<_WorkingOutput>, ::std::forward<_Output>(__output)));
+
+			::std::size_t __handled_errors = 0;
+			for (;;) {
+				auto __in_first         = __adl::__adl_begin(__working_input);
+				auto __in_last          = __adl::__adl_end(__working_input);
+				auto __out_first        = __adl::__adl_begin(__working_output);
+				auto __out_last         = __adl::__adl_end(__working_output);
+				const auto* __pin_first = __adl::__adl_to_address(__in_first);
+				const auto* __pin       = __pin_first;
+				auto* __pout_first      = __adl::__adl_to_address(__out_first);
+				auto* __pout            = __pout_first;
+				__kernel(__pin, __pin_first + (__in_last - __in_first), __pout,
+					__pout_first + (__out_last - __out_first));
+				__in_first += (__pin - __pin_first);
+				__out_first += (__pout - __pout_first);
+				__working_input  = __reconstruct(
+					::std::in_place_type<_WorkingInput>, ::std::move(__in_first), ::std::move(__in_last));
+				__working_output = __reconstruct(
+					::std::in_place_type<_WorkingOutput>, ::std::move(__out_first), ::std::move(__out_last));
+				if (__adl::__adl_empty(__working_input)) {
+					break;
+				}
+				auto __result = __encoding.decode_one(
+					::std::move(__working_input), ::std::move(__working_output), __error_handler, __state);
+				if (__result.error_code != encoding_error::ok) {
+					return __result;
+				}
+				__handled_errors += __result.handled_errors;
+				__working_input  = ::std::move(__result.input);
+				__working_output = ::std::move(__result.output);
+				if (__adl::__adl_empty(__working_input)) {
+					break;
+				}
+			}
+			return _Result(::std::move(__working_input), ::std::move(__working_output), __state, encoding_error::ok,
+				__handled_errors);
+		}
+
+		//////
+		/// @brief Encodes contiguous input into contiguous output by alternating between a pointer-based bulk
+		/// kernel and a single call to the encoding's @c encode_one .
+		///
+		/// @param[in] __kernel A function object with the same requirements as for
+		/// ztd::text::__txt_detail::__bulk_transcode_into, reading code points.
+		///
+		/// @remarks The result (including what error handlers see) is identical to that of
+		/// ztd::text::basic_encode_into.
+		//////
+		template <typename _Kernel, typename _Input, typename _Encoding, typename _Output, typename _ErrorHandler,
+			typename _State>
+		constexpr auto __bulk_encode_into(_Kernel&& __kernel, _Input&& __input, _Encoding& __encoding,
+			_Output&& __output, _ErrorHandler& __error_handler, _State& __state) {
+			using _IntermediateInput  = __string_view_or_span_or_reconstruct_t<_Input>;
+			using _IntermediateOutput = __reconstruct_t<__remove_cvref_t<_Output>>;
+			using _Result             = decltype(__encoding.encode_one(::std::declval<_IntermediateInput>(),
+                    ::std::declval<_IntermediateOutput>(), __error_handler, __state));
+			using _WorkingInput       = __remove_cvref_t<decltype(::std::declval<_Result>().input)>;
+			using _WorkingOutput      = __remove_cvref_t<decltype(::std::declval<_Result>().output)>;
+
+			_WorkingInput __working_input(
+				__reconstruct(::std::in_place_type<_WorkingInput>, ::std::forward<_Input>(__input)));
+			_WorkingOutput __working_output(
+				__reconstruct(::std::in_place_type<_WorkingOutput>, ::std::forward<_Output>(__output)));
+
+			::std::size_t __handled_errors = 0;
+			for (;;) {
+				auto __in_first         = __adl::__adl_begin(__working_input);
+				auto __in_last          = __adl::__adl_end(__working_input);
+				auto __out_first        = __adl::__adl_begin(__working_output);
+				auto __out_last         = __adl::__adl_end(__working_output);
+				const auto* __pin_first = __adl::__adl_to_address(__in_first);
+				const auto* __pin       = __pin_first;
+				auto* __pout_first      = __adl::__adl_to_address(__out_first);
+				auto* __pout            = __pout_first;
+				__kernel(__pin, __pin_first + (__in_last - __in_first), __pout,
+					__pout_first + (__out_last - __out_first));
+				__in_first += (__pin - __pin_first);
+				__out_first += (__pout - __pout_first);
+				__working_input  = __reconstruct(
+					::std::in_place_type<_WorkingInput>, ::std::move(__in_first), ::std::move(__in_last));
+				__working_output = __reconstruct(
+					::std::in_place_type<_WorkingOutput>, ::std::move(__out_first), ::std::move(__out_last));
+				if (__adl::__adl_empty(__working_input)) {
+					break;
+				}
+				auto __result = __encoding.encode_one(
+					::std::move(__working_input), ::std::move(__working_output), __error_handler, __state);
+				if (__result.error_code != encoding_error::ok) {
+					return __result;
+				}
+				__handled_errors += __result.handled_errors;
+				__working_input  = ::std::move(__result.input);
+				__working_output = ::std::move(__result.output);
+				if (__adl::__adl_empty(__working_input)) {
+					break;
+				}
+			}
+			return _Result(::std::move(__working_input), ::std::move(__working_output), __state, encoding_error::ok,
+				__handled_errors);
+		}
+
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#endif // ZTD_TEXT_DETAIL_BULK_TRANSCODE_HPP
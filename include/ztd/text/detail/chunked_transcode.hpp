@@ -0,0 +1,336 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_CHUNKED_TRANSCODE_HPP
+#define ZTD_TEXT_DETAIL_CHUNKED_TRANSCODE_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/code_point.hpp>
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/decode.hpp>
+#include <ztd/text/encode.hpp>
+#include <ztd/text/state.hpp>
+#include <ztd/text/transcode_result.hpp>
+#include <ztd/text/unbounded.hpp>
+
+#include <ztd/text/detail/transcode_one.hpp>
+#include <ztd/text/detail/encoding_range.hpp>
+#include <ztd/text/detail/reconstruct.hpp>
+#include <ztd/text/detail/adl.hpp>
+#include <ztd/text/detail/range.hpp>
+#include <ztd/text/detail/span.hpp>
+#include <ztd/text/detail/type_traits.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		//////
+		/// @brief The number of code points decoded (and then encoded) at a time by
+		/// ztd::text::__txt_detail::__chunked_transcode_into.
+		//////
+		inline constexpr ::std::size_t __transcode_chunk_size = 256;
+
+		//////
+		/// @brief The fewest code points in front of a failing one that
+		/// ztd::text::__txt_detail::__chunked_transcode_into keeps. Keeping them means decoding and encoding them a
+		/// second time, and fewer than this are cheaper to go over one step at a time.
+		//////
+		inline constexpr ::std::size_t __transcode_chunk_keep_minimum = 32;
+
+		//////
+		/// @brief An error handler that passes the result through untouched, but records whether the failed step
+		/// read any input before it stopped.
+		///
+		/// @remarks A step which fails with ztd::text::encoding_error::insufficient_output_space without having read
+		/// anything can be picked back up from the input it returned. Anything else leaves the input somewhere inside
+		/// of (or past) the failing sequence.
+		//////
+		class __chunk_error_handler {
+		public:
+			using assume_valid = ::std::false_type;
+
+			constexpr __chunk_error_handler(bool& __read_input) noexcept : _M_read_input(&__read_input) {
+			}
+
+			template <typename _Encoding, typename _Result, typename _Progress>
+			constexpr auto operator()(const _Encoding&, _Result __result, const _Progress& __progress) const {
+				*_M_read_input = !__adl::__adl_empty(__progress);
+				return __result;
+			}
+
+		private:
+			bool* _M_read_input;
+		};
+
+		enum class __chunk_outcome { __transcoded, __failed, __out_of_room };
+
+		template <typename _State>
+		using __detect_copy_state_into
+			= decltype(__copy_state_into(::std::declval<const _State&>(), ::std::declval<_State&>()));
+
+		//////
+		/// @brief Whether a chunk can be worked on with a copy of the given state.
+		///
+		/// @remarks States which cannot be copied with a copy constructor can still take part by providing a @c
+		/// __copy_state_into(source, destination) hidden friend, which returns @c false if this particular state
+		/// cannot be copied after all (e.g. a type-erased state wrapping a move-only state).
+		//////
+		template <typename _State>
+		inline constexpr bool __is_chunk_state_copyable_v
+			= (::std::is_copy_constructible_v<_State> && ::std::is_copy_assignable_v<_State>)
+			|| __is_detected_v<__detect_copy_state_into, _State>;
+
+		template <typename _State>
+		constexpr bool __copy_chunk_state(const _State& __source, _State& __destination) {
+			if constexpr (__is_detected_v<__detect_copy_state_into, _State>) {
+				return __copy_state_into(__source, __destination);
+			}
+			else {
+				__destination = __source;
+				return true;
+			}
+		}
+
+		template <typename _State, typename _MakeState>
+		constexpr _State __make_chunk_state(const _State& __state, _MakeState&& __make_state) {
+			if constexpr (::std::is_copy_constructible_v<_State>) {
+				(void)__make_state;
+				return __state;
+			}
+			else {
+				(void)__state;
+				return __make_state();
+			}
+		}
+
+		template <typename _Input, typename _FromEncoding, typename _Output, typename _ToEncoding,
+			typename _FromState, typename _ToState, typename _UFromEncoding = __remove_cvref_t<_FromEncoding>,
+			typename _UToEncoding           = __remove_cvref_t<_ToEncoding>,
+			typename _IntermediateCodePoint = code_point_t<_UFromEncoding>>
+		inline constexpr bool __is_chunked_bulk_available_v
+			= __is_detected_v<__detect_adl_text_decode, _Input, _FromEncoding&,
+			       ::ztd::text::span<_IntermediateCodePoint>, __chunk_error_handler&, _FromState>
+			|| __is_detected_v<__detect_adl_internal_text_decode, _Input, _FromEncoding&,
+			     ::ztd::text::span<_IntermediateCodePoint>, __chunk_error_handler&, _FromState>
+			|| __is_detected_v<__detect_adl_text_encode, ::ztd::text::span<const _IntermediateCodePoint>,
+			     _ToEncoding&, ::ztd::text::span<code_unit_t<_UToEncoding>>, __chunk_error_handler&, _ToState>
+			|| __is_detected_v<__detect_adl_internal_text_encode, ::ztd::text::span<const _IntermediateCodePoint>,
+			     _ToEncoding&, ::ztd::text::span<code_unit_t<_UToEncoding>>, __chunk_error_handler&, _ToState>;
+
+		//////
+		/// @brief Whether ztd::text::__txt_detail::__chunked_transcode_into can be used for the given input, output,
+		/// encodings, and states.
+		///
+		/// @remarks A chunk is decoded and encoded ahead of time, and thrown away if anything goes wrong with
+		/// it. That needs an input which can be gone over more than once, states which can be copied (see
+		/// ztd::text::__txt_detail::__is_chunk_state_copyable_v), and an output
+		/// whose remaining space can be known up front. It is only worth it if either encoding has a bulk @c
+		/// text_decode or @c text_encode extension point.
+		//////
+		template <typename _Input, typename _FromEncoding, typename _Output, typename _ToEncoding,
+			typename _FromState, typename _ToState>
+		inline constexpr bool __is_chunked_transcodable_v
+			= __is_range_iterator_concept_or_better_v<::std::forward_iterator_tag, _Input>
+			&& (__is_detected_v<__detect_adl_size, _Output> || __is_specialization_of_v<_Output, unbounded_view>)
+			&& __is_chunk_state_copyable_v<_FromState> && __is_chunk_state_copyable_v<_ToState>
+			&& __is_chunked_bulk_available_v<_Input&, _FromEncoding, _Output, _ToEncoding, _FromState, _ToState>;
+
+		//////
+		/// @brief Transcodes by decoding a chunk of code points into a buffer with ztd::text::decode_into, then
+		/// encoding that whole buffer with ztd::text::encode_into, so that any bulk extension points either encoding
+		/// provides get used.
+		///
+		/// @remarks Each chunk is done with copies of the states, a handler which never fixes anything, and into
+		/// temporary buffers, and only committed to the real output if it went through cleanly. If a code point in
+		/// the chunk fails to decode or encode, everything before it is kept, and only the failing step is redone
+		/// with ztd::text::__txt_detail::__basic_transcode_one and the real error handlers. If the output runs out,
+		/// the whole chunk is redone one step at a time. When errors come close together, chunks which keep failing
+		/// early are tried further and further apart, so that input with many errors costs about as much as the
+		/// plain loop. Error handlers therefore see the exact same sequences, in
+		/// the same order, as they would in ztd::text::basic_transcode_into, and the result is identical as well.
+		//////
+		template <typename _Input, typename _FromEncoding, typename _Output, typename _ToEncoding,
+			typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState, typename _ToState>
+		constexpr auto __chunked_transcode_into(_Input&& __input, _FromEncoding& __from_encoding, _Output&& __output,
+			_ToEncoding& __to_encoding, _FromErrorHandler& __from_error_handler, _ToErrorHandler& __to_error_handler,
+			_FromState& __from_state, _ToState& __to_state) {
+			using _WorkingInput          = __string_view_or_span_or_reconstruct_t<_Input>;
+			using _WorkingOutput         = __reconstruct_t<__remove_cvref_t<_Output>>;
+			using _UFromEncoding         = __remove_cvref_t<_FromEncoding>;
+			using _UToEncoding           = __remove_cvref_t<_ToEncoding>;
+			using _IntermediateCodePoint = code_point_t<_UFromEncoding>;
+			using _CodeUnit              = code_unit_t<_UToEncoding>;
+			using _Result = __reconstruct_transcode_result_t<_WorkingInput, _WorkingOutput, _FromState, _ToState>;
+			constexpr ::std::size_t __code_unit_chunk_size = __transcode_chunk_size * max_code_units_v<_UToEncoding>;
+
+			_WorkingInput __working_input(
+				__reconstruct(::std::in_place_type<_WorkingInput>, ::std::forward<_Input>(__input)));
+			_WorkingOutput __working_output(
+				__reconstruct(::std::in_place_type<_WorkingOutput>, ::std::forward<_Output>(__output)));
+
+			_IntermediateCodePoint __intermediate[__transcode_chunk_size];
+			_CodeUnit __code_units[__code_unit_chunk_size];
+			::std::size_t __handled_errors = 0;
+			_FromState __chunk_from_state = __make_chunk_state(
+				__from_state, [&__from_encoding]() { return make_decode_state(__from_encoding); });
+			_ToState __chunk_to_state = __make_chunk_state(
+				__to_state, [&__to_encoding]() { return make_encode_state(__to_encoding); });
+			// Decodes at most __count code points into __intermediate and encodes them into __code_units, with the
+			// chunk's states, and commits them to the output if both went through cleanly. If not,
+			// __code_point_count is how many code points at the front of the chunk did.
+			auto __transcode_chunk = [&](::std::size_t __count, ::std::size_t& __code_point_count) {
+				bool __read_input = false;
+				__chunk_error_handler __chunk_handler(__read_input);
+				auto __decode_result = decode_into(__working_input, __from_encoding,
+					::ztd::text::span<_IntermediateCodePoint>(__intermediate, __count), __chunk_handler,
+					__chunk_from_state);
+				__code_point_count
+					= static_cast<::std::size_t>(__adl::__adl_data(__decode_result.output) - __intermediate);
+				::std::size_t __code_unit_count = 0;
+				bool __is_complete              = __code_point_count != 0
+					&& (__decode_result.error_code == encoding_error::ok
+					     || (__decode_result.error_code == encoding_error::insufficient_output_space
+					          && !__read_input));
+				if (__code_point_count != 0) {
+					auto __encode_result = encode_into(
+						::ztd::text::span<const _IntermediateCodePoint>(__intermediate, __code_point_count),
+						__to_encoding, ::ztd::text::span<_CodeUnit>(__code_units, __code_unit_chunk_size),
+						__chunk_handler, __chunk_to_state);
+					__code_unit_count
+						= static_cast<::std::size_t>(__adl::__adl_data(__encode_result.output) - __code_units);
+					if (__encode_result.error_code != encoding_error::ok
+						|| !__adl::__adl_empty(__encode_result.input)) {
+						__is_complete = false;
+						__code_point_count
+							-= static_cast<::std::size_t>(__adl::__adl_size(__encode_result.input));
+					}
+				}
+				if constexpr (__is_detected_v<__detect_adl_size, _WorkingOutput>) {
+					if (static_cast<::std::size_t>(__adl::__adl_size(__working_output)) < __code_unit_count) {
+						return __chunk_outcome::__out_of_room;
+					}
+				}
+				if (!__is_complete) {
+					return __chunk_outcome::__failed;
+				}
+				auto __out_it   = __adl::__adl_begin(__working_output);
+				auto __out_last = __adl::__adl_end(__working_output);
+				for (::std::size_t __index = 0; __index < __code_unit_count; ++__index) {
+					*__out_it = __code_units[__index];
+					++__out_it;
+				}
+				__working_input  = __reconstruct(::std::in_place_type<_WorkingInput>,
+					__adl::__adl_begin(__decode_result.input), __adl::__adl_end(__decode_result.input));
+				__working_output = __reconstruct(::std::in_place_type<_WorkingOutput>, ::std::move(__out_it),
+					::std::move(__out_last));
+				using ::std::swap;
+				swap(__from_state, __chunk_from_state);
+				swap(__to_state, __chunk_to_state);
+				return __chunk_outcome::__transcoded;
+			};
+
+			// how many more steps to take, on top of the failing one, after a chunk fails early
+			::std::size_t __backoff_step_count = 0;
+			while (!__adl::__adl_empty(__working_input)) {
+				// If the states cannot be copied after all (e.g. a type-erased state wrapping a move-only one),
+				// everything that is left is done one step at a time below.
+				::std::size_t __step_count = static_cast<::std::size_t>(-1);
+				if (__copy_chunk_state(__from_state, __chunk_from_state)
+					&& __copy_chunk_state(__to_state, __chunk_to_state)) {
+					::std::size_t __code_point_count = 0;
+					__chunk_outcome __outcome = __transcode_chunk(__transcode_chunk_size, __code_point_count);
+					if (__outcome == __chunk_outcome::__transcoded) {
+						__backoff_step_count = 0;
+						continue;
+					}
+					if (__outcome == __chunk_outcome::__out_of_room) {
+						__step_count = __transcode_chunk_size;
+					}
+					else if (__code_point_count >= __transcode_chunk_keep_minimum) {
+						// The code points before the failing one went through, but the input and the states were
+						// left somewhere inside the failing step: go over exactly those code points again, which
+						// stops right before it.
+						::std::size_t __good_code_point_count = __code_point_count;
+						__step_count                          = 1;
+						__backoff_step_count                  = 0;
+						if (!__copy_chunk_state(__from_state, __chunk_from_state)
+							|| !__copy_chunk_state(__to_state, __chunk_to_state)
+							|| __transcode_chunk(__good_code_point_count, __code_point_count)
+								!= __chunk_outcome::__transcoded
+							|| __code_point_count != __good_code_point_count) {
+							__step_count = __good_code_point_count + 1;
+						}
+					}
+					else {
+						// errors are close together: step over this part, and try the next chunk further away
+						__step_count         = __code_point_count + 1 + __backoff_step_count;
+						__backoff_step_count = __backoff_step_count == 0 ? 1 : __backoff_step_count * 2;
+						if (__backoff_step_count > __transcode_chunk_size) {
+							__backoff_step_count = __transcode_chunk_size;
+						}
+					}
+				}
+				// Something in this chunk needs an error handler, or the output is too small: do the failing step
+				// (or everything, if the output ran out) one step at a time, exactly as the plain loop would.
+				for (::std::size_t __step = 0; __step < __step_count; ++__step) {
+					_IntermediateCodePoint __step_intermediate[max_code_points_v<_UFromEncoding>];
+					auto __transcode_result = __basic_transcode_one<__consume::__no>(::std::move(__working_input),
+						__from_encoding, __step_intermediate, ::std::move(__working_output), __to_encoding,
+						__from_error_handler, __to_error_handler, __from_state, __to_state);
+					if (__transcode_result.error_code != encoding_error::ok) {
+						return _Result(::std::move(__working_input), ::std::move(__working_output), __from_state,
+							__to_state, __transcode_result.error_code, __transcode_result.handled_errors);
+					}
+					__handled_errors += __transcode_result.handled_errors;
+					__working_input  = ::std::move(__transcode_result.input);
+					__working_output = ::std::move(__transcode_result.output);
+					if (__adl::__adl_empty(__working_input)) {
+						break;
+					}
+				}
+			}
+			return _Result(::std::move(__working_input), ::std::move(__working_output), __from_state, __to_state,
+				encoding_error::ok, __handled_errors);
+		}
+
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#endif // ZTD_TEXT_DETAIL_CHUNKED_TRANSCODE_HPP
@@ -0,0 +1,185 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_COUNT_UTF8_HPP
+#define ZTD_TEXT_DETAIL_COUNT_UTF8_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/detail/unicode.hpp>
+#include <ztd/text/detail/skip_ascii.hpp>
+#include <ztd/text/detail/validate_utf8.hpp>
+
+#include <cstddef>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		//////
+		/// @brief Counts the code points in strict UTF-8, skipping whole runs of ASCII at a time.
+		///
+		/// @returns The number of code points in <tt>[old __in, new __in)</tt>. @p __in is left at the first
+		/// sequence that does not decode (or is cut off by @p __in_last).
+		//////
+		template <typename _CodeUnit>
+		constexpr ::std::size_t __utf8_count_decoded(const _CodeUnit*& __in, const _CodeUnit* __in_last) noexcept {
+			static_assert(sizeof(_CodeUnit) == sizeof(unsigned char),
+				"the code unit type must be a single byte in size for UTF-8");
+			::std::size_t __count = 0;
+			char32_t __decoded {};
+			while (__in != __in_last) {
+				const _CodeUnit* __ascii_stop = __skip_ascii(__in, __in_last);
+				__count += static_cast<::std::size_t>(__ascii_stop - __in);
+				__in = __ascii_stop;
+				if (__in == __in_last) {
+					break;
+				}
+				const ::std::ptrdiff_t __length = __utf8_decode_strict(__in, __in_last, __decoded);
+				if (__length == 0) {
+					break;
+				}
+				++__count;
+				__in += __length;
+			}
+			return __count;
+		}
+
+		//////
+		/// @brief Counts the UTF-8 code units needed to encode a sequence of code points, skipping whole runs of
+		/// ASCII at a time.
+		///
+		/// @returns The number of code units needed for <tt>[old __in, new __in)</tt>. @p __in is left at the first
+		/// code point that strict UTF-8 cannot encode (surrogates and values above U+10FFFF).
+		//////
+		template <typename _CodePoint>
+		constexpr ::std::size_t __utf8_count_encoded(const _CodePoint*& __in, const _CodePoint* __in_last) noexcept {
+			static_assert(sizeof(_CodePoint) == sizeof(char32_t), "the code point type must be 4 bytes in size");
+			::std::size_t __count = 0;
+			while (__in != __in_last) {
+				const _CodePoint* __ascii_stop = __skip_ascii(__in, __in_last);
+				__count += static_cast<::std::size_t>(__ascii_stop - __in);
+				__in = __ascii_stop;
+				if (__in == __in_last) {
+					break;
+				}
+				const char32_t __code_point = static_cast<char32_t>(*__in);
+				if (__code_point <= __last_2byte_value) {
+					__count += 2;
+				}
+				else if (__code_point <= __last_3byte_value) {
+					if (__is_surrogate(__code_point)) {
+						break;
+					}
+					__count += 3;
+				}
+				else if (__code_point <= __last_code_point) {
+					__count += 4;
+				}
+				else {
+					break;
+				}
+				++__in;
+			}
+			return __count;
+		}
+
+		//////
+		/// @brief Counts the UTF-16 code units that decoding strict UTF-8 and encoding it again as UTF-16 produces.
+		///
+		/// @returns The number of UTF-16 code units for <tt>[old __in, new __in)</tt>. @p __in is left at the first
+		/// sequence that does not decode (or is cut off by @p __in_last).
+		///
+		/// @remarks The input is validated in bulk first, after which every code unit that is not a continuation
+		/// counts for one UTF-16 code unit and every 4-byte lead counts for one more.
+		//////
+		template <typename _CodeUnit>
+		constexpr ::std::size_t __utf8_count_utf16(const _CodeUnit*& __in, const _CodeUnit* __in_last) noexcept {
+			static_assert(sizeof(_CodeUnit) == sizeof(unsigned char),
+				"the code unit type must be a single byte in size for UTF-8");
+			const _CodeUnit* __valid_last = __utf8_validate(__in, __in_last);
+			::std::size_t __count         = 0;
+			for (; __in != __valid_last; ++__in) {
+				const unsigned char __unit = static_cast<unsigned char>(*__in);
+				__count += static_cast<::std::size_t>((__unit & 0xC0u) != 0x80u)
+					+ static_cast<::std::size_t>(__unit >= __start_4byte_mask);
+			}
+			return __count;
+		}
+
+		//////
+		/// @brief Counts the UTF-8 code units that decoding strict UTF-16 and encoding it again as UTF-8 produces,
+		/// skipping whole runs of ASCII at a time.
+		///
+		/// @returns The number of UTF-8 code units for <tt>[old __in, new __in)</tt>. @p __in is left at the first
+		/// unpaired surrogate.
+		//////
+		template <typename _CodeUnit>
+		constexpr ::std::size_t __utf16_count_utf8(const _CodeUnit*& __in, const _CodeUnit* __in_last) noexcept {
+			static_assert(sizeof(_CodeUnit) == sizeof(char16_t),
+				"the code unit type must be two bytes in size for UTF-16");
+			::std::size_t __count = 0;
+			while (__in != __in_last) {
+				const _CodeUnit* __ascii_stop = __skip_ascii(__in, __in_last);
+				__count += static_cast<::std::size_t>(__ascii_stop - __in);
+				__in = __ascii_stop;
+				if (__in == __in_last) {
+					break;
+				}
+				const char32_t __unit = static_cast<char16_t>(*__in);
+				if (__unit <= __last_2byte_value) {
+					__count += 2;
+					++__in;
+				}
+				else if (!__is_surrogate(__unit)) {
+					__count += 3;
+					++__in;
+				}
+				else if (__is_lead_surrogate(__unit) && (__in_last - __in) > 1
+					&& __is_trail_surrogate(static_cast<char16_t>(__in[1]))) {
+					__count += 4;
+					__in += 2;
+				}
+				else {
+					break;
+				}
+			}
+			return __count;
+		}
+
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#endif // ZTD_TEXT_DETAIL_COUNT_UTF8_HPP
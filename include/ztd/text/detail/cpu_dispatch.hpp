@@ -0,0 +1,151 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_CPU_DISPATCH_HPP
+#define ZTD_TEXT_DETAIL_CPU_DISPATCH_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		//////
+		/// @brief The instruction set tiers the vectorized kernels are compiled for, from least to most capable.
+		/// Every tier includes everything in the tiers before it.
+		//////
+		enum class __isa : unsigned char { __scalar = 0, __sse2 = 1, __sse4_2 = 2, __avx2 = 3 };
+
+		//////
+		/// @brief The number of ztd::text::__txt_detail::__isa tiers.
+		//////
+		inline constexpr ::std::size_t __isa_count = 4;
+
+		//////
+		/// @brief A table of kernels, one per ztd::text::__txt_detail::__isa tier and indexed by it.
+		///
+		/// @remarks A tier without a kernel of its own repeats the one from the tier below it.
+		//////
+		template <typename _Function>
+		using __isa_table = ::std::array<_Function, __isa_count>;
+
+		//////
+		/// @brief Looks up a tier by the name used for the @c ZTD_TEXT_FORCE_ISA environment variable: one of @c
+		/// "scalar" , @c "sse2" , @c "sse4.2" , or @c "avx2" .
+		///
+		/// @returns @c true and sets @p __result if the name is one of the above, @c false otherwise.
+		//////
+		inline bool __isa_from_name(const char* __name, __isa& __result) noexcept {
+			constexpr const char* __names[__isa_count] = { "scalar", "sse2", "sse4.2", "avx2" };
+			for (::std::size_t __index = 0; __index < __isa_count; ++__index) {
+				if (::std::strcmp(__name, __names[__index]) == 0) {
+					__result = static_cast<__isa>(__index);
+					return true;
+				}
+			}
+			return false;
+		}
+
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_SIMD_X86_I_)
+		//////
+		/// @brief Asks the processor which tiers it supports.
+		//////
+		inline __isa __detect_isa() noexcept {
+			__builtin_cpu_init();
+			if (__builtin_cpu_supports("avx2")) {
+				return __isa::__avx2;
+			}
+			if (__builtin_cpu_supports("sse4.2")) {
+				return __isa::__sse4_2;
+			}
+			if (__builtin_cpu_supports("sse2")) {
+				return __isa::__sse2;
+			}
+			return __isa::__scalar;
+		}
+#else
+		inline __isa __detect_isa() noexcept {
+			return __isa::__scalar;
+		}
+#endif
+
+		//////
+		/// @brief Picks the tier to use: the best one the processor supports, or a lower one named by the @c
+		/// ZTD_TEXT_FORCE_ISA environment variable.
+		///
+		/// @remarks Forcing a tier the processor does not support picks the best supported one instead, rather than
+		/// running instructions that do not exist. Unknown names are ignored.
+		//////
+		inline __isa __select_isa() noexcept {
+			const __isa __detected = __detect_isa();
+			const char* __forced_name = ::std::getenv("ZTD_TEXT_FORCE_ISA");
+			__isa __forced = __detected;
+			if (__forced_name != nullptr && __isa_from_name(__forced_name, __forced) && __forced < __detected) {
+				return __forced;
+			}
+			return __detected;
+		}
+
+		//////
+		/// @brief The tier in use by this process.
+		///
+		/// @remarks Selected on first use and cached from then on. Being a function-local static in an inline
+		/// function, there is exactly one of it for the whole program, without linking against anything.
+		//////
+		inline __isa __cpu_isa() noexcept {
+			static const __isa __selected = __select_isa();
+			return __selected;
+		}
+
+		//////
+		/// @brief Picks the kernel for the tier in use out of @p __table .
+		///
+		/// @remarks Callers cache the returned function pointer in a function-local static of their own, so the
+		/// selection happens once per kernel.
+		//////
+		template <typename _Function>
+		inline _Function __isa_select(const __isa_table<_Function>& __table) noexcept {
+			return __table[static_cast<::std::size_t>(__cpu_isa())];
+		}
+
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#endif // ZTD_TEXT_DETAIL_CPU_DISPATCH_HPP
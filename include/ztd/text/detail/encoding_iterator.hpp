@@ -40,10 +40,13 @@
 #include <ztd/text/state.hpp>
 #include <ztd/text/unbounded.hpp>
 #include <ztd/text/subrange.hpp>
+#include <ztd/text/is_bidirectional_encoding.hpp>
 
 #include <ztd/text/detail/ebco.hpp>
+#include <ztd/text/detail/empty_state.hpp>
 #include <ztd/text/detail/blackhole_iterator.hpp>
 #include <ztd/text/detail/encoding_iterator_storage.hpp>
+#include <ztd/text/detail/encoding_iterator_buffer.hpp>
 #include <ztd/text/detail/adl.hpp>
 #include <ztd/text/detail/encoding_range.hpp>
 #include <ztd/text/detail/transcode_one.hpp>
@@ -51,6 +54,7 @@
 
 #include <array>
 #include <cassert>
+#include <iterator>
 
 namespace ztd { namespace text {
 	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
@@ -58,28 +62,68 @@ namespace ztd { namespace text {
 
 		class __encoding_sentinel { };
 
+		// only looked for on ranges which can be gone backwards from their end, so that detecting it does not
+		// instantiate anything which cannot work
+		template <bool _IsCommonBidirectional, __transaction _EncodeOrDecode, typename _UEncoding, typename _URange,
+			typename _UState, typename _UErrorHandler>
+		inline constexpr bool __has_one_backward_v = false;
+
+		template <typename _UEncoding, typename _URange, typename _UState, typename _UErrorHandler>
+		inline constexpr bool __has_one_backward_v<true, __transaction::__decode, _UEncoding, _URange, _UState,
+			_UErrorHandler> = __is_detected_v<__detect_decode_backward, _UEncoding, _URange,
+			::ztd::text::span<code_point_t<_UEncoding>>, _UState, _UErrorHandler>;
+
+		template <typename _UEncoding, typename _URange, typename _UState, typename _UErrorHandler>
+		inline constexpr bool __has_one_backward_v<true, __transaction::__encode, _UEncoding, _URange, _UState,
+			_UErrorHandler> = __is_detected_v<__detect_encode_backward, _UEncoding, _URange,
+			::ztd::text::span<code_unit_t<_UEncoding>>, _UState, _UErrorHandler>;
+
+		//////
+		/// @brief Whether an encoding iterator can go backwards: it is not buffering, the underlying range is
+		/// bidirectional, and the encoding has a @c decode_one_backward (or @c encode_one_backward) function.
+		//////
+		template <__transaction _EncodeOrDecode, typename _Encoding, typename _Range, typename _ErrorHandler,
+			typename _State, ::std::size_t _BufferSize>
+		inline constexpr bool __is_backward_encoding_iterator_v = _BufferSize == 0
+			&& __has_one_backward_v<
+			     __is_range_iterator_concept_or_better_v<::std::bidirectional_iterator_tag,
+			          __remove_cvref_t<__unwrap_t<_Range>>>
+			          && ::std::is_same_v<__range_iterator_t<__remove_cvref_t<__unwrap_t<_Range>>>,
+			               __range_sentinel_t<__remove_cvref_t<__unwrap_t<_Range>>>>,
+			     _EncodeOrDecode, __remove_cvref_t<_Encoding>, __remove_cvref_t<__unwrap_t<_Range>>,
+			     __remove_cvref_t<_State>, __remove_cvref_t<_ErrorHandler>>;
+
 		template <__transaction _EncodeOrDecode, typename _Derived, typename _Encoding, typename _Range,
-			typename _ErrorHandler, typename _State>
+			typename _ErrorHandler, typename _State, ::std::size_t _BufferSize>
 		class __encoding_iterator
 		: private __txt_detail::__ebco<__txt_detail::__remove_cvref_t<_Encoding>, 0>,
 		  private __txt_detail::__ebco<__txt_detail::__remove_cvref_t<_ErrorHandler>, 1>,
 		  private __txt_detail::__state_storage<__txt_detail::__remove_cvref_t<__txt_detail::__unwrap_t<_Encoding>>,
 			  __txt_detail::__remove_cvref_t<_State>>,
-		  private __txt_detail::__cache_cursor<
-			  max_code_units_v<__txt_detail::__remove_cvref_t<__txt_detail::__unwrap_t<_Encoding>>>>,
-		  private __txt_detail::__ebco<_Range, 2> {
+		  private __txt_detail::__encoding_cache_cursor_t<_Encoding, _BufferSize>,
+		  private __txt_detail::__ebco<_Range, 2>,
+		  private __txt_detail::__ebco<
+			  ::std::conditional_t<__is_backward_encoding_iterator_v<_EncodeOrDecode, _Encoding, _Range,
+			                            _ErrorHandler, _State, _BufferSize>,
+			       __range_iterator_t<__remove_cvref_t<__unwrap_t<_Range>>>, __empty_state>,
+			  3> {
 		private:
 			using _URange        = __txt_detail::__remove_cvref_t<__txt_detail::__unwrap_t<_Range>>;
 			using _UEncoding     = __txt_detail::__remove_cvref_t<__txt_detail::__unwrap_t<_Encoding>>;
 			using _UErrorHandler = __txt_detail::__remove_cvref_t<__txt_detail::__unwrap_t<_ErrorHandler>>;
 			using _UState        = __txt_detail::__remove_cvref_t<__txt_detail::__unwrap_t<_State>>;
 			using _BaseIterator  = __txt_detail::__range_iterator_t<_URange>;
-			static constexpr ::std::size_t _MaxValues = max_code_units_v<_UEncoding>;
-			static constexpr bool _IsSingleValueType  = _MaxValues == 1;
-			using __base_cursor_t                     = __txt_detail::__cache_cursor<_MaxValues>;
+			static constexpr bool _IsBuffered         = _BufferSize != 0;
+			static constexpr ::std::size_t _MaxValues = __cache_size_v<max_code_units_v<_UEncoding>, _BufferSize>;
+			static constexpr bool _IsSingleValueType  = !_IsBuffered && _MaxValues == 1;
+			static constexpr bool _IsBackward         = __is_backward_encoding_iterator_v<_EncodeOrDecode, _Encoding,
+                    _Range, _ErrorHandler, _State, _BufferSize>;
+			using __base_cursor_t = __txt_detail::__encoding_cache_cursor_t<_Encoding, _BufferSize>;
 			using __base_encoding_t                   = __txt_detail::__ebco<__txt_detail::__remove_cvref_t<_Encoding>, 0>;
 			using __base_error_handler_t = __txt_detail::__ebco<__txt_detail::__remove_cvref_t<_ErrorHandler>, 1>;
 			using __base_range_t         = __txt_detail::__ebco<_Range, 2>;
+			using __base_first_t
+				= __txt_detail::__ebco<::std::conditional_t<_IsBackward, _BaseIterator, __empty_state>, 3>;
 			using __base_state_t         = __txt_detail::__state_storage<__txt_detail::__remove_cvref_t<_Encoding>,
                     __txt_detail::__remove_cvref_t<_State>>;
 
@@ -112,17 +156,23 @@ namespace ztd { namespace text {
 			//////
 			/// @brief The strength of the iterator category, as defined in relation to the base.
 			///
+			/// @remarks This is only bidirectional if the iterator can actually go backwards; otherwise, it is at
+			/// most forward.
 			//////
-			using iterator_category = ::std::conditional_t<
-				__txt_detail::__is_iterator_concept_or_better_v<::std::bidirectional_iterator_tag, _BaseIterator>,
-				::std::bidirectional_iterator_tag, __txt_detail::__iterator_category_t<_BaseIterator>>;
+			using iterator_category = ::std::conditional_t<_IsBackward, ::std::bidirectional_iterator_tag,
+				::std::conditional_t<
+				     __txt_detail::__is_iterator_concept_or_better_v<::std::forward_iterator_tag, _BaseIterator>,
+				     ::std::forward_iterator_tag, __txt_detail::__iterator_category_t<_BaseIterator>>>;
 			//////
 			/// @brief The strength of the iterator concept, as defined in relation to the base.
 			///
+			/// @remarks This is only bidirectional if the iterator can actually go backwards; otherwise, it is at
+			/// most forward.
 			//////
-			using iterator_concept = ::std::conditional_t<
-				__txt_detail::__is_iterator_concept_or_better_v<::std::bidirectional_iterator_tag, _BaseIterator>,
-				::std::bidirectional_iterator_tag, __txt_detail::__iterator_concept_t<_BaseIterator>>;
+			using iterator_concept = ::std::conditional_t<_IsBackward, ::std::bidirectional_iterator_tag,
+				::std::conditional_t<
+				     __txt_detail::__is_iterator_concept_or_better_v<::std::forward_iterator_tag, _BaseIterator>,
+				     ::std::forward_iterator_tag, __txt_detail::__iterator_concept_t<_BaseIterator>>>;
 			//////
 			/// @brief The object type that gets output on every dereference.
 			///
@@ -171,8 +221,9 @@ namespace ztd { namespace text {
 			, __base_state_t(this->encoding())
 			, __base_cursor_t()
 			, __base_range_t(::std::move(__range))
+			, __base_first_t()
 			, _M_cache() {
-				this->_M_read_one();
+				this->_M_start();
 			}
 
 			constexpr __encoding_iterator(range_type __range, encoding_type __encoding,
@@ -182,8 +233,28 @@ namespace ztd { namespace text {
 			, __base_state_t(this->encoding(), ::std::move(__state))
 			, __base_cursor_t()
 			, __base_range_t(::std::move(__range))
+			, __base_first_t()
 			, _M_cache() {
-				this->_M_read_one();
+				this->_M_start();
+			}
+
+			//////
+			/// @brief Constructs the iterator which is at the end of the range @p __it is iterating over, so that it
+			/// can be gone backwards from.
+			///
+			/// @param[in] __it The iterator to take the range, encoding, error handler, and state from.
+			///
+			/// @remarks The state is copied from @p __it, so this is only meaningful for encodings which can go
+			/// backwards, which have no state that changes from one complete unit of information to the next.
+			//////
+			constexpr __encoding_iterator(const __encoding_sentinel&, const __encoding_iterator& __it)
+			: __encoding_iterator(__it) {
+				auto __last = __adl::__adl_end(this->_M_range());
+				this->_M_range() = __reconstruct(::std::in_place_type<_URange>, __last, __last);
+				if constexpr (!_IsSingleValueType) {
+					this->_M_size     = 0;
+					this->_M_position = 0;
+				}
 			}
 
 			// assignment
@@ -212,6 +283,8 @@ namespace ztd { namespace text {
 			/// @brief The state object.
 			///
 			/// @returns A const l-value reference to the state object used to construct this iterator.
+			///
+			/// @remarks For a buffering iterator, this is the state after everything currently in the buffer.
 			//////
 			constexpr const state_type& state() const {
 				return this->__base_state_t::_M_get_state();
@@ -248,6 +321,8 @@ namespace ztd { namespace text {
 			/// @brief The input range used to construct this object.
 			///
 			/// @returns A const l-value reference to the input range used to construct this iterator.
+			///
+			/// @remarks For a buffering iterator, this is the input after everything currently in the buffer.
 			//////
 			constexpr const range_type& base() const& {
 				return this->__base_range_t::get_value();
@@ -274,15 +349,15 @@ namespace ztd { namespace text {
 			//////
 			/// @brief Whether or not the underlying range for this iterator is empty or not.
 			///
-			/// @returns True if the range is empty, false otherwise.
+			/// @returns True if the range is empty, false otherwise. For a buffering iterator, this is only true
+			/// once everything in the buffer has been gone through as well.
 			//////
 			constexpr bool empty() const noexcept {
-				if constexpr (__is_detected_v<__detect_adl_empty, _Range>) {
-					return __adl::__adl_empty(this->__base_range_t::get_value());
+				if constexpr (_IsBuffered) {
+					return this->_M_position == this->_M_size;
 				}
 				else {
-					return __adl::__adl_cbegin(this->__base_range_t::get_value())
-						== __adl::__adl_cend(this->__base_range_t::get_value());
+					return this->_M_base_empty();
 				}
 			}
 
@@ -306,6 +381,12 @@ namespace ztd { namespace text {
 				if constexpr (_IsSingleValueType) {
 					this->_M_next_one();
 				}
+				else if constexpr (_IsBuffered) {
+					++this->_M_position;
+					if (this->_M_position == this->_M_size) {
+						this->_M_fill();
+					}
+				}
 				else {
 					++this->_M_position;
 					if (this->_M_position == this->_M_size) {
@@ -316,6 +397,43 @@ namespace ztd { namespace text {
 				return this->_M_derived();
 			}
 
+			//////
+			/// @brief Decrement a copy of the iterator.
+			///
+			/// @returns A copy of the iterator from before it was decremented.
+			//////
+			constexpr _Derived operator--(int) {
+				_Derived __copy = this->_M_derived();
+				--(*this);
+				return __copy;
+			}
+
+			//////
+			/// @brief Decrement the iterator.
+			///
+			/// @returns A reference to *this, after decrementing the iterator.
+			///
+			/// @remarks Only available when the underlying range is bidirectional, the iterator is not buffering,
+			/// and the encoding has a @c decode_one_backward (or, for encoding, @c encode_one_backward) function.
+			/// Each step only looks at the end of what comes before the current position, so walking back @c k
+			/// values from the end of a range takes time proportional to @c k, not to the size of the range.
+			/// Decrementing an iterator at the start of the range it was made from is undefined behavior.
+			//////
+			constexpr _Derived& operator--() {
+				static_assert(_IsBackward,
+					"this encoding iterator cannot go backwards: it must not be buffering, the range must be "
+					"bidirectional, and the encoding must have a decode_one_backward / encode_one_backward "
+					"function");
+				if constexpr (!_IsSingleValueType) {
+					if (this->_M_position != 0) {
+						--this->_M_position;
+						return this->_M_derived();
+					}
+				}
+				this->_M_previous_one();
+				return this->_M_derived();
+			}
+
 			//////
 			/// @brief Dereference the iterator.
 			///
@@ -367,6 +485,29 @@ namespace ztd { namespace text {
 				return !(__sen == __it);
 			}
 
+			//////
+			/// @brief Compares whether two iterators over the same range are at the same position.
+			///
+			//////
+			friend constexpr bool operator==(const _Derived& __left, const _Derived& __right) {
+				const bool __same_input
+					= __adl::__adl_begin(__left._M_range()) == __adl::__adl_begin(__right._M_range());
+				if constexpr (_IsSingleValueType) {
+					return __same_input;
+				}
+				else {
+					return __same_input && __left._M_position == __right._M_position;
+				}
+			}
+
+			//////
+			/// @brief Compares whether two iterators over the same range are at different positions.
+			///
+			//////
+			friend constexpr bool operator!=(const _Derived& __left, const _Derived& __right) {
+				return !(__left == __right);
+			}
+
 		private:
 			template <__consume _Consume>
 			constexpr void _M_consume_one() noexcept {
@@ -391,6 +532,75 @@ namespace ztd { namespace text {
 				this->_M_read_one();
 			}
 
+			constexpr void _M_fill() noexcept {
+				using _SizeType   = __remove_cvref_t<decltype(this->_M_size)>;
+				this->_M_position = 0;
+				this->_M_size     = 0;
+				// a step can legitimately produce nothing (e.g., an error handler which skips the bad input): keep
+				// going until there is something to look at, or nothing left
+				while (this->_M_size == 0 && !this->_M_base_empty()) {
+					this->_M_size = static_cast<_SizeType>(
+						__fill_encoding_buffer<_EncodeOrDecode>(this->_M_range(), this->encoding(),
+						     this->_M_cache.data(), this->_M_cache.size(), this->handler(), this->state()));
+				}
+			}
+
+			constexpr void _M_start() noexcept {
+				if constexpr (_IsBackward) {
+					this->__base_first_t::get_value() = __adl::__adl_begin(this->_M_range());
+				}
+				if constexpr (_IsBuffered) {
+					this->_M_fill();
+				}
+				else {
+					this->_M_read_one();
+				}
+			}
+
+			constexpr auto _M_one_backward(_URange __before) noexcept {
+				::ztd::text::span<value_type> __output(this->_M_cache.data(), this->_M_cache.size());
+				if constexpr (_EncodeOrDecode == __transaction::__decode) {
+					return this->encoding().decode_one_backward(
+						__before, __output, this->handler(), this->state());
+				}
+				else {
+					return this->encoding().encode_one_backward(
+						__before, __output, this->handler(), this->state());
+				}
+			}
+
+			constexpr void _M_previous_one() noexcept {
+				auto& __first           = this->__base_first_t::get_value();
+				auto& __range           = this->_M_range();
+				auto __last             = __adl::__adl_end(__range);
+				auto __current          = __adl::__adl_begin(__range);
+				::std::size_t __written = 0;
+				// keep going past steps that produce nothing (e.g., an error handler which skips the bad input)
+				do {
+					auto __result = this->_M_one_backward(
+						__reconstruct(::std::in_place_type<_URange>, __first, __current));
+					assert(__result.error_code == encoding_error::ok);
+					__written = static_cast<::std::size_t>(__result.output.data() - this->_M_cache.data());
+					__current = __adl::__adl_end(__result.input);
+				} while (__written == 0 && __current != __first);
+				__range = __reconstruct(::std::in_place_type<_URange>, __current, __last);
+				if constexpr (!_IsSingleValueType) {
+					using _SizeType   = __remove_cvref_t<decltype(this->_M_size)>;
+					this->_M_size     = static_cast<_SizeType>(__written);
+					this->_M_position = static_cast<_SizeType>(__written == 0 ? 0 : __written - 1);
+				}
+			}
+
+			constexpr bool _M_base_empty() const noexcept {
+				if constexpr (__is_detected_v<__detect_adl_empty, _Range>) {
+					return __adl::__adl_empty(this->__base_range_t::get_value());
+				}
+				else {
+					return __adl::__adl_cbegin(this->__base_range_t::get_value())
+						== __adl::__adl_cend(this->__base_range_t::get_value());
+				}
+			}
+
 			constexpr _Derived& _M_derived() {
 				return static_cast<_Derived&>(*this);
 			}
@@ -0,0 +1,229 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_ENCODING_ITERATOR_BUFFER_HPP
+#define ZTD_TEXT_DETAIL_ENCODING_ITERATOR_BUFFER_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/code_point.hpp>
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/decode.hpp>
+#include <ztd/text/encode.hpp>
+#include <ztd/text/encoding_error.hpp>
+
+#include <ztd/text/detail/chunked_transcode.hpp>
+#include <ztd/text/detail/transcode_one.hpp>
+#include <ztd/text/detail/reconstruct.hpp>
+#include <ztd/text/detail/adl.hpp>
+#include <ztd/text/detail/range.hpp>
+#include <ztd/text/detail/span.hpp>
+#include <ztd/text/detail/type_traits.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		//////
+		/// @brief Whether a buffering encoding iterator over @p _Range can fill its buffer ahead of time with the
+		/// bulk functions, throwing the result away whenever an error handler needs to get involved.
+		///
+		/// @remarks That needs an input which can be gone over more than once, and states which can be copied.
+		/// Otherwise, the buffer is filled one step at a time.
+		//////
+		template <typename _Range, typename... _States>
+		inline constexpr bool __is_speculatively_fillable_v
+			= __is_range_iterator_concept_or_better_v<::std::forward_iterator_tag, _Range>
+			&& ::std::is_copy_assignable_v<_Range>
+			&& (... && (::std::is_copy_constructible_v<_States> && ::std::is_copy_assignable_v<_States>));
+
+		template <__transaction _EncodeOrDecode, typename _Input, typename _Encoding, typename _Output,
+			typename _ErrorHandler, typename _State>
+		constexpr auto __encode_or_decode_into(_Input&& __input, _Encoding& __encoding, _Output&& __output,
+			_ErrorHandler& __error_handler, _State& __state) {
+			if constexpr (_EncodeOrDecode == __transaction::__decode) {
+				return decode_into(::std::forward<_Input>(__input), __encoding, ::std::forward<_Output>(__output),
+					__error_handler, __state);
+			}
+			else {
+				return encode_into(::std::forward<_Input>(__input), __encoding, ::std::forward<_Output>(__output),
+					__error_handler, __state);
+			}
+		}
+
+		//////
+		/// @brief Whether a speculative bulk operation that wrote @p __written values went through cleanly: either
+		/// all of the input was used, or it stopped only because the buffer was full.
+		//////
+		template <typename _Result>
+		constexpr bool __is_clean_fill(const _Result& __result, ::std::size_t __written, bool __read_input) noexcept {
+			return __written != 0
+				&& (__result.error_code == encoding_error::ok
+				     || (__result.error_code == encoding_error::insufficient_output_space && !__read_input));
+		}
+
+		//////
+		/// @brief The size to retry a speculative fill with, after one that wrote @p __written values into a
+		/// buffer of @p __limit values did not go through cleanly.
+		///
+		/// @remarks Everything before the failing step went through, so asking for just that much again stops right
+		/// in front of the failure without touching it. If the buffer was already full, the failing step was one
+		/// whose output did not fit, so ask for one less.
+		//////
+		constexpr ::std::size_t __retry_fill_limit(::std::size_t __written, ::std::size_t __limit) noexcept {
+			return __written < __limit ? __written : __written - 1;
+		}
+
+		//////
+		/// @brief Decodes or encodes as much of @p __range as fits into [ @p __buffer, @p __buffer + @p
+		/// __buffer_size ), then moves @p __range and @p __state past what was used.
+		///
+		/// @returns The number of values written.
+		///
+		/// @remarks The buffer is first filled with ztd::text::decode_into or ztd::text::encode_into (so that any
+		/// bulk extension points get used) with a copy of the state and an error handler that never fixes anything.
+		/// If that needed an error handler, it is retried once for just the part before the error. If nothing goes
+		/// through cleanly, a single step is done with the real error handler instead, exactly as an unbuffered
+		/// iterator would. Error handlers therefore see the same sequences, in the same order, as they would when
+		/// iterating one step at a time. @p __buffer_size must be at least the most values one step can produce.
+		//////
+		template <__transaction _EncodeOrDecode, typename _Range, typename _Encoding, typename _Value,
+			typename _ErrorHandler, typename _State>
+		constexpr ::std::size_t __fill_encoding_buffer(_Range& __range, _Encoding& __encoding, _Value* __buffer,
+			::std::size_t __buffer_size, _ErrorHandler& __error_handler, _State& __state) {
+			if constexpr (__is_speculatively_fillable_v<_Range, _State>) {
+				::std::size_t __limit = __buffer_size;
+				for (::std::size_t __attempt = 0; __attempt < 2 && __limit != 0; ++__attempt) {
+					bool __read_input = false;
+					__chunk_error_handler __chunk_handler(__read_input);
+					_State __chunk_state = __state;
+					auto __result        = __encode_or_decode_into<_EncodeOrDecode>(__range, __encoding,
+                              ::ztd::text::span<_Value>(__buffer, __limit), __chunk_handler, __chunk_state);
+					const ::std::size_t __written
+						= static_cast<::std::size_t>(__adl::__adl_data(__result.output) - __buffer);
+					if (__is_clean_fill(__result, __written, __read_input)) {
+						__range = __reconstruct(::std::in_place_type<_Range>, __adl::__adl_begin(__result.input),
+							__adl::__adl_end(__result.input));
+						__state = __chunk_state;
+						return __written;
+					}
+					__limit = __retry_fill_limit(__written, __limit);
+				}
+			}
+			::ztd::text::span<_Value> __step_output(__buffer, __buffer_size);
+			auto __result = __basic_encode_or_decode_one<__consume::__no, _EncodeOrDecode>(
+				__range, __encoding, __step_output, __error_handler, __state);
+			assert(__result.error_code == encoding_error::ok);
+			__range = ::std::move(__result.input);
+			return static_cast<::std::size_t>(
+				__adl::__adl_begin(__result.output) - __adl::__adl_begin(__step_output));
+		}
+
+		//////
+		/// @brief Transcodes as much of @p __range as fits into [ @p __buffer, @p __buffer + @p _BufferSize ), then
+		/// moves @p __range and the states past what was used.
+		///
+		/// @returns The number of code units written.
+		///
+		/// @remarks Works like ztd::text::__txt_detail::__fill_encoding_buffer: a block of code points is decoded
+		/// and then encoded speculatively (never more than the buffer is guaranteed to hold), and only a single step
+		/// is done with the real error handlers if that does not go through cleanly.
+		//////
+		template <::std::size_t _BufferSize, typename _Range, typename _FromEncoding, typename _ToEncoding,
+			typename _CodeUnit, typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState,
+			typename _ToState>
+		constexpr ::std::size_t __fill_transcode_buffer(_Range& __range, _FromEncoding& __from_encoding,
+			_ToEncoding& __to_encoding, _CodeUnit* __buffer, _FromErrorHandler& __from_error_handler,
+			_ToErrorHandler& __to_error_handler, _FromState& __from_state, _ToState& __to_state) {
+			using _UToEncoding           = __remove_cvref_t<_ToEncoding>;
+			using _IntermediateCodePoint = code_point_t<__remove_cvref_t<_FromEncoding>>;
+			constexpr ::std::size_t __code_point_limit = _BufferSize / max_code_units_v<_UToEncoding>;
+			if constexpr (__code_point_limit != 0 && __is_speculatively_fillable_v<_Range, _FromState, _ToState>) {
+				_IntermediateCodePoint __intermediate[__code_point_limit];
+				::std::size_t __limit = __code_point_limit;
+				for (::std::size_t __attempt = 0; __attempt < 2 && __limit != 0; ++__attempt) {
+					bool __read_input = false;
+					__chunk_error_handler __chunk_handler(__read_input);
+					_FromState __chunk_from_state = __from_state;
+					_ToState __chunk_to_state     = __to_state;
+					auto __decode_result          = decode_into(__range, __from_encoding,
+                              ::ztd::text::span<_IntermediateCodePoint>(__intermediate, __limit), __chunk_handler,
+                              __chunk_from_state);
+					::std::size_t __code_point_count
+						= static_cast<::std::size_t>(__adl::__adl_data(__decode_result.output) - __intermediate);
+					if (__is_clean_fill(__decode_result, __code_point_count, __read_input)) {
+						auto __encode_result = encode_into(
+							::ztd::text::span<const _IntermediateCodePoint>(__intermediate, __code_point_count),
+							__to_encoding, ::ztd::text::span<_CodeUnit>(__buffer, _BufferSize), __chunk_handler,
+							__chunk_to_state);
+						if (__encode_result.error_code == encoding_error::ok
+							&& __adl::__adl_empty(__encode_result.input)) {
+							__range      = __reconstruct(::std::in_place_type<_Range>,
+                                        __adl::__adl_begin(__decode_result.input),
+                                        __adl::__adl_end(__decode_result.input));
+							__from_state = __chunk_from_state;
+							__to_state   = __chunk_to_state;
+							return static_cast<::std::size_t>(
+								__adl::__adl_data(__encode_result.output) - __buffer);
+						}
+						// the code point that failed to encode was at most one before where the input stopped:
+						// only the ones before that are known to be fine
+						const ::std::size_t __encoded = __code_point_count
+							- static_cast<::std::size_t>(__adl::__adl_size(__encode_result.input));
+						__code_point_count = __encoded == 0 ? 0 : __encoded - 1;
+						__limit            = __code_point_count;
+						continue;
+					}
+					__limit = __retry_fill_limit(__code_point_count, __limit);
+				}
+			}
+			::ztd::text::span<_CodeUnit> __step_output(__buffer, _BufferSize);
+			auto __result = __basic_transcode_one<__consume::__no>(__range, __from_encoding, __step_output,
+				__to_encoding, __from_error_handler, __to_error_handler, __from_state, __to_state);
+			assert(__result.error_code == encoding_error::ok);
+			__range = ::std::move(__result.input);
+			return static_cast<::std::size_t>(
+				__adl::__adl_begin(__result.output) - __adl::__adl_begin(__step_output));
+		}
+
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#endif // ZTD_TEXT_DETAIL_ENCODING_ITERATOR_BUFFER_HPP
@@ -36,6 +36,7 @@
 #include <ztd/text/version.hpp>
 
 #include <ztd/text/state.hpp>
+#include <ztd/text/code_unit.hpp>
 
 #include <ztd/text/detail/range.hpp>
 #include <ztd/text/detail/ebco.hpp>
@@ -68,7 +69,7 @@ namespace ztd { namespace text {
 				::std::enable_if_t<
 				     is_state_independent_v<__remove_cvref_t<_ArgEncoding>,
 				          _UEncodingState> && !::std::is_same_v<__remove_cvref_t<_ArgEncoding>, __state_storage>>* = nullptr>
-			constexpr __state_storage(_ArgEncoding& __encoding) noexcept(
+			constexpr __state_storage(_ArgEncoding&) noexcept(
 				::std::is_nothrow_default_constructible_v<__state_base_t>)
 			: __state_base_t() {
 			}
@@ -109,6 +110,27 @@ namespace ztd { namespace text {
 		template <>
 		class __cache_cursor<1> { };
 
+		//////
+		/// @brief The number of values held by the cache of an encoding iterator: enough for one step producing at
+		/// most @p _StepMaxValues values, or @p _BufferSize values if that is more.
+		//////
+		template <::std::size_t _StepMaxValues, ::std::size_t _BufferSize>
+		inline constexpr ::std::size_t __cache_size_v = _StepMaxValues < _BufferSize ? _BufferSize : _StepMaxValues;
+
+		//////
+		/// @brief The cursor into a cache of @p _CacheSize values. A buffering iterator (one with a non-zero @p
+		/// _BufferSize) always keeps a position and size, even if its cache only holds a single value.
+		//////
+		template <::std::size_t _CacheSize, ::std::size_t _BufferSize>
+		using __cache_cursor_for_t = __cache_cursor<(_BufferSize != 0 && _CacheSize == 1) ? 2 : _CacheSize>;
+
+		//////
+		/// @brief The cache cursor for an iterator which produces the code units (or code points) of @p _Encoding.
+		//////
+		template <typename _Encoding, ::std::size_t _BufferSize>
+		using __encoding_cache_cursor_t = __cache_cursor_for_t<
+			__cache_size_v<max_code_units_v<__remove_cvref_t<__unwrap_t<_Encoding>>>, _BufferSize>, _BufferSize>;
+
 	} // namespace __txt_detail
 	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
 }} // namespace ztd::text
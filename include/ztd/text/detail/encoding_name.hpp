@@ -42,6 +42,8 @@
 #include <ztd/text/ascii.hpp>
 #include <ztd/text/no_encoding.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <string_view>
 
 namespace ztd { namespace text {
@@ -49,62 +51,98 @@ namespace ztd { namespace text {
 
 	namespace __txt_detail {
 
+		//////
+		/// @brief Maps every byte to its upper-case form if it is a letter or a digit, and to @c 0 otherwise, so that
+		/// encoding names compare without regard to case, spacing or punctuation.
+		//////
+		struct __encoding_name_fold_table {
+			char _M_folded[256];
+
+			constexpr __encoding_name_fold_table() noexcept : _M_folded() {
+				constexpr ::std::string_view __uncased_characters = "abcdefghijklmnopqrstuvwxyz";
+				constexpr ::std::string_view __cased_characters   = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+				constexpr ::std::string_view __digit_characters   = "0123456789";
+				for (::std::size_t __index = 0; __index < __cased_characters.size(); ++__index) {
+					this->_M_folded[static_cast<unsigned char>(__uncased_characters[__index])]
+						= __cased_characters[__index];
+					this->_M_folded[static_cast<unsigned char>(__cased_characters[__index])]
+						= __cased_characters[__index];
+				}
+				for (::std::size_t __index = 0; __index < __digit_characters.size(); ++__index) {
+					this->_M_folded[static_cast<unsigned char>(__digit_characters[__index])]
+						= __digit_characters[__index];
+				}
+			}
+		};
+
+		inline constexpr __encoding_name_fold_table __encoding_name_folds {};
+
+		inline constexpr char __encoding_name_fold(char __c) noexcept {
+			return __encoding_name_folds._M_folded[static_cast<unsigned char>(__c)];
+		}
+
 		inline constexpr bool __is_encoding_name_equal(
 			::std::string_view __left, ::std::string_view __right) noexcept {
-			constexpr std::string_view __readable_characters
-				= "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuuvwxyz1234567890";
-			constexpr std::string_view __uncased_characters = "abcdefghijklmnopqrstuuvwxyz";
-			constexpr std::string_view __cased_characters   = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
-			::std::size_t __left_size                       = __left.size();
-			::std::size_t __right_size                      = __right.size();
-			const char* __left_ptr                          = __left.data();
-			const char* __right_ptr                         = __right.data();
-			::std::size_t __left_index                      = 0;
-			::std::size_t __right_index                     = 0;
-			for (; __left_index < __left_size && __right_index < __right_size;) {
-				// find the first non-ignorable character we can read
-				::std::size_t __left_first_index = __left.find_first_of(__readable_characters, __left_index);
-				if (__left_first_index == ::std::string_view::npos) {
-					return __left_index == __right_index;
-				}
-				__left_index                      = __left_first_index + 1;
-				::std::size_t __right_first_index = __right.find_first_of(__readable_characters, __right_index);
-				if (__right_first_index == ::std::string_view::npos) {
-					return __left_index == __right_index;
+			::std::size_t __left_size   = __left.size();
+			::std::size_t __right_size  = __right.size();
+			::std::size_t __left_index  = 0;
+			::std::size_t __right_index = 0;
+			for (;;) {
+				// find the first non-ignorable character we can read on each side
+				char __left_c = '\0';
+				for (; __left_index < __left_size && __left_c == '\0'; ++__left_index) {
+					__left_c = __encoding_name_fold(__left[__left_index]);
 				}
-				__right_index  = __right_first_index + 1;
-				char __left_c  = __left_ptr[__left_first_index];
-				char __right_c = __right_ptr[__right_first_index];
-				// make sure we eliminate casing differences
-				::std::size_t __left_c_casing_index = __uncased_characters.find(__left_c);
-				if (__left_c_casing_index != ::std::string_view::npos) {
-					__left_c = __cased_characters[__left_c_casing_index];
+				char __right_c = '\0';
+				for (; __right_index < __right_size && __right_c == '\0'; ++__right_index) {
+					__right_c = __encoding_name_fold(__right[__right_index]);
 				}
-				::std::size_t __right_c_casing_index = __uncased_characters.find(__right_c);
-				if (__right_c_casing_index != ::std::string_view::npos) {
-					__right_c = __cased_characters[__right_c_casing_index];
+				// both names have to run out at the same time: "UTF-16" is not "UTF-16LE"
+				if (__left_c != __right_c) {
+					return false;
 				}
-				// finally, check
-				if (__left_c == __right_c) {
-					continue;
+				if (__left_c == '\0') {
+					return true;
 				}
-				return false;
 			}
-			return true;
 		}
 
-		inline constexpr bool __is_unicode_encoding_name(std::string_view __encoding_name) noexcept {
-			constexpr const char* __unicode_names[]
-				= { "UTF-7", "UTF-7-IMAP", "UTF-8", "UTF-16", "UTF-32", "UTF-16LE", "UTF-16BE", "UTF-32LE",
-					  "UTF-32BE", "UTF-EBCDIC", "UTF-8-EBCDIC", "MUTF-8", "WTF-8", "GB18030", "CESU-8", "UTF-1" };
-			constexpr ::std::size_t __unicode_names_count = sizeof(__unicode_names) / sizeof(__unicode_names[0]);
-			for (::std::size_t __index = 0; __index < __unicode_names_count; ++__index) {
-				std::string_view __unicode_name = __unicode_names[__index];
-				if (__is_encoding_name_equal(__encoding_name, __unicode_name)) {
-					return true;
+		//////
+		/// @brief Hashes the folded form of an encoding name (see ztd::text::__txt_detail::__encoding_name_fold), so
+		/// that every name which compares equal with ztd::text::__txt_detail::__is_encoding_name_equal hashes the
+		/// same. This is the only pass over the name a lookup makes before the final comparison.
+		//////
+		inline constexpr ::std::uint_least64_t __encoding_name_hash(::std::string_view __name) noexcept {
+			// 64-bit FNV-1a
+			::std::uint_least64_t __hash = UINT64_C(14695981039346656037);
+			for (char __c : __name) {
+				char __folded = __encoding_name_fold(__c);
+				if (__folded == '\0') {
+					continue;
 				}
+				__hash ^= static_cast<unsigned char>(__folded);
+				__hash *= UINT64_C(1099511628211);
 			}
-			return false;
+			return __hash;
+		}
+
+		//////
+		/// @brief Turns a name's hash into a table index for one member of a family of hash functions.
+		///
+		/// @param[in] __hash The hash from ztd::text::__txt_detail::__encoding_name_hash.
+		/// @param[in] __seed Picks the member of the family: @c 0 picks the bucket, anything else a slot.
+		/// @param[in] __mask The table size, minus one.
+		//////
+		inline constexpr ::std::size_t __encoding_name_index(
+			::std::uint_least64_t __hash, ::std::uint_least32_t __seed, ::std::size_t __mask) noexcept {
+			// a 64-bit finalizer (from MurmurHash3), so the low bits we index with depend on every bit of the hash
+			__hash ^= __seed * UINT64_C(0x9E3779B97F4A7C15);
+			__hash ^= __hash >> 33;
+			__hash *= UINT64_C(0xFF51AFD7ED558CCD);
+			__hash ^= __hash >> 33;
+			__hash *= UINT64_C(0xC4CEB9FE1A85EC53);
+			__hash ^= __hash >> 33;
+			return static_cast<::std::size_t>(__hash) & __mask;
 		}
 
 		enum class __encoding_id {
@@ -127,61 +165,149 @@ namespace ztd { namespace text {
 			__ascii
 		};
 
-		inline constexpr __encoding_id __to_encoding_id(::std::string_view __name) {
-			if (__is_encoding_name_equal(__name, "UTF-8")) {
-				return __encoding_id::__utf8;
-			}
-			else if (__is_encoding_name_equal(__name, "UTF-16") || __is_encoding_name_equal(__name, "UCS-2-INTERNAL")
-				|| __is_encoding_name_equal(__name, "UCS-2")) {
-				return __encoding_id::__utf16;
-			}
-			else if (__is_encoding_name_equal(__name, "UTF-16LE")
-				|| __is_encoding_name_equal(__name, "UCS-2LE-INTERNAL")
-				|| __is_encoding_name_equal(__name, "UCS-2LE")) {
-				return __encoding_id::__utf16le;
-			}
-			else if (__is_encoding_name_equal(__name, "UTF-16BE")
-				|| __is_encoding_name_equal(__name, "UCS-2BE-INTERNAL")
-				|| __is_encoding_name_equal(__name, "UCS-2BE")) {
-				return __encoding_id::__utf16be;
-			}
-			else if (__is_encoding_name_equal(__name, "UTF-32") || __is_encoding_name_equal(__name, "UCS-4-INTERNAL")
-				|| __is_encoding_name_equal(__name, "UCS-4")) {
-				return __encoding_id::__utf32;
-			}
-			else if (__is_encoding_name_equal(__name, "UTF-32LE")
-				|| __is_encoding_name_equal(__name, "UCS-4LE-INTERNAL")
-				|| __is_encoding_name_equal(__name, "UCS-4LE")) {
-				return __encoding_id::__utf32le;
-			}
-			else if (__is_encoding_name_equal(__name, "UTF-32BE")
-				|| __is_encoding_name_equal(__name, "UCS-4BE-INTERNAL")
-				|| __is_encoding_name_equal(__name, "UCS-4BE")) {
-				return __encoding_id::__utf32be;
-			}
-			else if (__is_encoding_name_equal(__name, "ASCII")
-				|| __is_encoding_name_equal(__name, "ANSI_X3.4-1968")) {
-				return __encoding_id::__ascii;
-			}
-			else if (__is_encoding_name_equal(__name, "UTF-EBCDIC")
-				|| __is_encoding_name_equal(__name, "UTF-8-EBCDIC")) {
-				return __encoding_id::__utfebcdic;
-			}
-			else if (__is_encoding_name_equal(__name, "WTF-8")) {
-				return __encoding_id::__wtf8;
-			}
-			else if (__is_encoding_name_equal(__name, "MUTF-8")) {
-				return __encoding_id::__mutf8;
-			}
-			else if (__is_encoding_name_equal(__name, "UTF-7")) {
-				return __encoding_id::__utf7;
+		struct __encoding_alias {
+			::std::string_view _M_name;
+			__encoding_id _M_id;
+		};
+
+		//////
+		/// @brief Every name (canonical, IANA and common platform aliases) recognized for the encodings in
+		/// ztd::text::__txt_detail::__encoding_id.
+		//////
+		inline constexpr __encoding_alias __encoding_aliases[] = {
+			{ "UTF-8", __encoding_id::__utf8 },
+			{ "csUTF8", __encoding_id::__utf8 },
+			{ "unicode-1-1-utf-8", __encoding_id::__utf8 },
+			{ "unicode20utf8", __encoding_id::__utf8 },
+			{ "x-unicode20utf8", __encoding_id::__utf8 },
+			{ "CP65001", __encoding_id::__utf8 },
+			{ "UTF-16", __encoding_id::__utf16 },
+			{ "csUTF16", __encoding_id::__utf16 },
+			{ "UCS-2", __encoding_id::__utf16 },
+			{ "UCS-2-INTERNAL", __encoding_id::__utf16 },
+			{ "ISO-10646-UCS-2", __encoding_id::__utf16 },
+			{ "csUnicode", __encoding_id::__utf16 },
+			{ "UTF-16LE", __encoding_id::__utf16le },
+			{ "csUTF16LE", __encoding_id::__utf16le },
+			{ "UCS-2LE", __encoding_id::__utf16le },
+			{ "UCS-2LE-INTERNAL", __encoding_id::__utf16le },
+			{ "UTF-16BE", __encoding_id::__utf16be },
+			{ "csUTF16BE", __encoding_id::__utf16be },
+			{ "UCS-2BE", __encoding_id::__utf16be },
+			{ "UCS-2BE-INTERNAL", __encoding_id::__utf16be },
+			{ "UTF-32", __encoding_id::__utf32 },
+			{ "csUTF32", __encoding_id::__utf32 },
+			{ "UCS-4", __encoding_id::__utf32 },
+			{ "UCS-4-INTERNAL", __encoding_id::__utf32 },
+			{ "ISO-10646-UCS-4", __encoding_id::__utf32 },
+			{ "csUCS4", __encoding_id::__utf32 },
+			{ "UTF-32LE", __encoding_id::__utf32le },
+			{ "csUTF32LE", __encoding_id::__utf32le },
+			{ "UCS-4LE", __encoding_id::__utf32le },
+			{ "UCS-4LE-INTERNAL", __encoding_id::__utf32le },
+			{ "UTF-32BE", __encoding_id::__utf32be },
+			{ "csUTF32BE", __encoding_id::__utf32be },
+			{ "UCS-4BE", __encoding_id::__utf32be },
+			{ "UCS-4BE-INTERNAL", __encoding_id::__utf32be },
+			{ "ASCII", __encoding_id::__ascii },
+			{ "US-ASCII", __encoding_id::__ascii },
+			{ "csASCII", __encoding_id::__ascii },
+			{ "ANSI_X3.4-1968", __encoding_id::__ascii },
+			{ "ANSI_X3.4-1986", __encoding_id::__ascii },
+			{ "ISO646-US", __encoding_id::__ascii },
+			{ "ISO_646.irv:1991", __encoding_id::__ascii },
+			{ "iso-ir-6", __encoding_id::__ascii },
+			{ "IBM367", __encoding_id::__ascii },
+			{ "cp367", __encoding_id::__ascii },
+			{ "us", __encoding_id::__ascii },
+			{ "646", __encoding_id::__ascii },
+			{ "UTF-EBCDIC", __encoding_id::__utfebcdic },
+			{ "UTF-8-EBCDIC", __encoding_id::__utfebcdic },
+			{ "WTF-8", __encoding_id::__wtf8 },
+			{ "MUTF-8", __encoding_id::__mutf8 },
+			{ "UTF-7", __encoding_id::__utf7 },
+			{ "csUTF7", __encoding_id::__utf7 },
+			{ "unicode-1-1-utf-7", __encoding_id::__utf7 },
+			{ "UTF-7-IMAP", __encoding_id::__utf7imap },
+			{ "GB18030", __encoding_id::__gb18030 },
+			{ "csGB18030", __encoding_id::__gb18030 },
+			{ "CESU-8", __encoding_id::__cesu8 },
+			{ "csCESU8", __encoding_id::__cesu8 },
+			{ "UTF-1", __encoding_id::__utf1 },
+			{ "ISO-10646-UTF-1", __encoding_id::__utf1 },
+			{ "csISO10646UTF1", __encoding_id::__utf1 },
+		};
+
+		inline constexpr ::std::size_t __encoding_aliases_size
+			= sizeof(__encoding_aliases) / sizeof(__encoding_aliases[0]);
+
+		//////
+		/// @brief The perfect hash over ztd::text::__txt_detail::__encoding_aliases, made with hash-and-displace: a
+		/// name's bucket is ztd::text::__txt_detail::__encoding_name_index with seed @c 0, and its slot is the index
+		/// with the seed kept for that bucket.
+		///
+		/// @remarks These tables are generated rather than written by hand. When the aliases change, the
+		/// "text/detail/encoding_name/hash" test fails and prints the new tables to paste in here.
+		//////
+		inline constexpr ::std::size_t __encoding_alias_table_size = 128;
+
+		inline constexpr ::std::uint_least16_t __encoding_alias_seeds[__encoding_alias_table_size] = {
+			0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+			0, 0, 0, 0, 0, 3, 1, 0, 0, 1, 1, 1, 0, 0, 0, 0,
+			0, 2, 0, 0, 1, 0, 0, 1, 1, 1, 1, 0, 3, 0, 1, 2,
+			0, 0, 1, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1,
+			0, 0, 1, 1, 0, 0, 1, 0, 0, 1, 3, 0, 1, 0, 0, 0,
+			0, 0, 1, 1, 1, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 2,
+			3, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 2, 0, 1, 2, 1,
+			3, 0, 0, 0, 2, 0, 5, 0, 0, 1, 1, 0, 0, 0, 0, 2,
+		};
+
+		//////
+		/// @brief The index of the alias kept in each slot of the perfect hash, or
+		/// ztd::text::__txt_detail::__encoding_aliases_size for an empty slot.
+		//////
+		inline constexpr ::std::uint_least8_t __encoding_alias_slots[__encoding_alias_table_size] = {
+			5, 61, 49, 51, 61, 55, 43, 20, 61, 61, 31, 46, 61, 61, 61, 39,
+			61, 24, 61, 61, 17, 19, 8, 61, 28, 61, 1, 15, 61, 61, 42, 38,
+			61, 61, 61, 48, 32, 61, 61, 61, 50, 33, 61, 0, 61, 61, 61, 61,
+			61, 37, 61, 61, 61, 61, 61, 61, 61, 29, 61, 61, 14, 61, 61, 54,
+			21, 6, 53, 22, 61, 44, 57, 13, 61, 35, 60, 18, 58, 61, 61, 61,
+			16, 4, 61, 30, 61, 61, 36, 45, 26, 61, 61, 9, 12, 61, 61, 41,
+			61, 61, 61, 2, 61, 3, 40, 61, 61, 34, 27, 59, 61, 10, 47, 61,
+			7, 61, 61, 52, 61, 61, 61, 61, 56, 23, 25, 61, 61, 61, 11, 61,
+		};
+
+		inline constexpr ::std::size_t __find_encoding_alias(::std::string_view __name) noexcept {
+			constexpr ::std::size_t __mask = __encoding_alias_table_size - 1;
+			::std::uint_least64_t __hash   = __encoding_name_hash(__name);
+			::std::uint_least16_t __seed   = __encoding_alias_seeds[__encoding_name_index(__hash, 0, __mask)];
+			::std::size_t __index          = __encoding_alias_slots[__encoding_name_index(__hash, __seed, __mask)];
+			if (__index != __encoding_aliases_size
+				&& __is_encoding_name_equal(__name, __encoding_aliases[__index]._M_name)) {
+				return __index;
 			}
-			else if (__is_encoding_name_equal(__name, "UTF-7-IMAP")) {
-				return __encoding_id::__utf7imap;
+			return __encoding_aliases_size;
+		}
+
+		inline constexpr bool __is_encoding_alias_hash_current() noexcept {
+			for (::std::size_t __index = 0; __index < __encoding_aliases_size; ++__index) {
+				if (__find_encoding_alias(__encoding_aliases[__index]._M_name) != __index) {
+					return false;
+				}
 			}
-			else {
+			return true;
+		}
+
+		static_assert(__is_encoding_alias_hash_current(),
+			"the encoding alias hash tables are out of date: run the text/detail/encoding_name/hash test and paste "
+			"in the tables it prints");
+
+		inline constexpr __encoding_id __to_encoding_id(::std::string_view __name) noexcept {
+			::std::size_t __index = __find_encoding_alias(__name);
+			if (__index == __encoding_aliases_size) {
 				return __encoding_id::__unknown;
 			}
+			return __encoding_aliases[__index]._M_id;
 		}
 
 		inline constexpr bool __is_unicode_encoding_id(__encoding_id __id) noexcept {
@@ -209,6 +335,10 @@ namespace ztd { namespace text {
 			}
 		}
 
+		inline constexpr bool __is_unicode_encoding_name(::std::string_view __encoding_name) noexcept {
+			return __is_unicode_encoding_id(__to_encoding_id(__encoding_name));
+		}
+
 		template <typename _CharType, __encoding_id _Id>
 		constexpr auto __select_encoding() {
 			if constexpr (_Id == __encoding_id::__utf8) {
@@ -224,23 +354,44 @@ namespace ztd { namespace text {
 				return basic_utf16<_CharType> {};
 			}
 			else if constexpr (_Id == __encoding_id::__utf16le) {
-				// TODO: beef up encoding_scheme to handle this better...!
-				return basic_utf16_le<_CharType> {};
+				// code units in native byte order are just the plain encoding
+				if constexpr (endian::native == endian::little) {
+					return basic_utf16<_CharType> {};
+				}
+				else {
+					// TODO: beef up encoding_scheme to handle this better...!
+					return basic_utf16_le<_CharType> {};
+				}
 			}
 			else if constexpr (_Id == __encoding_id::__utf16be) {
-				// TODO: beef up encoding_scheme to handle this better...!
-				return basic_utf16_be<_CharType> {};
+				if constexpr (endian::native == endian::big) {
+					return basic_utf16<_CharType> {};
+				}
+				else {
+					// TODO: beef up encoding_scheme to handle this better...!
+					return basic_utf16_be<_CharType> {};
+				}
 			}
 			else if constexpr (_Id == __encoding_id::__utf32) {
 				return basic_utf32<_CharType> {};
 			}
 			else if constexpr (_Id == __encoding_id::__utf32le) {
-				// TODO: beef up encoding_scheme to handle this better...!
-				return basic_utf32_le<_CharType> {};
+				if constexpr (endian::native == endian::little) {
+					return basic_utf32<_CharType> {};
+				}
+				else {
+					// TODO: beef up encoding_scheme to handle this better...!
+					return basic_utf32_le<_CharType> {};
+				}
 			}
 			else if constexpr (_Id == __encoding_id::__utf32be) {
-				// TODO: beef up encoding_scheme to handle this better...!
-				return basic_utf32_be<_CharType> {};
+				if constexpr (endian::native == endian::big) {
+					return basic_utf32<_CharType> {};
+				}
+				else {
+					// TODO: beef up encoding_scheme to handle this better...!
+					return basic_utf32_be<_CharType> {};
+				}
 			}
 			else if constexpr (_Id == __encoding_id::__ascii) {
 				return basic_ascii<_CharType> {};
@@ -95,6 +95,19 @@ namespace ztd { namespace text {
 			= decltype(__text_count_code_units(tag<__remove_cvref_t<_Encoding>> {}, ::std::declval<_Input>(),
 			     ::std::declval<_Encoding>(), ::std::declval<_Handler>(), ::std::declval<_State&>()));
 
+		// counting: transcoded code units
+		template <typename _Input, typename _FromEncoding, typename _ToEncoding>
+		using __detect_adl_internal_text_count_transcoded = decltype(__text_count_transcoded(
+			tag<__remove_cvref_t<_FromEncoding>, __remove_cvref_t<_ToEncoding>> {}, ::std::declval<_Input>(),
+			::std::declval<_FromEncoding>(), ::std::declval<_ToEncoding>()));
+
+		// splitting: code unit boundaries
+		template <typename _Encoding, typename _CodeUnit>
+		using __detect_adl_internal_text_code_unit_boundary
+			= decltype(__text_code_unit_boundary(tag<__remove_cvref_t<_Encoding>> {},
+			     ::std::declval<const _CodeUnit*>(), ::std::declval<const _CodeUnit*>(),
+			     ::std::declval<const _CodeUnit*>()));
+
 		// counting: encode
 		template <typename _Encoding, typename _Input, typename _Handler, typename _State>
 		using __detect_object_count_code_points_one = decltype(::std::declval<_Encoding>().count_code_points_one(
@@ -107,8 +120,8 @@ namespace ztd { namespace text {
 
 		template <typename _Input, typename _Encoding, typename _Handler, typename _State>
 		using __detect_adl_internal_text_count_code_points
-			= decltype(__text_count_code_points(::std::declval<_Input>(), ::std::declval<_Encoding>(),
-			     ::std::declval<_Handler>(), ::std::declval<_State&>()));
+			= decltype(__text_count_code_points(tag<__remove_cvref_t<_Encoding>> {}, ::std::declval<_Input>(),
+			     ::std::declval<_Encoding>(), ::std::declval<_Handler>(), ::std::declval<_State&>()));
 
 
 		// decode
@@ -118,7 +131,7 @@ namespace ztd { namespace text {
 
 		template <typename _Encoding, typename _Input, typename _Output, typename _Handler, typename _State>
 		using __detect_object_decode_one_backwards
-			= decltype(::std::declval<_Encoding>().decode_one_backwards(::std::declval<_Input>(),
+			= decltype(::std::declval<_Encoding>().decode_one_backward(::std::declval<_Input>(),
 			     ::std::declval<_Output>(), ::std::declval<_Handler>(), ::std::declval<_State&>()));
 
 		template <typename _Input, typename _Encoding, typename _Output, typename _Handler, typename _State>
@@ -138,7 +151,7 @@ namespace ztd { namespace text {
 
 		template <typename _Encoding, typename _Input, typename _Output, typename _Handler, typename _State>
 		using __detect_object_encode_one_backwards
-			= decltype(::std::declval<_Encoding>().encode_one_backwards(::std::declval<_Input>(),
+			= decltype(::std::declval<_Encoding>().encode_one_backward(::std::declval<_Input>(),
 			     ::std::declval<_Output>(), ::std::declval<_Handler>(), ::std::declval<_State&>()));
 
 		template <typename _Input, typename _Encoding, typename _Output, typename _Handler, typename _State>
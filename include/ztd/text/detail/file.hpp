@@ -0,0 +1,379 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_FILE_HPP
+#define ZTD_TEXT_DETAIL_FILE_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <system_error>
+
+// clang-format off
+
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_MEMORY_MAPPED_FILES_I_)
+extern "C" {
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+}
+#else
+#include <cstdio>
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_PLATFORM_WINDOWS_I_)
+#include <ztd/text/detail/windows.hpp>
+extern "C" {
+#include <io.h>
+}
+#elif ZTD_TEXT_IS_ON(ZTD_TEXT_PLATFORM_UNIX_I_)
+extern "C" {
+#include <sys/stat.h>
+}
+#endif
+#endif
+
+// clang-format on
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		inline ::std::error_code __last_file_error() noexcept {
+			return ::std::error_code(errno, ::std::generic_category());
+		}
+
+		//////
+		/// @brief A file opened for reading or writing bytes, closed on destruction.
+		///
+		/// @remarks This is a file descriptor where files can be memory-mapped, and a @c std::FILE otherwise.
+		//////
+		class __file {
+		public:
+			__file() noexcept = default;
+			__file(const __file&) = delete;
+			__file& operator=(const __file&) = delete;
+
+			~__file() {
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_MEMORY_MAPPED_FILES_I_)
+				if (this->_M_handle != -1) {
+					::close(this->_M_handle);
+				}
+#else
+				if (this->_M_handle != nullptr) {
+					::std::fclose(this->_M_handle);
+				}
+#endif
+			}
+
+			bool __open_read(const char* __path, ::std::error_code& __error) noexcept {
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_MEMORY_MAPPED_FILES_I_)
+				this->_M_handle = ::open(__path, O_RDONLY | O_CLOEXEC);
+				if (this->_M_handle == -1) {
+#else
+				this->_M_handle = ::std::fopen(__path, "rb");
+				if (this->_M_handle == nullptr) {
+#endif
+					__error = __last_file_error();
+					return false;
+				}
+				return true;
+			}
+
+			//////
+			/// @brief Opens the file at @p __path for writing, creating it if needed. What is already in it is
+			/// kept until ztd::text::__txt_detail::__file::__clear is called, so it can be checked against the input
+			/// first.
+			//////
+			bool __open_write(const char* __path, ::std::error_code& __error) noexcept {
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_MEMORY_MAPPED_FILES_I_)
+				// read access as well, as a shared writable mapping of the file needs it
+				this->_M_handle = ::open(__path, O_RDWR | O_CREAT | O_CLOEXEC, 0666);
+				if (this->_M_handle == -1) {
+#else
+				this->_M_handle = ::std::fopen(__path, "ab");
+				if (this->_M_handle == nullptr) {
+#endif
+					__error = __last_file_error();
+					return false;
+				}
+				return true;
+			}
+
+			//////
+			/// @brief Whether this and @p __other are the same file, under any name. Where that cannot be found out,
+			/// they are taken to be different files.
+			//////
+			bool __is_same_file(const __file& __other) const noexcept {
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_MEMORY_MAPPED_FILES_I_) || ZTD_TEXT_IS_ON(ZTD_TEXT_PLATFORM_UNIX_I_)
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_MEMORY_MAPPED_FILES_I_)
+				int __handle       = this->_M_handle;
+				int __other_handle = __other._M_handle;
+#else
+				int __handle       = ::fileno(this->_M_handle);
+				int __other_handle = ::fileno(__other._M_handle);
+#endif
+				struct ::stat __status {}, __other_status {};
+				if (::fstat(__handle, &__status) != 0 || ::fstat(__other_handle, &__other_status) != 0) {
+					return false;
+				}
+				return __status.st_dev == __other_status.st_dev && __status.st_ino == __other_status.st_ino;
+#elif ZTD_TEXT_IS_ON(ZTD_TEXT_PLATFORM_WINDOWS_I_)
+				::HANDLE __handle       = reinterpret_cast<::HANDLE>(::_get_osfhandle(::_fileno(this->_M_handle)));
+				::HANDLE __other_handle
+					= reinterpret_cast<::HANDLE>(::_get_osfhandle(::_fileno(__other._M_handle)));
+				::BY_HANDLE_FILE_INFORMATION __information {}, __other_information {};
+				if (!::GetFileInformationByHandle(__handle, &__information)
+				     || !::GetFileInformationByHandle(__other_handle, &__other_information)) {
+					return false;
+				}
+				return __information.dwVolumeSerialNumber == __other_information.dwVolumeSerialNumber
+				     && __information.nFileIndexHigh == __other_information.nFileIndexHigh
+				     && __information.nFileIndexLow == __other_information.nFileIndexLow;
+#else
+				(void)__other;
+				return false;
+#endif
+			}
+
+			//////
+			/// @brief Throws away everything in a file opened with ztd::text::__txt_detail::__file::__open_write .
+			//////
+			bool __clear(const char* __path, ::std::error_code& __error) noexcept {
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_MEMORY_MAPPED_FILES_I_)
+				(void)__path;
+				return this->__resize(0, __error);
+#else
+				this->_M_handle = ::std::freopen(__path, "wb", this->_M_handle);
+				if (this->_M_handle == nullptr) {
+					__error = __last_file_error();
+					return false;
+				}
+				return true;
+#endif
+			}
+
+			//////
+			/// @brief Reads up to @p __size bytes, setting @p __read to how many were read. Fewer than @p __size bytes
+			/// are only read at the end of the file.
+			//////
+			bool __read(void* __data, ::std::size_t __size, ::std::size_t& __read, ::std::error_code& __error) noexcept {
+				__read = 0;
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_MEMORY_MAPPED_FILES_I_)
+				while (__read < __size) {
+					::ssize_t __result = ::read(this->_M_handle, static_cast<char*>(__data) + __read, __size - __read);
+					if (__result == 0) {
+						break;
+					}
+					if (__result < 0) {
+						if (errno == EINTR) {
+							continue;
+						}
+						__error = __last_file_error();
+						return false;
+					}
+					__read += static_cast<::std::size_t>(__result);
+				}
+#else
+				__read = ::std::fread(__data, 1, __size, this->_M_handle);
+				if (__read < __size && ::std::ferror(this->_M_handle)) {
+					__error = __last_file_error();
+					return false;
+				}
+#endif
+				return true;
+			}
+
+			bool __write(const void* __data, ::std::size_t __size, ::std::error_code& __error) noexcept {
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_MEMORY_MAPPED_FILES_I_)
+				for (::std::size_t __written = 0; __written < __size;) {
+					::ssize_t __result
+						= ::write(this->_M_handle, static_cast<const char*>(__data) + __written, __size - __written);
+					if (__result < 0) {
+						if (errno == EINTR) {
+							continue;
+						}
+						__error = __last_file_error();
+						return false;
+					}
+					__written += static_cast<::std::size_t>(__result);
+				}
+#else
+				if (::std::fwrite(__data, 1, __size, this->_M_handle) != __size) {
+					__error = __last_file_error();
+					return false;
+				}
+#endif
+				return true;
+			}
+
+			//////
+			/// @brief Flushes and closes the file, reporting any error that only shows up then.
+			//////
+			bool __close(::std::error_code& __error) noexcept {
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_MEMORY_MAPPED_FILES_I_)
+				int __result    = ::close(this->_M_handle);
+				this->_M_handle = -1;
+#else
+				int __result    = ::std::fclose(this->_M_handle);
+				this->_M_handle = nullptr;
+#endif
+				if (__result != 0) {
+					__error = __last_file_error();
+					return false;
+				}
+				return true;
+			}
+
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_MEMORY_MAPPED_FILES_I_)
+			//////
+			/// @brief Gets the size of the file, if it is a regular file (and not, e.g., a pipe or a terminal).
+			//////
+			bool __regular_size(::std::size_t& __size) const noexcept {
+				struct ::stat __status {};
+				if (::fstat(this->_M_handle, &__status) != 0 || !S_ISREG(__status.st_mode)) {
+					return false;
+				}
+				__size = static_cast<::std::size_t>(__status.st_size);
+				return true;
+			}
+
+			//////
+			/// @brief Makes the file @p __size bytes long, allocating its storage up-front where that is possible so
+			/// that writing through a mapping cannot run out of disk space part of the way through.
+			//////
+			bool __reserve(::std::size_t __size, ::std::error_code& __error) noexcept {
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_PLATFORM_LINUX_I_)
+				int __result = ::posix_fallocate(this->_M_handle, 0, static_cast<::off_t>(__size));
+				if (__result == 0) {
+					return true;
+				}
+				if (__result != EINVAL && __result != EOPNOTSUPP) {
+					__error = ::std::error_code(__result, ::std::generic_category());
+					return false;
+				}
+				// the file system cannot allocate ahead of time: just set the size
+#endif
+				return this->__resize(__size, __error);
+			}
+
+			bool __resize(::std::size_t __size, ::std::error_code& __error) noexcept {
+				if (::ftruncate(this->_M_handle, static_cast<::off_t>(__size)) != 0) {
+					__error = __last_file_error();
+					return false;
+				}
+				return true;
+			}
+
+			int __handle() const noexcept {
+				return this->_M_handle;
+			}
+
+		private:
+			int _M_handle = -1;
+#else
+		private:
+			::std::FILE* _M_handle = nullptr;
+#endif
+		};
+
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_MEMORY_MAPPED_FILES_I_)
+		inline ::std::size_t __file_page_size() noexcept {
+			static const ::std::size_t __page_size = []() noexcept {
+				long __size = ::sysconf(_SC_PAGESIZE);
+				return __size > 0 ? static_cast<::std::size_t>(__size) : static_cast<::std::size_t>(4096);
+			}();
+			return __page_size;
+		}
+
+		//////
+		/// @brief A view of part of a ztd::text::__txt_detail::__file mapped into memory, unmapped on destruction or
+		/// when another part is mapped.
+		//////
+		class __file_mapping {
+		public:
+			__file_mapping() noexcept = default;
+			__file_mapping(const __file_mapping&) = delete;
+			__file_mapping& operator=(const __file_mapping&) = delete;
+
+			~__file_mapping() {
+				this->__unmap();
+			}
+
+			//////
+			/// @brief Maps @p __size bytes of @p __file , starting at @p __offset (which must be a multiple of the
+			/// page size), and tells the system they will be gone through once, from front to back.
+			//////
+			bool __map(const __file& __file, ::std::size_t __offset, ::std::size_t __size, bool __writable,
+				::std::error_code& __error) noexcept {
+				this->__unmap();
+				void* __data = ::mmap(nullptr, __size, __writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED,
+					__file.__handle(), static_cast<::off_t>(__offset));
+				if (__data == MAP_FAILED) {
+					__error = __last_file_error();
+					return false;
+				}
+				// only a hint: nothing is lost if it is not taken
+				(void)::madvise(__data, __size, MADV_SEQUENTIAL);
+				this->_M_data = __data;
+				this->_M_size = __size;
+				return true;
+			}
+
+			void __unmap() noexcept {
+				if (this->_M_data != nullptr) {
+					::munmap(this->_M_data, this->_M_size);
+					this->_M_data = nullptr;
+					this->_M_size = 0;
+				}
+			}
+
+			void* __data() const noexcept {
+				return this->_M_data;
+			}
+
+			::std::size_t __size() const noexcept {
+				return this->_M_size;
+			}
+
+		private:
+			void* _M_data         = nullptr;
+			::std::size_t _M_size = 0;
+		};
+#endif
+
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#endif // ZTD_TEXT_DETAIL_FILE_HPP
@@ -0,0 +1,161 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_INLINE_ERASED_HPP
+#define ZTD_TEXT_DETAIL_INLINE_ERASED_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		inline constexpr ::std::size_t __any_encoding_inline_size = ZTD_TEXT_ANY_ENCODING_INLINE_SIZE_I_;
+
+		//////
+		/// @brief Owns one object derived from @p _Interface, kept in a buffer inside this object when it fits and on
+		/// the heap otherwise.
+		///
+		/// @tparam _Interface The polymorphic base type. It must have a virtual destructor and a
+		/// <tt>virtual _Interface* __move_into(void* destination) noexcept</tt> member that move-constructs the
+		/// most derived object at @c destination and returns it.
+		/// @tparam _InlineSize The size of the inline buffer, in bytes.
+		///
+		/// @remarks Objects are only kept inline when they fit in the buffer, are not over-aligned, and can be moved
+		/// without throwing, so that moving this object never throws.
+		//////
+		template <typename _Interface, ::std::size_t _InlineSize = __any_encoding_inline_size>
+		class __inline_erased {
+		private:
+			template <typename _Type>
+			inline static constexpr bool _S_is_inline = sizeof(_Type) <= _InlineSize
+				&& alignof(_Type) <= alignof(::std::max_align_t) && ::std::is_nothrow_move_constructible_v<_Type>;
+
+			alignas(::std::max_align_t) unsigned char _M_buffer[_InlineSize == 0 ? 1 : _InlineSize];
+			// _M_ptr points at the _Interface base, which need not be at the start of the object in _M_buffer
+			_Interface* _M_ptr;
+			bool _M_inline;
+
+			void _M_take(__inline_erased& __other) noexcept {
+				if (__other._M_ptr == nullptr) {
+					this->_M_ptr    = nullptr;
+					this->_M_inline = false;
+				}
+				else if (__other._M_inline) {
+					this->_M_ptr    = __other._M_ptr->__move_into(this->_M_buffer);
+					this->_M_inline = true;
+					__other._M_reset();
+				}
+				else {
+					this->_M_ptr    = __other._M_ptr;
+					this->_M_inline = false;
+					__other._M_ptr  = nullptr;
+				}
+			}
+
+		public:
+			__inline_erased() noexcept : _M_ptr(nullptr), _M_inline(false) {
+			}
+
+			__inline_erased(const __inline_erased&) = delete;
+			__inline_erased& operator=(const __inline_erased&) = delete;
+
+			__inline_erased(__inline_erased&& __other) noexcept {
+				this->_M_take(__other);
+			}
+
+			__inline_erased& operator=(__inline_erased&& __other) noexcept {
+				if (this != ::std::addressof(__other)) {
+					this->_M_reset();
+					this->_M_take(__other);
+				}
+				return *this;
+			}
+
+			~__inline_erased() {
+				this->_M_reset();
+			}
+
+			template <typename _Type, typename... _Args>
+			_Type& _M_emplace(_Args&&... __args) {
+				this->_M_reset();
+				_Type* __object;
+				if constexpr (_S_is_inline<_Type>) {
+					__object = ::new (static_cast<void*>(this->_M_buffer)) _Type(::std::forward<_Args>(__args)...);
+				}
+				else {
+					__object = new _Type(::std::forward<_Args>(__args)...);
+				}
+				this->_M_ptr    = __object;
+				this->_M_inline = _S_is_inline<_Type>;
+				return *__object;
+			}
+
+			void _M_reset() noexcept {
+				if (this->_M_ptr == nullptr) {
+					return;
+				}
+				if (this->_M_inline) {
+					this->_M_ptr->~_Interface();
+				}
+				else {
+					delete this->_M_ptr;
+				}
+				this->_M_ptr    = nullptr;
+				this->_M_inline = false;
+			}
+
+			bool _M_stored_inline() const noexcept {
+				return this->_M_ptr != nullptr && this->_M_inline;
+			}
+
+			_Interface* _M_get() const noexcept {
+				return this->_M_ptr;
+			}
+
+			_Interface* operator->() const noexcept {
+				return this->_M_ptr;
+			}
+		};
+
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#endif // ZTD_TEXT_DETAIL_INLINE_ERASED_HPP
@@ -53,7 +53,7 @@ namespace ztd { namespace text {
 		}
 
 		template <typename _Pointer, ::std::enable_if_t<!::std::is_pointer_v<_Pointer>>* = nullptr>
-		auto __adl_to_address(const _Pointer& p) noexcept {
+		constexpr auto __adl_to_address(const _Pointer& p) noexcept {
 			if constexpr (__is_detected_v<__detect_to_address, _Pointer>) {
 				return ::std::pointer_traits<_Pointer>::to_address(p);
 			}
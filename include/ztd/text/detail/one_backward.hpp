@@ -0,0 +1,142 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_ONE_BACKWARD_HPP
+#define ZTD_TEXT_DETAIL_ONE_BACKWARD_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/encoding_error.hpp>
+
+#include <ztd/text/detail/range.hpp>
+#include <ztd/text/detail/reconstruct.hpp>
+#include <ztd/text/detail/span.hpp>
+#include <ztd/text/detail/type_traits.hpp>
+#include <ztd/text/detail/cast.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		//////
+		/// @brief An error handler that hands back every error untouched, so a backward step can tell whether the
+		/// forward step it tried over the tail of the input worked.
+		//////
+		class __one_backward_probe_handler {
+		public:
+			using assume_valid = ::std::false_type;
+
+			template <typename _Encoding, typename _Result, typename _Progress>
+			constexpr _Result operator()(const _Encoding&, _Result __result, const _Progress&) const noexcept {
+				return __result;
+			}
+		};
+
+		//////
+		/// @brief Finds where the last complete unit of information before @p __last starts, by decoding forward
+		/// from @p __first.
+		///
+		/// @remarks @p __first must be somewhere a forward step starts when decoding the whole input, so that the
+		/// steps taken from there are the same ones (and the result is where decoding forward would put the last
+		/// one). Nothing is written anywhere but a scratch buffer.
+		//////
+		template <typename _CodePoint, ::std::size_t _MaxCodePoints, typename _Encoding, typename _UInputRange,
+			typename _InputIterator, typename _State>
+		constexpr _InputIterator __one_backward_first(const _Encoding& __encoding,
+			::std::in_place_type_t<_UInputRange>, _InputIterator __first, _InputIterator __last,
+			const _State& __state) {
+			_State __scratch_state = __state;
+			_CodePoint __scratch[_MaxCodePoints] {};
+			for (;;) {
+				auto __result
+					= __encoding.decode_one(__reconstruct(::std::in_place_type<_UInputRange>, __first, __last),
+					     ::ztd::text::span<_CodePoint, _MaxCodePoints>(__scratch), __one_backward_probe_handler {},
+					     __scratch_state);
+				_InputIterator __next_first = __adl::__adl_cbegin(__result.input);
+				assert(__next_first != __first);
+				if (__next_first == __last) {
+					return __first;
+				}
+				__first = __next_first;
+			}
+		}
+
+		//////
+		/// @brief Finishes a backward step, given the result of a forward step over [ @p __tail_first, @p __last )
+		/// made with ztd::text::__txt_detail::__one_backward_probe_handler.
+		///
+		/// @returns The result of the backward step: its input is [ @p __first, @p __tail_first ).
+		///
+		/// @remarks The tail must be exactly what one forward step uses when decoding the whole input (see
+		/// ztd::text::__txt_detail::__one_backward_first). If it is ill-formed, @p __error_handler is then given the
+		/// same error and the same input values as going forward. Running out of output space leaves the input
+		/// alone, exactly like the forward step would.
+		//////
+		template <typename _ProgressValue, ::std::size_t _MaxProgress, typename _Encoding, typename _UInputRange,
+			typename _InputIterator, typename _Result, typename _ErrorHandler, typename _State>
+		constexpr _Result __finish_one_backward(const _Encoding& __encoding, ::std::in_place_type_t<_UInputRange>,
+			_InputIterator __first, _InputIterator __tail_first, _InputIterator __last, _Result&& __tail_result,
+			_ErrorHandler&& __error_handler, _State& __state) {
+			if (__tail_result.error_code == encoding_error::insufficient_output_space) {
+				return __error_handler(__encoding,
+					_Result(__reconstruct(::std::in_place_type<_UInputRange>, __first, __last),
+					     ::std::move(__tail_result.output), __state, encoding_error::insufficient_output_space),
+					::ztd::text::span<_ProgressValue, 0>());
+			}
+			assert(__adl::__adl_cbegin(__tail_result.input) == __adl::__adl_cend(__tail_result.input));
+			if (__tail_result.error_code == encoding_error::ok) {
+				return _Result(__reconstruct(::std::in_place_type<_UInputRange>, __first, __tail_first),
+					::std::move(__tail_result.output), __state, encoding_error::ok);
+			}
+			_ProgressValue __values[_MaxProgress] {};
+			::std::size_t __values_size = 0;
+			for (_InputIterator __it = __tail_first; __it != __last; __it = __next(__it)) {
+				__values[__values_size] = static_cast<_ProgressValue>(__dereference(__it));
+				++__values_size;
+			}
+			return __error_handler(__encoding,
+				_Result(__reconstruct(::std::in_place_type<_UInputRange>, __first, __tail_first),
+				     ::std::move(__tail_result.output), __state, __tail_result.error_code),
+				::ztd::text::span<_ProgressValue>(__values, __values_size));
+		}
+
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#endif // ZTD_TEXT_DETAIL_ONE_BACKWARD_HPP
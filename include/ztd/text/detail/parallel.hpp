@@ -0,0 +1,213 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_PARALLEL_HPP
+#define ZTD_TEXT_DETAIL_PARALLEL_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/code_point.hpp>
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/is_self_synchronizing_code.hpp>
+#include <ztd/text/state.hpp>
+#include <ztd/text/tag.hpp>
+
+#include <ztd/text/detail/encoding_range.hpp>
+#include <ztd/text/detail/type_traits.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_STD_LIBRARY_EXECUTION_I_)
+#include <algorithm>
+#include <execution>
+#include <numeric>
+#endif
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		//////
+		/// @brief The number of input code units each task of a parallel algorithm works on (give or take the few
+		/// needed to land on a boundary). Input no larger than this is not split at all.
+		//////
+		inline constexpr ::std::size_t __parallel_chunk_size = static_cast<::std::size_t>(1) << 16;
+
+		//////
+		/// @brief Whether contiguous input in @p _Encoding can be cut into pieces that decode separately into
+		/// exactly what decoding all of it at once does.
+		///
+		/// @remarks This needs a self-synchronizing encoding, so that every piece can start with a fresh state, and a
+		/// way to find a place to cut: either every code unit is a whole sequence, or the encoding knows where no
+		/// @c decode_one call can run across (the internal @c __text_code_unit_boundary extension point).
+		//////
+		template <typename _Encoding>
+		inline constexpr bool __is_code_unit_splittable_v = is_self_synchronizing_code_v<_Encoding>
+			&& (max_code_units_v<_Encoding> == 1
+			     || __is_detected_v<__detect_adl_internal_text_code_unit_boundary, _Encoding,
+			          code_unit_t<_Encoding>>);
+
+		//////
+		/// @brief Whether input of code points can be cut anywhere and encoded separately into @p _Encoding with
+		/// exactly the result of encoding all of it at once: every encode step takes one code point and carries
+		/// nothing over to the next.
+		//////
+		template <typename _Encoding>
+		inline constexpr bool __is_code_point_splittable_v
+			= max_code_points_v<_Encoding> == 1 && ::std::is_empty_v<encode_state_t<_Encoding>>;
+
+		//////
+		/// @brief Finds the first position at or after @p __candidate where input in @p _Encoding can be cut.
+		//////
+		template <typename _Encoding, typename _CodeUnit>
+		constexpr const _CodeUnit* __code_unit_boundary(
+			const _CodeUnit* __first, const _CodeUnit* __candidate, const _CodeUnit* __last) noexcept {
+			if constexpr (__is_detected_v<__detect_adl_internal_text_code_unit_boundary, _Encoding, _CodeUnit>) {
+				return __text_code_unit_boundary(tag<_Encoding> {}, __first, __candidate, __last);
+			}
+			else {
+				(void)__first;
+				(void)__last;
+				return __candidate;
+			}
+		}
+
+		//////
+		/// @brief Cuts the input into pieces of roughly @p __piece_size code units each.
+		///
+		/// @returns The offsets of the cuts, starting with @c 0 and ending with the size of the input. Pieces are
+		/// never empty, so there is only one piece if no cut could be made.
+		//////
+		template <typename _Encoding, typename _CodeUnit>
+		::std::vector<::std::size_t> __split_code_units(
+			const _CodeUnit* __first, const _CodeUnit* __last, ::std::size_t __piece_size) {
+			::std::vector<::std::size_t> __bounds;
+			const ::std::size_t __size = static_cast<::std::size_t>(__last - __first);
+			__bounds.reserve(__size / __piece_size + 2);
+			__bounds.push_back(0);
+			const _CodeUnit* __piece_first = __first;
+			while (static_cast<::std::size_t>(__last - __piece_first) > __piece_size) {
+				const _CodeUnit* __piece_last
+					= __code_unit_boundary<_Encoding>(__first, __piece_first + __piece_size, __last);
+				if (__piece_last == __last) {
+					break;
+				}
+				__bounds.push_back(static_cast<::std::size_t>(__piece_last - __first));
+				__piece_first = __piece_last;
+			}
+			__bounds.push_back(__size);
+			return __bounds;
+		}
+
+		//////
+		/// @brief Cuts input of @p __size code points into pieces of @p __piece_size code points each, with the
+		/// last one holding whatever is left.
+		///
+		/// @returns The offsets of the cuts, starting with @c 0 and ending with @p __size .
+		//////
+		inline ::std::vector<::std::size_t> __split_code_points(::std::size_t __size, ::std::size_t __piece_size) {
+			::std::vector<::std::size_t> __bounds;
+			__bounds.reserve(__size / __piece_size + 2);
+			__bounds.push_back(0);
+			for (::std::size_t __offset = __piece_size; __offset < __size; __offset += __piece_size) {
+				__bounds.push_back(__offset);
+			}
+			__bounds.push_back(__size);
+			return __bounds;
+		}
+
+		//////
+		/// @brief Calls @p __task with every index in <tt>[0, __count)</tt> through @p __executor , or directly
+		/// if there is only one.
+		///
+		/// @remarks The executor is either a standard execution policy, used with @c std::for_each over the indices,
+		/// or it is called as <tt>__executor(__count, __task)</tt> and must call @p __task once with each index, on
+		/// whatever threads it likes, before it returns.
+		//////
+		template <typename _Executor, typename _Task>
+		void __parallel_for(_Executor& __executor, ::std::size_t __count, const _Task& __task) {
+			if (__count == 0) {
+				return;
+			}
+			if (__count == 1) {
+				__task(static_cast<::std::size_t>(0));
+				return;
+			}
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_STD_LIBRARY_EXECUTION_I_)
+			if constexpr (::std::is_execution_policy_v<__remove_cvref_t<_Executor>>) {
+				::std::vector<::std::size_t> __indices(__count);
+				::std::iota(__indices.begin(), __indices.end(), static_cast<::std::size_t>(0));
+				::std::for_each(__executor, __indices.begin(), __indices.end(), __task);
+			}
+			else
+#endif
+			{
+				__executor(__count, __task);
+			}
+		}
+
+		//////
+		/// @brief Calls @p __task with indices in <tt>[0, __count)</tt> through @p __executor until one of them
+		/// returns @c true .
+		///
+		/// @returns The lowest index @p __task returned @c true for, or @p __count if it never did.
+		///
+		/// @remarks Every index below the returned one is always run. Indices above it may or may not be: once a task
+		/// returns @c true , the ones after it that have not started yet are skipped.
+		//////
+		template <typename _Executor, typename _Task>
+		::std::size_t __parallel_find_first(_Executor& __executor, ::std::size_t __count, const _Task& __task) {
+			::std::atomic<::std::size_t> __first_found(__count);
+			__parallel_for(__executor, __count, [&__first_found, &__task](::std::size_t __index) {
+				if (__index > __first_found.load(::std::memory_order_relaxed)) {
+					return;
+				}
+				if (!__task(__index)) {
+					return;
+				}
+				::std::size_t __current = __first_found.load(::std::memory_order_relaxed);
+				while (__index < __current
+					&& !__first_found.compare_exchange_weak(__current, __index, ::std::memory_order_relaxed)) {
+				}
+			});
+			return __first_found.load(::std::memory_order_relaxed);
+		}
+
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#endif // ZTD_TEXT_DETAIL_PARALLEL_HPP
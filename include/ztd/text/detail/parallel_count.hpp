@@ -0,0 +1,137 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_PARALLEL_COUNT_HPP
+#define ZTD_TEXT_DETAIL_PARALLEL_COUNT_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/encoding_error.hpp>
+
+#include <ztd/text/detail/adl.hpp>
+#include <ztd/text/detail/parallel.hpp>
+#include <ztd/text/detail/reconstruct.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		//////
+		/// @brief Passes every error through unchanged, like ztd::text::pass_handler, and notes that there was one.
+		/// The counting functions carry on past errors, so this is the only way to tell a piece had any.
+		//////
+		class __parallel_count_error_flag {
+		public:
+			bool* _M_has_error;
+
+			template <typename _Encoding, typename _Result, typename _Progress>
+			constexpr auto operator()(const _Encoding&, _Result __result, const _Progress&) const {
+				*this->_M_has_error = true;
+				return __result;
+			}
+		};
+
+		//////
+		/// @brief Counts the pieces of @p __working_input cut at @p __bounds in parallel, and puts together the result
+		/// counting all of it at once would have given.
+		///
+		/// @param[in] __count_piece A function object taking one piece of the input as a @p _WorkingInput and an
+		/// error handler, and returning a ztd::text::count_result or ztd::text::stateless_count_result for it.
+		/// @param[in] __error_handler The caller's error handler.
+		///
+		/// @remarks The pieces are first counted in parallel, passing errors through, up to the first one with an
+		/// error. That piece is counted again on the calling thread with @p __error_handler , so the caller's
+		/// handler is only ever called there, once for each error and in order, and then the pieces after it are
+		/// counted in parallel again. Counting stops at the first error that is not handled, just like the serial
+		/// count.
+		//////
+		template <typename _Result, typename _Executor, typename _WorkingInput, typename _CountPiece,
+			typename _ErrorHandler, typename _State>
+		_Result __parallel_count(_Executor& __executor, _WorkingInput& __working_input,
+			const ::std::vector<::std::size_t>& __bounds, const _CountPiece& __count_piece,
+			_ErrorHandler& __error_handler, _State& __state) {
+			auto __in_first                   = __adl::__adl_begin(__working_input);
+			auto __in_last                    = __adl::__adl_end(__working_input);
+			const ::std::size_t __piece_count = __bounds.size() - 1;
+
+			::std::vector<::std::size_t> __counts(__piece_count, 0);
+			::std::size_t __count          = 0;
+			::std::size_t __handled_errors = 0;
+			for (::std::size_t __index = 0; __index < __piece_count;) {
+				const ::std::size_t __run_first = __index;
+				__index += __parallel_find_first(
+					__executor, __piece_count - __run_first, [&](::std::size_t __run_index) {
+						bool __has_error = false;
+						__parallel_count_error_flag __piece_error_handler { &__has_error };
+						const ::std::size_t __piece = __run_first + __run_index;
+						_WorkingInput __piece_input = __reconstruct(::std::in_place_type<_WorkingInput>,
+							__in_first + __bounds[__piece], __in_first + __bounds[__piece + 1]);
+						auto __count_result = __count_piece(::std::move(__piece_input), __piece_error_handler);
+						__counts[__piece]   = __count_result.count;
+						return __has_error || __count_result.error_code != encoding_error::ok;
+					});
+				for (::std::size_t __piece = __run_first; __piece < __index; ++__piece) {
+					__count += __counts[__piece];
+				}
+				if (__index == __piece_count) {
+					break;
+				}
+				// this piece has an error in it: it goes through the caller's error handler, here
+				_WorkingInput __piece_input = __reconstruct(::std::in_place_type<_WorkingInput>,
+					__in_first + __bounds[__index], __in_first + __bounds[__index + 1]);
+				auto __count_result         = __count_piece(::std::move(__piece_input), __error_handler);
+				__count += __count_result.count;
+				__handled_errors += __count_result.handled_errors;
+				if (__count_result.error_code != encoding_error::ok) {
+					const ::std::size_t __input_stop = __bounds[__index + 1]
+						- static_cast<::std::size_t>(__adl::__adl_size(__count_result.input));
+					return _Result(
+						__reconstruct(::std::in_place_type<_WorkingInput>, __in_first + __input_stop, __in_last),
+						__count, __state, __count_result.error_code, __handled_errors);
+				}
+				++__index;
+			}
+			return _Result(__reconstruct(::std::in_place_type<_WorkingInput>, __in_last, __in_last), __count,
+				__state, encoding_error::ok, __handled_errors);
+		}
+
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#endif // ZTD_TEXT_DETAIL_PARALLEL_COUNT_HPP
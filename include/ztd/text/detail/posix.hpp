@@ -35,10 +35,15 @@
 
 #include <ztd/text/version.hpp>
 
+#include <ztd/text/endian.hpp>
+
 #include <ztd/text/detail/encoding_name.hpp>
 
 #if ZTD_TEXT_IS_ON(ZTD_TEXT_PLATFORM_UNIX_I_)
 
+#include <atomic>
+#include <string_view>
+
 // clang-foramt off
 
 #if ZTD_TEXT_IS_ON(ZTD_TEXT_LANGINFO_I_)
@@ -55,6 +60,15 @@ extern "C" {
 #include <clocale>
 #endif
 
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_EXECUTION_ICONV_I_)
+extern "C" {
+#include <iconv.h>
+}
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#endif
+
 // clang-format on
 
 namespace ztd { namespace text {
@@ -63,17 +77,178 @@ namespace ztd { namespace text {
 
 	namespace __txt_detail { namespace __posix {
 
-		inline __encoding_id __determine_active_code_page() noexcept {
+		inline const char* __active_code_page_name() noexcept {
 #if ZTD_TEXT_IS_ON(ZTD_TEXT_LANGINFO_I_) || ZTD_TEXT_IS_ON(ZTD_TEXT_NL_LANGINFO_I_)
-			const char* __name = nl_langinfo(LC_CTYPE);
-			return __to_encoding_id(__name);
+			return nl_langinfo(CODESET);
 #else
 			// fallback to stdlib I guess?
-			const char* __ctype_name = setlocale(LC_CTYPE, nullptr);
-			return __to_encoding_id(__ctype_name);
+			return setlocale(LC_CTYPE, nullptr);
 #endif
 		}
 
+		inline __encoding_id __to_active_code_page_id(const char* __name) noexcept {
+			if (__name == nullptr) {
+				return __encoding_id::__unknown;
+			}
+			::std::string_view __codeset(__name);
+#if ZTD_TEXT_IS_OFF(ZTD_TEXT_LANGINFO_I_) && ZTD_TEXT_IS_OFF(ZTD_TEXT_NL_LANGINFO_I_)
+			// a locale name looks like "language_TERRITORY.codeset@modifier": keep only the codeset
+			::std::size_t __dot = __codeset.find('.');
+			if (__dot != ::std::string_view::npos) {
+				__codeset.remove_prefix(__dot + 1);
+				__codeset = __codeset.substr(0, __codeset.find('@'));
+			}
+#endif
+			return __to_encoding_id(__codeset);
+		}
+
+		//////
+		/// @brief Bumped by ztd::text::refresh_execution_encoding, so that every thread knows the encoding it
+		/// remembered for its locale has to be looked up again. No thread's cache starts out at @c 0.
+		//////
+		inline ::std::atomic<unsigned int> __active_code_page_generation { 1 };
+
+		inline void __refresh_active_code_page() noexcept {
+			__active_code_page_generation.fetch_add(1, ::std::memory_order_relaxed);
+		}
+
+		inline unsigned int __active_code_page_current_generation() noexcept {
+			return __active_code_page_generation.load(::std::memory_order_relaxed);
+		}
+
+		//////
+		/// @brief The identifier of the code page seen on this thread, and the generation it was looked up in.
+		//////
+		struct __active_code_page_cache {
+			unsigned int _M_generation;
+			__encoding_id _M_id;
+		};
+
+		//////
+		/// @brief Returns the identifier of the encoding for the @c LC_CTYPE locale of this thread.
+		///
+		/// @remarks The locale is asked for its encoding the first time this is called on a thread, and then again
+		/// only after a call to ztd::text::refresh_execution_encoding. Every other call is a thread-local read.
+		//////
+		inline __encoding_id __determine_active_code_page() noexcept {
+			thread_local __active_code_page_cache __cache = { 0, __encoding_id::__unknown };
+			const unsigned int __generation               = __active_code_page_current_generation();
+			if (__cache._M_generation != __generation) {
+				__cache._M_id         = __to_active_code_page_id(__active_code_page_name());
+				__cache._M_generation = __generation;
+			}
+			return __cache._M_id;
+		}
+
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_EXECUTION_ICONV_I_)
+		//////
+		/// @brief The @c iconv conversion descriptors from the encoding of the current locale to UTF-32 in native
+		/// endianness, and back.
+		//////
+		struct __active_code_page_iconv {
+			iconv_t _M_decode;
+			iconv_t _M_encode;
+		};
+
+		//////
+		/// @brief The descriptors for the code page seen on this thread, closed when the thread exits.
+		//////
+		class __active_code_page_iconv_cache {
+		public:
+			__active_code_page_iconv_cache() noexcept
+			: _M_generation(0), _M_usable(false), _M_iconv { _S_closed(), _S_closed() } {
+			}
+
+			__active_code_page_iconv_cache(const __active_code_page_iconv_cache&)            = delete;
+			__active_code_page_iconv_cache& operator=(const __active_code_page_iconv_cache&) = delete;
+
+			~__active_code_page_iconv_cache() {
+				_M_close();
+			}
+
+			const __active_code_page_iconv* __get(unsigned int __generation) noexcept {
+				if (__generation != _M_generation) {
+					_M_open(__active_code_page_name());
+					_M_generation = __generation;
+				}
+				return _M_usable ? &_M_iconv : nullptr;
+			}
+
+		private:
+			static iconv_t _S_closed() noexcept {
+				return reinterpret_cast<iconv_t>(static_cast<::std::intptr_t>(-1));
+			}
+
+			void _M_close() noexcept {
+				if (_M_iconv._M_decode != _S_closed()) {
+					iconv_close(_M_iconv._M_decode);
+				}
+				if (_M_iconv._M_encode != _S_closed()) {
+					iconv_close(_M_iconv._M_encode);
+				}
+				_M_iconv = { _S_closed(), _S_closed() };
+				_M_usable = false;
+			}
+
+			void _M_open(const char* __name) noexcept {
+				_M_close();
+				if (__name == nullptr) {
+					return;
+				}
+				// stopping and restarting in the middle of text is only fine without shift states
+				if (::std::mbtowc(nullptr, nullptr, 0) != 0) {
+					return;
+				}
+				const char* __utf32_name = endian::native == endian::big ? "UTF-32BE" : "UTF-32LE";
+				_M_iconv._M_decode       = iconv_open(__utf32_name, __name);
+				_M_iconv._M_encode       = iconv_open(__name, __utf32_name);
+				_M_usable = _M_iconv._M_decode != _S_closed() && _M_iconv._M_encode != _S_closed();
+			}
+
+			unsigned int _M_generation;
+			bool _M_usable;
+			__active_code_page_iconv _M_iconv;
+		};
+
+		//////
+		/// @brief Returns the @c iconv conversion descriptors for the current @c LC_CTYPE locale of this thread, or
+		/// @c nullptr if they cannot be used.
+		///
+		/// @remarks The descriptors are opened once per thread, and again after each call to
+		/// ztd::text::refresh_execution_encoding, and only for encodings without shift states, so that converting can
+		/// stop and restart between any two characters. Their shift state is therefore never meaningful, but it is
+		/// reset before each conversion anyway.
+		//////
+		inline const __active_code_page_iconv* __determine_active_code_page_iconv() noexcept {
+			thread_local __active_code_page_iconv_cache __cache {};
+			return __cache.__get(__active_code_page_current_generation());
+		}
+
+		//////
+		/// @brief Converts with @p __handle from @p __in into @p __out until the input runs out, the output is full,
+		/// or a sequence that does not convert (or is cut off) is reached.
+		///
+		/// @remarks Both pointers are moved past what was converted, which is always a whole number of characters.
+		//////
+		template <typename _InUnit, typename _OutUnit>
+		void __iconv_convert(iconv_t __handle, const _InUnit*& __in, const _InUnit* __in_last, _OutUnit*& __out,
+			_OutUnit* __out_last) noexcept {
+			if (__in == __in_last || __out == __out_last) {
+				// empty ranges may be null, which iconv does not accept
+				return;
+			}
+			iconv(__handle, nullptr, nullptr, nullptr, nullptr);
+			char* __in_bytes         = const_cast<char*>(reinterpret_cast<const char*>(__in));
+			::std::size_t __in_left  = static_cast<::std::size_t>(__in_last - __in) * sizeof(_InUnit);
+			char* __out_bytes        = reinterpret_cast<char*>(__out);
+			::std::size_t __out_left = static_cast<::std::size_t>(__out_last - __out) * sizeof(_OutUnit);
+			iconv(__handle, &__in_bytes, &__in_left, &__out_bytes, &__out_left);
+			__in  = reinterpret_cast<const _InUnit*>(__in_bytes);
+			__out = reinterpret_cast<_OutUnit*>(__out_bytes);
+		}
+
+#endif
+
 	}} // namespace __txt_detail::__posix
 
 	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
@@ -96,10 +96,14 @@ namespace ztd { namespace text {
 		using __iterator_category_t =
 			typename ::std::iterator_traits<::std::remove_reference_t<_It>>::iterator_category;
 
+		template <typename _It>
+		using __detect_iterator_concept_member = typename _It::iterator_concept;
+
 		template <typename _It, typename = void>
 		struct __iterator_concept_or_fallback {
 			using type = ::std::conditional_t<::std::is_pointer_v<__remove_cvref_t<_It>>, contiguous_iterator_tag,
-				__iterator_category_t<_It>>;
+				typename __detected_or<__iterator_category_t<_It>, __detect_iterator_concept_member,
+				     __remove_cvref_t<_It>>::type>;
 		};
 
 		template <typename _It>
@@ -253,6 +253,34 @@ namespace ztd { namespace text {
 		using __reconstruct_t = decltype(__reconstruct(::std::in_place_type<_Range>,
 			::std::declval<__remove_cvref_t<_It>>(), ::std::declval<__remove_cvref_t<_Sen>>()));
 
+		template <typename _Input, typename _UInput = __remove_cvref_t<_Input>,
+			typename _InputValueType = __range_value_type_t<_UInput>>
+		using __string_view_or_span_or_reconstruct_t = __reconstruct_t<::std::conditional_t<::std::is_array_v<_UInput>,
+			::std::conditional_t<__is_character_v<_InputValueType>, ::std::basic_string_view<_InputValueType>,
+			     ::ztd::text::span<const _InputValueType>>,
+			_UInput>>;
+
+		template <typename _Range, ::std::size_t _Size, typename = void>
+		struct __is_contiguous_code_unit_range : ::std::false_type { };
+
+		template <typename _Range, ::std::size_t _Size>
+		struct __is_contiguous_code_unit_range<_Range, _Size,
+			::std::enable_if_t<__is_range_iterator_concept_or_better_v<contiguous_iterator_tag, _Range>
+			     && ::std::is_same_v<__range_iterator_t<_Range>, __range_sentinel_t<_Range>>>>
+		: ::std::integral_constant<bool, sizeof(__range_value_type_t<_Range>) == _Size> { };
+
+		template <typename _Range, ::std::size_t _Size>
+		inline constexpr bool __is_contiguous_code_unit_range_v
+			= __is_contiguous_code_unit_range<__remove_cvref_t<_Range>, _Size>::value;
+
+		template <typename _Range, ::std::size_t _Size>
+		inline constexpr bool __is_contiguous_writable_code_unit_range_v
+			= __is_contiguous_code_unit_range_v<_Range, _Size>
+			&& !::std::is_const_v<::std::remove_reference_t<__range_reference_t<__remove_cvref_t<_Range>>>>;
+
+		template <typename _Range>
+		inline constexpr bool __is_contiguous_byte_range_v = __is_contiguous_code_unit_range_v<_Range, 1>;
+
 	} // namespace __txt_detail
 	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
 }} // namespace ztd::text
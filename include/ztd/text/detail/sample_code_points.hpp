@@ -0,0 +1,161 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_SAMPLE_CODE_POINTS_HPP
+#define ZTD_TEXT_DETAIL_SAMPLE_CODE_POINTS_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/detail/unicode.hpp>
+#include <ztd/text/detail/validate_utf8.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		inline constexpr ::std::uint_least64_t __utf8_sample_high_bits = 0x8080808080808080u;
+		inline constexpr ::std::uint_least64_t __utf8_sample_low_bytes = 0x0101010101010101u;
+
+		//////
+		/// @brief Counts the code units in an 8 code unit word that do not start a code point.
+		///
+		/// @remarks A continuation has its top bit set and the bit below it cleared; shifting the word left by one
+		/// moves every second-highest bit under the highest bit of the same code unit.
+		//////
+		constexpr ::std::size_t __utf8_count_continuations(::std::uint_least64_t __word) noexcept {
+			const ::std::uint_least64_t __continuations = __word & ~(__word << 1) & __utf8_sample_high_bits;
+			return static_cast<::std::size_t>(
+				(((__continuations >> 7) * __utf8_sample_low_bytes) >> 56) & 0xFFu);
+		}
+
+		//////
+		/// @brief Walks strict UTF-8, reporting every code point whose index is a multiple of @p __interval .
+		///
+		/// @param[in, out] __in The start of the input. It is left at the first sequence that does not decode (or is
+		/// cut off by @p __in_last).
+		/// @param[in] __in_last The end of the input.
+		/// @param[in] __index The index of the code point that starts at @p __in .
+		/// @param[in] __interval The distance between two reported code points.
+		/// @param[in] __sink A function object called with <tt>(const _CodeUnit* at, std::size_t index)</tt> for
+		/// every reported code point.
+		///
+		/// @returns The number of code points in <tt>[old __in, new __in)</tt>.
+		///
+		/// @remarks The input is validated in bulk first, after which every code unit that is not a continuation
+		/// starts a code point. Words of 8 code units that do not hold a reported code point are counted at once.
+		//////
+		template <typename _CodeUnit, typename _Sink>
+		constexpr ::std::size_t __utf8_sample_code_points(const _CodeUnit*& __in, const _CodeUnit* __in_last,
+			::std::size_t __index, ::std::size_t __interval, _Sink& __sink) {
+			static_assert(sizeof(_CodeUnit) == sizeof(unsigned char),
+				"the code unit type must be a single byte in size for UTF-8");
+			const _CodeUnit* __valid_last = __utf8_validate(__in, __in_last);
+			::std::size_t __until         = (__interval - (__index % __interval)) % __interval;
+			::std::size_t __count         = 0;
+			while (__in != __valid_last) {
+				if ((__valid_last - __in) >= 8) {
+					::std::uint_least64_t __word = 0;
+					for (::std::size_t __unit_index = 0; __unit_index < 8; ++__unit_index) {
+						const unsigned char __word_unit = static_cast<unsigned char>(__in[__unit_index]);
+						__word |= static_cast<::std::uint_least64_t>(__word_unit) << (__unit_index * 8);
+					}
+					const ::std::size_t __starts = 8 - __utf8_count_continuations(__word);
+					if (__starts <= __until) {
+						__until -= __starts;
+						__count += __starts;
+						__in += 8;
+						continue;
+					}
+				}
+				const unsigned char __unit = static_cast<unsigned char>(*__in);
+				if ((__unit & 0xC0u) != 0x80u) {
+					if (__until == 0) {
+						__sink(__in, __index + __count);
+						__until = __interval;
+					}
+					--__until;
+					++__count;
+				}
+				++__in;
+			}
+			return __count;
+		}
+
+		//////
+		/// @brief Walks strict UTF-16, reporting every code point whose index is a multiple of @p __interval .
+		///
+		/// @param[in, out] __in The start of the input. It is left at the first unpaired surrogate.
+		/// @param[in] __in_last The end of the input.
+		/// @param[in] __index The index of the code point that starts at @p __in .
+		/// @param[in] __interval The distance between two reported code points.
+		/// @param[in] __sink A function object called with <tt>(const _CodeUnit* at, std::size_t index)</tt> for
+		/// every reported code point.
+		///
+		/// @returns The number of code points in <tt>[old __in, new __in)</tt>.
+		//////
+		template <typename _CodeUnit, typename _Sink>
+		constexpr ::std::size_t __utf16_sample_code_points(const _CodeUnit*& __in, const _CodeUnit* __in_last,
+			::std::size_t __index, ::std::size_t __interval, _Sink& __sink) {
+			static_assert(sizeof(_CodeUnit) == sizeof(char16_t),
+				"the code unit type must be two bytes in size for UTF-16");
+			::std::size_t __until = (__interval - (__index % __interval)) % __interval;
+			::std::size_t __count = 0;
+			while (__in != __in_last) {
+				const char32_t __unit     = static_cast<char16_t>(*__in);
+				::std::ptrdiff_t __length = 1;
+				if (__is_surrogate(__unit)) {
+					if (!__is_lead_surrogate(__unit) || (__in_last - __in) < 2
+						|| !__is_trail_surrogate(static_cast<char16_t>(__in[1]))) {
+						break;
+					}
+					__length = 2;
+				}
+				if (__until == 0) {
+					__sink(__in, __index + __count);
+					__until = __interval;
+				}
+				--__until;
+				++__count;
+				__in += __length;
+			}
+			return __count;
+		}
+
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#endif // ZTD_TEXT_DETAIL_SAMPLE_CODE_POINTS_HPP
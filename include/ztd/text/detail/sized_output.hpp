@@ -0,0 +1,467 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_SIZED_OUTPUT_HPP
+#define ZTD_TEXT_DETAIL_SIZED_OUTPUT_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/code_point.hpp>
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/count_code_points.hpp>
+#include <ztd/text/count_code_units.hpp>
+#include <ztd/text/encoding_error.hpp>
+#include <ztd/text/output_sizing.hpp>
+#include <ztd/text/state.hpp>
+#include <ztd/text/tag.hpp>
+#include <ztd/text/validate_code_units.hpp>
+
+#include <ztd/text/detail/adl.hpp>
+#include <ztd/text/detail/bitwise_transcode.hpp>
+#include <ztd/text/detail/encoding_range.hpp>
+#include <ztd/text/detail/range.hpp>
+#include <ztd/text/detail/span.hpp>
+#include <ztd/text/detail/type_traits.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		template <typename _Type>
+		using __detect_resize = decltype(::std::declval<_Type&>().resize(::std::declval<::std::size_t>()));
+
+		template <typename _Type>
+		using __detect_resize_and_overwrite = decltype(::std::declval<_Type&>().resize_and_overwrite(
+			::std::declval<::std::size_t>(),
+			::std::declval<::std::size_t (*)(__range_value_type_t<_Type>*, ::std::size_t)>()));
+
+		template <typename _Type>
+		using __detect_shrink_to_fit = decltype(::std::declval<_Type&>().shrink_to_fit());
+
+		template <typename _Type>
+		using __detect_mutable_data = decltype(::std::declval<_Type&>().data());
+
+		//////
+		/// @brief Whether a container can be resized and then written into through a pointer to its storage.
+		//////
+		template <typename _Container, typename = void>
+		inline constexpr bool __is_sized_output_container_v = false;
+
+		template <typename _Container>
+		inline constexpr bool __is_sized_output_container_v<_Container,
+			::std::enable_if_t<__is_detected_v<__detect_resize, _Container>
+			     && __is_detected_v<__detect_mutable_data, _Container>>>
+			= ::std::is_same_v<__detect_mutable_data<_Container>, __range_value_type_t<_Container>*>;
+
+		//////
+		/// @brief Whether a container-returning conversion from @p _Input into @p _Container can size the container
+		/// up-front and write into it directly.
+		//////
+		template <typename _Container, typename _Input>
+		inline constexpr bool __is_sized_output_v
+			= __is_sized_output_container_v<_Container> && __is_detected_v<__detect_adl_size, _Input>;
+
+		//////
+		/// @brief Resizes @p __container to @p __size elements that are about to be overwritten, skipping the
+		/// zero-filling where the container allows it.
+		//////
+		template <typename _Container>
+		constexpr void __resize_for_overwrite(_Container& __container, ::std::size_t __size) {
+			if constexpr (__is_detected_v<__detect_resize_and_overwrite, _Container>) {
+				__container.resize_and_overwrite(
+					__size, [](auto*, auto __overwrite_size) { return __overwrite_size; });
+			}
+			else {
+				__container.resize(__size);
+			}
+		}
+
+		//////
+		/// @brief Sizes @p __output to @p __size , writes into it through a span with @p __into , and then trims
+		/// it (and its storage) down to what was written.
+		///
+		/// @param[in,out] __output The container to write into.
+		/// @param[in]     __size The number of elements to size the container to before writing.
+		/// @param[in]     __into A function object taking a ztd::text::span of the container's elements and
+		/// returning a result with an @c .output member pointing at what is left of that span.
+		//////
+		template <typename _Container, typename _Into>
+		constexpr auto __sized_output_into(_Container& __output, ::std::size_t __size, _Into&& __into) {
+			using _OutputValue = __range_value_type_t<_Container>;
+			__resize_for_overwrite(__output, __size);
+			_OutputValue* __output_first = __output.data();
+			auto __result = ::std::forward<_Into>(__into)(::ztd::text::span<_OutputValue>(__output_first, __size));
+			const ::std::size_t __written_size
+				= static_cast<::std::size_t>(__adl::__adl_to_address(__adl::__adl_begin(__result.output))
+				     - __output_first);
+			__output.resize(__written_size);
+			if constexpr (__is_detected_v<__detect_shrink_to_fit, _Container>) {
+				if (__written_size != __size) {
+					__output.shrink_to_fit();
+				}
+			}
+			return __result;
+		}
+
+		template <typename _Type>
+		using __detect_capacity = decltype(::std::declval<_Type&>().capacity());
+
+		//////
+		/// @brief The smallest number of elements a ztd::text::__txt_detail::__resizing_pointer_output grows its
+		/// container by.
+		//////
+		inline constexpr ::std::size_t __minimum_output_growth = 32;
+
+		template <typename _Container>
+		class __resizing_pointer_output;
+
+		//////
+		/// @brief An output iterator that writes into a ztd::text::__txt_detail::__resizing_pointer_output.
+		///
+		/// @remarks All copies of the iterator share the same write position, so it does not matter which copy an
+		/// algorithm (or a wrapping iterator) ends up writing through.
+		//////
+		template <typename _Container>
+		class __resizing_pointer_inserter {
+		private:
+			using __value_type = __range_value_type_t<_Container>;
+
+		public:
+			using iterator_category = ::std::output_iterator_tag;
+			using value_type        = void;
+			using difference_type   = ::std::ptrdiff_t;
+			using pointer           = void;
+			using reference         = void;
+
+			constexpr __resizing_pointer_inserter() noexcept : _M_output(nullptr) {
+			}
+
+			constexpr __resizing_pointer_inserter(__resizing_pointer_output<_Container>& __output) noexcept
+			: _M_output(::std::addressof(__output)) {
+			}
+
+			constexpr __resizing_pointer_inserter& operator=(const __value_type& __value) {
+				_M_output->__push_back(__value);
+				return *this;
+			}
+
+			constexpr __resizing_pointer_inserter& operator*() noexcept {
+				return *this;
+			}
+
+			constexpr __resizing_pointer_inserter& operator++() noexcept {
+				return *this;
+			}
+
+			constexpr __resizing_pointer_inserter& operator++(int) noexcept {
+				return *this;
+			}
+
+		private:
+			__resizing_pointer_output<_Container>* _M_output;
+		};
+
+		//////
+		/// @brief Writes through a raw pointer into a resizable, contiguous container, growing the container
+		/// geometrically whenever the pointer reaches its end.
+		///
+		/// @remarks Unlike a @c std::back_insert_iterator , a write is a pointer comparison and a store: the
+		/// container's size is only brought up to date when it grows, and once more at the end with @c __finish .
+		//////
+		template <typename _Container>
+		class __resizing_pointer_output {
+		private:
+			using __value_type = __range_value_type_t<_Container>;
+
+		public:
+			constexpr __resizing_pointer_output(_Container& __container) noexcept
+			: _M_container(::std::addressof(__container))
+			, _M_current(__container.data() + __container.size())
+			, _M_last(_M_current) {
+			}
+
+			__resizing_pointer_output(const __resizing_pointer_output&) = delete;
+			__resizing_pointer_output& operator=(const __resizing_pointer_output&) = delete;
+
+			constexpr __resizing_pointer_inserter<_Container> __begin() noexcept {
+				return __resizing_pointer_inserter<_Container>(*this);
+			}
+
+			constexpr void __push_back(const __value_type& __value) {
+				if (_M_current == _M_last) {
+					_M_grow();
+				}
+				*_M_current = __value;
+				++_M_current;
+			}
+
+			//////
+			/// @brief Shrinks the container down to what was written into it.
+			//////
+			constexpr void __finish() {
+				_M_container->resize(static_cast<::std::size_t>(_M_current - _M_container->data()));
+			}
+
+		private:
+			constexpr void _M_grow() {
+				const ::std::size_t __written_size = static_cast<::std::size_t>(_M_current - _M_container->data());
+				::std::size_t __grown_size         = __written_size * 2;
+				if constexpr (__is_detected_v<__detect_capacity, _Container>) {
+					// use up whatever was already reserved before reallocating
+					const ::std::size_t __capacity = static_cast<::std::size_t>(_M_container->capacity());
+					if (__grown_size < __capacity) {
+						__grown_size = __capacity;
+					}
+				}
+				if (__grown_size < __written_size + __minimum_output_growth) {
+					__grown_size = __written_size + __minimum_output_growth;
+				}
+				__resize_for_overwrite(*_M_container, __grown_size);
+				_M_current = _M_container->data() + __written_size;
+				_M_last    = _M_container->data() + _M_container->size();
+			}
+
+			_Container* _M_container;
+			__value_type* _M_current;
+			__value_type* _M_last;
+		};
+
+		//////
+		/// @brief Fills in a container that cannot be written through a pointer with a @c
+		/// std::back_insert_iterator .
+		//////
+		template <typename _Container>
+		class __back_insert_output {
+		public:
+			constexpr __back_insert_output(_Container& __container) noexcept
+			: _M_container(::std::addressof(__container)) {
+			}
+
+			constexpr ::std::back_insert_iterator<_Container> __begin() noexcept {
+				return ::std::back_inserter(*_M_container);
+			}
+
+			constexpr void __finish() noexcept {
+			}
+
+		private:
+			_Container* _M_container;
+		};
+
+		//////
+		/// @brief The object used to fill in a container one step at a time: a
+		/// ztd::text::__txt_detail::__resizing_pointer_output where the container allows it, and a
+		/// ztd::text::__txt_detail::__back_insert_output otherwise.
+		///
+		/// @remarks The object must outlive every use of the iterator from its @c __begin function, and @c __finish
+		/// must be called once writing is done to bring the container's size up to date.
+		//////
+		template <typename _Container>
+		using __container_output_t = ::std::conditional_t<__is_sized_output_container_v<_Container>,
+			__resizing_pointer_output<_Container>, __back_insert_output<_Container>>;
+
+		//////
+		/// @brief The output iterator of a ztd::text::__txt_detail::__container_output_t.
+		//////
+		template <typename _Container>
+		using __container_output_iterator_t = decltype(::std::declval<__container_output_t<_Container>&>().__begin());
+
+		//////
+		/// @brief An error handler that passes the result through untouched, but records that it was called.
+		///
+		/// @remarks Used for counting passes, where the count is only worth anything if no errors occurred.
+		//////
+		class __error_flag_handler {
+		public:
+			using assume_valid = ::std::false_type;
+
+			constexpr __error_flag_handler(bool& __errored) noexcept : _M_errored(&__errored) {
+			}
+
+			template <typename _Encoding, typename _Result, typename _Progress>
+			constexpr auto operator()(const _Encoding&, _Result __result, const _Progress&) const {
+				*_M_errored = true;
+				return __result;
+			}
+
+		private:
+			bool* _M_errored;
+		};
+
+		//////
+		/// @brief Computes the exact number of code units transcoding @p __input produces, if that can be done
+		/// quickly and without calling any error handlers.
+		///
+		/// @returns @c true and sets @p __size if the input was counted in full without errors, @c false otherwise.
+		///
+		/// @remarks This uses either an encoding pair's count extension point, or bulk validation for bitwise
+		/// compatible encodings (where the output is the same size as the input).
+		//////
+		template <typename _OutputContainer, typename _Input, typename _FromEncoding, typename _ToEncoding,
+			typename _FromState, typename _ToState>
+		constexpr bool __transcode_exact_size(::std::size_t& __size, _Input& __input,
+			const _FromEncoding& __from_encoding, const _ToEncoding& __to_encoding, const _FromState&,
+			const _ToState&) {
+			using _OutputView = ::ztd::text::span<__range_value_type_t<_OutputContainer>>;
+			if constexpr (__is_detected_v<__detect_adl_internal_text_count_transcoded, _Input&,
+				              const _FromEncoding&, const _ToEncoding&>) {
+				auto __result = __text_count_transcoded(tag<_FromEncoding, _ToEncoding> {}, __input,
+					__from_encoding, __to_encoding);
+				if (__result.error_code != encoding_error::ok || !__adl::__adl_empty(__result.input)) {
+					return false;
+				}
+				__size = __result.count;
+				return true;
+			}
+			else if constexpr (__is_bitwise_transcodable_v<_Input&, _FromEncoding, _OutputView, _ToEncoding,
+				                   _FromState, _ToState>) {
+				decode_state_t<_FromEncoding> __decode_state = make_decode_state(__from_encoding);
+				encode_state_t<_FromEncoding> __encode_state = make_encode_state(__from_encoding);
+				auto __result = validate_code_units(__input, __from_encoding, __decode_state, __encode_state);
+				if (!__result.valid) {
+					return false;
+				}
+				__size = static_cast<::std::size_t>(__adl::__adl_size(__input));
+				return true;
+			}
+			else {
+				(void)__input;
+				(void)__from_encoding;
+				(void)__to_encoding;
+				return false;
+			}
+		}
+
+		//////
+		/// @brief Computes the exact number of code points decoding @p __input produces, if the encoding has a fast
+		/// way of counting them. No error handlers are called.
+		///
+		/// @returns @c true and sets @p __size if the input was counted in full without errors, @c false otherwise.
+		//////
+		template <typename _Input, typename _Encoding, typename _State>
+		constexpr bool __decode_exact_size(
+			::std::size_t& __size, _Input& __input, const _Encoding& __encoding, const _State& __state) {
+			if constexpr (::std::is_copy_constructible_v<_State>
+				&& __is_detected_v<__detect_adl_internal_text_count_code_units, _Input&, const _Encoding&,
+				     __error_flag_handler&, _State>) {
+				_State __count_state(__state);
+				bool __errored = false;
+				__error_flag_handler __handler(__errored);
+				auto __result = count_code_units(__input, __encoding, __handler, __count_state);
+				if (__errored || __result.error_code != encoding_error::ok || !__adl::__adl_empty(__result.input)) {
+					return false;
+				}
+				__size = __result.count;
+				return true;
+			}
+			else {
+				(void)__input;
+				(void)__encoding;
+				(void)__state;
+				return false;
+			}
+		}
+
+		//////
+		/// @brief Computes the exact number of code units encoding @p __input produces, if the encoding has a fast
+		/// way of counting them. No error handlers are called.
+		///
+		/// @returns @c true and sets @p __size if the input was counted in full without errors, @c false otherwise.
+		//////
+		template <typename _Input, typename _Encoding, typename _State>
+		constexpr bool __encode_exact_size(
+			::std::size_t& __size, _Input& __input, const _Encoding& __encoding, const _State& __state) {
+			if constexpr (::std::is_copy_constructible_v<_State>
+				&& __is_detected_v<__detect_adl_internal_text_count_code_points, _Input&, const _Encoding&,
+				     __error_flag_handler&, _State>) {
+				_State __count_state(__state);
+				bool __errored = false;
+				__error_flag_handler __handler(__errored);
+				auto __result = count_code_points(__input, __encoding, __handler, __count_state);
+				if (__errored || __result.error_code != encoding_error::ok || !__adl::__adl_empty(__result.input)) {
+					return false;
+				}
+				__size = __result.count;
+				return true;
+			}
+			else {
+				(void)__input;
+				(void)__encoding;
+				(void)__state;
+				return false;
+			}
+		}
+
+		//////
+		/// @brief Picks the size to give a container before writing into it directly.
+		///
+		/// @param[out] __size The size to use.
+		/// @param[in]  __sizing The requested strategy.
+		/// @param[in]  __upper_bound The worst-case size.
+		/// @param[in]  __count A function object that sets its argument to the exact size and returns @c true , or
+		/// returns @c false if there is no cheap exact size.
+		///
+		/// @returns @c false if the container should be filled in incrementally instead.
+		//////
+		template <typename _Count>
+		constexpr bool __pick_output_size(
+			::std::size_t& __size, output_sizing __sizing, ::std::size_t __upper_bound, _Count&& __count) {
+			switch (__sizing) {
+			case output_sizing::incremental:
+				return false;
+			case output_sizing::upper_bound:
+				__size = __upper_bound;
+				return true;
+			case output_sizing::exact:
+				if (!__count(__size)) {
+					__size = __upper_bound;
+				}
+				return true;
+			case output_sizing::automatic:
+			default:
+				return __count(__size);
+			}
+		}
+
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#endif // ZTD_TEXT_DETAIL_SIZED_OUTPUT_HPP
@@ -0,0 +1,195 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_SKIP_ASCII_HPP
+#define ZTD_TEXT_DETAIL_SKIP_ASCII_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/detail/cpu_dispatch.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_SIMD_X86_I_)
+#include <immintrin.h>
+#endif
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		template <::std::size_t _Size>
+		using __ascii_scan_unsigned_t = ::std::conditional_t<_Size == 1, unsigned char,
+			::std::conditional_t<_Size == 2, char16_t, char32_t>>;
+
+		//////
+		/// @brief Finds the end of the run of ASCII (<tt>[0, 0x7F]</tt>) values at the start of the input, one value
+		/// at a time.
+		///
+		/// @returns A pointer to the first value that is not ASCII, or @p __last if all of them are.
+		//////
+		template <typename _CodeUnit>
+		constexpr const _CodeUnit* __skip_ascii_scalar(const _CodeUnit* __first, const _CodeUnit* __last) noexcept {
+			using _UValue = __ascii_scan_unsigned_t<sizeof(_CodeUnit)>;
+			for (; __first != __last; ++__first) {
+				if (static_cast<_UValue>(*__first) > static_cast<_UValue>(0x7F)) {
+					break;
+				}
+			}
+			return __first;
+		}
+
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_SIMD_X86_I_)
+		// For every value width, the bits that must be clear for a value to be ASCII. Checking each byte of
+		// (value & mask) against 0 works for every width, and the first non-zero byte is in the first non-ASCII
+		// value.
+		template <::std::size_t _Size>
+		inline constexpr unsigned int __ascii_scan_mask = _Size == 1 ? 0x80808080u
+			: _Size == 2                                             ? 0xFF80FF80u
+			                                                         : 0xFFFFFF80u;
+
+		template <::std::size_t _Size>
+		ZTD_TEXT_TARGET_I_("sse2")
+		inline const unsigned char* __skip_ascii_sse2(
+			const unsigned char* __first, const unsigned char* __last) noexcept {
+			const __m128i __mask = _mm_set1_epi32(static_cast<int>(__ascii_scan_mask<_Size>));
+			const __m128i __zero = _mm_setzero_si128();
+			while ((__last - __first) >= 64) {
+				const __m128i __any = _mm_or_si128(
+					_mm_or_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(__first)),
+					     _mm_loadu_si128(reinterpret_cast<const __m128i*>(__first + 16))),
+					_mm_or_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(__first + 32)),
+					     _mm_loadu_si128(reinterpret_cast<const __m128i*>(__first + 48))));
+				if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(__any, __mask), __zero)) != 0xFFFF) {
+					break;
+				}
+				__first += 64;
+			}
+			while ((__last - __first) >= 16) {
+				const __m128i __input          = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__first));
+				const __m128i __ascii          = _mm_cmpeq_epi8(_mm_and_si128(__input, __mask), __zero);
+				const unsigned int __non_ascii = static_cast<unsigned int>(_mm_movemask_epi8(__ascii)) ^ 0xFFFFu;
+				if (__non_ascii != 0) {
+					const unsigned int __byte = static_cast<unsigned int>(__builtin_ctz(__non_ascii));
+					return __first + (__byte - (__byte % _Size));
+				}
+				__first += 16;
+			}
+			return __first;
+		}
+
+		template <::std::size_t _Size>
+		ZTD_TEXT_TARGET_I_("avx2")
+		inline const unsigned char* __skip_ascii_avx2(
+			const unsigned char* __first, const unsigned char* __last) noexcept {
+			const __m256i __mask = _mm256_set1_epi32(static_cast<int>(__ascii_scan_mask<_Size>));
+			while ((__last - __first) >= 128) {
+				const __m256i __any = _mm256_or_si256(
+					_mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(__first)),
+					     _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__first + 32))),
+					_mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(__first + 64)),
+					     _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__first + 96))));
+				if (!_mm256_testz_si256(__any, __mask)) {
+					break;
+				}
+				__first += 128;
+			}
+			while ((__last - __first) >= 32) {
+				const __m256i __input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__first));
+				if (!_mm256_testz_si256(__input, __mask)) {
+					break;
+				}
+				__first += 32;
+			}
+			return __skip_ascii_sse2<_Size>(__first, __last);
+		}
+
+		inline const unsigned char* __skip_ascii_none(const unsigned char* __first, const unsigned char*) noexcept {
+			return __first;
+		}
+
+		using __skip_ascii_function = const unsigned char* (*)(const unsigned char*, const unsigned char*) noexcept;
+
+		template <::std::size_t _Size>
+		inline constexpr __isa_table<__skip_ascii_function> __skip_ascii_kernels
+			= { &__skip_ascii_none, &__skip_ascii_sse2<_Size>, &__skip_ascii_sse2<_Size>,
+				  &__skip_ascii_avx2<_Size> };
+
+		//////
+		/// @brief Skips the ASCII run at the start of the input in blocks of up to 128 bytes, for values that are
+		/// @p _Size bytes wide.
+		///
+		/// @remarks Stops at a block boundary (when there are fewer than 16 bytes left) or at the first value that
+		/// is not ASCII. @p __last - @p __first must be a multiple of @p _Size.
+		//////
+		template <::std::size_t _Size>
+		inline const unsigned char* __skip_ascii_vectorized(
+			const unsigned char* __first, const unsigned char* __last) noexcept {
+			static const __skip_ascii_function __skip = __isa_select(__skip_ascii_kernels<_Size>);
+			return __skip(__first, __last);
+		}
+#endif
+
+		//////
+		/// @brief Finds the end of the run of ASCII values at the start of the input, using the vectorized kernels
+		/// when not in a constant expression.
+		///
+		/// @returns A pointer to the first value above @c 0x7F, or @p __last if there is none. This is always the
+		/// same as what ztd::text::__txt_detail::__skip_ascii_scalar returns.
+		///
+		/// @remarks This is the shared fast path for mostly-ASCII text: callers skip (or copy, or count) the run it
+		/// finds in one go and only use their per-character loop for what comes after it.
+		//////
+		template <typename _CodeUnit>
+		constexpr const _CodeUnit* __skip_ascii(const _CodeUnit* __first, const _CodeUnit* __last) noexcept {
+			static_assert(sizeof(_CodeUnit) == 1 || sizeof(_CodeUnit) == 2 || sizeof(_CodeUnit) == 4,
+				"the value type must be 1, 2 or 4 bytes in size");
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_SIMD_X86_I_) && ZTD_TEXT_IS_ON(ZTD_TEXT_STD_LIBRARY_IS_CONSTANT_EVALUATED_I_)
+			constexpr ::std::ptrdiff_t __block_size = static_cast<::std::ptrdiff_t>(16 / sizeof(_CodeUnit));
+			if (!::std::is_constant_evaluated() && (__last - __first) >= __block_size) {
+				const unsigned char* __ufirst = reinterpret_cast<const unsigned char*>(__first);
+				const unsigned char* __ulast  = reinterpret_cast<const unsigned char*>(__last);
+				__first += (__skip_ascii_vectorized<sizeof(_CodeUnit)>(__ufirst, __ulast) - __ufirst)
+					/ static_cast<::std::ptrdiff_t>(sizeof(_CodeUnit));
+			}
+#endif
+			return __skip_ascii_scalar(__first, __last);
+		}
+
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#endif // ZTD_TEXT_DETAIL_SKIP_ASCII_HPP
@@ -210,7 +210,10 @@ namespace ztd { namespace text {
 						::std::forward<_Input>(__input), __output_range, __error_handler, __state);
 				}
 				else if constexpr (
-					__is_encode_error_handler_callable_v<_UEncoding, _UInput, _Blackhole, _ErrorHandler,
+					// a view passed by value is the rest of the caller's output: only scratch buffers (always big
+					// enough for one encode) or already-unbounded outputs can drop their end
+					(::std::is_lvalue_reference_v<_Output> || ::std::is_same_v<_Sentinel, infinity_sentinel_t>)
+					&& __is_encode_error_handler_callable_v<_UEncoding, _UInput, _Blackhole, _ErrorHandler,
 					     _State> && __is_encode_one_callable_v<_UEncoding, _UInput, _Unbounded, _ErrorHandler, _State>) {
 					auto __first = __adl::__adl_begin(::std::forward<_Output>(__output));
 					_Unbounded __output_range(::std::move(__first));
@@ -330,8 +333,23 @@ namespace ztd { namespace text {
 						__intermediate_result.handled_errors);
 				}
 			}
-			_WorkingIntermediate __intermediate_view = __reconstruct(::std::in_place_type<_WorkingIntermediate>,
-				__adl::__adl_begin(__intermediate), __adl::__adl_begin(__intermediate_result.output));
+			_WorkingIntermediate __intermediate_view = [&]() {
+				auto __intermediate_first = __adl::__adl_begin(__intermediate);
+				auto __intermediate_last  = __adl::__adl_begin(__intermediate_result.output);
+				if constexpr (!::std::is_same_v<decltype(__intermediate_first), decltype(__intermediate_last)>
+					&& __is_iterator_concept_or_better_v<contiguous_iterator_tag,
+					     __range_iterator_t<_IntermediateContainer>>) {
+					// the decode wrote through a different (but still contiguous) view of the intermediate, as
+					// type-erased encodings do
+					return __reconstruct(::std::in_place_type<_WorkingIntermediate>,
+						__adl::__adl_to_address(__intermediate_first),
+						__adl::__adl_to_address(__intermediate_last));
+				}
+				else {
+					return __reconstruct(::std::in_place_type<_WorkingIntermediate>,
+						::std::move(__intermediate_first), ::std::move(__intermediate_last));
+				}
+			}();
 			auto __end_result = __basic_encode_one<_ConsumeIntoTheNothingness>(__intermediate_view, __to_encoding,
 				::std::forward<_Output>(__output), __to_error_handler, __to_state);
 
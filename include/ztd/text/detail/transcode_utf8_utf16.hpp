@@ -0,0 +1,610 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_TRANSCODE_UTF8_UTF16_HPP
+#define ZTD_TEXT_DETAIL_TRANSCODE_UTF8_UTF16_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/char8_t.hpp>
+#include <ztd/text/detail/unicode.hpp>
+#include <ztd/text/detail/validate_utf8.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_SIMD_X86_I_)
+#include <immintrin.h>
+#endif
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		//////
+		/// @brief Converts strict UTF-8 to UTF-16 one sequence at a time, until @p __in reaches @p __in_stop.
+		///
+		/// @returns @c true if @p __in reached @p __in_stop, or @c false if it stopped early because the sequence at
+		/// @p __in does not decode or because there is not enough room in the output for it.
+		///
+		/// @remarks Sequences may run past @p __in_stop, up to @p __in_last. Both pointers are left at the start of
+		/// the sequence that was not converted, so that the normal one-at-a-time path can pick up from there.
+		//////
+		template <typename _InCodeUnit, typename _OutCodeUnit>
+		constexpr bool __utf8_to_utf16_scalar(const _InCodeUnit*& __in, const _InCodeUnit* __in_stop,
+			const _InCodeUnit* __in_last, _OutCodeUnit*& __out, _OutCodeUnit* __out_last) noexcept {
+			char32_t __decoded {};
+			while (__in < __in_stop) {
+				if (__out == __out_last) {
+					return false;
+				}
+				const ::std::ptrdiff_t __length = __utf8_decode_strict(__in, __in_last, __decoded);
+				if (__length == 0) {
+					return false;
+				}
+				if (__decoded <= __last_bmp_value) {
+					*__out = static_cast<_OutCodeUnit>(__decoded);
+					++__out;
+				}
+				else {
+					if ((__out_last - __out) < 2) {
+						return false;
+					}
+					const char32_t __normal = __decoded - __normalizing_value;
+					__out[0]
+						= static_cast<_OutCodeUnit>(__first_lead_surrogate + (__normal >> __lead_shifted_bits));
+					__out[1] = static_cast<_OutCodeUnit>(
+						__first_trail_surrogate + (__normal & __trail_surrogate_bitmask));
+					__out += 2;
+				}
+				__in += __length;
+			}
+			return true;
+		}
+
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_SIMD_X86_I_)
+		struct __utf16_compress_table {
+			alignas(16) unsigned char __shuffles[256][16];
+		};
+
+		// For every 8-bit mask of 16-bit lanes to drop, a byte shuffle that moves the kept lanes to the front.
+		inline constexpr __utf16_compress_table __make_utf16_compress_table() noexcept {
+			__utf16_compress_table __table {};
+			for (unsigned int __mask = 0; __mask < 256; ++__mask) {
+				unsigned int __kept = 0;
+				for (unsigned int __lane = 0; __lane < 8; ++__lane) {
+					if ((__mask & (1u << __lane)) == 0) {
+						__table.__shuffles[__mask][__kept * 2]     = static_cast<unsigned char>(__lane * 2);
+						__table.__shuffles[__mask][__kept * 2 + 1] = static_cast<unsigned char>(__lane * 2 + 1);
+						++__kept;
+					}
+				}
+				for (; __kept < 8; ++__kept) {
+					__table.__shuffles[__mask][__kept * 2]     = 0x80;
+					__table.__shuffles[__mask][__kept * 2 + 1] = 0x80;
+				}
+			}
+			return __table;
+		}
+
+		inline constexpr __utf16_compress_table __utf16_compress = __make_utf16_compress_table();
+
+		struct __utf16_shift_table {
+			alignas(16) unsigned char __shuffles[17][16];
+		};
+
+		// For every shift from -8 to 8 (stored at that plus 8), a byte shuffle that moves each 16-bit lane that many
+		// lanes towards the front, zeroing the lanes that nothing moves into.
+		inline constexpr __utf16_shift_table __make_utf16_shift_table() noexcept {
+			__utf16_shift_table __table {};
+			for (int __shift = -8; __shift <= 8; ++__shift) {
+				for (int __byte = 0; __byte < 16; ++__byte) {
+					const int __from = __byte + __shift * 2;
+					__table.__shuffles[__shift + 8][__byte]
+						= (__from >= 0 && __from < 16) ? static_cast<unsigned char>(__from) : 0x80;
+				}
+			}
+			return __table;
+		}
+
+		inline constexpr __utf16_shift_table __utf16_shift = __make_utf16_shift_table();
+
+		//////
+		/// @brief Converts one block of 16 bytes made up only of ASCII and 2-byte sequences, starting at a sequence
+		/// boundary.
+		///
+		/// @returns @c false, and writes nothing, if the block has anything else in it (including sequences that
+		/// are malformed). There must be room for 16 code units in the output.
+		///
+		/// @remarks Only the code units that were decoded are written: nothing past them is changed.
+		//////
+		ZTD_TEXT_TARGET_I_("sse4.2")
+		inline bool __utf8_to_utf16_two_byte_block_sse42(
+			const unsigned char*& __in, char16_t*& __out, __m128i __input) noexcept {
+			const unsigned int __ascii = ~static_cast<unsigned int>(_mm_movemask_epi8(__input)) & 0xFFFFu;
+			const unsigned int __continuation = static_cast<unsigned int>(
+				_mm_movemask_epi8(_mm_cmplt_epi8(__input, _mm_set1_epi8(static_cast<char>(0xC0)))));
+			const __m128i __lead_bytes
+				= _mm_andnot_si128(_mm_cmpgt_epi8(__input, _mm_set1_epi8(static_cast<char>(0xDF))),
+				     _mm_cmpgt_epi8(__input, _mm_set1_epi8(static_cast<char>(0xC1))));
+			const unsigned int __lead = static_cast<unsigned int>(_mm_movemask_epi8(__lead_bytes));
+			if ((__ascii | __continuation | __lead) != 0xFFFFu || __continuation != ((__lead << 1) & 0xFFFFu)) {
+				return false;
+			}
+			// a lead in the last byte has its continuation in the next block: leave it for later
+			const unsigned int __skip = __continuation | (__lead & 0x8000u);
+
+			const __m128i __zero      = _mm_setzero_si128();
+			const __m128i __next      = _mm_srli_si128(__input, 1);
+			const __m128i __low_bits  = _mm_set1_epi16(0x3F);
+			const __m128i __high_bits = _mm_set1_epi16(0x1F);
+
+			const __m128i __units_low  = _mm_unpacklo_epi8(__input, __zero);
+			const __m128i __units_high = _mm_unpackhi_epi8(__input, __zero);
+			const __m128i __pairs_low
+				= _mm_or_si128(_mm_slli_epi16(_mm_and_si128(__units_low, __high_bits), 6),
+				     _mm_and_si128(_mm_unpacklo_epi8(__next, __zero), __low_bits));
+			const __m128i __pairs_high
+				= _mm_or_si128(_mm_slli_epi16(_mm_and_si128(__units_high, __high_bits), 6),
+				     _mm_and_si128(_mm_unpackhi_epi8(__next, __zero), __low_bits));
+			const __m128i __decoded_low
+				= _mm_blendv_epi8(__units_low, __pairs_low, _mm_unpacklo_epi8(__lead_bytes, __lead_bytes));
+			const __m128i __decoded_high
+				= _mm_blendv_epi8(__units_high, __pairs_high, _mm_unpackhi_epi8(__lead_bytes, __lead_bytes));
+
+			const unsigned int __skip_low  = __skip & 0xFFu;
+			const unsigned int __skip_high = __skip >> 8;
+			const __m128i __low            = _mm_shuffle_epi8(__decoded_low,
+				_mm_load_si128(reinterpret_cast<const __m128i*>(__utf16_compress.__shuffles[__skip_low])));
+			const __m128i __high           = _mm_shuffle_epi8(__decoded_high,
+				_mm_load_si128(reinterpret_cast<const __m128i*>(__utf16_compress.__shuffles[__skip_high])));
+			const int __low_size           = 8 - __builtin_popcount(__skip_low);
+			const int __high_size          = 8 - __builtin_popcount(__skip_high);
+			const int __size               = __low_size + __high_size;
+			// the block starts and ends at sequence boundaries, so there are always at least 8 code units: the last
+			// 8 of them (the end of the low half, then the high half) are stored over the low half's slack
+			const __m128i __tail = _mm_or_si128(
+				_mm_shuffle_epi8(__low,
+				     _mm_load_si128(reinterpret_cast<const __m128i*>(__utf16_shift.__shuffles[__size]))),
+				_mm_shuffle_epi8(__high,
+				     _mm_load_si128(reinterpret_cast<const __m128i*>(__utf16_shift.__shuffles[__high_size]))));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(__out), __low);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(__out + __size - 8), __tail);
+			__out += __size;
+			__in += ((__lead & 0x8000u) != 0) ? 15 : 16;
+			return true;
+		}
+
+		ZTD_TEXT_TARGET_I_("sse4.2")
+		inline void __utf8_to_utf16_sse42(const unsigned char*& __in, const unsigned char* __in_last,
+			char16_t*& __out, char16_t* __out_last) noexcept {
+			const __m128i __zero = _mm_setzero_si128();
+			while ((__in_last - __in) >= 16 && (__out_last - __out) >= 16) {
+				const __m128i __input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__in));
+				if (_mm_movemask_epi8(__input) == 0) {
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(__out), _mm_unpacklo_epi8(__input, __zero));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(__out + 8), _mm_unpackhi_epi8(__input, __zero));
+					__in += 16;
+					__out += 16;
+					continue;
+				}
+				if (!__utf8_to_utf16_two_byte_block_sse42(__in, __out, __input)) {
+					break;
+				}
+			}
+		}
+
+		ZTD_TEXT_TARGET_I_("avx2")
+		inline void __utf8_to_utf16_avx2(const unsigned char*& __in, const unsigned char* __in_last,
+			char16_t*& __out, char16_t* __out_last) noexcept {
+			while ((__in_last - __in) >= 32 && (__out_last - __out) >= 32) {
+				const __m256i __input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__in));
+				if (_mm256_movemask_epi8(__input) == 0) {
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(__out),
+						_mm256_cvtepu8_epi16(_mm256_castsi256_si128(__input)));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(__out + 16),
+						_mm256_cvtepu8_epi16(_mm256_extracti128_si256(__input, 1)));
+					__in += 32;
+					__out += 32;
+					continue;
+				}
+				if (!__utf8_to_utf16_two_byte_block_sse42(
+					    __in, __out, _mm_loadu_si128(reinterpret_cast<const __m128i*>(__in)))) {
+					break;
+				}
+			}
+			while ((__in_last - __in) >= 16 && (__out_last - __out) >= 16) {
+				const __m128i __input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__in));
+				if (_mm_movemask_epi8(__input) == 0) {
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(__out), _mm256_cvtepu8_epi16(__input));
+					__in += 16;
+					__out += 16;
+					continue;
+				}
+				if (!__utf8_to_utf16_two_byte_block_sse42(__in, __out, __input)) {
+					break;
+				}
+			}
+		}
+
+		inline void __utf8_to_utf16_none(
+			const unsigned char*&, const unsigned char*, char16_t*&, char16_t*) noexcept {
+		}
+
+		using __utf8_to_utf16_function
+			= void (*)(const unsigned char*&, const unsigned char*, char16_t*&, char16_t*) noexcept;
+
+		inline constexpr __isa_table<__utf8_to_utf16_function> __utf8_to_utf16_kernels
+			= { &__utf8_to_utf16_none, &__utf8_to_utf16_none, &__utf8_to_utf16_sse42, &__utf8_to_utf16_avx2 };
+
+		//////
+		/// @brief Converts the blocks at the start of the input that are entirely ASCII or 2-byte sequences, stopping
+		/// at the first block that is not (or that does not fit in the output).
+		//////
+		inline void __utf8_to_utf16_vectorized(const unsigned char*& __in, const unsigned char* __in_last,
+			char16_t*& __out, char16_t* __out_last) noexcept {
+			static const __utf8_to_utf16_function __convert = __isa_select(__utf8_to_utf16_kernels);
+			__convert(__in, __in_last, __out, __out_last);
+		}
+#endif
+
+		//////
+		/// @brief Converts strict UTF-8 to UTF-16 in bulk, using the vectorized kernels when not in a constant
+		/// expression.
+		///
+		/// @remarks Stops with @p __in at the start of the first sequence that does not decode or that does not
+		/// fit in the output, and @p __out just past the last code unit written. This is always the same as what
+		/// ztd::text::__txt_detail::__utf8_to_utf16_scalar does with the whole input.
+		//////
+		template <typename _InCodeUnit, typename _OutCodeUnit>
+		constexpr void __utf8_to_utf16(const _InCodeUnit*& __in, const _InCodeUnit* __in_last, _OutCodeUnit*& __out,
+			_OutCodeUnit* __out_last) noexcept {
+			static_assert(sizeof(_InCodeUnit) == sizeof(unsigned char),
+				"the input code unit type must be a single byte in size for UTF-8");
+			static_assert(sizeof(_OutCodeUnit) == sizeof(char16_t),
+				"the output code unit type must be two bytes in size for UTF-16");
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_SIMD_X86_I_) && ZTD_TEXT_IS_ON(ZTD_TEXT_STD_LIBRARY_IS_CONSTANT_EVALUATED_I_)
+			if (!::std::is_constant_evaluated()) {
+				for (;;) {
+					const unsigned char* __vin_first = reinterpret_cast<const unsigned char*>(__in);
+					char16_t* __vout_first           = reinterpret_cast<char16_t*>(__out);
+					const unsigned char* __vin       = __vin_first;
+					char16_t* __vout                 = __vout_first;
+					__utf8_to_utf16_vectorized(__vin, reinterpret_cast<const unsigned char*>(__in_last), __vout,
+						reinterpret_cast<char16_t*>(__out_last));
+					__in += __vin - __vin_first;
+					__out += __vout - __vout_first;
+					// work through whatever stopped the vector loop one sequence at a time, then try again
+					const _InCodeUnit* __in_stop = (__in_last - __in) > 16 ? __in + 16 : __in_last;
+					if (!__utf8_to_utf16_scalar(__in, __in_stop, __in_last, __out, __out_last)
+						|| __in == __in_last) {
+						return;
+					}
+				}
+			}
+#endif
+			__utf8_to_utf16_scalar(__in, __in_last, __in_last, __out, __out_last);
+		}
+
+		//////
+		/// @brief Converts strict UTF-16 to UTF-8 one code point at a time, until @p __in reaches @p __in_stop.
+		///
+		/// @returns @c true if @p __in reached @p __in_stop, or @c false if it stopped early because of an unpaired
+		/// surrogate (including a leading surrogate cut off by @p __in_last) or because there is not enough room in
+		/// the output for the code point at @p __in.
+		//////
+		template <typename _InCodeUnit, typename _OutCodeUnit>
+		constexpr bool __utf16_to_utf8_scalar(const _InCodeUnit*& __in, const _InCodeUnit* __in_stop,
+			const _InCodeUnit* __in_last, _OutCodeUnit*& __out, _OutCodeUnit* __out_last) noexcept {
+			while (__in < __in_stop) {
+				const char32_t __unit0 = static_cast<char16_t>(*__in);
+				const ::std::ptrdiff_t __room = __out_last - __out;
+				if (__unit0 <= __last_1byte_value) {
+					if (__room < 1) {
+						return false;
+					}
+					__out[0] = static_cast<_OutCodeUnit>(__unit0);
+					__out += 1;
+					__in += 1;
+				}
+				else if (__unit0 <= __last_2byte_value) {
+					if (__room < 2) {
+						return false;
+					}
+					__out[0] = static_cast<_OutCodeUnit>(0xC0 | (__unit0 >> 6));
+					__out[1] = static_cast<_OutCodeUnit>(0x80 | (__unit0 & 0x3F));
+					__out += 2;
+					__in += 1;
+				}
+				else if (!__is_surrogate(__unit0)) {
+					if (__room < 3) {
+						return false;
+					}
+					__out[0] = static_cast<_OutCodeUnit>(0xE0 | (__unit0 >> 12));
+					__out[1] = static_cast<_OutCodeUnit>(0x80 | ((__unit0 >> 6) & 0x3F));
+					__out[2] = static_cast<_OutCodeUnit>(0x80 | (__unit0 & 0x3F));
+					__out += 3;
+					__in += 1;
+				}
+				else {
+					if (!__is_lead_surrogate(__unit0) || (__in_last - __in) < 2
+						|| !__is_trail_surrogate(static_cast<char16_t>(__in[1])) || __room < 4) {
+						return false;
+					}
+					const char32_t __decoded = __utf16_combine_surrogates(
+						static_cast<char16_t>(__unit0), static_cast<char16_t>(__in[1]));
+					__out[0] = static_cast<_OutCodeUnit>(0xF0 | (__decoded >> 18));
+					__out[1] = static_cast<_OutCodeUnit>(0x80 | ((__decoded >> 12) & 0x3F));
+					__out[2] = static_cast<_OutCodeUnit>(0x80 | ((__decoded >> 6) & 0x3F));
+					__out[3] = static_cast<_OutCodeUnit>(0x80 | (__decoded & 0x3F));
+					__out += 4;
+					__in += 2;
+				}
+			}
+			return true;
+		}
+
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_SIMD_X86_I_)
+		struct __utf8_compress_table {
+			alignas(16) unsigned char __shuffles[256][16];
+		};
+
+		// Indexed by a 4-bit mask of the 32-bit lanes at or above 0x80, plus a 4-bit mask (shifted up by 4) of the
+		// lanes at or above 0x800: a byte shuffle that keeps the first 1, 2 or 3 bytes of each lane.
+		inline constexpr __utf8_compress_table __make_utf8_compress_table() noexcept {
+			__utf8_compress_table __table {};
+			for (unsigned int __mask = 0; __mask < 256; ++__mask) {
+				unsigned int __kept = 0;
+				for (unsigned int __lane = 0; __lane < 4; ++__lane) {
+					const unsigned int __length
+						= 1 + ((__mask >> __lane) & 1u) + ((__mask >> (__lane + 4)) & 1u);
+					for (unsigned int __byte = 0; __byte < __length; ++__byte) {
+						__table.__shuffles[__mask][__kept] = static_cast<unsigned char>(__lane * 4 + __byte);
+						++__kept;
+					}
+				}
+				for (; __kept < 16; ++__kept) {
+					__table.__shuffles[__mask][__kept] = 0x80;
+				}
+			}
+			return __table;
+		}
+
+		inline constexpr __utf8_compress_table __utf8_compress = __make_utf8_compress_table();
+
+		//////
+		/// @brief Encodes 4 code units in the Basic Multilingual Plane (no surrogates), widened to 32-bit lanes, as
+		/// 4 to 12 bytes of UTF-8.
+		///
+		/// @returns The UTF-8 at the start of a vector, with @p __size set to how many of its bytes that is.
+		//////
+		ZTD_TEXT_TARGET_I_("sse4.2")
+		inline __m128i __utf16_to_utf8_bmp_lanes_sse42(__m128i __units, ::std::size_t& __size) noexcept {
+			const __m128i __low_bits     = _mm_set1_epi32(0x3F);
+			const __m128i __continuation = _mm_set1_epi32(0x80);
+			const __m128i __two_bytes    = _mm_cmpgt_epi32(__units, _mm_set1_epi32(0x7F));
+			const __m128i __three_bytes  = _mm_cmpgt_epi32(__units, _mm_set1_epi32(0x7FF));
+			const __m128i __low6         = _mm_and_si128(__units, __low_bits);
+			const __m128i __middle6      = _mm_and_si128(_mm_srli_epi32(__units, 6), __low_bits);
+			const __m128i __lead2        = _mm_or_si128(_mm_srli_epi32(__units, 6), _mm_set1_epi32(0xC0));
+			const __m128i __lead3        = _mm_or_si128(_mm_srli_epi32(__units, 12), _mm_set1_epi32(0xE0));
+			// byte 0: the unit itself, a 2-byte lead or a 3-byte lead
+			const __m128i __byte0
+				= _mm_blendv_epi8(_mm_blendv_epi8(__units, __lead2, __two_bytes), __lead3, __three_bytes);
+			// byte 1: the last continuation for 2 bytes, the middle one for 3 bytes; byte 2: the last continuation
+			const __m128i __byte1 = _mm_or_si128(_mm_blendv_epi8(__low6, __middle6, __three_bytes), __continuation);
+			const __m128i __byte2 = _mm_or_si128(__low6, __continuation);
+			const __m128i __lanes = _mm_or_si128(
+				__byte0, _mm_or_si128(_mm_slli_epi32(__byte1, 8), _mm_slli_epi32(__byte2, 16)));
+			const unsigned int __two_mask
+				= static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(__two_bytes)));
+			const unsigned int __three_mask
+				= static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(__three_bytes)));
+			const __m128i __shuffle = _mm_load_si128(
+				reinterpret_cast<const __m128i*>(__utf8_compress.__shuffles[__two_mask | (__three_mask << 4)]));
+			__size = static_cast<::std::size_t>(
+				4 + __builtin_popcount(__two_mask) + __builtin_popcount(__three_mask));
+			return _mm_shuffle_epi8(__lanes, __shuffle);
+		}
+
+		//////
+		/// @brief Whether any of the 8 code units in @p __input is a surrogate.
+		//////
+		ZTD_TEXT_TARGET_I_("sse4.2")
+		inline bool __utf16_has_surrogate_sse42(__m128i __input) noexcept {
+			const __m128i __surrogates = _mm_cmpeq_epi16(
+				_mm_and_si128(__input, _mm_set1_epi16(static_cast<short>(0xF800))),
+				_mm_set1_epi16(static_cast<short>(0xD800)));
+			return !_mm_testz_si128(__surrogates, __surrogates);
+		}
+
+		//////
+		/// @brief Stores the first @p __size bytes of @p __bytes , writing over no more than 7 bytes past them.
+		//////
+		ZTD_TEXT_TARGET_I_("sse4.2")
+		inline void __utf16_to_utf8_store_lanes_sse42(
+			unsigned char* __out, __m128i __bytes, ::std::size_t __size) noexcept {
+			if (__size <= 8) {
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(__out), __bytes);
+			}
+			else {
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(__out), __bytes);
+			}
+		}
+
+		//////
+		/// @brief Converts one block of 8 code units that has no surrogates in it.
+		///
+		/// @returns @c false, and writes nothing, if there is a surrogate anywhere in the block. There must be room
+		/// for 32 bytes in the output.
+		///
+		/// @remarks Whole vectors are stored when the loops calling this are certain to store another block right
+		/// after this one: every block writes at least 8 bytes, which covers the up to 7 bytes past the end this one
+		/// wrote over. Otherwise, this is the last block, and only the bytes it encodes are copied to the output.
+		//////
+		ZTD_TEXT_TARGET_I_("sse4.2")
+		inline bool __utf16_to_utf8_bmp_block_sse42(const char16_t*& __in, const char16_t* __in_last,
+			unsigned char*& __out, unsigned char* __out_last, __m128i __input) noexcept {
+			if (__utf16_has_surrogate_sse42(__input)) {
+				return false;
+			}
+			::std::size_t __low_size = 0, __high_size = 0;
+			const __m128i __low  = __utf16_to_utf8_bmp_lanes_sse42(_mm_cvtepu16_epi32(__input), __low_size);
+			const __m128i __high = __utf16_to_utf8_bmp_lanes_sse42(
+				_mm_cvtepu16_epi32(_mm_srli_si128(__input, 8)), __high_size);
+			const ::std::size_t __size = __low_size + __high_size;
+			const bool __followed      = (__in_last - __in) >= 16
+				&& static_cast<::std::size_t>(__out_last - __out) >= __size + 32
+				&& !__utf16_has_surrogate_sse42(_mm_loadu_si128(reinterpret_cast<const __m128i*>(__in + 8)));
+			if (__followed) {
+				__utf16_to_utf8_store_lanes_sse42(__out, __low, __low_size);
+				__utf16_to_utf8_store_lanes_sse42(__out + __low_size, __high, __high_size);
+			}
+			else {
+				alignas(16) unsigned char __encoded[32];
+				_mm_store_si128(reinterpret_cast<__m128i*>(__encoded), __low);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(__encoded + __low_size), __high);
+				::std::memcpy(__out, __encoded, __size);
+			}
+			__out += __size;
+			__in += 8;
+			return true;
+		}
+
+		ZTD_TEXT_TARGET_I_("sse4.2")
+		inline void __utf16_to_utf8_sse42(const char16_t*& __in, const char16_t* __in_last, unsigned char*& __out,
+			unsigned char* __out_last) noexcept {
+			const __m128i __non_ascii = _mm_set1_epi16(static_cast<short>(0xFF80));
+			while ((__in_last - __in) >= 8 && (__out_last - __out) >= 32) {
+				const __m128i __input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__in));
+				if (_mm_testz_si128(__input, __non_ascii)) {
+					_mm_storel_epi64(reinterpret_cast<__m128i*>(__out), _mm_packus_epi16(__input, __input));
+					__in += 8;
+					__out += 8;
+					continue;
+				}
+				if (!__utf16_to_utf8_bmp_block_sse42(__in, __in_last, __out, __out_last, __input)) {
+					break;
+				}
+			}
+		}
+
+		ZTD_TEXT_TARGET_I_("avx2")
+		inline void __utf16_to_utf8_avx2(const char16_t*& __in, const char16_t* __in_last, unsigned char*& __out,
+			unsigned char* __out_last) noexcept {
+			const __m256i __non_ascii = _mm256_set1_epi16(static_cast<short>(0xFF80));
+			while ((__in_last - __in) >= 16 && (__out_last - __out) >= 32) {
+				const __m256i __input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__in));
+				if (_mm256_testz_si256(__input, __non_ascii)) {
+					const __m128i __packed = _mm_packus_epi16(
+						_mm256_castsi256_si128(__input), _mm256_extracti128_si256(__input, 1));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(__out), __packed);
+					__in += 16;
+					__out += 16;
+					continue;
+				}
+				if (!__utf16_to_utf8_bmp_block_sse42(__in, __in_last, __out, __out_last,
+					    _mm_loadu_si128(reinterpret_cast<const __m128i*>(__in)))) {
+					break;
+				}
+			}
+			__utf16_to_utf8_sse42(__in, __in_last, __out, __out_last);
+		}
+
+		inline void __utf16_to_utf8_none(
+			const char16_t*&, const char16_t*, unsigned char*&, unsigned char*) noexcept {
+		}
+
+		using __utf16_to_utf8_function
+			= void (*)(const char16_t*&, const char16_t*, unsigned char*&, unsigned char*) noexcept;
+
+		inline constexpr __isa_table<__utf16_to_utf8_function> __utf16_to_utf8_kernels
+			= { &__utf16_to_utf8_none, &__utf16_to_utf8_none, &__utf16_to_utf8_sse42, &__utf16_to_utf8_avx2 };
+
+		//////
+		/// @brief Converts the blocks at the start of the input that have no surrogates in them, stopping at the
+		/// first block that does (or that may not fit in the output).
+		//////
+		inline void __utf16_to_utf8_vectorized(const char16_t*& __in, const char16_t* __in_last,
+			unsigned char*& __out, unsigned char* __out_last) noexcept {
+			static const __utf16_to_utf8_function __convert = __isa_select(__utf16_to_utf8_kernels);
+			__convert(__in, __in_last, __out, __out_last);
+		}
+#endif
+
+		//////
+		/// @brief Converts strict UTF-16 to UTF-8 in bulk, using the vectorized kernels when not in a constant
+		/// expression.
+		///
+		/// @remarks Stops with @p __in at the first unpaired surrogate or at the first code point that does not fit
+		/// in the output, and @p __out just past the last code unit written. This is always the same as what
+		/// ztd::text::__txt_detail::__utf16_to_utf8_scalar does with the whole input.
+		//////
+		template <typename _InCodeUnit, typename _OutCodeUnit>
+		constexpr void __utf16_to_utf8(const _InCodeUnit*& __in, const _InCodeUnit* __in_last, _OutCodeUnit*& __out,
+			_OutCodeUnit* __out_last) noexcept {
+			static_assert(sizeof(_InCodeUnit) == sizeof(char16_t),
+				"the input code unit type must be two bytes in size for UTF-16");
+			static_assert(sizeof(_OutCodeUnit) == sizeof(unsigned char),
+				"the output code unit type must be a single byte in size for UTF-8");
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_SIMD_X86_I_) && ZTD_TEXT_IS_ON(ZTD_TEXT_STD_LIBRARY_IS_CONSTANT_EVALUATED_I_)
+			if (!::std::is_constant_evaluated()) {
+				for (;;) {
+					const char16_t* __vin_first       = reinterpret_cast<const char16_t*>(__in);
+					unsigned char* __vout_first       = reinterpret_cast<unsigned char*>(__out);
+					const char16_t* __vin             = __vin_first;
+					unsigned char* __vout             = __vout_first;
+					__utf16_to_utf8_vectorized(__vin, reinterpret_cast<const char16_t*>(__in_last), __vout,
+						reinterpret_cast<unsigned char*>(__out_last));
+					__in += __vin - __vin_first;
+					__out += __vout - __vout_first;
+					// work through whatever stopped the vector loop one code point at a time, then try again
+					const _InCodeUnit* __in_stop = (__in_last - __in) > 8 ? __in + 8 : __in_last;
+					if (!__utf16_to_utf8_scalar(__in, __in_stop, __in_last, __out, __out_last)
+						|| __in == __in_last) {
+						return;
+					}
+				}
+			}
+#endif
+			__utf16_to_utf8_scalar(__in, __in_last, __in_last, __out, __out_last);
+		}
+
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#endif // ZTD_TEXT_DETAIL_TRANSCODE_UTF8_UTF16_HPP
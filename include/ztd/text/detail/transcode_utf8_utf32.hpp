@@ -0,0 +1,86 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_TRANSCODE_UTF8_UTF32_HPP
+#define ZTD_TEXT_DETAIL_TRANSCODE_UTF8_UTF32_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/detail/skip_ascii.hpp>
+#include <ztd/text/detail/validate_utf8.hpp>
+
+#include <cstddef>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		//////
+		/// @brief Converts strict UTF-8 to UTF-32, copying whole runs of ASCII at a time and decoding everything
+		/// else one code point at a time.
+		///
+		/// @remarks Stops with @p __in at the first sequence that does not decode (or is cut off by @p __in_last),
+		/// or when the output is full, and @p __out just past the last code point written.
+		//////
+		template <typename _InCodeUnit, typename _OutCodePoint>
+		constexpr void __utf8_to_utf32(const _InCodeUnit*& __in, const _InCodeUnit* __in_last, _OutCodePoint*& __out,
+			_OutCodePoint* __out_last) noexcept {
+			static_assert(sizeof(_InCodeUnit) == sizeof(unsigned char),
+				"the input code unit type must be a single byte in size for UTF-8");
+			char32_t __decoded {};
+			while (__in != __in_last && __out != __out_last) {
+				const _InCodeUnit* __ascii_last
+					= (__in_last - __in) > (__out_last - __out) ? __in + (__out_last - __out) : __in_last;
+				for (const _InCodeUnit* __ascii_stop = __skip_ascii(__in, __ascii_last); __in != __ascii_stop;
+					++__in, ++__out) {
+					*__out = static_cast<_OutCodePoint>(static_cast<unsigned char>(*__in));
+				}
+				if (__in == __in_last || __out == __out_last) {
+					return;
+				}
+				const ::std::ptrdiff_t __length = __utf8_decode_strict(__in, __in_last, __decoded);
+				if (__length == 0) {
+					return;
+				}
+				*__out = static_cast<_OutCodePoint>(__decoded);
+				++__out;
+				__in += __length;
+			}
+		}
+
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#endif // ZTD_TEXT_DETAIL_TRANSCODE_UTF8_UTF32_HPP
@@ -0,0 +1,682 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_TRANSCODE_UTF_SCHEME_HPP
+#define ZTD_TEXT_DETAIL_TRANSCODE_UTF_SCHEME_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/endian.hpp>
+#include <ztd/text/detail/unicode.hpp>
+#include <ztd/text/detail/cpu_dispatch.hpp>
+
+#include <climits>
+#include <cstddef>
+#include <type_traits>
+
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_SIMD_X86_I_)
+#include <immintrin.h>
+#endif
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		//////
+		/// @brief Reads one @p _Word stored in @p _Endian byte order out of the bytes at @p __in .
+		//////
+		template <endian _Endian, typename _Word, typename _Byte>
+		constexpr _Word __load_word(const _Byte* __in) noexcept {
+			_Word __word = 0;
+			for (::std::size_t __index = 0; __index < sizeof(_Word); ++__index) {
+				const ::std::size_t __significance = _Endian == endian::big ? sizeof(_Word) - 1 - __index : __index;
+				__word |= static_cast<_Word>(static_cast<_Word>(static_cast<unsigned char>(__in[__index]))
+					<< (__significance * CHAR_BIT));
+			}
+			return __word;
+		}
+
+		//////
+		/// @brief Writes @p __word into the bytes at @p __out in @p _Endian byte order.
+		//////
+		template <endian _Endian, typename _Word, typename _Byte>
+		constexpr void __store_word(_Byte* __out, _Word __word) noexcept {
+			for (::std::size_t __index = 0; __index < sizeof(_Word); ++__index) {
+				const ::std::size_t __significance = _Endian == endian::big ? sizeof(_Word) - 1 - __index : __index;
+				__out[__index] = static_cast<_Byte>(static_cast<unsigned char>(__word >> (__significance * CHAR_BIT)));
+			}
+		}
+
+		//////
+		/// @brief Cuts @p __in_last back so that only whole @p _Word s are left between @p __in and it.
+		//////
+		template <typename _Word, typename _Byte>
+		constexpr const _Byte* __whole_words_last(const _Byte* __in, const _Byte* __in_last) noexcept {
+			return __in + ((__in_last - __in) / static_cast<::std::ptrdiff_t>(sizeof(_Word))) * sizeof(_Word);
+		}
+
+		//////
+		/// @brief Decodes UTF-16 stored as bytes until @p __in reaches @p __in_stop.
+		///
+		/// @returns @c true if @p __in reached @p __in_stop, or @c false if it stopped early at an unpaired surrogate
+		/// (including a leading surrogate cut off by @p __in_last) or because the output is full.
+		///
+		/// @remarks The distance between @p __in and both @p __in_stop and @p __in_last must be whole words.
+		//////
+		template <endian _Endian, typename _Byte, typename _CodePoint>
+		constexpr bool __utf16_scheme_to_utf32_scalar(const _Byte*& __in, const _Byte* __in_stop,
+			const _Byte* __in_last, _CodePoint*& __out, _CodePoint* __out_last) noexcept {
+			while (__in < __in_stop) {
+				if (__out == __out_last) {
+					return false;
+				}
+				const char16_t __unit0 = __load_word<_Endian, char16_t>(__in);
+				if (!__is_surrogate(__unit0)) {
+					*__out = static_cast<_CodePoint>(__unit0);
+					++__out;
+					__in += 2;
+					continue;
+				}
+				if (!__is_lead_surrogate(__unit0) || (__in_last - __in) < 4) {
+					return false;
+				}
+				const char16_t __unit1 = __load_word<_Endian, char16_t>(__in + 2);
+				if (!__is_trail_surrogate(__unit1)) {
+					return false;
+				}
+				*__out = static_cast<_CodePoint>(__utf16_combine_surrogates(__unit0, __unit1));
+				++__out;
+				__in += 4;
+			}
+			return true;
+		}
+
+		//////
+		/// @brief Encodes code points as UTF-16 stored as bytes until @p __in reaches @p __in_stop.
+		///
+		/// @returns @c true if @p __in reached @p __in_stop, or @c false if it stopped early at a code point that is
+		/// not a Unicode scalar value or because the output does not have room for the next one.
+		//////
+		template <endian _Endian, typename _CodePoint, typename _Byte>
+		constexpr bool __utf32_to_utf16_scheme_scalar(const _CodePoint*& __in, const _CodePoint* __in_stop,
+			_Byte*& __out, _Byte* __out_last) noexcept {
+			while (__in < __in_stop) {
+				const char32_t __code_point = static_cast<char32_t>(*__in);
+				if (__code_point > __last_code_point || __is_surrogate(__code_point)) {
+					return false;
+				}
+				if (__code_point <= __last_bmp_value) {
+					if ((__out_last - __out) < 2) {
+						return false;
+					}
+					__store_word<_Endian>(__out, static_cast<char16_t>(__code_point));
+					__out += 2;
+				}
+				else {
+					if ((__out_last - __out) < 4) {
+						return false;
+					}
+					const char32_t __normal = __code_point - __normalizing_value;
+					__store_word<_Endian>(
+						__out, static_cast<char16_t>(__first_lead_surrogate + (__normal >> __lead_shifted_bits)));
+					__store_word<_Endian>(__out + 2,
+						static_cast<char16_t>(__first_trail_surrogate + (__normal & __trail_surrogate_bitmask)));
+					__out += 4;
+				}
+				++__in;
+			}
+			return true;
+		}
+
+		//////
+		/// @brief Decodes UTF-32 stored as bytes until @p __in reaches @p __in_stop.
+		///
+		/// @returns @c true if @p __in reached @p __in_stop, or @c false if it stopped early at a value that is not a
+		/// Unicode scalar value or because the output is full.
+		///
+		/// @remarks The distance between @p __in and @p __in_stop must be whole words.
+		//////
+		template <endian _Endian, typename _Byte, typename _CodePoint>
+		constexpr bool __utf32_scheme_to_utf32_scalar(
+			const _Byte*& __in, const _Byte* __in_stop, _CodePoint*& __out, _CodePoint* __out_last) noexcept {
+			for (; __in < __in_stop; __in += 4, ++__out) {
+				if (__out == __out_last) {
+					return false;
+				}
+				const char32_t __code_point = __load_word<_Endian, char32_t>(__in);
+				if (__code_point > __last_code_point || __is_surrogate(__code_point)) {
+					return false;
+				}
+				*__out = static_cast<_CodePoint>(__code_point);
+			}
+			return true;
+		}
+
+		//////
+		/// @brief Encodes code points as UTF-32 stored as bytes until @p __in reaches @p __in_stop.
+		///
+		/// @returns @c true if @p __in reached @p __in_stop, or @c false if it stopped early at a code point that is
+		/// not a Unicode scalar value or because the output does not have room for the next one.
+		//////
+		template <endian _Endian, typename _CodePoint, typename _Byte>
+		constexpr bool __utf32_to_utf32_scheme_scalar(const _CodePoint*& __in, const _CodePoint* __in_stop,
+			_Byte*& __out, _Byte* __out_last) noexcept {
+			for (; __in < __in_stop; ++__in, __out += 4) {
+				if ((__out_last - __out) < 4) {
+					return false;
+				}
+				const char32_t __code_point = static_cast<char32_t>(*__in);
+				if (__code_point > __last_code_point || __is_surrogate(__code_point)) {
+					return false;
+				}
+				__store_word<_Endian>(__out, __code_point);
+			}
+			return true;
+		}
+
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_SIMD_X86_I_)
+		template <bool _Swap>
+		ZTD_TEXT_TARGET_I_("sse2")
+		inline __m128i __swap16_sse2(__m128i __words) noexcept {
+			if constexpr (_Swap) {
+				return _mm_or_si128(_mm_slli_epi16(__words, 8), _mm_srli_epi16(__words, 8));
+			}
+			else {
+				return __words;
+			}
+		}
+
+		template <bool _Swap>
+		ZTD_TEXT_TARGET_I_("sse2")
+		inline __m128i __swap32_sse2(__m128i __words) noexcept {
+			if constexpr (_Swap) {
+				__words = _mm_shufflelo_epi16(__words, _MM_SHUFFLE(2, 3, 0, 1));
+				__words = _mm_shufflehi_epi16(__words, _MM_SHUFFLE(2, 3, 0, 1));
+				return __swap16_sse2<true>(__words);
+			}
+			else {
+				return __words;
+			}
+		}
+
+		//////
+		/// @brief All ones in every 16-bit lane that holds a surrogate.
+		//////
+		ZTD_TEXT_TARGET_I_("sse2")
+		inline __m128i __surrogates16_sse2(__m128i __units) noexcept {
+			return _mm_cmpeq_epi16(_mm_and_si128(__units, _mm_set1_epi16(static_cast<short>(0xF800))),
+				_mm_set1_epi16(static_cast<short>(0xD800)));
+		}
+
+		//////
+		/// @brief All ones in every 32-bit lane that does not hold a Unicode scalar value.
+		//////
+		ZTD_TEXT_TARGET_I_("sse2")
+		inline __m128i __non_scalars32_sse2(__m128i __values) noexcept {
+			const __m128i __too_large = _mm_or_si128(_mm_cmpgt_epi32(__values, _mm_set1_epi32(0x10FFFF)),
+				_mm_cmplt_epi32(__values, _mm_setzero_si128()));
+			const __m128i __surrogates = _mm_cmpeq_epi32(
+				_mm_and_si128(__values, _mm_set1_epi32(static_cast<int>(0xFFFFF800))), _mm_set1_epi32(0xD800));
+			return _mm_or_si128(__too_large, __surrogates);
+		}
+
+		template <bool _Swap>
+		ZTD_TEXT_TARGET_I_("sse2")
+		inline void __utf16_scheme_to_utf32_sse2(const unsigned char*& __in, const unsigned char* __in_last,
+			char32_t*& __out, char32_t* __out_last) noexcept {
+			const __m128i __zero = _mm_setzero_si128();
+			while ((__in_last - __in) >= 16 && (__out_last - __out) >= 8) {
+				const __m128i __units = __swap16_sse2<_Swap>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(__in)));
+				if (_mm_movemask_epi8(__surrogates16_sse2(__units)) != 0) {
+					break;
+				}
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(__out), _mm_unpacklo_epi16(__units, __zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(__out + 4), _mm_unpackhi_epi16(__units, __zero));
+				__in += 16;
+				__out += 8;
+			}
+		}
+
+		template <bool _Swap>
+		ZTD_TEXT_TARGET_I_("sse2")
+		inline void __utf32_to_utf16_scheme_sse2(const char32_t*& __in, const char32_t* __in_last,
+			unsigned char*& __out, unsigned char* __out_last) noexcept {
+			const __m128i __zero      = _mm_setzero_si128();
+			const __m128i __non_bmp   = _mm_set1_epi32(static_cast<int>(0xFFFF0000));
+			const __m128i __pack_bias = _mm_set1_epi32(0x8000);
+			while ((__in_last - __in) >= 8 && (__out_last - __out) >= 16) {
+				const __m128i __low  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__in));
+				const __m128i __high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__in + 4));
+				// anything outside of the BMP or that is a surrogate takes more care than this
+				const __m128i __in_bmp = _mm_and_si128(_mm_cmpeq_epi32(_mm_and_si128(__low, __non_bmp), __zero),
+					_mm_cmpeq_epi32(_mm_and_si128(__high, __non_bmp), __zero));
+				const __m128i __surrogates = _mm_or_si128(_mm_cmpeq_epi32(_mm_and_si128(__low, _mm_set1_epi32(0xF800)),
+					                                          _mm_set1_epi32(0xD800)),
+					_mm_cmpeq_epi32(_mm_and_si128(__high, _mm_set1_epi32(0xF800)), _mm_set1_epi32(0xD800)));
+				if (_mm_movemask_epi8(_mm_andnot_si128(__surrogates, __in_bmp)) != 0xFFFF) {
+					break;
+				}
+				// SSE2 only packs with signed saturation, so move every value into the signed range and back
+				const __m128i __units = _mm_xor_si128(
+					_mm_packs_epi32(_mm_sub_epi32(__low, __pack_bias), _mm_sub_epi32(__high, __pack_bias)),
+					_mm_set1_epi16(static_cast<short>(0x8000)));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(__out), __swap16_sse2<_Swap>(__units));
+				__in += 8;
+				__out += 16;
+			}
+		}
+
+		template <bool _Swap>
+		ZTD_TEXT_TARGET_I_("sse2")
+		inline void __utf32_scheme_to_utf32_sse2(const unsigned char*& __in, const unsigned char* __in_last,
+			char32_t*& __out, char32_t* __out_last) noexcept {
+			while ((__in_last - __in) >= 16 && (__out_last - __out) >= 4) {
+				const __m128i __values
+					= __swap32_sse2<_Swap>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(__in)));
+				if (_mm_movemask_epi8(__non_scalars32_sse2(__values)) != 0) {
+					break;
+				}
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(__out), __values);
+				__in += 16;
+				__out += 4;
+			}
+		}
+
+		template <bool _Swap>
+		ZTD_TEXT_TARGET_I_("sse2")
+		inline void __utf32_to_utf32_scheme_sse2(const char32_t*& __in, const char32_t* __in_last,
+			unsigned char*& __out, unsigned char* __out_last) noexcept {
+			while ((__in_last - __in) >= 4 && (__out_last - __out) >= 16) {
+				const __m128i __values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__in));
+				if (_mm_movemask_epi8(__non_scalars32_sse2(__values)) != 0) {
+					break;
+				}
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(__out), __swap32_sse2<_Swap>(__values));
+				__in += 4;
+				__out += 16;
+			}
+		}
+
+		template <bool _Swap>
+		ZTD_TEXT_TARGET_I_("avx2")
+		inline __m256i __swap_avx2(__m256i __words, ::std::size_t __word_size) noexcept {
+			if constexpr (_Swap) {
+				const __m256i __swap16 = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14, 1, 0,
+					3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+				const __m256i __swap32 = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2,
+					1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+				return _mm256_shuffle_epi8(__words, __word_size == 2 ? __swap16 : __swap32);
+			}
+			else {
+				(void)__word_size;
+				return __words;
+			}
+		}
+
+		ZTD_TEXT_TARGET_I_("avx2")
+		inline __m256i __non_scalars32_avx2(__m256i __values) noexcept {
+			const __m256i __too_large = _mm256_or_si256(_mm256_cmpgt_epi32(__values, _mm256_set1_epi32(0x10FFFF)),
+				_mm256_cmpgt_epi32(_mm256_setzero_si256(), __values));
+			const __m256i __surrogates
+				= _mm256_cmpeq_epi32(_mm256_and_si256(__values, _mm256_set1_epi32(static_cast<int>(0xFFFFF800))),
+				     _mm256_set1_epi32(0xD800));
+			return _mm256_or_si256(__too_large, __surrogates);
+		}
+
+		template <bool _Swap>
+		ZTD_TEXT_TARGET_I_("avx2")
+		inline void __utf16_scheme_to_utf32_avx2(const unsigned char*& __in, const unsigned char* __in_last,
+			char32_t*& __out, char32_t* __out_last) noexcept {
+			while ((__in_last - __in) >= 32 && (__out_last - __out) >= 16) {
+				const __m256i __units
+					= __swap_avx2<_Swap>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(__in)), 2);
+				const __m256i __surrogates
+					= _mm256_cmpeq_epi16(_mm256_and_si256(__units, _mm256_set1_epi16(static_cast<short>(0xF800))),
+					     _mm256_set1_epi16(static_cast<short>(0xD800)));
+				if (!_mm256_testz_si256(__surrogates, __surrogates)) {
+					break;
+				}
+				_mm256_storeu_si256(
+					reinterpret_cast<__m256i*>(__out), _mm256_cvtepu16_epi32(_mm256_castsi256_si128(__units)));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(__out + 8),
+					_mm256_cvtepu16_epi32(_mm256_extracti128_si256(__units, 1)));
+				__in += 32;
+				__out += 16;
+			}
+			__utf16_scheme_to_utf32_sse2<_Swap>(__in, __in_last, __out, __out_last);
+		}
+
+		template <bool _Swap>
+		ZTD_TEXT_TARGET_I_("avx2")
+		inline void __utf32_to_utf16_scheme_avx2(const char32_t*& __in, const char32_t* __in_last,
+			unsigned char*& __out, unsigned char* __out_last) noexcept {
+			const __m256i __zero    = _mm256_setzero_si256();
+			const __m256i __non_bmp = _mm256_set1_epi32(static_cast<int>(0xFFFF0000));
+			while ((__in_last - __in) >= 16 && (__out_last - __out) >= 32) {
+				const __m256i __low  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__in));
+				const __m256i __high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__in + 8));
+				const __m256i __outside_bmp = _mm256_or_si256(_mm256_and_si256(__low, __non_bmp),
+					_mm256_and_si256(__high, __non_bmp));
+				const __m256i __surrogates = _mm256_or_si256(
+					_mm256_cmpeq_epi32(_mm256_and_si256(__low, _mm256_set1_epi32(0xF800)), _mm256_set1_epi32(0xD800)),
+					_mm256_cmpeq_epi32(
+					     _mm256_and_si256(__high, _mm256_set1_epi32(0xF800)), _mm256_set1_epi32(0xD800)));
+				if (!_mm256_testz_si256(__outside_bmp, __outside_bmp)
+					|| !_mm256_testz_si256(__surrogates, __surrogates)) {
+					break;
+				}
+				// packing works within each 128-bit half, so the middle two quarters come out swapped
+				const __m256i __units = _mm256_permute4x64_epi64(
+					_mm256_packus_epi32(__low, __high), _MM_SHUFFLE(3, 1, 2, 0));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(__out), __swap_avx2<_Swap>(__units, 2));
+				__in += 16;
+				__out += 32;
+			}
+			(void)__zero;
+			__utf32_to_utf16_scheme_sse2<_Swap>(__in, __in_last, __out, __out_last);
+		}
+
+		template <bool _Swap>
+		ZTD_TEXT_TARGET_I_("avx2")
+		inline void __utf32_scheme_to_utf32_avx2(const unsigned char*& __in, const unsigned char* __in_last,
+			char32_t*& __out, char32_t* __out_last) noexcept {
+			while ((__in_last - __in) >= 32 && (__out_last - __out) >= 8) {
+				const __m256i __values
+					= __swap_avx2<_Swap>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(__in)), 4);
+				const __m256i __non_scalars = __non_scalars32_avx2(__values);
+				if (!_mm256_testz_si256(__non_scalars, __non_scalars)) {
+					break;
+				}
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(__out), __values);
+				__in += 32;
+				__out += 8;
+			}
+			__utf32_scheme_to_utf32_sse2<_Swap>(__in, __in_last, __out, __out_last);
+		}
+
+		template <bool _Swap>
+		ZTD_TEXT_TARGET_I_("avx2")
+		inline void __utf32_to_utf32_scheme_avx2(const char32_t*& __in, const char32_t* __in_last,
+			unsigned char*& __out, unsigned char* __out_last) noexcept {
+			while ((__in_last - __in) >= 8 && (__out_last - __out) >= 32) {
+				const __m256i __values      = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__in));
+				const __m256i __non_scalars = __non_scalars32_avx2(__values);
+				if (!_mm256_testz_si256(__non_scalars, __non_scalars)) {
+					break;
+				}
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(__out), __swap_avx2<_Swap>(__values, 4));
+				__in += 8;
+				__out += 32;
+			}
+			__utf32_to_utf32_scheme_sse2<_Swap>(__in, __in_last, __out, __out_last);
+		}
+
+		template <typename _In, typename _Out>
+		inline void __utf_scheme_none(const _In*&, const _In*, _Out*&, _Out*) noexcept {
+		}
+
+		using __utf_scheme_decode_function
+			= void (*)(const unsigned char*&, const unsigned char*, char32_t*&, char32_t*) noexcept;
+		using __utf_scheme_encode_function
+			= void (*)(const char32_t*&, const char32_t*, unsigned char*&, unsigned char*) noexcept;
+
+		template <bool _Swap>
+		inline constexpr __isa_table<__utf_scheme_decode_function> __utf16_scheme_to_utf32_kernels
+			= { &__utf_scheme_none<unsigned char, char32_t>, &__utf16_scheme_to_utf32_sse2<_Swap>,
+				  &__utf16_scheme_to_utf32_sse2<_Swap>, &__utf16_scheme_to_utf32_avx2<_Swap> };
+
+		template <bool _Swap>
+		inline constexpr __isa_table<__utf_scheme_encode_function> __utf32_to_utf16_scheme_kernels
+			= { &__utf_scheme_none<char32_t, unsigned char>, &__utf32_to_utf16_scheme_sse2<_Swap>,
+				  &__utf32_to_utf16_scheme_sse2<_Swap>, &__utf32_to_utf16_scheme_avx2<_Swap> };
+
+		template <bool _Swap>
+		inline constexpr __isa_table<__utf_scheme_decode_function> __utf32_scheme_to_utf32_kernels
+			= { &__utf_scheme_none<unsigned char, char32_t>, &__utf32_scheme_to_utf32_sse2<_Swap>,
+				  &__utf32_scheme_to_utf32_sse2<_Swap>, &__utf32_scheme_to_utf32_avx2<_Swap> };
+
+		template <bool _Swap>
+		inline constexpr __isa_table<__utf_scheme_encode_function> __utf32_to_utf32_scheme_kernels
+			= { &__utf_scheme_none<char32_t, unsigned char>, &__utf32_to_utf32_scheme_sse2<_Swap>,
+				  &__utf32_to_utf32_scheme_sse2<_Swap>, &__utf32_to_utf32_scheme_avx2<_Swap> };
+
+		//////
+		/// @brief Decodes the blocks at the start of the input that have no surrogates in them, stopping at the first
+		/// block that does (or that does not fit in the output).
+		//////
+		template <bool _Swap>
+		inline void __utf16_scheme_to_utf32_vectorized(
+			const unsigned char*& __in, const unsigned char* __in_last, char32_t*& __out,
+			char32_t* __out_last) noexcept {
+			static const __utf_scheme_decode_function __convert = __isa_select(__utf16_scheme_to_utf32_kernels<_Swap>);
+			__convert(__in, __in_last, __out, __out_last);
+		}
+
+		//////
+		/// @brief Encodes the blocks at the start of the input that are entirely outside of the surrogate range and
+		/// below U+10000, stopping at the first block that is not (or that does not fit in the output).
+		//////
+		template <bool _Swap>
+		inline void __utf32_to_utf16_scheme_vectorized(
+			const char32_t*& __in, const char32_t* __in_last, unsigned char*& __out,
+			unsigned char* __out_last) noexcept {
+			static const __utf_scheme_encode_function __convert = __isa_select(__utf32_to_utf16_scheme_kernels<_Swap>);
+			__convert(__in, __in_last, __out, __out_last);
+		}
+
+		//////
+		/// @brief Decodes the blocks at the start of the input that are entirely Unicode scalar values, stopping at
+		/// the first block that is not (or that does not fit in the output).
+		//////
+		template <bool _Swap>
+		inline void __utf32_scheme_to_utf32_vectorized(
+			const unsigned char*& __in, const unsigned char* __in_last, char32_t*& __out,
+			char32_t* __out_last) noexcept {
+			static const __utf_scheme_decode_function __convert = __isa_select(__utf32_scheme_to_utf32_kernels<_Swap>);
+			__convert(__in, __in_last, __out, __out_last);
+		}
+
+		//////
+		/// @brief Encodes the blocks at the start of the input that are entirely Unicode scalar values, stopping at
+		/// the first block that is not (or that does not fit in the output).
+		//////
+		template <bool _Swap>
+		inline void __utf32_to_utf32_scheme_vectorized(
+			const char32_t*& __in, const char32_t* __in_last, unsigned char*& __out,
+			unsigned char* __out_last) noexcept {
+			static const __utf_scheme_encode_function __convert = __isa_select(__utf32_to_utf32_scheme_kernels<_Swap>);
+			__convert(__in, __in_last, __out, __out_last);
+		}
+
+		//////
+		/// @brief Runs the vector kernel for the tier in use out of @p __table over whole blocks at the start of the
+		/// input, then hands what stopped it to @p __scalar one block at a time until either gives up.
+		///
+		/// @remarks @p __block is how many input units make up one block of the vector kernels.
+		//////
+		template <typename _VectorIn, typename _VectorOut, typename _Function, typename _In, typename _Out,
+			typename _Scalar>
+		inline void __utf_scheme_vectorized(_Function __convert, const _In*& __in, const _In* __in_last,
+			_Out*& __out, _Out* __out_last, ::std::ptrdiff_t __block, _Scalar&& __scalar) noexcept {
+			for (;;) {
+				const _VectorIn* __vin_first = reinterpret_cast<const _VectorIn*>(__in);
+				_VectorOut* __vout_first     = reinterpret_cast<_VectorOut*>(__out);
+				const _VectorIn* __vin       = __vin_first;
+				_VectorOut* __vout           = __vout_first;
+				__convert(__vin, reinterpret_cast<const _VectorIn*>(__in_last), __vout,
+					reinterpret_cast<_VectorOut*>(__out_last));
+				__in += __vin - __vin_first;
+				__out += __vout - __vout_first;
+				// work through whatever stopped the vector loop one unit at a time, then try again
+				const _In* __in_stop = (__in_last - __in) > __block ? __in + __block : __in_last;
+				if (!__scalar(__in, __in_stop, __out) || __in == __in_last) {
+					return;
+				}
+			}
+		}
+#endif
+
+		//////
+		/// @brief Decodes UTF-16 stored as bytes in @p _Endian byte order into code points in bulk, byte-swapping
+		/// whole vectors at once when not in a constant expression.
+		///
+		/// @remarks Stops with @p __in at the first unpaired surrogate, at a trailing partial word, or at the first
+		/// code point that does not fit in the output, and @p __out just past the last code point written.
+		//////
+		template <endian _Endian, typename _Byte, typename _CodePoint>
+		constexpr void __utf16_scheme_to_utf32(
+			const _Byte*& __in, const _Byte* __in_last, _CodePoint*& __out, _CodePoint* __out_last) noexcept {
+			static_assert(sizeof(_Byte) == 1, "the input must be bytes");
+			static_assert(sizeof(_CodePoint) == sizeof(char32_t), "the output must be 32-bit code points");
+			__in_last = __whole_words_last<char16_t>(__in, __in_last);
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_SIMD_X86_I_) && ZTD_TEXT_IS_ON(ZTD_TEXT_STD_LIBRARY_IS_CONSTANT_EVALUATED_I_)
+			if (!::std::is_constant_evaluated()) {
+				__utf_scheme_vectorized<unsigned char, char32_t>(
+					&__utf16_scheme_to_utf32_vectorized<_Endian != endian::native>, __in, __in_last, __out,
+					__out_last, 32,
+					[__in_last, __out_last](const _Byte*& __sin, const _Byte* __sin_stop, _CodePoint*& __sout) {
+						return __utf16_scheme_to_utf32_scalar<_Endian>(
+							__sin, __sin_stop, __in_last, __sout, __out_last);
+					});
+				return;
+			}
+#endif
+			__utf16_scheme_to_utf32_scalar<_Endian>(__in, __in_last, __in_last, __out, __out_last);
+		}
+
+		//////
+		/// @brief Encodes code points as UTF-16 stored as bytes in @p _Endian byte order in bulk, byte-swapping
+		/// whole vectors at once when not in a constant expression.
+		///
+		/// @remarks Stops with @p __in at the first code point that is not a Unicode scalar value or that does not fit
+		/// in the output, and @p __out just past the last byte written.
+		//////
+		template <endian _Endian, typename _CodePoint, typename _Byte>
+		constexpr void __utf32_to_utf16_scheme(
+			const _CodePoint*& __in, const _CodePoint* __in_last, _Byte*& __out, _Byte* __out_last) noexcept {
+			static_assert(sizeof(_CodePoint) == sizeof(char32_t), "the input must be 32-bit code points");
+			static_assert(sizeof(_Byte) == 1, "the output must be bytes");
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_SIMD_X86_I_) && ZTD_TEXT_IS_ON(ZTD_TEXT_STD_LIBRARY_IS_CONSTANT_EVALUATED_I_)
+			if (!::std::is_constant_evaluated()) {
+				__utf_scheme_vectorized<char32_t, unsigned char>(
+					&__utf32_to_utf16_scheme_vectorized<_Endian != endian::native>, __in, __in_last, __out,
+					__out_last, 16,
+					[__out_last](const _CodePoint*& __sin, const _CodePoint* __sin_stop, _Byte*& __sout) {
+						return __utf32_to_utf16_scheme_scalar<_Endian>(__sin, __sin_stop, __sout, __out_last);
+					});
+				return;
+			}
+#endif
+			__utf32_to_utf16_scheme_scalar<_Endian>(__in, __in_last, __out, __out_last);
+		}
+
+		//////
+		/// @brief Decodes UTF-32 stored as bytes in @p _Endian byte order into code points in bulk, byte-swapping
+		/// whole vectors at once when not in a constant expression.
+		///
+		/// @remarks Stops with @p __in at the first value that is not a Unicode scalar value, at a trailing partial
+		/// word, or when the output is full, and @p __out just past the last code point written.
+		//////
+		template <endian _Endian, typename _Byte, typename _CodePoint>
+		constexpr void __utf32_scheme_to_utf32(
+			const _Byte*& __in, const _Byte* __in_last, _CodePoint*& __out, _CodePoint* __out_last) noexcept {
+			static_assert(sizeof(_Byte) == 1, "the input must be bytes");
+			static_assert(sizeof(_CodePoint) == sizeof(char32_t), "the output must be 32-bit code points");
+			__in_last = __whole_words_last<char32_t>(__in, __in_last);
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_SIMD_X86_I_) && ZTD_TEXT_IS_ON(ZTD_TEXT_STD_LIBRARY_IS_CONSTANT_EVALUATED_I_)
+			if (!::std::is_constant_evaluated()) {
+				__utf_scheme_vectorized<unsigned char, char32_t>(
+					&__utf32_scheme_to_utf32_vectorized<_Endian != endian::native>, __in, __in_last, __out,
+					__out_last, 32,
+					[__out_last](const _Byte*& __sin, const _Byte* __sin_stop, _CodePoint*& __sout) {
+						return __utf32_scheme_to_utf32_scalar<_Endian>(__sin, __sin_stop, __sout, __out_last);
+					});
+				return;
+			}
+#endif
+			__utf32_scheme_to_utf32_scalar<_Endian>(__in, __in_last, __out, __out_last);
+		}
+
+		//////
+		/// @brief Encodes code points as UTF-32 stored as bytes in @p _Endian byte order in bulk, byte-swapping
+		/// whole vectors at once when not in a constant expression.
+		///
+		/// @remarks Stops with @p __in at the first code point that is not a Unicode scalar value or that does not fit
+		/// in the output, and @p __out just past the last byte written.
+		//////
+		template <endian _Endian, typename _CodePoint, typename _Byte>
+		constexpr void __utf32_to_utf32_scheme(
+			const _CodePoint*& __in, const _CodePoint* __in_last, _Byte*& __out, _Byte* __out_last) noexcept {
+			static_assert(sizeof(_CodePoint) == sizeof(char32_t), "the input must be 32-bit code points");
+			static_assert(sizeof(_Byte) == 1, "the output must be bytes");
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_SIMD_X86_I_) && ZTD_TEXT_IS_ON(ZTD_TEXT_STD_LIBRARY_IS_CONSTANT_EVALUATED_I_)
+			if (!::std::is_constant_evaluated()) {
+				__utf_scheme_vectorized<char32_t, unsigned char>(
+					&__utf32_to_utf32_scheme_vectorized<_Endian != endian::native>, __in, __in_last, __out,
+					__out_last, 8,
+					[__out_last](const _CodePoint*& __sin, const _CodePoint* __sin_stop, _Byte*& __sout) {
+						return __utf32_to_utf32_scheme_scalar<_Endian>(__sin, __sin_stop, __sout, __out_last);
+					});
+				return;
+			}
+#endif
+			__utf32_to_utf32_scheme_scalar<_Endian>(__in, __in_last, __out, __out_last);
+		}
+
+		//////
+		/// @brief Validates bytes with one of the bulk decoding functions above, throwing away what it decodes.
+		///
+		/// @returns A pointer to the start of the first sequence that does not decode (or that is a trailing partial
+		/// word), or @p __in_last if all of the input is valid.
+		//////
+		template <typename _Byte, typename _Decode>
+		constexpr const _Byte* __utf_scheme_validate(
+			const _Byte* __in, const _Byte* __in_last, _Decode&& __decode) noexcept {
+			constexpr ::std::size_t __scratch_size = 256;
+			char32_t __scratch[__scratch_size] {};
+			for (;;) {
+				char32_t* __out = __scratch;
+				__decode(__in, __in_last, __out, __scratch + __scratch_size);
+				if (__in == __in_last || __out != __scratch + __scratch_size) {
+					// it did not stop because of the output, so it stopped at the end or at something invalid
+					return __in;
+				}
+			}
+		}
+
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#endif // ZTD_TEXT_DETAIL_TRANSCODE_UTF_SCHEME_HPP
@@ -0,0 +1,373 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#pragma once
+
+#ifndef ZTD_TEXT_DETAIL_VALIDATE_UTF8_HPP
+#define ZTD_TEXT_DETAIL_VALIDATE_UTF8_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/char8_t.hpp>
+#include <ztd/text/detail/unicode.hpp>
+#include <ztd/text/detail/skip_ascii.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_SIMD_X86_I_)
+#include <immintrin.h>
+#endif
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		//////
+		/// @brief Decodes one strict UTF-8 sequence starting at @p __first.
+		///
+		/// @returns The length of the sequence, or @c 0 if it is not valid (invalid lead, missing or bad
+		/// continuation, overlong form, surrogate, out of range value) or is cut off by @p __last.
+		//////
+		template <typename _CodeUnit>
+		constexpr ::std::ptrdiff_t __utf8_decode_strict(
+			const _CodeUnit* __first, const _CodeUnit* __last, char32_t& __decoded) noexcept {
+			const uchar8_t __unit0 = static_cast<uchar8_t>(*__first);
+			if (__unit0 <= __last_1byte_value) {
+				__decoded = __unit0;
+				return 1;
+			}
+			const ::std::ptrdiff_t __available = __last - __first;
+			if (__unit0 < 0xE0) {
+				// continuations and the always-overlong 0xC0/0xC1 leads all sit below 0xC2
+				if (__unit0 < 0xC2 || __available < 2
+					|| !__utf8_is_continuation(static_cast<uchar8_t>(__first[1]))) {
+					return 0;
+				}
+				__decoded = __decode(__unit0, static_cast<uchar8_t>(__first[1]));
+				return 2;
+			}
+			if (__unit0 < 0xF0) {
+				if (__available < 3 || !__utf8_is_continuation(static_cast<uchar8_t>(__first[1]))
+					|| !__utf8_is_continuation(static_cast<uchar8_t>(__first[2]))) {
+					return 0;
+				}
+				__decoded = __decode(__unit0, static_cast<uchar8_t>(__first[1]), static_cast<uchar8_t>(__first[2]));
+				if (__decoded <= __last_2byte_value || __is_surrogate(__decoded)) {
+					return 0;
+				}
+				return 3;
+			}
+			if (__unit0 > 0xF4 || __available < 4 || !__utf8_is_continuation(static_cast<uchar8_t>(__first[1]))
+				|| !__utf8_is_continuation(static_cast<uchar8_t>(__first[2]))
+				|| !__utf8_is_continuation(static_cast<uchar8_t>(__first[3]))) {
+				return 0;
+			}
+			__decoded = __decode(__unit0, static_cast<uchar8_t>(__first[1]), static_cast<uchar8_t>(__first[2]),
+				static_cast<uchar8_t>(__first[3]));
+			if (__decoded <= __last_3byte_value || __decoded > __last_code_point) {
+				return 0;
+			}
+			return 4;
+		}
+
+		//////
+		/// @brief Validates strict UTF-8 one sequence at a time, skipping over runs of ASCII in bulk.
+		///
+		/// @returns A pointer to the first unit of the first sequence that does not decode, or @p __last if all of
+		/// the input is valid.
+		///
+		/// @remarks Every failure is reported at the start of the sequence, exactly as the UTF-8 @c decode_one
+		/// function sees it.
+		//////
+		template <typename _CodeUnit>
+		constexpr const _CodeUnit* __utf8_validate_scalar(
+			const _CodeUnit* __first, const _CodeUnit* __last) noexcept {
+			char32_t __decoded {};
+			while (__first != __last) {
+				__first = __skip_ascii(__first, __last);
+				if (__first == __last) {
+					break;
+				}
+				const ::std::ptrdiff_t __length = __utf8_decode_strict(__first, __last, __decoded);
+				if (__length == 0) {
+					return __first;
+				}
+				__first += __length;
+			}
+			return __first;
+		}
+
+		//////
+		/// @brief Finishes validation with the scalar validator, starting from the beginning of the sequence that
+		/// @p __block is in the middle of (if any).
+		///
+		/// @remarks Everything before @p __block must already be known to be valid, save for a sequence which may be
+		/// cut off by @p __block. This is what lets the vectorized kernels report the exact same failing position
+		/// as the scalar loop.
+		//////
+		inline const unsigned char* __utf8_validate_resume(
+			const unsigned char* __first, const unsigned char* __block, const unsigned char* __last) noexcept {
+			const unsigned char* __start = __block;
+			for (const unsigned char* __lead = __block; __lead != __first && (__block - __lead) < 3;) {
+				--__lead;
+				if (__utf8_is_continuation(static_cast<uchar8_t>(*__lead))) {
+					continue;
+				}
+				if ((__lead + __sequence_length(static_cast<uchar8_t>(*__lead))) > __block) {
+					__start = __lead;
+				}
+				break;
+			}
+			return __utf8_validate_scalar(__start, __last);
+		}
+
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_SIMD_X86_I_)
+		// Lookup tables for the "Validating UTF-8 In Less Than One Instruction Per Byte" algorithm (Keiser &
+		// Lemire). Each byte pair (previous byte, current byte) is classified by the high nibble of the previous
+		// byte, the low nibble of the previous byte and the high nibble of the current byte; a non-zero AND of the 3
+		// classifications is an error.
+		inline constexpr unsigned char __utf8_too_short      = 1 << 0;
+		inline constexpr unsigned char __utf8_too_long       = 1 << 1;
+		inline constexpr unsigned char __utf8_overlong_3     = 1 << 2;
+		inline constexpr unsigned char __utf8_too_large      = 1 << 3;
+		inline constexpr unsigned char __utf8_surrogate      = 1 << 4;
+		inline constexpr unsigned char __utf8_overlong_2     = 1 << 5;
+		inline constexpr unsigned char __utf8_too_large_1000 = 1 << 6;
+		inline constexpr unsigned char __utf8_overlong_4     = 1 << 6;
+		inline constexpr unsigned char __utf8_two_conts      = 1 << 7;
+		inline constexpr unsigned char __utf8_carry = __utf8_too_short | __utf8_too_long | __utf8_two_conts;
+
+		alignas(16) inline constexpr unsigned char __utf8_byte_1_high_table[16] = {
+			// 0_______ ________ <ASCII in byte 1>
+			__utf8_too_long, __utf8_too_long, __utf8_too_long, __utf8_too_long, __utf8_too_long, __utf8_too_long,
+			__utf8_too_long, __utf8_too_long,
+			// 10______ ________ <continuation in byte 1>
+			__utf8_two_conts, __utf8_two_conts, __utf8_two_conts, __utf8_two_conts,
+			// 1100____ ________ <two byte lead in byte 1>
+			__utf8_too_short | __utf8_overlong_2,
+			// 1101____ ________ <two byte lead in byte 1>
+			__utf8_too_short,
+			// 1110____ ________ <three byte lead in byte 1>
+			__utf8_too_short | __utf8_overlong_3 | __utf8_surrogate,
+			// 1111____ ________ <four+ byte lead in byte 1>
+			__utf8_too_short | __utf8_too_large | __utf8_too_large_1000 | __utf8_overlong_4
+		};
+
+		alignas(16) inline constexpr unsigned char __utf8_byte_1_low_table[16] = {
+			// ____0000 ________
+			__utf8_carry | __utf8_overlong_3 | __utf8_overlong_2 | __utf8_overlong_4,
+			// ____0001 ________
+			__utf8_carry | __utf8_overlong_2,
+			// ____001_ ________
+			__utf8_carry, __utf8_carry,
+			// ____0100 ________
+			__utf8_carry | __utf8_too_large,
+			// ____0101 ________
+			__utf8_carry | __utf8_too_large | __utf8_too_large_1000,
+			// ____011_ ________
+			__utf8_carry | __utf8_too_large | __utf8_too_large_1000,
+			__utf8_carry | __utf8_too_large | __utf8_too_large_1000,
+			// ____1___ ________
+			__utf8_carry | __utf8_too_large | __utf8_too_large_1000,
+			__utf8_carry | __utf8_too_large | __utf8_too_large_1000,
+			__utf8_carry | __utf8_too_large | __utf8_too_large_1000,
+			__utf8_carry | __utf8_too_large | __utf8_too_large_1000,
+			__utf8_carry | __utf8_too_large | __utf8_too_large_1000,
+			// ____1101 ________
+			__utf8_carry | __utf8_too_large | __utf8_too_large_1000 | __utf8_surrogate,
+			__utf8_carry | __utf8_too_large | __utf8_too_large_1000,
+			__utf8_carry | __utf8_too_large | __utf8_too_large_1000
+		};
+
+		alignas(16) inline constexpr unsigned char __utf8_byte_2_high_table[16] = {
+			// ________ 0_______ <ASCII in byte 2>
+			__utf8_too_short, __utf8_too_short, __utf8_too_short, __utf8_too_short, __utf8_too_short,
+			__utf8_too_short, __utf8_too_short, __utf8_too_short,
+			// ________ 1000____
+			__utf8_too_long | __utf8_overlong_2 | __utf8_two_conts | __utf8_overlong_3 | __utf8_too_large_1000
+				| __utf8_overlong_4,
+			// ________ 1001____
+			__utf8_too_long | __utf8_overlong_2 | __utf8_two_conts | __utf8_overlong_3 | __utf8_too_large,
+			// ________ 101_____
+			__utf8_too_long | __utf8_overlong_2 | __utf8_two_conts | __utf8_surrogate | __utf8_too_large,
+			__utf8_too_long | __utf8_overlong_2 | __utf8_two_conts | __utf8_surrogate | __utf8_too_large,
+			// ________ 11______
+			__utf8_too_short, __utf8_too_short, __utf8_too_short, __utf8_too_short
+		};
+
+		// Any of the last 3 bytes of a block being at or above these values means the sequence continues into the
+		// next block.
+		alignas(32) inline constexpr unsigned char __utf8_incomplete_table[32] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1 };
+
+		ZTD_TEXT_TARGET_I_("sse4.2")
+		inline const unsigned char* __utf8_validate_sse42(
+			const unsigned char* __first, const unsigned char* __last) noexcept {
+			const __m128i __byte_1_high = _mm_load_si128(reinterpret_cast<const __m128i*>(__utf8_byte_1_high_table));
+			const __m128i __byte_1_low  = _mm_load_si128(reinterpret_cast<const __m128i*>(__utf8_byte_1_low_table));
+			const __m128i __byte_2_high = _mm_load_si128(reinterpret_cast<const __m128i*>(__utf8_byte_2_high_table));
+			const __m128i __incomplete
+				= _mm_load_si128(reinterpret_cast<const __m128i*>(__utf8_incomplete_table + 16));
+			const __m128i __nibble     = _mm_set1_epi8(0x0F);
+			const __m128i __third_min  = _mm_set1_epi8(0xE0 - 0x80);
+			const __m128i __fourth_min = _mm_set1_epi8(0xF0 - 0x80);
+			const __m128i __high_bit   = _mm_set1_epi8(static_cast<char>(0x80));
+
+			__m128i __previous            = _mm_setzero_si128();
+			__m128i __previous_incomplete = _mm_setzero_si128();
+			const unsigned char* __block  = __first;
+			for (; (__last - __block) >= 16; __block += 16) {
+				const __m128i __input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__block));
+				__m128i __error;
+				if (_mm_movemask_epi8(__input) == 0) {
+					// all ASCII: only a sequence left unfinished by the last block can be wrong
+					__error = __previous_incomplete;
+				}
+				else {
+					const __m128i __prev1 = _mm_alignr_epi8(__input, __previous, 15);
+					const __m128i __prev2 = _mm_alignr_epi8(__input, __previous, 14);
+					const __m128i __prev3 = _mm_alignr_epi8(__input, __previous, 13);
+					const __m128i __special = _mm_and_si128(
+						_mm_and_si128(_mm_shuffle_epi8(__byte_1_high,
+						                   _mm_and_si128(_mm_srli_epi16(__prev1, 4), __nibble)),
+						     _mm_shuffle_epi8(__byte_1_low, _mm_and_si128(__prev1, __nibble))),
+						_mm_shuffle_epi8(__byte_2_high, _mm_and_si128(_mm_srli_epi16(__input, 4), __nibble)));
+					const __m128i __must_continue = _mm_and_si128(
+						_mm_or_si128(_mm_subs_epu8(__prev2, __third_min), _mm_subs_epu8(__prev3, __fourth_min)),
+						__high_bit);
+					__error               = _mm_xor_si128(__must_continue, __special);
+					__previous_incomplete = _mm_subs_epu8(__input, __incomplete);
+				}
+				if (!_mm_testz_si128(__error, __error)) {
+					break;
+				}
+				__previous = __input;
+			}
+			return __utf8_validate_resume(__first, __block, __last);
+		}
+
+		ZTD_TEXT_TARGET_I_("avx2")
+		inline const unsigned char* __utf8_validate_avx2(
+			const unsigned char* __first, const unsigned char* __last) noexcept {
+			const __m256i __byte_1_high = _mm256_broadcastsi128_si256(
+				_mm_load_si128(reinterpret_cast<const __m128i*>(__utf8_byte_1_high_table)));
+			const __m256i __byte_1_low = _mm256_broadcastsi128_si256(
+				_mm_load_si128(reinterpret_cast<const __m128i*>(__utf8_byte_1_low_table)));
+			const __m256i __byte_2_high = _mm256_broadcastsi128_si256(
+				_mm_load_si128(reinterpret_cast<const __m128i*>(__utf8_byte_2_high_table)));
+			const __m256i __incomplete
+				= _mm256_load_si256(reinterpret_cast<const __m256i*>(__utf8_incomplete_table));
+			const __m256i __nibble     = _mm256_set1_epi8(0x0F);
+			const __m256i __third_min  = _mm256_set1_epi8(0xE0 - 0x80);
+			const __m256i __fourth_min = _mm256_set1_epi8(0xF0 - 0x80);
+			const __m256i __high_bit   = _mm256_set1_epi8(static_cast<char>(0x80));
+
+			__m256i __previous            = _mm256_setzero_si256();
+			__m256i __previous_incomplete = _mm256_setzero_si256();
+			const unsigned char* __block  = __first;
+			for (; (__last - __block) >= 32; __block += 32) {
+				const __m256i __input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__block));
+				__m256i __error;
+				if (_mm256_movemask_epi8(__input) == 0) {
+					// all ASCII: only a sequence left unfinished by the last block can be wrong
+					__error = __previous_incomplete;
+				}
+				else {
+					// [ high half of the previous block | low half of this block ], for shifting across lanes
+					const __m256i __straddle = _mm256_permute2x128_si256(__previous, __input, 0x21);
+					const __m256i __prev1    = _mm256_alignr_epi8(__input, __straddle, 15);
+					const __m256i __prev2    = _mm256_alignr_epi8(__input, __straddle, 14);
+					const __m256i __prev3    = _mm256_alignr_epi8(__input, __straddle, 13);
+					const __m256i __special  = _mm256_and_si256(
+						_mm256_and_si256(_mm256_shuffle_epi8(__byte_1_high,
+						                     _mm256_and_si256(_mm256_srli_epi16(__prev1, 4), __nibble)),
+						     _mm256_shuffle_epi8(__byte_1_low, _mm256_and_si256(__prev1, __nibble))),
+						_mm256_shuffle_epi8(
+							__byte_2_high, _mm256_and_si256(_mm256_srli_epi16(__input, 4), __nibble)));
+					const __m256i __must_continue = _mm256_and_si256(
+						_mm256_or_si256(
+							_mm256_subs_epu8(__prev2, __third_min), _mm256_subs_epu8(__prev3, __fourth_min)),
+						__high_bit);
+					__error               = _mm256_xor_si256(__must_continue, __special);
+					__previous_incomplete = _mm256_subs_epu8(__input, __incomplete);
+				}
+				if (!_mm256_testz_si256(__error, __error)) {
+					break;
+				}
+				__previous = __input;
+			}
+			return __utf8_validate_resume(__first, __block, __last);
+		}
+
+		using __utf8_validate_function
+			= const unsigned char* (*)(const unsigned char*, const unsigned char*) noexcept;
+
+		inline constexpr __isa_table<__utf8_validate_function> __utf8_validate_kernels
+			= { &__utf8_validate_scalar<unsigned char>, &__utf8_validate_scalar<unsigned char>,
+				  &__utf8_validate_sse42, &__utf8_validate_avx2 };
+
+		inline const unsigned char* __utf8_validate_vectorized(
+			const unsigned char* __first, const unsigned char* __last) noexcept {
+			static const __utf8_validate_function __validate = __isa_select(__utf8_validate_kernels);
+			return __validate(__first, __last);
+		}
+#endif
+
+		//////
+		/// @brief Validates strict UTF-8, using the vectorized kernels when not in a constant expression and the
+		/// input is long enough to be worth it.
+		///
+		/// @returns A pointer to the first unit of the first sequence that does not decode, or @p __last if all of
+		/// the input is valid. This is always the same as what ztd::text::__txt_detail::__utf8_validate_scalar
+		/// returns.
+		//////
+		template <typename _CodeUnit>
+		constexpr const _CodeUnit* __utf8_validate(const _CodeUnit* __first, const _CodeUnit* __last) noexcept {
+			static_assert(sizeof(_CodeUnit) == sizeof(unsigned char),
+				"the code unit type must be a single byte in size for UTF-8 validation");
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_SIMD_X86_I_) && ZTD_TEXT_IS_ON(ZTD_TEXT_STD_LIBRARY_IS_CONSTANT_EVALUATED_I_)
+			if (!::std::is_constant_evaluated() && (__last - __first) >= 16) {
+				const unsigned char* __ufirst = reinterpret_cast<const unsigned char*>(__first);
+				const unsigned char* __ulast  = reinterpret_cast<const unsigned char*>(__last);
+				return __first + (__utf8_validate_vectorized(__ufirst, __ulast) - __ufirst);
+			}
+#endif
+			return __utf8_validate_scalar(__first, __last);
+		}
+
+	} // namespace __txt_detail
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#endif // ZTD_TEXT_DETAIL_VALIDATE_UTF8_HPP
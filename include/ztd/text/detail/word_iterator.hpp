@@ -42,6 +42,7 @@
 #include <ztd/text/detail/memory.hpp>
 #include <ztd/text/detail/to_underlying.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <limits>
 #include <climits>
@@ -80,8 +81,11 @@ namespace ztd { namespace text {
 					__underlying_value_type __bit_value = __any_to_underlying(__val);
 					auto __base_it                      = this->_M_base_it;
 					for (::std::size_t __index = 0; __index < __base_values_per_word; ++__index) {
+						// little endian puts the least significant part first, big endian the most significant
+						::std::size_t __significance
+							= _Endian == endian::big ? (__base_values_per_word - 1 - __index) : __index;
 						__underlying_value_type __bit_position = static_cast<__underlying_value_type>(
-							__index * (sizeof(__underlying_base_value_type) * CHAR_BIT));
+							__significance * (sizeof(__underlying_base_value_type) * CHAR_BIT));
 						__underlying_base_value_type __shifted_bit_value
 							= static_cast<__underlying_base_value_type>(__bit_value >> __bit_position);
 						*__base_it = static_cast<__base_value_type>(__shifted_bit_value);
@@ -91,24 +95,12 @@ namespace ztd { namespace text {
 				else
 #endif
 				{
-					if constexpr (_Endian == endian::native) {
-						__base_value_type __storage[__base_values_per_word];
-						::std::memcpy(__storage, ::std::addressof(__val), sizeof(value_type));
-						::std::copy_n(__storage, __adl::__adl_size(__storage), this->_M_base_it);
-					}
-					else if (_Endian == endian::little) {
-						__base_value_type __storage[__base_values_per_word];
-						::std::memcpy(__storage, ::std::addressof(__val), sizeof(value_type));
-						::std::copy_n(__storage, __adl::__adl_size(__storage), this->_M_base_it);
-					}
-					else {
-						// copy... as-is, I guess?
-						__base_value_type __storage[__base_values_per_word];
-						auto __first_it = __storage + 0;
-						auto __last_it  = __storage + __base_values_per_word;
-						::std::memcpy(__storage, ::std::addressof(__val), sizeof(value_type));
-						::std::copy_backward(__first_it, __last_it, this->_M_base_it);
+					__base_value_type __storage[__base_values_per_word];
+					::std::memcpy(__storage, ::std::addressof(__val), sizeof(value_type));
+					if constexpr (_Endian != endian::native) {
+						::std::reverse(__storage + 0, __storage + __base_values_per_word);
 					}
+					::std::copy_n(__storage, __adl::__adl_size(__storage), this->_M_base_it);
 				}
 				return *this;
 			}
@@ -124,13 +116,9 @@ namespace ztd { namespace text {
 				if (::std::is_constant_evaluated()) {
 					__base_value_type __storage[__base_values_per_word] {};
 					__underlying_value_type __val = __any_to_underlying(value_type {});
-					if constexpr (_Endian == endian::little) {
-						::std::copy_n(this->_M_base_it, __adl::__adl_size(__storage), __storage);
-					}
-					else {
-						static_assert(_Endian == endian::big);
-						auto __last_it = ::std::next(this->_M_base_it, __adl::__adl_size(__storage));
-						::std::copy_backward(this->_M_base_it, __last_it, __storage);
+					::std::copy_n(this->_M_base_it, __adl::__adl_size(__storage), __storage);
+					if constexpr (_Endian == endian::big) {
+						::std::reverse(__storage + 0, __storage + __base_values_per_word);
 					}
 					// God's given, handwritten, bit-fusin'
 					// one-way """memcpy""". 😵
@@ -149,16 +137,11 @@ namespace ztd { namespace text {
 				{
 					__base_value_type __storage[__base_values_per_word];
 					value_type __val;
-					if constexpr (_Endian == endian::big) {
-						auto __last_it = ::std::next(this->_M_base_it, __adl::__adl_size(__storage));
-						::std::copy_backward(this->_M_base_it, __last_it, __storage);
+					::std::copy_n(this->_M_base_it, __adl::__adl_size(__storage), __storage);
+					if constexpr (_Endian != endian::native) {
+						::std::reverse(__storage + 0, __storage + __base_values_per_word);
 					}
-					else {
-						static_assert(_Endian == endian::little);
-						::std::copy_n(this->_M_base_it, __adl::__adl_size(__storage), __storage);
-					}
-					::std::memcpy(
-						::std::addressof(__val), ::std::addressof(__storage), __adl::__adl_size(__storage));
+					::std::memcpy(::std::addressof(__val), ::std::addressof(__storage), sizeof(value_type));
 					return __val;
 				}
 			}
@@ -270,7 +253,7 @@ namespace ztd { namespace text {
 
 			constexpr _Derived& operator+=(difference_type __by) {
 				if (__by < static_cast<difference_type>(0)) {
-					return this->operator+=(-__by);
+					return this->operator-=(-__by);
 				}
 				this->_M_base_it += __base_values_per_word * __by;
 				return this->_M_this();
@@ -278,7 +261,7 @@ namespace ztd { namespace text {
 
 			constexpr difference_type operator-(const __category_word_iterator& __right) const {
 				difference_type __dist = this->_M_base_it - __right._M_base_it;
-				return static_cast<difference_type>(__dist * __base_values_per_word);
+				return static_cast<difference_type>(__dist / static_cast<difference_type>(__base_values_per_word));
 			}
 
 			constexpr _Derived operator-(difference_type __by) const {
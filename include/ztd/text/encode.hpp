@@ -39,12 +39,14 @@
 #include <ztd/text/default_encoding.hpp>
 #include <ztd/text/state.hpp>
 #include <ztd/text/unbounded.hpp>
+#include <ztd/text/output_sizing.hpp>
 #include <ztd/text/is_unicode_code_point.hpp>
 
 #include <ztd/text/detail/is_lossless.hpp>
 #include <ztd/text/detail/encoding_range.hpp>
 #include <ztd/text/detail/type_traits.hpp>
 #include <ztd/text/detail/span.hpp>
+#include <ztd/text/detail/sized_output.hpp>
 #include <ztd/text/detail/transcode_one.hpp>
 
 #include <string>
@@ -346,20 +348,23 @@ namespace ztd { namespace text {
 	/// @param[in]     __error_handler The error handlers for the from and to encodings,
 	/// respectively.
 	/// @param[in,out] __state A reference to the associated state for the @p __encoding 's encode step.
+	/// @param[in]     __sizing How to size the output container before writing into it. See
+	/// ztd::text::output_sizing.
 	///
 	/// @result A ztd::text::encode_result object that contains references to @p __state and an output of type @p
 	/// _OutputContainer.
 	///
-	/// @remarks This function detects creates a container of type @p _OutputContainer and uses a typical @c
-	/// std::back_inserter or @c std::push_back_inserter to fill in elements as it is written to. The result is
+	/// @remarks This function detects creates a container of type @p _OutputContainer and fills in elements as
+	/// they are written. Containers that are contiguous and resizable are written into through a pointer and grown
+	/// geometrically; others use a typical @c std::back_inserter or @c std::push_back_inserter . The result is
 	/// then returned, with the @c .output value put into the container.
 	//////
 	template <typename _OutputContainer, typename _Input, typename _Encoding, typename _ErrorHandler, typename _State>
-	constexpr auto encode_to(
-		_Input&& __input, _Encoding&& __encoding, _ErrorHandler&& __error_handler, _State& __state) {
+	constexpr auto encode_to(_Input&& __input, _Encoding&& __encoding, _ErrorHandler&& __error_handler,
+		_State& __state, output_sizing __sizing = output_sizing::automatic) {
 		using _UEncoding            = __txt_detail::__remove_cvref_t<_Encoding>;
-		using _BackInserterIterator = decltype(::std::back_inserter(::std::declval<_OutputContainer&>()));
-		using _Unbounded            = unbounded_view<_BackInserterIterator>;
+		using _OutputIterator       = __txt_detail::__container_output_iterator_t<_OutputContainer>;
+		using _Unbounded            = unbounded_view<_OutputIterator>;
 		using _UInput               = __txt_detail::__remove_cvref_t<_Input>;
 		using _InputValueType       = __txt_detail::__range_value_type_t<_UInput>;
 		using _IntermediateInput    = __txt_detail::__reconstruct_t<::std::conditional_t<::std::is_array_v<_UInput>,
@@ -368,6 +373,31 @@ namespace ztd { namespace text {
                _UInput>>;
 
 		_OutputContainer __output {};
+		if constexpr (__txt_detail::__is_sized_output_v<_OutputContainer, _Input>
+			&& __txt_detail::__is_encode_error_handler_callable_v<_Encoding, _IntermediateInput, _Unbounded,
+			     _ErrorHandler, _State>
+			&& __txt_detail::__is_encode_one_callable_v<_Encoding, _IntermediateInput, _Unbounded, _ErrorHandler,
+			     _State>) {
+			const ::std::size_t __upper_bound_size
+				= static_cast<::std::size_t>(__txt_detail::__adl::__adl_size(__input))
+				* max_code_units_v<_UEncoding>;
+			::std::size_t __output_size = 0;
+			if (__txt_detail::__pick_output_size(
+				     __output_size, __sizing, __upper_bound_size, [&](::std::size_t& __exact_size) {
+					     return __txt_detail::__encode_exact_size(__exact_size, __input, __encoding, __state);
+				     })) {
+				auto __stateful_result
+					= __txt_detail::__sized_output_into(__output, __output_size, [&](auto __output_view) {
+					       return encode_into(::std::forward<_Input>(__input),
+					            ::std::forward<_Encoding>(__encoding), ::std::move(__output_view),
+					            ::std::forward<_ErrorHandler>(__error_handler), __state);
+				       });
+				return __txt_detail::__replace_result_output(::std::move(__stateful_result), ::std::move(__output));
+			}
+		}
+		else {
+			(void)__sizing;
+		}
 		if constexpr (__txt_detail::__is_detected_v<__txt_detail::__detect_adl_size, _Input>) {
 			using _SizeType = decltype(__txt_detail::__adl::__adl_size(__input));
 			if constexpr (__txt_detail::__is_detected_v<__txt_detail::__detect_reserve_with_size_type, _OutputContainer,
@@ -382,10 +412,12 @@ namespace ztd { namespace text {
 			if constexpr (__txt_detail::__is_encode_one_callable_v<_Encoding, _IntermediateInput, _Unbounded,
 				              _ErrorHandler, _State>) {
 				// We can use the unbounded stuff
-				_Unbounded __insert_view(::std::back_inserter(__output));
+				__txt_detail::__container_output_t<_OutputContainer> __container_output(__output);
+				_Unbounded __insert_view(__container_output.__begin());
 				auto __stateful_result
 					= encode_into(::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding),
 					     ::std::move(__insert_view), ::std::forward<_ErrorHandler>(__error_handler), __state);
+				__container_output.__finish();
 				return __txt_detail::__replace_result_output(::std::move(__stateful_result), ::std::move(__output));
 			}
 			else {
@@ -500,17 +532,21 @@ namespace ztd { namespace text {
 	/// @param[in]     __error_handler The error handlers for the from and to encodings,
 	/// respectively.
 	/// @param[in,out] __state A reference to the associated state for the @p __encoding 's encode step.
+	/// @param[in]     __sizing How to size the output container before writing into it. See
+	/// ztd::text::output_sizing.
 	///
 	/// @result An object of type @p _OutputContainer .
 	///
-	/// @remarks This function detects creates a container of type @p _OutputContainer and uses a typical @c
-	/// std::back_inserter or @c std::push_back_inserter to fill in elements as it is written to.
+	/// @remarks This function detects creates a container of type @p _OutputContainer and fills in elements as
+	/// they are written. Containers that are contiguous and resizable are written into through a pointer and grown
+	/// geometrically; others use a typical @c std::back_inserter or @c std::push_back_inserter .
 	//////
 	template <typename _OutputContainer, typename _Input, typename _Encoding, typename _ErrorHandler, typename _State>
-	constexpr auto encode(_Input&& __input, _Encoding&& __encoding, _ErrorHandler&& __error_handler, _State& __state) {
+	constexpr auto encode(_Input&& __input, _Encoding&& __encoding, _ErrorHandler&& __error_handler,
+		_State& __state, output_sizing __sizing = output_sizing::automatic) {
 		using _UEncoding            = __txt_detail::__remove_cvref_t<_Encoding>;
-		using _BackInserterIterator = decltype(::std::back_inserter(::std::declval<_OutputContainer&>()));
-		using _Unbounded            = unbounded_view<_BackInserterIterator>;
+		using _OutputIterator       = __txt_detail::__container_output_iterator_t<_OutputContainer>;
+		using _Unbounded            = unbounded_view<_OutputIterator>;
 		using _UInput               = __txt_detail::__remove_cvref_t<_Input>;
 		using _InputValueType       = __txt_detail::__range_value_type_t<_UInput>;
 		using _IntermediateInput    = __txt_detail::__reconstruct_t<::std::conditional_t<::std::is_array_v<_UInput>,
@@ -519,6 +555,32 @@ namespace ztd { namespace text {
                _UInput>>;
 
 		_OutputContainer __output {};
+		if constexpr (__txt_detail::__is_sized_output_v<_OutputContainer, _Input>
+			&& __txt_detail::__is_encode_error_handler_callable_v<_Encoding, _IntermediateInput, _Unbounded,
+			     _ErrorHandler, _State>
+			&& __txt_detail::__is_encode_one_callable_v<_Encoding, _IntermediateInput, _Unbounded, _ErrorHandler,
+			     _State>) {
+			const ::std::size_t __upper_bound_size
+				= static_cast<::std::size_t>(__txt_detail::__adl::__adl_size(__input))
+				* max_code_units_v<_UEncoding>;
+			::std::size_t __output_size = 0;
+			if (__txt_detail::__pick_output_size(
+				     __output_size, __sizing, __upper_bound_size, [&](::std::size_t& __exact_size) {
+					     return __txt_detail::__encode_exact_size(__exact_size, __input, __encoding, __state);
+				     })) {
+				auto __stateful_result
+					= __txt_detail::__sized_output_into(__output, __output_size, [&](auto __output_view) {
+					       return encode_into(::std::forward<_Input>(__input),
+					            ::std::forward<_Encoding>(__encoding), ::std::move(__output_view),
+					            ::std::forward<_ErrorHandler>(__error_handler), __state);
+				       });
+				(void)__stateful_result;
+				return __output;
+			}
+		}
+		else {
+			(void)__sizing;
+		}
 		if constexpr (__txt_detail::__is_detected_v<__txt_detail::__detect_adl_size, _Input>) {
 			using _SizeType = decltype(__txt_detail::__adl::__adl_size(__input));
 			if constexpr (__txt_detail::__is_detected_v<__txt_detail::__detect_reserve_with_size_type, _OutputContainer,
@@ -533,10 +595,12 @@ namespace ztd { namespace text {
 			if constexpr (__txt_detail::__is_encode_one_callable_v<_Encoding, _IntermediateInput, _Unbounded,
 				              _ErrorHandler, _State>) {
 				// We can use the unbounded stuff
-				_Unbounded __insert_view(::std::back_inserter(__output));
+				__txt_detail::__container_output_t<_OutputContainer> __container_output(__output);
+				_Unbounded __insert_view(__container_output.__begin());
 				auto __stateful_result
 					= encode_into(::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding),
 					     ::std::move(__insert_view), ::std::forward<_ErrorHandler>(__error_handler), __state);
+				__container_output.__finish();
 				(void)__stateful_result;
 				return __output;
 			}
@@ -651,6 +715,8 @@ namespace ztd { namespace text {
 	/// @param[in]     __error_handler The error handlers for the from and to encodings,
 	/// respectively.
 	/// @param[in,out] __state A reference to the associated state for the @p __encoding 's encode step.
+	/// @param[in]     __sizing How to size the output container before writing into it. See
+	/// ztd::text::output_sizing.
 	///
 	/// @result An object of type @c std::vector or @c std::basic_string , whichever is more appropriate for the
 	/// output code unt type.
@@ -661,7 +727,8 @@ namespace ztd { namespace text {
 	/// elements as it is written to.
 	//////
 	template <typename _Input, typename _Encoding, typename _ErrorHandler, typename _State>
-	constexpr auto encode(_Input&& __input, _Encoding&& __encoding, _ErrorHandler&& __error_handler, _State& __state) {
+	constexpr auto encode(_Input&& __input, _Encoding&& __encoding, _ErrorHandler&& __error_handler,
+		_State& __state, output_sizing __sizing = output_sizing::automatic) {
 		using _UEncoding = __txt_detail::__remove_cvref_t<_Encoding>;
 		using _CodeUnit  = code_unit_t<_UEncoding>;
 		using _OutputContainer
@@ -669,7 +736,7 @@ namespace ztd { namespace text {
 			     ::std::basic_string<_CodeUnit>, ::std::vector<_CodeUnit>>;
 
 		return encode<_OutputContainer>(::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding),
-			::std::forward<_ErrorHandler>(__error_handler), __state);
+			::std::forward<_ErrorHandler>(__error_handler), __state, __sizing);
 	}
 
 	//////
@@ -57,6 +57,8 @@ namespace ztd { namespace text {
 	/// @tparam _Range The range of input that will be fed into the _FromEncoding's decode operation.
 	/// @tparam _ErrorHandler The error handler for any encode-step failures.
 	/// @tparam _State The state type to use for the encode operations to intermediate code points.
+	/// @tparam _BufferSize The number of code units to encode ahead of time and keep in the iterator. The default, 0,
+	/// does one encode step at a time.
 	///
 	/// @remarks This type produces proxies as their reference type, and are only readable, not writable iterators. The
 	/// iterator presents code units one at a time, regardless of how many code units are output by one decode
@@ -66,13 +68,15 @@ namespace ztd { namespace text {
 	/// interfaces.
 	//////
 	template <typename _Encoding, typename _Range, typename _ErrorHandler = default_handler,
-		typename _State = encode_state_t<_Encoding>>
+		typename _State = encode_state_t<_Encoding>, ::std::size_t _BufferSize = 0>
 	class encode_iterator
 	: public __txt_detail::__encoding_iterator<__txt_detail::__transaction::__encode,
-		  encode_iterator<_Encoding, _Range, _ErrorHandler, _State>, _Encoding, _Range, _ErrorHandler, _State> {
+		  encode_iterator<_Encoding, _Range, _ErrorHandler, _State, _BufferSize>, _Encoding, _Range, _ErrorHandler,
+		  _State, _BufferSize> {
 	private:
 		using __base_t = __txt_detail::__encoding_iterator<__txt_detail::__transaction::__encode,
-			encode_iterator<_Encoding, _Range, _ErrorHandler, _State>, _Encoding, _Range, _ErrorHandler, _State>;
+			encode_iterator<_Encoding, _Range, _ErrorHandler, _State, _BufferSize>, _Encoding, _Range, _ErrorHandler,
+			_State, _BufferSize>;
 
 	public:
 		using __base_t::__base_t;
@@ -42,6 +42,7 @@
 #include <ztd/text/subrange.hpp>
 #include <ztd/text/detail/reconstruct.hpp>
 
+#include <iterator>
 #include <string_view>
 
 namespace ztd { namespace text {
@@ -60,15 +61,20 @@ namespace ztd { namespace text {
 	/// @tparam _Range The range of input that will be fed into the _FromEncoding's decode operation.
 	/// @tparam _ErrorHandler The error handler for any encode-step failures.
 	/// @tparam _State The state type to use for the encode operations to intermediate code points.
+	/// @tparam _BufferSize The number of code units the iterators encode ahead of time and keep. The default, 0,
+	/// does one encode step per increment. Something like 64 lets the iterators use the bulk encode functions (and
+	/// any fast paths they have), which is a lot faster for plain loops over the view.
 	///
 	/// @remarks The view presents code units one at a time, regardless of how many code units are output by one decode
 	/// operation. This means if, for example, one (1) UTF-32 code point becomes four (4) UTF-8 code units, it will
 	/// present each code unit one at a time. If you are looking to explicitly know what a single encode operation maps
 	/// into as far as number of code points to code units (and vice-versa), you will have to use lower-level
-	/// interfaces.
+	/// interfaces. When buffering, the @c base() and @c state() of an iterator are the input and state after
+	/// everything in its buffer, rather than after the value it currently points to.
 	//////
 	template <typename _Encoding, typename _Range = ::std::basic_string_view<code_point_t<_Encoding>>,
-		typename _ErrorHandler = __txt_detail::__careless_handler, typename _State = encode_state_t<_Encoding>>
+		typename _ErrorHandler = __txt_detail::__careless_handler, typename _State = encode_state_t<_Encoding>,
+		::std::size_t _BufferSize = 0>
 	class encode_view {
 	private:
 		using _StoredRange = __txt_detail::__reconstruct_t<__txt_detail::__remove_cvref_t<_Range>>;
@@ -78,7 +84,7 @@ namespace ztd { namespace text {
 		/// @brief The iterator type for this view.
 		///
 		//////
-		using iterator = encode_iterator<_Encoding, _StoredRange, _ErrorHandler, _State>;
+		using iterator = encode_iterator<_Encoding, _StoredRange, _ErrorHandler, _State, _BufferSize>;
 		//////
 		/// @brief The sentinel type for this view.
 		///
@@ -179,6 +185,26 @@ namespace ztd { namespace text {
 			return sentinel();
 		}
 
+		//////
+		/// @brief The beginning of the range, going backwards.
+		///
+		/// @remarks Only usable when the iterators can go backwards: the range must be bidirectional, the view must
+		/// not be buffering, and the encoding must have a @c encode_one_backward function. The code units are then
+		/// produced starting from the end of the range, so looking at the last few of them does not go through all
+		/// of the ones before.
+		//////
+		constexpr ::std::reverse_iterator<iterator> rbegin() const {
+			return ::std::reverse_iterator<iterator>(iterator(sentinel(), this->_M_it));
+		}
+
+		//////
+		/// @brief The end of the range, going backwards.
+		///
+		//////
+		constexpr ::std::reverse_iterator<iterator> rend() const {
+			return ::std::reverse_iterator<iterator>(this->_M_it);
+		}
+
 		//////
 		/// @brief The reconstruct extension point for rebuilding an encoding view from its iterator and sentinel
 		/// type.
@@ -0,0 +1,334 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#pragma once
+
+#ifndef ZTD_TEXT_ENCODING_REGISTRY_HPP
+#define ZTD_TEXT_ENCODING_REGISTRY_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/any_encoding.hpp>
+#include <ztd/text/ascii.hpp>
+#include <ztd/text/encoding_scheme.hpp>
+#include <ztd/text/utf8.hpp>
+#include <ztd/text/utf16.hpp>
+#include <ztd/text/utf32.hpp>
+
+#include <ztd/text/detail/encoding_name.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	//////
+	/// @addtogroup ztd_text_encodings Encodings
+	/// @{
+	//////
+
+	//////
+	/// @brief A table from encoding names (such as an HTTP @c charset or an XML encoding declaration) to
+	/// ztd::text::any_byte_encoding objects.
+	///
+	/// @tparam _Byte The byte type of the erased encodings.
+	///
+	/// @remarks Names are matched without regard to case, spacing, or punctuation, so @c "utf-8", @c "UTF8" and @c "
+	/// Utf_8 " all name the same encoding. Each encoding is constructed once, when it is added, and lookups hand out
+	/// pointers to that one object: they hash the name once, probe a hash table, and never allocate.
+	/// A default-constructed registry knows every Unicode encoding of the library, and ASCII, under all of their
+	/// common aliases. Looking things up from many threads at once is fine; adding encodings while other threads look
+	/// things up is not.
+	//////
+	template <typename _Byte>
+	class basic_encoding_registry {
+	public:
+		//////
+		/// @brief The type of the encodings handed out by this registry.
+		///
+		//////
+		using encoding_type = any_byte_encoding<_Byte>;
+
+		//////
+		/// @brief A pair of encodings looked up together, typically for transcoding from one to the other.
+		///
+		//////
+		struct encoding_pair {
+			//////
+			/// @brief The encoding to transcode from, or @c nullptr if the name was not found.
+			///
+			//////
+			const encoding_type* from;
+			//////
+			/// @brief The encoding to transcode to, or @c nullptr if the name was not found.
+			///
+			//////
+			const encoding_type* to;
+
+			//////
+			/// @brief Whether both names were found.
+			///
+			//////
+			constexpr explicit operator bool() const noexcept {
+				return this->from != nullptr && this->to != nullptr;
+			}
+		};
+
+		//////
+		/// @brief Constructs a registry with the built-in encodings: UTF-8, UTF-16, UTF-32 (each with its
+		/// little-endian and big-endian byte orders), WTF-8, MUTF-8, and ASCII.
+		///
+		//////
+		basic_encoding_registry() : _M_encodings(), _M_names(), _M_name_hashes(), _M_name_encodings(), _M_slots() {
+			constexpr __txt_detail::__encoding_id __builtin_ids[]
+				= { __txt_detail::__encoding_id::__utf8, __txt_detail::__encoding_id::__utf16,
+					  __txt_detail::__encoding_id::__utf16le, __txt_detail::__encoding_id::__utf16be,
+					  __txt_detail::__encoding_id::__utf32, __txt_detail::__encoding_id::__utf32le,
+					  __txt_detail::__encoding_id::__utf32be, __txt_detail::__encoding_id::__wtf8,
+					  __txt_detail::__encoding_id::__mutf8, __txt_detail::__encoding_id::__ascii };
+			for (__txt_detail::__encoding_id __id : __builtin_ids) {
+				this->_M_encodings.push_back(_S_make_builtin(__id));
+				for (const __txt_detail::__encoding_alias& __alias : __txt_detail::__encoding_aliases) {
+					if (__alias._M_id == __id) {
+						this->_M_add_name(__alias._M_name, this->_M_encodings.size() - 1);
+					}
+				}
+			}
+		}
+
+		//////
+		/// @brief Cannot copy-construct a registry: the encodings it hands out are owned by it.
+		///
+		//////
+		basic_encoding_registry(const basic_encoding_registry&) = delete;
+
+		//////
+		/// @brief Cannot copy-assign a registry: the encodings it hands out are owned by it.
+		///
+		//////
+		basic_encoding_registry& operator=(const basic_encoding_registry&) = delete;
+
+		//////
+		/// @brief Move-constructs a registry. Pointers handed out by @p __other stay valid and now belong to this
+		/// registry.
+		///
+		/// @remarks @p __other is left empty: it finds nothing, until encodings are added to it again.
+		//////
+		basic_encoding_registry(basic_encoding_registry&&) = default;
+
+		//////
+		/// @brief Move-assigns a registry. Pointers handed out by @p __other stay valid and now belong to this
+		/// registry.
+		///
+		/// @remarks @p __other is left empty: it finds nothing, until encodings are added to it again.
+		//////
+		basic_encoding_registry& operator=(basic_encoding_registry&&) = default;
+
+		//////
+		/// @brief Finds the encoding with the given name.
+		///
+		/// @param[in] __name The name, or any alias, of the encoding.
+		///
+		/// @returns A pointer to the encoding, which stays valid as long as this registry does, or @c nullptr if no
+		/// encoding has that name.
+		//////
+		const encoding_type* find(::std::string_view __name) const noexcept {
+			::std::size_t __index = this->_M_find(__name);
+			if (__index == _S_empty_slot) {
+				return nullptr;
+			}
+			return this->_M_encodings[this->_M_name_encodings[__index]].get();
+		}
+
+		//////
+		/// @brief Finds the encodings to transcode between.
+		///
+		/// @param[in] __from_name The name, or any alias, of the encoding to transcode from.
+		/// @param[in] __to_name The name, or any alias, of the encoding to transcode to.
+		///
+		/// @remarks Both encodings are the ones kept by this registry, so this never constructs anything.
+		//////
+		encoding_pair find_pair(::std::string_view __from_name, ::std::string_view __to_name) const noexcept {
+			return encoding_pair { this->find(__from_name), this->find(__to_name) };
+		}
+
+		//////
+		/// @brief Whether an encoding has the given name.
+		///
+		//////
+		bool contains(::std::string_view __name) const noexcept {
+			return this->find(__name) != nullptr;
+		}
+
+		//////
+		/// @brief Adds an encoding under the given name.
+		///
+		/// @param[in] __name The name of the encoding. If an encoding already has this name, the name is moved over
+		/// to the new one: pointers handed out for the old one stay valid.
+		/// @param[in] __encoding The encoding object, which is put into a ztd::text::any_byte_encoding (and wrapped
+		/// in a ztd::text::encoding_scheme if its code units are not bytes).
+		///
+		/// @returns The encoding kept by this registry.
+		//////
+		template <typename _Encoding>
+		const encoding_type& add(::std::string_view __name, _Encoding&& __encoding) {
+			this->_M_encodings.push_back(::std::make_unique<encoding_type>(::std::forward<_Encoding>(__encoding)));
+			this->_M_add_name(__name, this->_M_encodings.size() - 1);
+			return *this->_M_encodings.back();
+		}
+
+		//////
+		/// @brief Adds another name for an encoding already in this registry.
+		///
+		/// @param[in] __alias The new name. If an encoding already has this name, the name is moved over.
+		/// @param[in] __name The name, or any alias, of the encoding.
+		///
+		/// @returns Whether @p __name was found.
+		//////
+		bool add_alias(::std::string_view __alias, ::std::string_view __name) {
+			::std::size_t __index = this->_M_find(__name);
+			if (__index == _S_empty_slot) {
+				return false;
+			}
+			this->_M_add_name(__alias, this->_M_name_encodings[__index]);
+			return true;
+		}
+
+	private:
+		static constexpr ::std::size_t _S_empty_slot = static_cast<::std::size_t>(-1);
+
+		static ::std::unique_ptr<encoding_type> _S_make_builtin(__txt_detail::__encoding_id __id) {
+			switch (__id) {
+			case __txt_detail::__encoding_id::__utf8:
+				return ::std::make_unique<encoding_type>(utf8 {});
+			case __txt_detail::__encoding_id::__utf16:
+				return ::std::make_unique<encoding_type>(utf16 {});
+			case __txt_detail::__encoding_id::__utf16le:
+				return ::std::make_unique<encoding_type>(basic_utf16_le<_Byte> {});
+			case __txt_detail::__encoding_id::__utf16be:
+				return ::std::make_unique<encoding_type>(basic_utf16_be<_Byte> {});
+			case __txt_detail::__encoding_id::__utf32:
+				return ::std::make_unique<encoding_type>(utf32 {});
+			case __txt_detail::__encoding_id::__utf32le:
+				return ::std::make_unique<encoding_type>(basic_utf32_le<_Byte> {});
+			case __txt_detail::__encoding_id::__utf32be:
+				return ::std::make_unique<encoding_type>(basic_utf32_be<_Byte> {});
+			case __txt_detail::__encoding_id::__wtf8:
+				return ::std::make_unique<encoding_type>(wtf8 {});
+			case __txt_detail::__encoding_id::__mutf8:
+				return ::std::make_unique<encoding_type>(mutf8 {});
+			case __txt_detail::__encoding_id::__ascii:
+			default:
+				return ::std::make_unique<encoding_type>(ascii {});
+			}
+		}
+
+		// Returns the slot holding the name, or the empty slot where it would go. The table is open-addressed with
+		// linear probing, and never more than half full.
+		::std::size_t _M_find_slot(::std::string_view __name, ::std::uint_least64_t __hash) const noexcept {
+			const ::std::size_t __mask = this->_M_slots.size() - 1;
+			for (::std::size_t __slot = __txt_detail::__encoding_name_index(__hash, 0, __mask);;
+				__slot                = (__slot + 1) & __mask) {
+				::std::size_t __index = this->_M_slots[__slot];
+				if (__index == _S_empty_slot
+					|| (this->_M_name_hashes[__index] == __hash
+					     && __txt_detail::__is_encoding_name_equal(__name, this->_M_names[__index]))) {
+					return __slot;
+				}
+			}
+		}
+
+		::std::size_t _M_find(::std::string_view __name) const noexcept {
+			if (this->_M_slots.empty()) {
+				// moved-from: there is no table to look in
+				return _S_empty_slot;
+			}
+			return this->_M_slots[this->_M_find_slot(__name, __txt_detail::__encoding_name_hash(__name))];
+		}
+
+		void _M_add_name(::std::string_view __name, ::std::size_t __encoding_index) {
+			if ((this->_M_names.size() + 1) * 2 > this->_M_slots.size()) {
+				// grow, and put every name back in: their hashes are kept, so no name is hashed again
+				this->_M_slots.assign(this->_M_slots.empty() ? 16 : this->_M_slots.size() * 2, _S_empty_slot);
+				for (::std::size_t __index = 0; __index < this->_M_names.size(); ++__index) {
+					const ::std::string& __existing = this->_M_names[__index];
+					this->_M_slots[this->_M_find_slot(__existing, this->_M_name_hashes[__index])] = __index;
+				}
+			}
+			::std::uint_least64_t __hash = __txt_detail::__encoding_name_hash(__name);
+			::std::size_t __slot         = this->_M_find_slot(__name, __hash);
+			if (this->_M_slots[__slot] != _S_empty_slot) {
+				this->_M_name_encodings[this->_M_slots[__slot]] = __encoding_index;
+				return;
+			}
+			this->_M_slots[__slot] = this->_M_names.size();
+			this->_M_names.emplace_back(__name);
+			this->_M_name_hashes.push_back(__hash);
+			this->_M_name_encodings.push_back(__encoding_index);
+		}
+
+		::std::vector<::std::unique_ptr<encoding_type>> _M_encodings;
+		::std::vector<::std::string> _M_names;
+		::std::vector<::std::uint_least64_t> _M_name_hashes;
+		::std::vector<::std::size_t> _M_name_encodings;
+		::std::vector<::std::size_t> _M_slots;
+	};
+
+	//////
+	/// @brief A ztd::text::basic_encoding_registry of ztd::text::any_encoding objects.
+	///
+	//////
+	using encoding_registry = basic_encoding_registry<::std::byte>;
+
+	//////
+	/// @brief A registry with only the built-in encodings, constructed on first use.
+	///
+	/// @remarks Use this for lookups from anywhere in a program without passing a registry around. To add encodings
+	/// of your own, make a ztd::text::encoding_registry of your own.
+	//////
+	inline const encoding_registry& default_encoding_registry() {
+		static const encoding_registry __registry {};
+		return __registry;
+	}
+
+	//////
+	/// @}
+	//////
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#endif // ZTD_TEXT_ENCODING_REGISTRY_HPP
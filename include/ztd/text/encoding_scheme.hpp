@@ -49,10 +49,16 @@
 #include <ztd/text/decode_result.hpp>
 #include <ztd/text/encoding_scheme.hpp>
 #include <ztd/text/endian.hpp>
+#include <ztd/text/validate_result.hpp>
+#include <ztd/text/tag.hpp>
+#include <ztd/text/forward.hpp>
 
 #include <ztd/text/detail/word_iterator.hpp>
 #include <ztd/text/detail/ebco.hpp>
 #include <ztd/text/detail/span.hpp>
+#include <ztd/text/detail/reconstruct.hpp>
+#include <ztd/text/detail/bulk_transcode.hpp>
+#include <ztd/text/detail/transcode_utf_scheme.hpp>
 
 #include <optional>
 #include <cstddef>
@@ -229,6 +235,21 @@ namespace ztd { namespace text {
 			}
 		};
 
+		//////
+		/// @brief Whether an encoding_scheme over @p _Encoding can use the byte-swapping UTF-16 / UTF-32 bulk
+		/// kernels.
+		//////
+		template <typename _Encoding>
+		inline constexpr bool __is_byte_swappable_utf_v = false;
+
+		template <typename _CodeUnit, typename _CodePoint>
+		inline constexpr bool __is_byte_swappable_utf_v<basic_utf16<_CodeUnit, _CodePoint>>
+			= sizeof(_CodeUnit) == sizeof(char16_t) && sizeof(_CodePoint) == sizeof(char32_t);
+
+		template <typename _CodeUnit, typename _CodePoint>
+		inline constexpr bool __is_byte_swappable_utf_v<basic_utf32<_CodeUnit, _CodePoint>>
+			= sizeof(_CodeUnit) == sizeof(char32_t) && sizeof(_CodePoint) == sizeof(char32_t);
+
 		template <typename _Super, typename _Encoding, typename = void>
 		class __is_or_contains_unicode_encoding { };
 
@@ -275,13 +296,13 @@ namespace ztd { namespace text {
 	template <typename _Encoding, endian _Endian = endian::native, typename _Byte = ::std::byte>
 	class encoding_scheme
 	: public __txt_detail::__replacement_code_units<encoding_scheme<_Encoding, _Endian, _Byte>,
-		  is_code_points_replaceable_v<__txt_detail::__remove_cvref_t<__txt_detail::__unwrap_t<_Encoding>>>>,
-	  public __txt_detail::__replacement_code_points<encoding_scheme<_Encoding, _Endian, _Byte>,
 		  is_code_units_replaceable_v<__txt_detail::__remove_cvref_t<__txt_detail::__unwrap_t<_Encoding>>>>,
+	  public __txt_detail::__replacement_code_points<encoding_scheme<_Encoding, _Endian, _Byte>,
+		  is_code_points_replaceable_v<__txt_detail::__remove_cvref_t<__txt_detail::__unwrap_t<_Encoding>>>>,
 	  public __txt_detail::__maybe_replacement_code_units<encoding_scheme<_Encoding, _Endian, _Byte>,
-		  is_code_points_maybe_replaceable_v<__txt_detail::__remove_cvref_t<__txt_detail::__unwrap_t<_Encoding>>>>,
-	  public __txt_detail::__maybe_replacement_code_points<encoding_scheme<_Encoding, _Endian, _Byte>,
 		  is_code_units_maybe_replaceable_v<__txt_detail::__remove_cvref_t<__txt_detail::__unwrap_t<_Encoding>>>>,
+	  public __txt_detail::__maybe_replacement_code_points<encoding_scheme<_Encoding, _Endian, _Byte>,
+		  is_code_points_maybe_replaceable_v<__txt_detail::__remove_cvref_t<__txt_detail::__unwrap_t<_Encoding>>>>,
 	  public __txt_detail::__is_or_contains_unicode_encoding<encoding_scheme<_Encoding, _Endian, _Byte>,
 		  __txt_detail::__remove_cvref_t<__txt_detail::__unwrap_t<_Encoding>>>,
 	  private __txt_detail::__ebco<_Encoding> {
@@ -290,6 +311,11 @@ namespace ztd { namespace text {
 		using _UBaseEncoding = __txt_detail::__remove_cvref_t<__txt_detail::__unwrap_t<_Encoding>>;
 		using _BaseCodeUnit  = code_unit_t<_UBaseEncoding>;
 
+		template <typename _Range>
+		inline static constexpr bool __is_word_trimmable_v
+			= __txt_detail::__is_range_iterator_concept_or_better_v<::std::random_access_iterator_tag, _Range>
+			&& ::std::is_same_v<__txt_detail::__range_iterator_t<_Range>, __txt_detail::__range_sentinel_t<_Range>>;
+
 	public:
 		///////
 		/// @brief The encoding type that this scheme wraps.
@@ -413,16 +439,49 @@ namespace ztd { namespace text {
 
 			auto __init   = __txt_detail::__adl::__adl_cbegin(__input);
 			auto __inlast = __txt_detail::__adl::__adl_cend(__input);
-			subrange<_InByteIt, _InByteSen> __inbytes(
-				_InByteIt(::std::move(__init)), _InByteSen(::std::move(__inlast)));
-			__txt_detail::__scheme_decode_handler<_Byte, _UInputRange, _UOutputRange, _UErrorHandler> __scheme_handler(
-				__error_handler);
-			auto __result
-				= this->base().decode_one(__inbytes, ::std::forward<_OutputRange>(__output), __scheme_handler, __s);
-			return _Result(__txt_detail::__reconstruct(::std::in_place_type<_UInputRange>, __result.input.begin().base(),
-				               __result.input.end().base()),
-				__txt_detail::__reconstruct(::std::in_place_type<_UOutputRange>, ::std::move(__result.output)), __s,
-				__result.error_code, __result.handled_errors);
+			if constexpr (__is_word_trimmable_v<_UInputRange>) {
+				// only ever look at whole words: a trailing partial one would be read past the end of the input
+				constexpr ::std::ptrdiff_t __per_word
+					= sizeof(_BaseCodeUnit) / sizeof(__txt_detail::__range_value_type_t<_UInputRange>);
+				const auto __whole_size = ((__inlast - __init) / __per_word) * __per_word;
+				if (__whole_size == 0 && __init != __inlast) {
+					code_unit __units[max_code_units] {};
+					::std::size_t __units_size = 0;
+					for (; __init != __inlast; ++__init, ++__units_size) {
+						__units[__units_size] = static_cast<code_unit>(*__init);
+					}
+					return __error_handler(*this,
+						_Result(__txt_detail::__reconstruct(::std::in_place_type<_UInputRange>, __init, __inlast),
+						     __txt_detail::__reconstruct(
+						          ::std::in_place_type<_UOutputRange>, ::std::forward<_OutputRange>(__output)),
+						     __s, encoding_error::incomplete_sequence),
+						::ztd::text::span<code_unit>(__units, __units_size));
+				}
+				auto __inwords_last = __init + __whole_size;
+				subrange<_InByteIt, _InByteSen> __inbytes(
+					_InByteIt(::std::move(__init)), _InByteSen(::std::move(__inwords_last)));
+				__txt_detail::__scheme_decode_handler<_Byte, _UInputRange, _UOutputRange, _UErrorHandler>
+					__scheme_handler(__error_handler);
+				auto __result = this->base().decode_one(
+					__inbytes, ::std::forward<_OutputRange>(__output), __scheme_handler, __s);
+				// the partial word is still there for the next call to report
+				return _Result(__txt_detail::__reconstruct(::std::in_place_type<_UInputRange>,
+					               __result.input.begin().base(), ::std::move(__inlast)),
+					__txt_detail::__reconstruct(::std::in_place_type<_UOutputRange>, ::std::move(__result.output)), __s,
+					__result.error_code, __result.handled_errors);
+			}
+			else {
+				subrange<_InByteIt, _InByteSen> __inbytes(
+					_InByteIt(::std::move(__init)), _InByteSen(::std::move(__inlast)));
+				__txt_detail::__scheme_decode_handler<_Byte, _UInputRange, _UOutputRange, _UErrorHandler>
+					__scheme_handler(__error_handler);
+				auto __result = this->base().decode_one(
+					__inbytes, ::std::forward<_OutputRange>(__output), __scheme_handler, __s);
+				return _Result(__txt_detail::__reconstruct(::std::in_place_type<_UInputRange>,
+					               __result.input.begin().base(), __result.input.end().base()),
+					__txt_detail::__reconstruct(::std::in_place_type<_UOutputRange>, ::std::move(__result.output)), __s,
+					__result.error_code, __result.handled_errors);
+			}
 		}
 
 		//////
@@ -455,14 +514,136 @@ namespace ztd { namespace text {
 
 			auto __outit   = __txt_detail::__adl::__adl_begin(__output);
 			auto __outlast = __txt_detail::__adl::__adl_end(__output);
-			subrange<_OutByteIt, _OutByteSen> __outwords(
-				_OutByteIt(::std::move(__outit)), _OutByteSen(::std::move(__outlast)));
-			auto __result = this->base().encode_one(::std::forward<_InputRange>(__input), __outwords,
-				::std::forward<_ErrorHandler>(__error_handler), __s);
-			return _Result(__txt_detail::__reconstruct(::std::in_place_type<_UInputRange>, __result.input),
-				__txt_detail::__reconstruct(::std::in_place_type<_UOutputRange>, __result.output.begin().base(),
-				     __result.output.end().base()),
-				__s, __result.error_code, __result.handled_errors);
+			if constexpr (__is_word_trimmable_v<_UOutputRange>) {
+				// only ever write whole words: a trailing partial one would be written past the end of the output
+				constexpr ::std::ptrdiff_t __per_word
+					= sizeof(_BaseCodeUnit) / sizeof(__txt_detail::__range_value_type_t<_UOutputRange>);
+				auto __outwords_last = __outit + ((__outlast - __outit) / __per_word) * __per_word;
+				subrange<_OutByteIt, _OutByteSen> __outwords(
+					_OutByteIt(::std::move(__outit)), _OutByteSen(::std::move(__outwords_last)));
+				auto __result = this->base().encode_one(::std::forward<_InputRange>(__input), __outwords,
+					::std::forward<_ErrorHandler>(__error_handler), __s);
+				return _Result(__txt_detail::__reconstruct(::std::in_place_type<_UInputRange>, __result.input),
+					__txt_detail::__reconstruct(::std::in_place_type<_UOutputRange>, __result.output.begin().base(),
+					     ::std::move(__outlast)),
+					__s, __result.error_code, __result.handled_errors);
+			}
+			else {
+				subrange<_OutByteIt, _OutByteSen> __outwords(
+					_OutByteIt(::std::move(__outit)), _OutByteSen(::std::move(__outlast)));
+				auto __result = this->base().encode_one(::std::forward<_InputRange>(__input), __outwords,
+					::std::forward<_ErrorHandler>(__error_handler), __s);
+				return _Result(__txt_detail::__reconstruct(::std::in_place_type<_UInputRange>, __result.input),
+					__txt_detail::__reconstruct(::std::in_place_type<_UOutputRange>, __result.output.begin().base(),
+					     __result.output.end().base()),
+					__s, __result.error_code, __result.handled_errors);
+			}
+		}
+
+	private:
+		inline static constexpr bool __is_byte_swappable
+			= __txt_detail::__is_byte_swappable_utf_v<_UBaseEncoding> && (sizeof(_Byte) == 1);
+
+		template <typename _InByte, typename _OutCodePoint>
+		static constexpr void __bulk_decode(const _InByte*& __in, const _InByte* __in_last, _OutCodePoint*& __out,
+			_OutCodePoint* __out_last) noexcept {
+			if constexpr (sizeof(_BaseCodeUnit) == sizeof(char16_t)) {
+				__txt_detail::__utf16_scheme_to_utf32<_Endian>(__in, __in_last, __out, __out_last);
+			}
+			else {
+				__txt_detail::__utf32_scheme_to_utf32<_Endian>(__in, __in_last, __out, __out_last);
+			}
+		}
+
+		template <typename _InCodePoint, typename _OutByte>
+		static constexpr void __bulk_encode(const _InCodePoint*& __in, const _InCodePoint* __in_last,
+			_OutByte*& __out, _OutByte* __out_last) noexcept {
+			if constexpr (sizeof(_BaseCodeUnit) == sizeof(char16_t)) {
+				__txt_detail::__utf32_to_utf16_scheme<_Endian>(__in, __in_last, __out, __out_last);
+			}
+			else {
+				__txt_detail::__utf32_to_utf32_scheme<_Endian>(__in, __in_last, __out, __out_last);
+			}
+		}
+
+	public:
+		//////
+		/// @internal
+		///
+		/// @brief Extension point hooks for the implementation-side only.
+		///
+		/// @remarks For UTF-16 and UTF-32 over contiguous bytes, validates whole vectors of words at once, swapping
+		/// their bytes if need be. The failing position is the same as with ztd::text::basic_validate_code_units.
+		//////
+		template <typename _Input, typename _DecodeState,
+			::std::enable_if_t<__is_byte_swappable
+			     && __txt_detail::__is_contiguous_byte_range_v<
+			          __txt_detail::__string_view_or_span_or_reconstruct_t<_Input>>>* = nullptr>
+		constexpr friend auto __text_validate_code_units(tag<encoding_scheme>, _Input&& __input,
+			__txt_detail::__type_identity_t<const encoding_scheme&>, _DecodeState& __state) {
+			using _WorkingInput = __txt_detail::__string_view_or_span_or_reconstruct_t<_Input>;
+			using _Result       = validate_result<_WorkingInput, _DecodeState>;
+
+			_WorkingInput __working_input(
+				__txt_detail::__reconstruct(::std::in_place_type<_WorkingInput>, ::std::forward<_Input>(__input)));
+			auto __first         = __txt_detail::__adl::__adl_begin(__working_input);
+			auto __last          = __txt_detail::__adl::__adl_end(__working_input);
+			const auto* __pfirst = __txt_detail::__adl::__adl_to_address(__first);
+			const auto* __plast  = __pfirst + (__last - __first);
+			const auto* __pfail  = __txt_detail::__utf_scheme_validate(__pfirst, __plast,
+				[](auto*& __in, auto* __in_last, auto*& __out, auto* __out_last) constexpr noexcept {
+					encoding_scheme::__bulk_decode(__in, __in_last, __out, __out_last);
+				});
+			__first += (__pfail - __pfirst);
+			return _Result(__txt_detail::__reconstruct(::std::in_place_type<_WorkingInput>, ::std::move(__first),
+				               ::std::move(__last)),
+				__pfail == __plast, __state);
+		}
+
+		//////
+		/// @internal
+		///
+		/// @brief Extension point hooks for the implementation-side only.
+		///
+		/// @remarks For UTF-16 and UTF-32 over contiguous bytes, decodes whole vectors of words at once, swapping
+		/// their bytes if need be. The result is the same as with ztd::text::basic_decode_into.
+		//////
+		template <typename _Input, typename _Output, typename _ErrorHandler, typename _State,
+			::std::enable_if_t<__is_byte_swappable
+			     && __txt_detail::__is_bulk_transcodable_v<_Input, sizeof(code_unit), _Output,
+			          sizeof(code_point)>>* = nullptr>
+		constexpr friend auto __text_decode(tag<encoding_scheme>, _Input&& __input,
+			__txt_detail::__type_identity_t<const encoding_scheme&> __encoding, _Output&& __output,
+			_ErrorHandler&& __error_handler, _State& __state) {
+			return __txt_detail::__bulk_decode_into(
+				[](auto*& __in, auto* __in_last, auto*& __out, auto* __out_last) constexpr noexcept {
+					encoding_scheme::__bulk_decode(__in, __in_last, __out, __out_last);
+				},
+				::std::forward<_Input>(__input), __encoding, ::std::forward<_Output>(__output), __error_handler,
+				__state);
+		}
+
+		//////
+		/// @internal
+		///
+		/// @brief Extension point hooks for the implementation-side only.
+		///
+		/// @remarks For UTF-16 and UTF-32 over contiguous bytes, encodes whole vectors of code points at once,
+		/// swapping their bytes if need be. The result is the same as with ztd::text::basic_encode_into.
+		//////
+		template <typename _Input, typename _Output, typename _ErrorHandler, typename _State,
+			::std::enable_if_t<__is_byte_swappable
+			     && __txt_detail::__is_bulk_transcodable_v<_Input, sizeof(code_point), _Output,
+			          sizeof(code_unit)>>* = nullptr>
+		constexpr friend auto __text_encode(tag<encoding_scheme>, _Input&& __input,
+			__txt_detail::__type_identity_t<const encoding_scheme&> __encoding, _Output&& __output,
+			_ErrorHandler&& __error_handler, _State& __state) {
+			return __txt_detail::__bulk_encode_into(
+				[](auto*& __in, auto* __in_last, auto*& __out, auto* __out_last) constexpr noexcept {
+					encoding_scheme::__bulk_encode(__in, __in_last, __out, __out_last);
+				},
+				::std::forward<_Input>(__input), __encoding, ::std::forward<_Output>(__output), __error_handler,
+				__state);
 		}
 	};
 
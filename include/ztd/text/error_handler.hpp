@@ -59,6 +59,7 @@
 #include <string_view>
 #include <utility>
 #include <array>
+#include <algorithm>
 
 namespace ztd { namespace text {
 	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
@@ -302,8 +303,8 @@ namespace ztd { namespace text {
 		//////
 		template <typename _Encoding, typename _InputRange, typename _OutputRange, typename _State,
 			typename _Progress>
-		constexpr auto operator()(const _Encoding&, encode_result<_InputRange, _OutputRange, _State> __result,
-			const _Progress&) const noexcept(false) {
+		constexpr encode_result<_InputRange, _OutputRange, _State> operator()(const _Encoding&,
+			encode_result<_InputRange, _OutputRange, _State> __result, const _Progress&) const noexcept(false) {
 			throw __result.error_code;
 		}
 
@@ -313,8 +314,8 @@ namespace ztd { namespace text {
 		//////
 		template <typename _Encoding, typename _InputRange, typename _OutputRange, typename _State,
 			typename _Progress>
-		constexpr auto operator()(const _Encoding&, decode_result<_InputRange, _OutputRange, _State> __result,
-			const _Progress&) const noexcept(false) {
+		constexpr decode_result<_InputRange, _OutputRange, _State> operator()(const _Encoding&,
+			decode_result<_InputRange, _OutputRange, _State> __result, const _Progress&) const noexcept(false) {
 			throw __result.error_code;
 		}
 	};
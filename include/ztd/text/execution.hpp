@@ -43,6 +43,8 @@
 #include <ztd/text/unicode_code_point.hpp>
 #include <ztd/text/utf8.hpp>
 #include <ztd/text/utf16.hpp>
+#include <ztd/text/validate_result.hpp>
+#include <ztd/text/tag.hpp>
 
 #include <ztd/text/detail/type_traits.hpp>
 #include <ztd/text/detail/range.hpp>
@@ -52,19 +54,160 @@
 #include <ztd/text/detail/posix.hpp>
 #include <ztd/text/detail/assert.hpp>
 #include <ztd/text/detail/encoding_name.hpp>
+#include <ztd/text/detail/transcode_one.hpp>
+#include <ztd/text/detail/bulk_transcode.hpp>
+#include <ztd/text/detail/bulk_count.hpp>
+#include <ztd/text/detail/validate_utf8.hpp>
+#include <ztd/text/detail/count_utf8.hpp>
+#include <ztd/text/detail/transcode_utf8_utf32.hpp>
 
 #include <cuchar>
 #include <cwchar>
 #include <cstdint>
+#include <climits>
+#include <algorithm>
 
 namespace ztd { namespace text {
 	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
 
+	namespace __txt_detail {
+		//////
+		/// @brief Whether the encoding of the current locale is UTF-8, in which case the execution encoding (and
+		/// those built on it) can skip the C Standard Library and use the library's own UTF-8 codec.
+		//////
+		inline bool __is_active_code_page_utf8() noexcept {
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_PLATFORM_WINDOWS_I_)
+			return __windows::__determine_active_code_page() == CP_UTF8;
+#elif ZTD_TEXT_IS_ON(ZTD_TEXT_PLATFORM_UNIX_I_)
+			return __posix::__determine_active_code_page() == __encoding_id::__utf8;
+#else
+			return false;
+#endif
+		}
+
+		//////
+		/// @brief The bulk conversions the execution encoding can use for the current locale, looked up once per
+		/// call of a bulk extension point.
+		///
+		/// @remarks The kernels only go as far as they can convert exactly like one @c mbrtoc32 / @c c32rtomb call
+		/// at a time would, and do nothing at all when there is no bulk conversion for the locale.
+		//////
+		class __execution_bulk {
+		public:
+			__execution_bulk() noexcept
+			: _M_is_utf8(__is_active_code_page_utf8())
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_PLATFORM_UNIX_I_) && ZTD_TEXT_IS_ON(ZTD_TEXT_EXECUTION_ICONV_I_)
+			, _M_iconv(__posix::__determine_active_code_page_iconv())
+#endif
+			{
+			}
+
+			bool __is_utf8() const noexcept {
+				return _M_is_utf8;
+			}
+
+			template <typename _InUnit, typename _OutUnit>
+			void __decode(const _InUnit*& __in, const _InUnit* __in_last, _OutUnit*& __out,
+				_OutUnit* __out_last) const noexcept {
+				if (_M_is_utf8) {
+					__utf8_to_utf32(__in, __in_last, __out, __out_last);
+					return;
+				}
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_PLATFORM_UNIX_I_) && ZTD_TEXT_IS_ON(ZTD_TEXT_EXECUTION_ICONV_I_)
+				if (_M_iconv != nullptr) {
+					__posix::__iconv_convert(_M_iconv->_M_decode, __in, __in_last, __out, __out_last);
+				}
+#endif
+			}
+
+			template <typename _InUnit, typename _OutUnit>
+			void __encode(const _InUnit*& __in, const _InUnit* __in_last, _OutUnit*& __out,
+				_OutUnit* __out_last) const noexcept {
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_PLATFORM_UNIX_I_) && ZTD_TEXT_IS_ON(ZTD_TEXT_EXECUTION_ICONV_I_)
+				if (_M_iconv != nullptr) {
+					__posix::__iconv_convert(_M_iconv->_M_encode, __in, __in_last, __out, __out_last);
+				}
+#else
+				(void)__in;
+				(void)__in_last;
+				(void)__out;
+				(void)__out_last;
+#endif
+			}
+
+			//////
+			/// @brief Encodes code points into the locale's encoding and decodes them right back, which is what
+			/// going through @c wcrtomb and @c mbrtowc one at a time does. Stops at the first code point that does
+			/// not come back as exactly one code point.
+			//////
+			template <typename _InUnit, typename _OutUnit>
+			void __round_trip(const _InUnit*& __in, const _InUnit* __in_last, _OutUnit*& __out,
+				_OutUnit* __out_last) const noexcept {
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_PLATFORM_UNIX_I_) && ZTD_TEXT_IS_ON(ZTD_TEXT_EXECUTION_ICONV_I_)
+				if (_M_iconv == nullptr) {
+					return;
+				}
+				constexpr ::std::ptrdiff_t __scratch_size = 1024;
+				char __scratch[__scratch_size];
+				while (__in != __in_last) {
+					::std::ptrdiff_t __chunk_size = ::std::min<::std::ptrdiff_t>(
+						{ __in_last - __in, __out_last - __out, __scratch_size / MB_LEN_MAX });
+					if (__chunk_size == 0) {
+						return;
+					}
+					const _InUnit* __chunk_last = __in + __chunk_size;
+					const _InUnit* __encoded    = __in;
+					char* __narrow_last         = __scratch;
+					__posix::__iconv_convert(
+						_M_iconv->_M_encode, __encoded, __chunk_last, __narrow_last, __scratch + __scratch_size);
+					const char* __narrow = __scratch;
+					_OutUnit* __decoded  = __out;
+					__posix::__iconv_convert(_M_iconv->_M_decode, __narrow, __narrow_last, __decoded, __out_last);
+					if (__narrow != __narrow_last || (__decoded - __out) != (__encoded - __in)) {
+						// not one code point for each code point: leave the whole chunk to the slow path
+						return;
+					}
+					__in  = __encoded;
+					__out = __decoded;
+					if (__encoded != __chunk_last) {
+						return;
+					}
+				}
+#else
+				(void)__in;
+				(void)__in_last;
+				(void)__out;
+				(void)__out_last;
+#endif
+			}
+
+		private:
+			bool _M_is_utf8;
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_PLATFORM_UNIX_I_) && ZTD_TEXT_IS_ON(ZTD_TEXT_EXECUTION_ICONV_I_)
+			const __posix::__active_code_page_iconv* _M_iconv;
+#endif
+		};
+	} // namespace __txt_detail
+
 	//////
 	/// @addtogroup ztd_text_encodings Encodings
 	/// @{
 	//////
 
+	//////
+	/// @brief Makes ztd::text::execution and ztd::text::wide_execution look up the encoding of the locale again.
+	///
+	/// @remarks On POSIX platforms, each thread asks its @c LC_CTYPE locale for its encoding once, the first time
+	/// it needs it, and then keeps using the answer. Call this after changing the locale with @c setlocale or
+	/// @c uselocale, and before using either encoding again, so that every thread looks the encoding up anew. It
+	/// does nothing on Windows, where the active code page is asked for directly.
+	//////
+	inline void refresh_execution_encoding() noexcept {
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_PLATFORM_UNIX_I_)
+		__txt_detail::__posix::__refresh_active_code_page();
+#endif
+	}
+
 	//////
 	/// @brief The Encoding that represents the "Execution" (narrow locale-based) encoding. The execution encoding is
 	/// typically associated with the locale, which is tied to the C standard library's setlocale function.
@@ -73,6 +216,12 @@ namespace ztd { namespace text {
 	/// Supplementary Character Set (Big5-HKSCS)) are broken when accessed without @c ZTD_TEXT_USE_CUNEICODE is not
 	/// defined, due to fundamental design issues in the C Standard Library and bugs in glibc/musl libc's current
 	/// locale encoding support.
+	///
+	/// @remarks When the encoding of the current locale is UTF-8, this type does not go through the C Standard
+	/// Library at all and uses the library's own UTF-8 conversions, including the bulk ones used by
+	/// ztd::text::decode_into, ztd::text::validate_code_units, and the counting functions. The locale's encoding is
+	/// looked up once per thread and remembered: after a call to @c setlocale, call
+	/// ztd::text::refresh_execution_encoding.
 	//////
 	class execution {
 	private:
@@ -186,12 +335,11 @@ namespace ztd { namespace text {
 #if ZTD_TEXT_IS_ON(ZTD_TEXT_PLATFORM_WINDOWS_I_)
 			int __codepage_id = __txt_detail::__windows::__determine_active_code_page();
 			return __txt_detail::__windows::__is_unicode_code_page(__codepage_id);
-#elif ZTD_TEXT_IS_ON(ZTD_TEXT_NL_LANGINFO_I_) || ZTD_TEXT_IS_ON(ZTD_TEXT_LANGINFO_I_)
-			const char* __ctype_name = nl_langinfo(CODESET);
-			return __txt_detail::__is_unicode_encoding_name(__ctype_name);
+#elif ZTD_TEXT_IS_ON(ZTD_TEXT_PLATFORM_UNIX_I_)
+			return __txt_detail::__is_unicode_encoding_id(__txt_detail::__posix::__determine_active_code_page());
 #else
 				const char* __ctype_name = setlocale(LC_CTYPE, nullptr);
-				return __txt_detail::__is_encoding_name_unicode(__ctype_name);
+				return __txt_detail::__is_unicode_encoding_name(__ctype_name);
 #endif
 		}
 
@@ -228,8 +376,7 @@ namespace ztd { namespace text {
 			using _Result = __txt_detail::__reconstruct_encode_result_t<_UInputRange, _UOutputRange, encode_state>;
 			constexpr bool __call_error_handler = !is_ignorable_error_handler_v<_UErrorHandler>;
 
-#if ZTD_TEXT_IS_ON(ZTD_TEXT_PLATFORM_WINDOWS_I_)
-			if (__txt_detail::__windows::__determine_active_code_page() == CP_UTF8) {
+			if (__txt_detail::__is_active_code_page_utf8()) {
 				// just go straight to UTF8
 				using __exec_utf8 = __impl::__utf8_with<void, code_unit, code_point>;
 				__exec_utf8 __u8enc {};
@@ -251,7 +398,6 @@ namespace ztd { namespace text {
 				return _Result(::std::move(__intermediate_result.input), ::std::move(__intermediate_result.output),
 					__s, __intermediate_result.error_code);
 			}
-#endif // Windows Hell
 
 #if ZTD_TEXT_IS_ON(ZTD_TEXT_PLATFORM_WINDOWS_I_)
 			auto __outit   = __txt_detail::__adl::__adl_begin(__output);
@@ -425,10 +571,8 @@ namespace ztd { namespace text {
 			using _Result = __txt_detail::__reconstruct_decode_result_t<_UInputRange, _UOutputRange, decode_state>;
 			constexpr bool __call_error_handler = !is_ignorable_error_handler_v<_UErrorHandler>;
 
-#if ZTD_TEXT_IS_ON(ZTD_TEXT_PLATFORM_WINDOWS_I_)
-			if (__txt_detail::__windows::__determine_active_code_page() == CP_UTF8) {
+			if (__txt_detail::__is_active_code_page_utf8()) {
 				// just use utf8 directly
-				// just go straight to UTF8
 				using __char_utf8 = __impl::__utf8_with<void, code_unit, code_point>;
 				__char_utf8 __u8enc {};
 				decode_state_t<__char_utf8> __intermediate_s {};
@@ -449,7 +593,6 @@ namespace ztd { namespace text {
 				return _Result(::std::move(__intermediate_result.input), ::std::move(__intermediate_result.output),
 					__s, __intermediate_result.error_code);
 			}
-#endif
 
 			auto __init   = __txt_detail::__adl::__adl_cbegin(__input);
 			auto __inlast = __txt_detail::__adl::__adl_cend(__input);
@@ -652,6 +795,136 @@ namespace ztd { namespace text {
 					encoding_error::ok);
 			}
 		}
+
+		//////
+		/// @internal
+		///
+		/// @brief Extension point hooks for the implementation-side only.
+		///
+		/// @remarks When the locale is UTF-8, validates contiguous input with the library's bulk UTF-8 validation.
+		/// Otherwise, this is the usual one code point at a time validation.
+		//////
+		template <typename _Input, typename _DecodeState,
+			::std::enable_if_t<__txt_detail::__is_bulk_countable_v<_Input, sizeof(code_unit)>>* = nullptr>
+		friend auto __text_validate_code_units(tag<execution>, _Input&& __input,
+			__txt_detail::__type_identity_t<const execution&> __encoding, _DecodeState& __state) {
+			using _WorkingInput = __txt_detail::__string_view_or_span_or_reconstruct_t<_Input>;
+			using _Result       = validate_result<_WorkingInput, _DecodeState>;
+
+			_WorkingInput __working_input(
+				__txt_detail::__reconstruct(::std::in_place_type<_WorkingInput>, ::std::forward<_Input>(__input)));
+			if (__txt_detail::__is_active_code_page_utf8()) {
+				auto __first         = __txt_detail::__adl::__adl_begin(__working_input);
+				auto __last          = __txt_detail::__adl::__adl_end(__working_input);
+				const auto* __pfirst = __txt_detail::__adl::__adl_to_address(__first);
+				const auto* __plast  = __pfirst + (__last - __first);
+				const auto* __pfail  = __txt_detail::__utf8_validate(__pfirst, __plast);
+				__first += (__pfail - __pfirst);
+				return _Result(__txt_detail::__reconstruct(::std::in_place_type<_WorkingInput>,
+					               ::std::move(__first), ::std::move(__last)),
+					__pfail == __plast, __state);
+			}
+			encode_state __encode_state {};
+			while (!__txt_detail::__adl::__adl_empty(__working_input)) {
+				auto __validate_result = __txt_detail::__basic_validate_code_units_one(
+					__working_input, __encoding, __state, __encode_state);
+				if (!__validate_result.valid) {
+					return _Result(::std::move(__working_input), false, __state);
+				}
+				__working_input = __txt_detail::__reconstruct(
+					::std::in_place_type<_WorkingInput>, ::std::move(__validate_result.input));
+			}
+			return _Result(::std::move(__working_input), true, __state);
+		}
+
+		//////
+		/// @internal
+		///
+		/// @brief Extension point hooks for the implementation-side only.
+		///
+		/// @remarks Decodes contiguous input into contiguous output with the library's bulk UTF-8 decoding when the
+		/// locale is UTF-8, or whole buffers at a time with @c iconv otherwise (if available). The result is the same
+		/// as with ztd::text::basic_decode_into.
+		//////
+		template <typename _Input, typename _Output, typename _ErrorHandler, typename _State,
+			::std::enable_if_t<__txt_detail::__is_bulk_transcodable_v<_Input, sizeof(code_unit), _Output,
+			     sizeof(char32_t)>>* = nullptr>
+		friend auto __text_decode(tag<execution>, _Input&& __input,
+			__txt_detail::__type_identity_t<const execution&> __encoding, _Output&& __output,
+			_ErrorHandler&& __error_handler, _State& __state) {
+			const __txt_detail::__execution_bulk __bulk {};
+			return __txt_detail::__bulk_decode_into(
+				[&__bulk](auto*& __in, auto* __in_last, auto*& __out, auto* __out_last) noexcept {
+					__bulk.__decode(__in, __in_last, __out, __out_last);
+				},
+				::std::forward<_Input>(__input), __encoding, ::std::forward<_Output>(__output), __error_handler,
+				__state);
+		}
+
+		//////
+		/// @internal
+		///
+		/// @brief Extension point hooks for the implementation-side only.
+		///
+		/// @remarks Encodes contiguous input into contiguous output whole buffers at a time with @c iconv, if
+		/// available. The result is the same as with ztd::text::basic_encode_into.
+		//////
+		template <typename _Input, typename _Output, typename _ErrorHandler, typename _State,
+			::std::enable_if_t<__txt_detail::__is_bulk_transcodable_v<_Input, sizeof(char32_t), _Output,
+			     sizeof(code_unit)>>* = nullptr>
+		friend auto __text_encode(tag<execution>, _Input&& __input,
+			__txt_detail::__type_identity_t<const execution&> __encoding, _Output&& __output,
+			_ErrorHandler&& __error_handler, _State& __state) {
+			const __txt_detail::__execution_bulk __bulk {};
+			return __txt_detail::__bulk_encode_into(
+				[&__bulk](auto*& __in, auto* __in_last, auto*& __out, auto* __out_last) noexcept {
+					__bulk.__encode(__in, __in_last, __out, __out_last);
+				},
+				::std::forward<_Input>(__input), __encoding, ::std::forward<_Output>(__output), __error_handler,
+				__state);
+		}
+
+		//////
+		/// @internal
+		///
+		/// @brief Extension point hooks for the implementation-side only.
+		///
+		/// @remarks When the locale is UTF-8, counts the code points in contiguous input with the library's bulk
+		/// UTF-8 counting. The result is the same as with ztd::text::basic_count_code_units.
+		//////
+		template <typename _Input, typename _ErrorHandler, typename _State,
+			::std::enable_if_t<__txt_detail::__is_bulk_countable_v<_Input, sizeof(code_unit)>>* = nullptr>
+		friend auto __text_count_code_units(tag<execution>, _Input&& __input,
+			__txt_detail::__type_identity_t<const execution&> __encoding, _ErrorHandler&& __error_handler,
+			_State& __state) {
+			const bool __is_utf8 = __txt_detail::__is_active_code_page_utf8();
+			return __txt_detail::__bulk_count_code_units(
+				[__is_utf8](auto*& __in, auto* __in_last) noexcept -> ::std::size_t {
+					return __is_utf8 ? __txt_detail::__utf8_count_decoded(__in, __in_last) : 0;
+				},
+				::std::forward<_Input>(__input), __encoding, __error_handler, __state);
+		}
+
+		//////
+		/// @internal
+		///
+		/// @brief Extension point hooks for the implementation-side only.
+		///
+		/// @remarks When the locale is UTF-8, counts the code units needed for contiguous input with the library's
+		/// bulk UTF-8 counting. The result is the same as with ztd::text::basic_count_code_points.
+		//////
+		template <typename _Input, typename _ErrorHandler, typename _State,
+			::std::enable_if_t<__txt_detail::__is_bulk_countable_v<_Input, sizeof(char32_t)>>* = nullptr>
+		friend auto __text_count_code_points(tag<execution>, _Input&& __input,
+			__txt_detail::__type_identity_t<const execution&> __encoding, _ErrorHandler&& __error_handler,
+			_State& __state) {
+			const bool __is_utf8 = __txt_detail::__is_active_code_page_utf8();
+			return __txt_detail::__bulk_count_code_points(
+				[__is_utf8](auto*& __in, auto* __in_last) noexcept -> ::std::size_t {
+					return __is_utf8 ? __txt_detail::__utf8_count_encoded(__in, __in_last) : 0;
+				},
+				::std::forward<_Input>(__input), __encoding, __error_handler, __state);
+		}
 	};
 
 	//////
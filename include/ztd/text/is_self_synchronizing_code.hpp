@@ -35,6 +35,8 @@
 
 #include <ztd/text/version.hpp>
 
+#include <ztd/text/state.hpp>
+
 #include <ztd/text/detail/type_traits.hpp>
 
 #include <type_traits>
@@ -44,7 +46,7 @@ namespace ztd { namespace text {
 
 	namespace __txt_detail {
 		template <typename _Type>
-		using __detect_is_self_synchronizing_code = decltype(_Type::is_self_synchronizing_code::value);
+		using __detect_is_self_synchronizing_code = decltype(_Type::self_synchronizing_code::value);
 
 		template <typename _Encoding, typename = void>
 		struct __is_self_synchronizing_code_sfinae
@@ -0,0 +1,95 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#pragma once
+
+#ifndef ZTD_TEXT_OUTPUT_SIZING_HPP
+#define ZTD_TEXT_OUTPUT_SIZING_HPP
+
+#include <ztd/text/version.hpp>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	//////
+	/// @addtogroup ztd_text_output_sizing ztd::text::output_sizing
+	/// @brief This enumeration picks how the container-returning forms of ztd_text_transcode, ztd_text_decode, and
+	/// ztd_text_encode size the container they return.
+	/// @{
+	//////
+
+	//////
+	/// @brief Describes how a container is sized before it is written into by a container-returning conversion
+	/// function (e.g., ztd::text::transcode_to or ztd::text::decode).
+	///
+	/// @remarks The sized strategies are only used when the container is resizable, has a mutable @c .data() , and
+	/// the input has a size. Otherwise, every strategy behaves like ztd::text::output_sizing::incremental.
+	//////
+	enum class output_sizing : int {
+		//////
+		/// @brief Use ztd::text::output_sizing::exact if there is a fast way to count the output for the encodings
+		/// involved and the input has no errors, and ztd::text::output_sizing::incremental otherwise.
+		//////
+		automatic = 0x00,
+		//////
+		/// @brief Count the output exactly in a first pass that never calls an error handler, then write directly
+		/// into a container of that size.
+		///
+		/// @remarks If the output cannot be counted quickly or the input contains errors (which error handlers may
+		/// replace with something of a different size), this falls back to
+		/// ztd::text::output_sizing::upper_bound.
+		//////
+		exact = 0x01,
+		//////
+		/// @brief Size the container for the worst case, write directly into it, and then shrink it down to what
+		/// was written.
+		///
+		/// @remarks The worst case is the input size multiplied by ztd::text::max_code_points_v and/or
+		/// ztd::text::max_code_units_v of the encodings involved. This assumes every step consumes at least one
+		/// code unit of input and that error handlers write no more than one step's worth of output, which is
+		/// true of all the error handlers in this library. If an error handler writes more, the result will
+		/// report ztd::text::encoding_error::insufficient_output_space.
+		//////
+		upper_bound = 0x02,
+		//////
+		/// @brief Reserve some space up-front and then fill in the container one step at a time, growing it
+		/// geometrically as it runs out of room.
+		//////
+		incremental = 0x03
+	};
+
+	//////
+	/// @}
+	//////
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#endif // ZTD_TEXT_OUTPUT_SIZING_HPP
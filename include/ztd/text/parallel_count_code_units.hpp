@@ -0,0 +1,200 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#pragma once
+
+#ifndef ZTD_TEXT_PARALLEL_COUNT_CODE_UNITS_HPP
+#define ZTD_TEXT_PARALLEL_COUNT_CODE_UNITS_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/code_point.hpp>
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/count_code_units.hpp>
+#include <ztd/text/count_result.hpp>
+#include <ztd/text/error_handler.hpp>
+#include <ztd/text/state.hpp>
+
+#include <ztd/text/detail/adl.hpp>
+#include <ztd/text/detail/parallel.hpp>
+#include <ztd/text/detail/parallel_count.hpp>
+#include <ztd/text/detail/reconstruct.hpp>
+#include <ztd/text/detail/type_traits.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		template <typename _Input, typename _Encoding, typename _ErrorHandler, typename _State>
+		using __serial_count_code_units_result_t = decltype(count_code_units(::std::declval<_Input>(),
+			::std::declval<const _Encoding&>(), ::std::declval<_ErrorHandler&>(), ::std::declval<_State&>()));
+
+		template <typename _Input, typename _Encoding, typename _ErrorHandler, typename = void>
+		inline constexpr bool __is_parallel_code_units_countable_v = false;
+
+		//////
+		/// @brief Whether counting the code points that decoding @p _Input produces can be split up and run in
+		/// parallel: the input has to be contiguous and splittable (see
+		/// ztd::text::__txt_detail::__is_code_unit_splittable_v), and the serial count has to give back the same range
+		/// type the pieces are cut into.
+		//////
+		template <typename _Input, typename _Encoding, typename _ErrorHandler>
+		inline constexpr bool __is_parallel_code_units_countable_v<_Input, _Encoding, _ErrorHandler,
+			::std::enable_if_t<__is_contiguous_code_unit_range_v<__string_view_or_span_or_reconstruct_t<_Input>,
+			     sizeof(code_unit_t<__remove_cvref_t<_Encoding>>)>>>
+			= __is_code_unit_splittable_v<__remove_cvref_t<_Encoding>>
+			&& ::std::is_same_v<
+			     __remove_cvref_t<decltype(::std::declval<__serial_count_code_units_result_t<
+			          __string_view_or_span_or_reconstruct_t<_Input>, __remove_cvref_t<_Encoding>, _ErrorHandler,
+			          decode_state_t<__remove_cvref_t<_Encoding>>>>()
+			                                .input)>,
+			     __string_view_or_span_or_reconstruct_t<_Input>>;
+
+	} // namespace __txt_detail
+
+	//////
+	/// @addtogroup ztd_text_parallel_count_code_units ztd::text::parallel_count_code_units
+	///
+	/// @brief These functions count the code points that decoding large, contiguous inputs of code units produces,
+	/// by cutting them into pieces and counting the pieces in parallel. The result is exactly the one the
+	/// equivalent ztd::text::count_code_units call gives, including where the first error is.
+	///
+	/// @remarks The @c executor is either a standard execution policy (such as @c std::execution::par , with
+	/// @c ZTD_TEXT_STD_LIBRARY_EXECUTION turned on), or any object that can be called as
+	/// @c "executor(count, task)" : see ztd::text::parallel_transcode_into for what that has to do. Anything that
+	/// cannot be split up is counted on the calling thread. Pieces with errors in them are counted on the calling
+	/// thread too, so the error handler is only called there, once for each error and in order.
+	/// @{
+	//////
+
+	//////
+	/// @brief Counts the number of code points that decoding the @p __input produces, working on pieces of the
+	/// input in parallel.
+	///
+	/// @param[in]     __executor The execution policy or executor to count the pieces with.
+	/// @param[in]     __input The input range of code units to count.
+	/// @param[in]     __encoding The encoding to count the input with.
+	/// @param[in]     __error_handler The error handler to invoke when a decode operation fails.
+	/// @param[in,out] __state The state that will be used to count.
+	///
+	/// @returns A ztd::text::count_result with the same contents ztd::text::count_code_units gives, and a reference
+	/// to the provided @p __state .
+	//////
+	template <typename _Executor, typename _Input, typename _Encoding, typename _ErrorHandler, typename _State>
+	auto parallel_count_code_units(_Executor&& __executor, _Input&& __input, _Encoding&& __encoding,
+		_ErrorHandler&& __error_handler, _State& __state) {
+		if constexpr (__txt_detail::__is_parallel_code_units_countable_v<_Input, _Encoding, _ErrorHandler>) {
+			using _UEncoding    = __txt_detail::__remove_cvref_t<_Encoding>;
+			using _WorkingInput = __txt_detail::__string_view_or_span_or_reconstruct_t<_Input>;
+			using _Result       = __txt_detail::__serial_count_code_units_result_t<_WorkingInput, _UEncoding,
+				_ErrorHandler, _State>;
+
+			_WorkingInput __working_input(__txt_detail::__reconstruct(
+				::std::in_place_type<_WorkingInput>, ::std::forward<_Input>(__input)));
+			auto __in_first = __txt_detail::__adl::__adl_begin(__working_input);
+			auto __in_last  = __txt_detail::__adl::__adl_end(__working_input);
+			const auto* __pfirst = __txt_detail::__adl::__adl_to_address(__in_first);
+			const ::std::vector<::std::size_t> __bounds = __txt_detail::__split_code_units<_UEncoding>(
+				__pfirst, __pfirst + (__in_last - __in_first), __txt_detail::__parallel_chunk_size);
+			return __txt_detail::__parallel_count<_Result>(__executor, __working_input, __bounds,
+				[&](_WorkingInput __piece, auto& __piece_handler) {
+					decode_state_t<_UEncoding> __piece_state = make_decode_state(__encoding);
+					return count_code_units(::std::move(__piece), __encoding, __piece_handler, __piece_state);
+				},
+				__error_handler, __state);
+		}
+		else {
+			(void)__executor;
+			return count_code_units(::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding),
+				::std::forward<_ErrorHandler>(__error_handler), __state);
+		}
+	}
+
+	//////
+	/// @brief Counts the number of code points that decoding the @p __input produces, working on pieces of the
+	/// input in parallel.
+	///
+	/// @param[in] __executor The execution policy or executor to count the pieces with.
+	/// @param[in] __input The input range of code units to count.
+	/// @param[in] __encoding The encoding to count the input with.
+	/// @param[in] __error_handler The error handler to invoke when a decode operation fails.
+	///
+	/// @returns A ztd::text::stateless_count_result with the same contents ztd::text::count_code_units gives.
+	///
+	/// @remarks This function creates a state through ztd::text::make_decode_state before calling the base form of
+	/// ztd::text::parallel_count_code_units.
+	//////
+	template <typename _Executor, typename _Input, typename _Encoding, typename _ErrorHandler>
+	auto parallel_count_code_units(
+		_Executor&& __executor, _Input&& __input, _Encoding&& __encoding, _ErrorHandler&& __error_handler) {
+		using _UEncoding = __txt_detail::__remove_cvref_t<_Encoding>;
+		using _State     = decode_state_t<_UEncoding>;
+
+		_State __state         = make_decode_state(__encoding);
+		auto __stateful_result = parallel_count_code_units(::std::forward<_Executor>(__executor),
+			::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding),
+			::std::forward<_ErrorHandler>(__error_handler), __state);
+		return __txt_detail::__slice_to_stateless(::std::move(__stateful_result));
+	}
+
+	//////
+	/// @brief Counts the number of code points that decoding the @p __input produces, working on pieces of the
+	/// input in parallel.
+	///
+	/// @param[in] __executor The execution policy or executor to count the pieces with.
+	/// @param[in] __input The input range of code units to count.
+	/// @param[in] __encoding The encoding to count the input with.
+	///
+	/// @returns A ztd::text::stateless_count_result with the same contents ztd::text::count_code_units gives.
+	///
+	/// @remarks This function calls the next overload of ztd::text::parallel_count_code_units with an error handler
+	/// similar to ztd::text::default_handler.
+	//////
+	template <typename _Executor, typename _Input, typename _Encoding>
+	auto parallel_count_code_units(_Executor&& __executor, _Input&& __input, _Encoding&& __encoding) {
+		default_handler __handler {};
+		return parallel_count_code_units(::std::forward<_Executor>(__executor), ::std::forward<_Input>(__input),
+			::std::forward<_Encoding>(__encoding), __handler);
+	}
+
+	//////
+	/// @}
+	//////
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#endif // ZTD_TEXT_PARALLEL_COUNT_CODE_UNITS_HPP
@@ -0,0 +1,621 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#pragma once
+
+#ifndef ZTD_TEXT_PARALLEL_TRANSCODE_HPP
+#define ZTD_TEXT_PARALLEL_TRANSCODE_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/code_point.hpp>
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/encoding_error.hpp>
+#include <ztd/text/error_handler.hpp>
+#include <ztd/text/state.hpp>
+#include <ztd/text/transcode.hpp>
+#include <ztd/text/transcode_result.hpp>
+
+#include <ztd/text/detail/adl.hpp>
+#include <ztd/text/detail/bulk_transcode.hpp>
+#include <ztd/text/detail/parallel.hpp>
+#include <ztd/text/detail/reconstruct.hpp>
+#include <ztd/text/detail/sized_output.hpp>
+#include <ztd/text/detail/span.hpp>
+#include <ztd/text/detail/type_traits.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		template <typename _Input, typename _FromEncoding, typename _Output, typename _ToEncoding,
+			typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState, typename _ToState>
+		using __serial_transcode_result_t = decltype(transcode_into(::std::declval<_Input>(),
+			::std::declval<_FromEncoding&>(), ::std::declval<_Output>(), ::std::declval<_ToEncoding&>(),
+			::std::declval<_FromErrorHandler&>(), ::std::declval<_ToErrorHandler&>(), ::std::declval<_FromState&>(),
+			::std::declval<_ToState&>()));
+
+		template <typename _Input, typename _FromEncoding, typename _Output, typename _ToEncoding,
+			typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState, typename _ToState,
+			typename = void>
+		inline constexpr bool __is_parallel_transcodable_v = false;
+
+		//////
+		/// @brief Whether transcoding @p _Input into @p _Output can be split up and run in parallel with
+		/// ztd::text::__txt_detail::__parallel_transcode_into.
+		///
+		/// @remarks Both ranges have to be contiguous, the input has to be splittable (see
+		/// ztd::text::__txt_detail::__is_code_unit_splittable_v), the encode step can carry no state from one code
+		/// point to the next, and the serial transcode has to give back the same range types the pieces are cut
+		/// into.
+		//////
+		template <typename _Input, typename _FromEncoding, typename _Output, typename _ToEncoding,
+			typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState, typename _ToState>
+		inline constexpr bool __is_parallel_transcodable_v<_Input, _FromEncoding, _Output, _ToEncoding,
+			_FromErrorHandler, _ToErrorHandler, _FromState, _ToState,
+			::std::enable_if_t<__is_bulk_transcodable_v<_Input, sizeof(code_unit_t<__remove_cvref_t<_FromEncoding>>),
+			     _Output, sizeof(code_unit_t<__remove_cvref_t<_ToEncoding>>)>>>
+			= __is_code_unit_splittable_v<__remove_cvref_t<_FromEncoding>>
+			&& ::std::is_empty_v<encode_state_t<__remove_cvref_t<_ToEncoding>>>
+			&& ::std::is_same_v<__remove_cvref_t<decltype(::std::declval<__serial_transcode_result_t<
+			                         __string_view_or_span_or_reconstruct_t<_Input>, __remove_cvref_t<_FromEncoding>,
+			                         __reconstruct_t<__remove_cvref_t<_Output>>, __remove_cvref_t<_ToEncoding>,
+			                         _FromErrorHandler, _ToErrorHandler, _FromState, _ToState>>()
+			                                                          .input)>,
+			     __string_view_or_span_or_reconstruct_t<_Input>>
+			&& ::std::is_same_v<__remove_cvref_t<decltype(::std::declval<__serial_transcode_result_t<
+			                         __string_view_or_span_or_reconstruct_t<_Input>, __remove_cvref_t<_FromEncoding>,
+			                         __reconstruct_t<__remove_cvref_t<_Output>>, __remove_cvref_t<_ToEncoding>,
+			                         _FromErrorHandler, _ToErrorHandler, _FromState, _ToState>>()
+			                                                          .output)>,
+			     __reconstruct_t<__remove_cvref_t<_Output>>>;
+
+		//////
+		/// @brief The most code units transcoding one code unit of the input can write.
+		//////
+		template <typename _FromEncoding, typename _ToEncoding>
+		inline constexpr ::std::size_t __parallel_transcode_max_step
+			= max_code_points_v<_FromEncoding> * max_code_units_v<_ToEncoding>;
+
+		//////
+		/// @brief What the sizing pass found out about one piece of the input.
+		//////
+		struct __parallel_transcode_size {
+			//////
+			/// @brief The number of code units transcoding the piece writes, if it has no errors.
+			//////
+			::std::size_t _M_size = 0;
+			//////
+			/// @brief Whether the piece has an error in it, which leaves it to be transcoded on the calling thread.
+			//////
+			bool _M_has_error = false;
+		};
+
+		//////
+		/// @brief Counts how many code units transcoding the input between @p __piece_first and @p __piece_last
+		/// writes, stopping at the first error.
+		///
+		/// @remarks A fast count of the leading valid part is used where the encoding pair has one. Everything else
+		/// is transcoded for real, a bit at a time, into a scratch buffer sized for the worst case. No error handler
+		/// of the caller's is called: errors are only noted, so that the piece can be left to the calling thread.
+		//////
+		template <typename _WorkingInput, typename _OutputValue, typename _FromEncoding, typename _ToEncoding,
+			typename _InputIterator>
+		__parallel_transcode_size __parallel_transcode_piece_size(_InputIterator __piece_first,
+			_InputIterator __piece_last, const _FromEncoding& __from_encoding, const _ToEncoding& __to_encoding) {
+			using _OutputView                  = ::ztd::text::span<_OutputValue>;
+			constexpr ::std::size_t __max_step = __parallel_transcode_max_step<_FromEncoding, _ToEncoding>;
+			// how much is transcoded into the scratch buffer at once
+			constexpr ::std::size_t __sub_piece_size = 4096;
+
+			const auto* __pfirst = __adl::__adl_to_address(__piece_first);
+			::std::vector<_OutputValue> __scratch;
+			__parallel_transcode_size __result {};
+			_InputIterator __first = __piece_first;
+			pass_handler __error_handler {};
+			for (;;) {
+				if constexpr (__is_detected_v<__detect_adl_internal_text_count_transcoded, _WorkingInput,
+					              const _FromEncoding&, const _ToEncoding&>) {
+					auto __count_result = __text_count_transcoded(tag<_FromEncoding, _ToEncoding> {},
+						__reconstruct(::std::in_place_type<_WorkingInput>, __first, __piece_last), __from_encoding,
+						__to_encoding);
+					__result._M_size += __count_result.count;
+					__first = __piece_last - __adl::__adl_size(__count_result.input);
+				}
+				if (__first == __piece_last) {
+					break;
+				}
+				const auto* __pcurrent = __pfirst + (__first - __piece_first);
+				const auto* __plast    = __pfirst + (__piece_last - __piece_first);
+				const auto* __psub_last
+					= __code_unit_boundary<_FromEncoding>(__pfirst,
+					     static_cast<::std::size_t>(__plast - __pcurrent) > __sub_piece_size
+					          ? __pcurrent + __sub_piece_size
+					          : __plast,
+					     __plast);
+				_InputIterator __sub_last = __first + (__psub_last - __pcurrent);
+				const ::std::size_t __scratch_size
+					= static_cast<::std::size_t>(__psub_last - __pcurrent) * __max_step;
+				if (__scratch.size() < __scratch_size) {
+					__scratch.resize(__scratch_size);
+				}
+				decode_state_t<_FromEncoding> __from_state = make_decode_state(__from_encoding);
+				encode_state_t<_ToEncoding> __to_state     = make_encode_state(__to_encoding);
+				auto __transcode_result = transcode_into(
+					__reconstruct(::std::in_place_type<_WorkingInput>, __first, __sub_last), __from_encoding,
+					_OutputView(__scratch.data(), __scratch_size), __to_encoding, __error_handler, __error_handler,
+					__from_state, __to_state);
+				__result._M_size += __scratch_size - static_cast<::std::size_t>(__transcode_result.output.size());
+				if (__transcode_result.error_code != encoding_error::ok) {
+					__result._M_has_error = true;
+					break;
+				}
+				__first = __sub_last;
+			}
+			return __result;
+		}
+
+		//////
+		/// @brief Runs the sizing pass over every piece of the input cut at @p __bounds .
+		//////
+		template <typename _WorkingInput, typename _OutputValue, typename _Executor, typename _InputIterator,
+			typename _FromEncoding, typename _ToEncoding>
+		::std::vector<__parallel_transcode_size> __parallel_transcode_sizes(_Executor& __executor,
+			_InputIterator __in_first, const ::std::vector<::std::size_t>& __bounds,
+			const _FromEncoding& __from_encoding, const _ToEncoding& __to_encoding) {
+			::std::vector<__parallel_transcode_size> __sizes(__bounds.size() - 1);
+			__parallel_for(__executor, __sizes.size(), [&](::std::size_t __index) {
+				__sizes[__index] = __parallel_transcode_piece_size<_WorkingInput, _OutputValue>(
+					__in_first + __bounds[__index], __in_first + __bounds[__index + 1], __from_encoding,
+					__to_encoding);
+			});
+			return __sizes;
+		}
+
+		//////
+		/// @brief Transcodes the pieces of the input cut at @p __bounds into the output, and puts together the
+		/// result the serial transcode would have given.
+		///
+		/// @remarks Runs of pieces that have no errors and fit in what is left of the output are written in
+		/// parallel, each at the output offset the sizes of the ones before it add up to. Any other piece is
+		/// transcoded on the calling thread, into all of the output that is left. The error handlers are therefore
+		/// only called there, once for each error and in order. A piece that runs out of room stops in the same
+		/// place, and with the same error, as the serial transcode would.
+		//////
+		template <typename _Result, typename _Executor, typename _WorkingInput, typename _WorkingOutput,
+			typename _FromEncoding, typename _ToEncoding, typename _FromErrorHandler, typename _ToErrorHandler,
+			typename _FromState, typename _ToState>
+		_Result __parallel_transcode_write(_Executor& __executor, _WorkingInput& __working_input,
+			const ::std::vector<::std::size_t>& __bounds, const ::std::vector<__parallel_transcode_size>& __sizes,
+			_WorkingOutput& __working_output, const _FromEncoding& __from_encoding, const _ToEncoding& __to_encoding,
+			_FromErrorHandler& __from_error_handler, _ToErrorHandler& __to_error_handler, _FromState& __from_state,
+			_ToState& __to_state) {
+			auto __in_first                   = __adl::__adl_begin(__working_input);
+			auto __in_last                    = __adl::__adl_end(__working_input);
+			auto __out_first                  = __adl::__adl_begin(__working_output);
+			auto __out_last                   = __adl::__adl_end(__working_output);
+			const ::std::size_t __out_size    = static_cast<::std::size_t>(__out_last - __out_first);
+			const ::std::size_t __piece_count = __sizes.size();
+
+			::std::vector<::std::size_t> __offsets(__piece_count + 1, 0);
+			::std::size_t __handled_errors = 0;
+			for (::std::size_t __index = 0; __index < __piece_count;) {
+				const ::std::size_t __run_first = __index;
+				for (; __index < __piece_count && !__sizes[__index]._M_has_error
+				     && __sizes[__index]._M_size <= __out_size - __offsets[__index];
+				     ++__index) {
+					__offsets[__index + 1] = __offsets[__index] + __sizes[__index]._M_size;
+				}
+				__parallel_for(__executor, __index - __run_first, [&](::std::size_t __run_index) {
+					const ::std::size_t __piece                      = __run_first + __run_index;
+					decode_state_t<_FromEncoding> __piece_from_state = make_decode_state(__from_encoding);
+					encode_state_t<_ToEncoding> __piece_to_state     = make_encode_state(__to_encoding);
+					// the sizing pass found no errors here, so this is never called
+					pass_handler __piece_error_handler {};
+					_WorkingInput __piece_input = __reconstruct(::std::in_place_type<_WorkingInput>,
+						__in_first + __bounds[__piece], __in_first + __bounds[__piece + 1]);
+					_WorkingOutput __piece_output = __reconstruct(::std::in_place_type<_WorkingOutput>,
+						__out_first + __offsets[__piece], __out_first + __offsets[__piece + 1]);
+					transcode_into(::std::move(__piece_input), __from_encoding, ::std::move(__piece_output),
+						__to_encoding, __piece_error_handler, __piece_error_handler, __piece_from_state,
+						__piece_to_state);
+				});
+				if (__index == __piece_count) {
+					break;
+				}
+				// this piece has an error, or does not fit: it goes through the caller's error handlers, here
+				decode_state_t<_FromEncoding> __piece_from_state = make_decode_state(__from_encoding);
+				encode_state_t<_ToEncoding> __piece_to_state     = make_encode_state(__to_encoding);
+				_WorkingInput __piece_input = __reconstruct(::std::in_place_type<_WorkingInput>,
+					__in_first + __bounds[__index], __in_first + __bounds[__index + 1]);
+				_WorkingOutput __piece_output = __reconstruct(
+					::std::in_place_type<_WorkingOutput>, __out_first + __offsets[__index], __out_last);
+				auto __transcode_result = transcode_into(::std::move(__piece_input), __from_encoding,
+					::std::move(__piece_output), __to_encoding, __from_error_handler, __to_error_handler,
+					__piece_from_state, __piece_to_state);
+				__handled_errors += __transcode_result.handled_errors;
+				const ::std::size_t __output_stop
+					= __out_size - static_cast<::std::size_t>(__adl::__adl_size(__transcode_result.output));
+				if (__transcode_result.error_code != encoding_error::ok) {
+					const ::std::size_t __input_stop = __bounds[__index + 1]
+						- static_cast<::std::size_t>(__adl::__adl_size(__transcode_result.input));
+					auto __in_stop  = __in_first + __input_stop;
+					auto __out_stop = __out_first + __output_stop;
+					return _Result(__reconstruct(::std::in_place_type<_WorkingInput>, __in_stop, __in_last),
+						__reconstruct(::std::in_place_type<_WorkingOutput>, __out_stop, __out_last), __from_state,
+						__to_state, __transcode_result.error_code, __handled_errors);
+				}
+				__offsets[__index + 1] = __output_stop;
+				++__index;
+			}
+			auto __out_stop = __out_first + __offsets[__piece_count];
+			return _Result(__reconstruct(::std::in_place_type<_WorkingInput>, __in_last, __in_last),
+				__reconstruct(::std::in_place_type<_WorkingOutput>, __out_stop, __out_last), __from_state,
+				__to_state, encoding_error::ok, __handled_errors);
+		}
+
+	} // namespace __txt_detail
+
+	//////
+	/// @addtogroup ztd_text_parallel_transcode ztd::text::parallel_transcode_[into|to]
+	///
+	/// @brief These functions transcode large, contiguous inputs by cutting them into pieces and working on the
+	/// pieces in parallel, through an executor provided by the caller. The result is exactly the one the
+	/// equivalent ztd::text::transcode_into or ztd::text::transcode_to call gives.
+	///
+	/// @remarks The executor can be a standard execution policy (such as @c std::execution::par ), when
+	/// @c ZTD_TEXT_STD_LIBRARY_EXECUTION is turned on. Otherwise, it is any object that can be called as
+	/// @c "executor(count, task)" with a @c std::size_t and a copyable function object. It must call
+	/// @c "task(index)" once for every @c index in @c "[0, count)", on whichever threads it likes and in any order,
+	/// and only return once all of those calls have finished. This fits a thread pool's "parallel for" or an OpenMP
+	/// loop.
+	///
+	/// Only a self-synchronizing @c from_encoding that knows where its input can be cut (such as
+	/// ztd::text::basic_utf8, ztd::text::basic_utf16, or any encoding with one code unit per code point), going
+	/// into a @c to_encoding with no encode state, is split up; anything else is transcoded on the calling thread.
+	/// Cuts are only made where the code units on either side decode the same way on their own as they do
+	/// together, so error positions and the handled error count are identical to the serial result. Pieces with
+	/// errors in them are transcoded on the calling thread, so the error handlers are called there alone, once for
+	/// each error and in the same order as the serial transcode calls them. Input with many errors therefore gains
+	/// little from being split up.
+	/// @{
+	//////
+
+	//////
+	/// @brief Converts the code units of the given input view through the from encoding to code units of the to
+	/// encoding into the output view, working on pieces of the input in parallel.
+	///
+	/// @param[in]     __executor The execution policy or executor to run the pieces with.
+	/// @param[in]     __input An input_view to read code units from and use in the decode operation that will
+	/// produce intermediate code points.
+	/// @param[in]     __from_encoding The encoding that will be used to decode the input's code units into
+	/// intermediate code points.
+	/// @param[in]     __output An output_view to write code units to as the result of the encode operation from the
+	/// intermediate code points.
+	/// @param[in]     __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	/// @param[in]     __from_error_handler The error handler for the @p __from_encoding 's decode step.
+	/// @param[in]     __to_error_handler The error handler for the @p __to_encoding 's encode step.
+	/// @param[in,out] __from_state A reference to the associated state for the @p __from_encoding 's decode step.
+	/// @param[in,out] __to_state A reference to the associated state for the @p __to_encoding 's encode step.
+	///
+	/// @result A ztd::text::transcode_result object that contains references to @p __from_state and @p __to_state.
+	///
+	/// @remarks The output is first sized piece by piece, in parallel, so that every piece can then be written
+	/// straight into its final place in @p __output , also in parallel. If the result stops early (an error that
+	/// was not handled, or not enough room in the output), the contents of the output past the returned
+	/// @c ".output" are unspecified.
+	//////
+	template <typename _Executor, typename _Input, typename _FromEncoding, typename _Output, typename _ToEncoding,
+		typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState, typename _ToState>
+	auto parallel_transcode_into(_Executor&& __executor, _Input&& __input, _FromEncoding&& __from_encoding,
+		_Output&& __output, _ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler,
+		_ToErrorHandler&& __to_error_handler, _FromState& __from_state, _ToState& __to_state) {
+		if constexpr (__txt_detail::__is_parallel_transcodable_v<_Input, _FromEncoding, _Output, _ToEncoding,
+			              _FromErrorHandler, _ToErrorHandler, _FromState, _ToState>) {
+			using _UFromEncoding = __txt_detail::__remove_cvref_t<_FromEncoding>;
+			using _UToEncoding   = __txt_detail::__remove_cvref_t<_ToEncoding>;
+			using _WorkingInput  = __txt_detail::__string_view_or_span_or_reconstruct_t<_Input>;
+			using _WorkingOutput = __txt_detail::__reconstruct_t<__txt_detail::__remove_cvref_t<_Output>>;
+			using _OutputValue   = __txt_detail::__range_value_type_t<_WorkingOutput>;
+			using _Result = __txt_detail::__serial_transcode_result_t<_WorkingInput, _UFromEncoding, _WorkingOutput,
+				_UToEncoding, _FromErrorHandler, _ToErrorHandler, _FromState, _ToState>;
+
+			_WorkingInput __working_input(__txt_detail::__reconstruct(
+				::std::in_place_type<_WorkingInput>, ::std::forward<_Input>(__input)));
+			_WorkingOutput __working_output(__txt_detail::__reconstruct(
+				::std::in_place_type<_WorkingOutput>, ::std::forward<_Output>(__output)));
+			auto __in_first      = __txt_detail::__adl::__adl_begin(__working_input);
+			auto __in_last       = __txt_detail::__adl::__adl_end(__working_input);
+			const auto* __pfirst = __txt_detail::__adl::__adl_to_address(__in_first);
+			const ::std::vector<::std::size_t> __bounds = __txt_detail::__split_code_units<_UFromEncoding>(
+				__pfirst, __pfirst + (__in_last - __in_first), __txt_detail::__parallel_chunk_size);
+			const ::std::vector<__txt_detail::__parallel_transcode_size> __sizes
+				= __txt_detail::__parallel_transcode_sizes<_WorkingInput, _OutputValue>(
+				     __executor, __in_first, __bounds, __from_encoding, __to_encoding);
+			return __txt_detail::__parallel_transcode_write<_Result>(__executor, __working_input, __bounds, __sizes,
+				__working_output, __from_encoding, __to_encoding, __from_error_handler, __to_error_handler,
+				__from_state, __to_state);
+		}
+		else {
+			(void)__executor;
+			return transcode_into(::std::forward<_Input>(__input), ::std::forward<_FromEncoding>(__from_encoding),
+				::std::forward<_Output>(__output), ::std::forward<_ToEncoding>(__to_encoding),
+				::std::forward<_FromErrorHandler>(__from_error_handler),
+				::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state);
+		}
+	}
+
+	//////
+	/// @brief Converts the code units of the given input view through the from encoding to code units of the to
+	/// encoding into the output view, working on pieces of the input in parallel.
+	///
+	/// @param[in]     __executor The execution policy or executor to run the pieces with.
+	/// @param[in]     __input An input_view to read code units from and use in the decode operation that will
+	/// produce intermediate code points.
+	/// @param[in]     __from_encoding The encoding that will be used to decode the input's code units into
+	/// intermediate code points.
+	/// @param[in]     __output An output_view to write code units to as the result of the encode operation from the
+	/// intermediate code points.
+	/// @param[in]     __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	/// @param[in]     __from_error_handler The error handler for the @p __from_encoding 's decode step.
+	/// @param[in]     __to_error_handler The error handler for the @p __to_encoding 's encode step.
+	///
+	/// @result A ztd::text::stateless_transcode_result object.
+	///
+	/// @remarks This function creates both states with ztd::text::make_decode_state and
+	/// ztd::text::make_encode_state before calling the base form of ztd::text::parallel_transcode_into.
+	//////
+	template <typename _Executor, typename _Input, typename _FromEncoding, typename _Output, typename _ToEncoding,
+		typename _FromErrorHandler, typename _ToErrorHandler>
+	auto parallel_transcode_into(_Executor&& __executor, _Input&& __input, _FromEncoding&& __from_encoding,
+		_Output&& __output, _ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler,
+		_ToErrorHandler&& __to_error_handler) {
+		using _UFromEncoding = __txt_detail::__remove_cvref_t<_FromEncoding>;
+		using _UToEncoding   = __txt_detail::__remove_cvref_t<_ToEncoding>;
+		using _FromState     = decode_state_t<_UFromEncoding>;
+		using _ToState       = encode_state_t<_UToEncoding>;
+
+		_FromState __from_state = make_decode_state(__from_encoding);
+		_ToState __to_state     = make_encode_state(__to_encoding);
+
+		auto __stateful_result = parallel_transcode_into(::std::forward<_Executor>(__executor),
+			::std::forward<_Input>(__input), ::std::forward<_FromEncoding>(__from_encoding),
+			::std::forward<_Output>(__output), ::std::forward<_ToEncoding>(__to_encoding),
+			::std::forward<_FromErrorHandler>(__from_error_handler),
+			::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state);
+
+		return __txt_detail::__slice_to_stateless(::std::move(__stateful_result));
+	}
+
+	//////
+	/// @brief Converts the code units of the given input view through the from encoding to code units of the to
+	/// encoding into the output view, working on pieces of the input in parallel.
+	///
+	/// @param[in]     __executor The execution policy or executor to run the pieces with.
+	/// @param[in]     __input An input_view to read code units from and use in the decode operation that will
+	/// produce intermediate code points.
+	/// @param[in]     __from_encoding The encoding that will be used to decode the input's code units into
+	/// intermediate code points.
+	/// @param[in]     __output An output_view to write code units to as the result of the encode operation from the
+	/// intermediate code points.
+	/// @param[in]     __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	///
+	/// @result A ztd::text::stateless_transcode_result object.
+	///
+	/// @remarks This function uses an error handler like ztd::text::default_handler, but that is marked as careless
+	/// since you did not explicitly provide it, for both steps.
+	//////
+	template <typename _Executor, typename _Input, typename _FromEncoding, typename _Output, typename _ToEncoding>
+	auto parallel_transcode_into(_Executor&& __executor, _Input&& __input, _FromEncoding&& __from_encoding,
+		_Output&& __output, _ToEncoding&& __to_encoding) {
+		__txt_detail::__careless_handler __handler {};
+
+		return parallel_transcode_into(::std::forward<_Executor>(__executor), ::std::forward<_Input>(__input),
+			::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_Output>(__output),
+			::std::forward<_ToEncoding>(__to_encoding), __handler, __handler);
+	}
+
+	//////
+	/// @brief Converts the code units of the given input view through the from encoding to code units of the to
+	/// encoding for the output, working on pieces of the input in parallel, and returns the output in a result
+	/// structure with additional information about success.
+	///
+	/// @tparam _OutputContainer The container to default-construct and serialize data into. Typically, a @c
+	/// std::basic_string or a @c std::vector of some sort.
+	///
+	/// @param[in]     __executor The execution policy or executor to run the pieces with.
+	/// @param[in]     __input An input_view to read code units from and use in the decode operation that will
+	/// produce intermediate code points.
+	/// @param[in]     __from_encoding The encoding that will be used to decode the input's code units into
+	/// intermediate code points.
+	/// @param[in]     __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	/// @param[in]     __from_error_handler The error handler for the @p __from_encoding 's decode step.
+	/// @param[in]     __to_error_handler The error handler for the @p __to_encoding 's encode step.
+	/// @param[in,out] __from_state A reference to the associated state for the @p __from_encoding 's decode step.
+	/// @param[in,out] __to_state A reference to the associated state for the @p __to_encoding 's encode step.
+	///
+	/// @returns A ztd::text::transcode_result object that contains references to @p __from_state and @p __to_state and
+	/// an @c ".output" parameter that contains the @p _OutputContainer specified.
+	///
+	/// @remarks Every piece is sized in parallel first, then the container is sized to exactly what all of them
+	/// add up to and each piece is written straight into its place, also in parallel. Containers that cannot be
+	/// resized and written through @c ".data()" are filled in by ztd::text::transcode_to on the calling thread.
+	//////
+	template <typename _OutputContainer, typename _Executor, typename _Input, typename _FromEncoding,
+		typename _ToEncoding, typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState,
+		typename _ToState>
+	auto parallel_transcode_to(_Executor&& __executor, _Input&& __input, _FromEncoding&& __from_encoding,
+		_ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler,
+		_FromState& __from_state, _ToState& __to_state) {
+		using _OutputValue = __txt_detail::__range_value_type_t<_OutputContainer>;
+		using _OutputView  = ::ztd::text::span<_OutputValue>;
+		if constexpr (__txt_detail::__is_sized_output_v<_OutputContainer, _Input>
+			&& __txt_detail::__is_parallel_transcodable_v<_Input, _FromEncoding, _OutputView, _ToEncoding,
+			     _FromErrorHandler, _ToErrorHandler, _FromState, _ToState>) {
+			using _UFromEncoding = __txt_detail::__remove_cvref_t<_FromEncoding>;
+			using _UToEncoding   = __txt_detail::__remove_cvref_t<_ToEncoding>;
+			using _WorkingInput  = __txt_detail::__string_view_or_span_or_reconstruct_t<_Input>;
+			using _Result = __txt_detail::__serial_transcode_result_t<_WorkingInput, _UFromEncoding, _OutputView,
+				_UToEncoding, _FromErrorHandler, _ToErrorHandler, _FromState, _ToState>;
+
+			_WorkingInput __working_input(__txt_detail::__reconstruct(
+				::std::in_place_type<_WorkingInput>, ::std::forward<_Input>(__input)));
+			auto __in_first      = __txt_detail::__adl::__adl_begin(__working_input);
+			auto __in_last       = __txt_detail::__adl::__adl_end(__working_input);
+			const auto* __pfirst = __txt_detail::__adl::__adl_to_address(__in_first);
+			const ::std::vector<::std::size_t> __bounds = __txt_detail::__split_code_units<_UFromEncoding>(
+				__pfirst, __pfirst + (__in_last - __in_first), __txt_detail::__parallel_chunk_size);
+			const ::std::vector<__txt_detail::__parallel_transcode_size> __sizes
+				= __txt_detail::__parallel_transcode_sizes<_WorkingInput, _OutputValue>(
+				     __executor, __in_first, __bounds, __from_encoding, __to_encoding);
+			::std::size_t __output_size = 0;
+			for (::std::size_t __index = 0; __index < __sizes.size(); ++__index) {
+				// a piece with errors gets room for the worst case, so it never stops for lack of room where a
+				// growing container would not
+				__output_size += __sizes[__index]._M_has_error
+					? (__bounds[__index + 1] - __bounds[__index])
+					     * __txt_detail::__parallel_transcode_max_step<_UFromEncoding, _UToEncoding>
+					: __sizes[__index]._M_size;
+			}
+
+			_OutputContainer __output {};
+			auto __stateful_result = __txt_detail::__sized_output_into(
+				__output, __output_size, [&](_OutputView __output_view) {
+					return __txt_detail::__parallel_transcode_write<_Result>(__executor, __working_input,
+						__bounds, __sizes, __output_view, __from_encoding, __to_encoding, __from_error_handler,
+						__to_error_handler, __from_state, __to_state);
+				});
+			return __txt_detail::__replace_result_output(::std::move(__stateful_result), ::std::move(__output));
+		}
+		else {
+			(void)__executor;
+			return transcode_to<_OutputContainer>(::std::forward<_Input>(__input),
+				::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ToEncoding>(__to_encoding),
+				::std::forward<_FromErrorHandler>(__from_error_handler),
+				::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state);
+		}
+	}
+
+	//////
+	/// @brief Converts the code units of the given input view through the from encoding to code units of the to
+	/// encoding for the output, working on pieces of the input in parallel, and returns the output in a result
+	/// structure with additional information about success.
+	///
+	/// @tparam _OutputContainer The container to default-construct and serialize data into. Typically, a @c
+	/// std::basic_string or a @c std::vector of some sort.
+	///
+	/// @param[in]     __executor The execution policy or executor to run the pieces with.
+	/// @param[in]     __input An input_view to read code units from and use in the decode operation that will
+	/// produce intermediate code points.
+	/// @param[in]     __from_encoding The encoding that will be used to decode the input's code units into
+	/// intermediate code points.
+	/// @param[in]     __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	/// @param[in]     __from_error_handler The error handler for the @p __from_encoding 's decode step.
+	/// @param[in]     __to_error_handler The error handler for the @p __to_encoding 's encode step.
+	///
+	/// @returns A ztd::text::stateless_transcode_result object that contains an @c ".output" parameter that
+	/// contains the @p _OutputContainer specified.
+	///
+	/// @remarks This function creates both states with ztd::text::make_decode_state and
+	/// ztd::text::make_encode_state before calling the base form of ztd::text::parallel_transcode_to.
+	//////
+	template <typename _OutputContainer, typename _Executor, typename _Input, typename _FromEncoding,
+		typename _ToEncoding, typename _FromErrorHandler, typename _ToErrorHandler>
+	auto parallel_transcode_to(_Executor&& __executor, _Input&& __input, _FromEncoding&& __from_encoding,
+		_ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler,
+		_ToErrorHandler&& __to_error_handler) {
+		using _UFromEncoding = __txt_detail::__remove_cvref_t<_FromEncoding>;
+		using _UToEncoding   = __txt_detail::__remove_cvref_t<_ToEncoding>;
+		using _FromState     = decode_state_t<_UFromEncoding>;
+		using _ToState       = encode_state_t<_UToEncoding>;
+
+		_FromState __from_state = make_decode_state(__from_encoding);
+		_ToState __to_state     = make_encode_state(__to_encoding);
+
+		auto __stateful_result = parallel_transcode_to<_OutputContainer>(::std::forward<_Executor>(__executor),
+			::std::forward<_Input>(__input), ::std::forward<_FromEncoding>(__from_encoding),
+			::std::forward<_ToEncoding>(__to_encoding), ::std::forward<_FromErrorHandler>(__from_error_handler),
+			::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state);
+
+		return __txt_detail::__slice_to_stateless(::std::move(__stateful_result));
+	}
+
+	//////
+	/// @brief Converts the code units of the given input view through the from encoding to code units of the to
+	/// encoding for the output, working on pieces of the input in parallel, and returns the output in a result
+	/// structure with additional information about success.
+	///
+	/// @tparam _OutputContainer The container to default-construct and serialize data into. Typically, a @c
+	/// std::basic_string or a @c std::vector of some sort.
+	///
+	/// @param[in]     __executor The execution policy or executor to run the pieces with.
+	/// @param[in]     __input An input_view to read code units from and use in the decode operation that will
+	/// produce intermediate code points.
+	/// @param[in]     __from_encoding The encoding that will be used to decode the input's code units into
+	/// intermediate code points.
+	/// @param[in]     __to_encoding The encoding that will be used to encode the intermediate code points into the
+	/// final code units.
+	///
+	/// @returns A ztd::text::stateless_transcode_result object that contains an @c ".output" parameter that
+	/// contains the @p _OutputContainer specified.
+	///
+	/// @remarks This function uses an error handler like ztd::text::default_handler, but that is marked as careless
+	/// since you did not explicitly provide it, for both steps.
+	//////
+	template <typename _OutputContainer, typename _Executor, typename _Input, typename _FromEncoding,
+		typename _ToEncoding>
+	auto parallel_transcode_to(
+		_Executor&& __executor, _Input&& __input, _FromEncoding&& __from_encoding, _ToEncoding&& __to_encoding) {
+		__txt_detail::__careless_handler __handler {};
+
+		return parallel_transcode_to<_OutputContainer>(::std::forward<_Executor>(__executor),
+			::std::forward<_Input>(__input), ::std::forward<_FromEncoding>(__from_encoding),
+			::std::forward<_ToEncoding>(__to_encoding), __handler, __handler);
+	}
+
+	//////
+	/// @}
+	//////
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#endif // ZTD_TEXT_PARALLEL_TRANSCODE_HPP
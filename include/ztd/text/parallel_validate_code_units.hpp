@@ -0,0 +1,210 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#pragma once
+
+#ifndef ZTD_TEXT_PARALLEL_VALIDATE_CODE_UNITS_HPP
+#define ZTD_TEXT_PARALLEL_VALIDATE_CODE_UNITS_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/state.hpp>
+#include <ztd/text/validate_code_units.hpp>
+#include <ztd/text/validate_result.hpp>
+
+#include <ztd/text/detail/adl.hpp>
+#include <ztd/text/detail/parallel.hpp>
+#include <ztd/text/detail/reconstruct.hpp>
+#include <ztd/text/detail/type_traits.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		template <typename _Input, typename _Encoding, typename _DecodeState, typename _EncodeState>
+		using __serial_validate_code_units_result_t = decltype(validate_code_units(::std::declval<_Input>(),
+			::std::declval<const _Encoding&>(), ::std::declval<_DecodeState&>(), ::std::declval<_EncodeState&>()));
+
+		template <typename _Input, typename _Encoding, typename = void>
+		inline constexpr bool __is_parallel_validatable_v = false;
+
+		//////
+		/// @brief Whether validating @p _Input can be split up and run in parallel: the input has to be contiguous
+		/// and splittable (see ztd::text::__txt_detail::__is_code_unit_splittable_v), and the serial validation has
+		/// to give back the same range type the pieces are cut into.
+		//////
+		template <typename _Input, typename _Encoding>
+		inline constexpr bool __is_parallel_validatable_v<_Input, _Encoding,
+			::std::enable_if_t<__is_contiguous_code_unit_range_v<__string_view_or_span_or_reconstruct_t<_Input>,
+			     sizeof(code_unit_t<__remove_cvref_t<_Encoding>>)>>>
+			= __is_code_unit_splittable_v<__remove_cvref_t<_Encoding>>
+			&& ::std::is_same_v<
+			     __remove_cvref_t<decltype(::std::declval<__serial_validate_code_units_result_t<
+			          __string_view_or_span_or_reconstruct_t<_Input>, __remove_cvref_t<_Encoding>,
+			          decode_state_t<__remove_cvref_t<_Encoding>>, encode_state_t<__remove_cvref_t<_Encoding>>>>()
+			                                .input)>,
+			     __string_view_or_span_or_reconstruct_t<_Input>>;
+
+	} // namespace __txt_detail
+
+	//////
+	/// @addtogroup ztd_text_parallel_validate_code_units ztd::text::parallel_validate_code_units
+	///
+	/// @brief These functions check if large, contiguous inputs of code units will decode without an error, by
+	/// cutting them into pieces and checking the pieces in parallel. The result is exactly the one the equivalent
+	/// ztd::text::validate_code_units call gives, including where the first error is.
+	///
+	/// @remarks The @c executor is either a standard execution policy (such as @c std::execution::par , with
+	/// @c ZTD_TEXT_STD_LIBRARY_EXECUTION turned on), or any object that can be called as
+	/// @c "executor(count, task)" : see ztd::text::parallel_transcode_into for what that has to do. Only the same
+	/// encodings ztd::text::parallel_transcode_into splits up are checked in parallel; anything else is checked on
+	/// the calling thread. Once a piece turns out to be invalid, pieces after it that have not been started yet are
+	/// skipped.
+	/// @{
+	//////
+
+	//////
+	/// @brief Validates the code units of the @p __input according to the @p __encoding with the given states @p
+	/// __decode_state and @p __encode_state to see if it can be turned into code points, working on pieces of the
+	/// input in parallel.
+	///
+	/// @param[in] __executor The execution policy or executor to check the pieces with.
+	/// @param[in] __input The input range of code units to validate is possible for encoding into code points.
+	/// @param[in] __encoding The encoding to verify can properly encode the input of code units.
+	/// @param[in] __decode_state The state to use for the decoding portion of the validation check.
+	/// @param[in] __encode_state The state to use for the encoding portion of the validation check.
+	//////
+	template <typename _Executor, typename _Input, typename _Encoding, typename _DecodeState,
+		typename _EncodeState>
+	auto parallel_validate_code_units(_Executor&& __executor, _Input&& __input, _Encoding&& __encoding,
+		_DecodeState& __decode_state, _EncodeState& __encode_state) {
+		if constexpr (__txt_detail::__is_parallel_validatable_v<_Input, _Encoding>) {
+			using _UEncoding    = __txt_detail::__remove_cvref_t<_Encoding>;
+			using _WorkingInput = __txt_detail::__string_view_or_span_or_reconstruct_t<_Input>;
+			using _Result       = validate_result<_WorkingInput, _DecodeState>;
+
+			_WorkingInput __working_input(__txt_detail::__reconstruct(
+				::std::in_place_type<_WorkingInput>, ::std::forward<_Input>(__input)));
+			auto __in_first      = __txt_detail::__adl::__adl_begin(__working_input);
+			auto __in_last       = __txt_detail::__adl::__adl_end(__working_input);
+			const auto* __pfirst = __txt_detail::__adl::__adl_to_address(__in_first);
+			const ::std::vector<::std::size_t> __bounds = __txt_detail::__split_code_units<_UEncoding>(
+				__pfirst, __pfirst + (__in_last - __in_first), __txt_detail::__parallel_chunk_size);
+			const ::std::size_t __piece_count = __bounds.size() - 1;
+
+			::std::vector<::std::size_t> __input_stops(__piece_count);
+			const ::std::size_t __invalid_index
+				= __txt_detail::__parallel_find_first(__executor, __piece_count, [&](::std::size_t __index) {
+					  decode_state_t<_UEncoding> __piece_decode_state = make_decode_state(__encoding);
+					  encode_state_t<_UEncoding> __piece_encode_state = make_encode_state(__encoding);
+					  auto __validate_result = validate_code_units(
+					       __txt_detail::__reconstruct(::std::in_place_type<_WorkingInput>,
+					            __in_first + __bounds[__index], __in_first + __bounds[__index + 1]),
+					       __encoding, __piece_decode_state, __piece_encode_state);
+					  __input_stops[__index] = __bounds[__index + 1]
+					       - static_cast<::std::size_t>(__txt_detail::__adl::__adl_size(__validate_result.input));
+					  return !__validate_result.valid;
+				  });
+			(void)__encode_state;
+			if (__invalid_index != __piece_count) {
+				return _Result(__txt_detail::__reconstruct(::std::in_place_type<_WorkingInput>,
+					               __in_first + __input_stops[__invalid_index], __in_last),
+					false, __decode_state);
+			}
+			return _Result(__txt_detail::__reconstruct(::std::in_place_type<_WorkingInput>, __in_last, __in_last),
+				true, __decode_state);
+		}
+		else {
+			(void)__executor;
+			return validate_code_units(::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding),
+				__decode_state, __encode_state);
+		}
+	}
+
+	//////
+	/// @brief Validates the code units of the @p __input according to the @p __encoding with the given state @p
+	/// __decode_state to see if it can be turned into code points, working on pieces of the input in parallel.
+	///
+	/// @param[in] __executor The execution policy or executor to check the pieces with.
+	/// @param[in] __input The input range of code units to validate is possible for encoding into code points.
+	/// @param[in] __encoding The encoding to verify can properly encode the input of code units.
+	/// @param[in] __decode_state The state to use for the decoding portion of the validation check.
+	///
+	/// @remarks This function creates an encoding state through ztd::text::make_encode_state before calling the
+	/// base form of ztd::text::parallel_validate_code_units.
+	//////
+	template <typename _Executor, typename _Input, typename _Encoding, typename _DecodeState>
+	auto parallel_validate_code_units(
+		_Executor&& __executor, _Input&& __input, _Encoding&& __encoding, _DecodeState& __decode_state) {
+		using _UEncoding = __txt_detail::__remove_cvref_t<_Encoding>;
+		using _State     = encode_state_t<_UEncoding>;
+
+		_State __encode_state = make_encode_state(__encoding);
+		return parallel_validate_code_units(::std::forward<_Executor>(__executor), ::std::forward<_Input>(__input),
+			::std::forward<_Encoding>(__encoding), __decode_state, __encode_state);
+	}
+
+	//////
+	/// @brief Validates the code units of the @p __input according to the @p __encoding to see if they can be turned
+	/// into code points, working on pieces of the input in parallel.
+	///
+	/// @param[in] __executor The execution policy or executor to check the pieces with.
+	/// @param[in] __input The input range of code units to validate is possible for encoding into code points.
+	/// @param[in] __encoding The encoding to verify can properly encode the input of code units.
+	///
+	/// @remarks This function creates a decoding state through ztd::text::make_decode_state before calling the next
+	/// overload of ztd::text::parallel_validate_code_units.
+	//////
+	template <typename _Executor, typename _Input, typename _Encoding>
+	auto parallel_validate_code_units(_Executor&& __executor, _Input&& __input, _Encoding&& __encoding) {
+		using _UEncoding = __txt_detail::__remove_cvref_t<_Encoding>;
+		using _State     = decode_state_t<_UEncoding>;
+
+		_State __state         = make_decode_state(__encoding);
+		auto __stateful_result = parallel_validate_code_units(::std::forward<_Executor>(__executor),
+			::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding), __state);
+		return __txt_detail::__slice_to_stateless(::std::move(__stateful_result));
+	}
+
+	//////
+	/// @}
+	//////
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#endif // ZTD_TEXT_PARALLEL_VALIDATE_CODE_UNITS_HPP
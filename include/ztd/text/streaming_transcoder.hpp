@@ -0,0 +1,585 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+#pragma once
+
+#ifndef ZTD_TEXT_STREAMING_TRANSCODER_HPP
+#define ZTD_TEXT_STREAMING_TRANSCODER_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/code_point.hpp>
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/encoding_error.hpp>
+#include <ztd/text/error_handler.hpp>
+#include <ztd/text/state.hpp>
+#include <ztd/text/transcode.hpp>
+#include <ztd/text/transcode_result.hpp>
+
+#include <ztd/text/detail/adl.hpp>
+#include <ztd/text/detail/assert.hpp>
+#include <ztd/text/detail/ebco.hpp>
+#include <ztd/text/detail/encoding_iterator_storage.hpp>
+#include <ztd/text/detail/is_lossless.hpp>
+#include <ztd/text/detail/pass_through_handler.hpp>
+#include <ztd/text/detail/range.hpp>
+#include <ztd/text/detail/reconstruct.hpp>
+#include <ztd/text/detail/span.hpp>
+#include <ztd/text/detail/transcode_one.hpp>
+#include <ztd/text/detail/type_traits.hpp>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	namespace __txt_detail {
+
+		struct __streaming_progress {
+			::std::size_t _M_handled_errors = 0;
+			bool _M_last_decode_handled     = false;
+			bool _M_hold_incomplete         = false;
+			bool _M_held_incomplete         = false;
+		};
+
+		template <typename _ErrorHandler, bool _IsDecode>
+		class __streaming_handler {
+		public:
+			constexpr __streaming_handler(_ErrorHandler& __error_handler, __streaming_progress& __progress) noexcept
+			: _M_error_handler(::std::addressof(__error_handler)), _M_progress(::std::addressof(__progress)) {
+			}
+
+			template <typename _Encoding, typename _Result, typename _Progress>
+			constexpr __remove_cvref_t<_Result> operator()(
+				_Encoding&& __encoding, _Result&& __result, _Progress&& __progress) const {
+				if constexpr (_IsDecode) {
+					if (this->_M_progress->_M_hold_incomplete
+						&& __result.error_code == encoding_error::incomplete_sequence
+						&& __adl::__adl_empty(__result.input)) {
+						// the sequence runs off the end of the chunk: leave it for the next chunk to complete
+						this->_M_progress->_M_held_incomplete = true;
+						return ::std::forward<_Result>(__result);
+					}
+				}
+				__remove_cvref_t<_Result> __handled_result = (*this->_M_error_handler)(
+					::std::forward<_Encoding>(__encoding), ::std::forward<_Result>(__result),
+					::std::forward<_Progress>(__progress));
+				if (__handled_result.error_code == encoding_error::ok) {
+					++this->_M_progress->_M_handled_errors;
+				}
+				if constexpr (_IsDecode) {
+					this->_M_progress->_M_last_decode_handled = __handled_result.error_code == encoding_error::ok;
+				}
+				return __handled_result;
+			}
+
+		private:
+			_ErrorHandler* _M_error_handler;
+			__streaming_progress* _M_progress;
+		};
+
+	} // namespace __txt_detail
+
+	//////
+	/// @addtogroup ztd_text_transcode ztd::text::transcode[_into]
+	/// @{
+	//////
+
+	//////
+	/// @brief Transcodes a stream of input that arrives in arbitrarily-sized chunks, such as reads from a socket or a
+	/// file.
+	///
+	/// @tparam _FromEncoding The encoding to read the chunks of input code units as.
+	/// @tparam _ToEncoding The encoding to write the output code units as.
+	/// @tparam _FromErrorHandler The error handler for any decode-step failures.
+	/// @tparam _ToErrorHandler The error handler for any encode-step failures.
+	/// @tparam _FromState The state type to use for the decode operations to intermediate code points.
+	/// @tparam _ToState The state type to use for the encode operations to intermediate code points.
+	///
+	/// @remarks A chunk that ends in the middle of a sequence does not produce an
+	/// ztd::text::encoding_error::incomplete_sequence error: the (at most @c max_code_units_v<_FromEncoding> ) code
+	/// units of that sequence are kept inside this object and completed by the start of the next chunk. Nothing is
+	/// allocated, per chunk or otherwise. Once the input is done, call @c finish so a sequence that never got completed
+	/// is given to the @c "from" error handler. The kept code units are fed to the encoding again, so this requires
+	/// that the decode state does not itself swallow the code units of an incomplete sequence, which is true for all
+	/// of the Unicode encodings.
+	//////
+	template <typename _FromEncoding, typename _ToEncoding, typename _FromErrorHandler = default_handler,
+		typename _ToErrorHandler = default_handler, typename _FromState = decode_state_t<_FromEncoding>,
+		typename _ToState = encode_state_t<_ToEncoding>>
+	class streaming_transcoder
+	: private __txt_detail::__ebco<__txt_detail::__remove_cvref_t<_FromEncoding>, 0>,
+	  private __txt_detail::__ebco<__txt_detail::__remove_cvref_t<_ToEncoding>, 1>,
+	  private __txt_detail::__ebco<__txt_detail::__remove_cvref_t<_FromErrorHandler>, 2>,
+	  private __txt_detail::__ebco<__txt_detail::__remove_cvref_t<_ToErrorHandler>, 3>,
+	  private __txt_detail::__state_storage<__txt_detail::__remove_cvref_t<_FromEncoding>,
+	       __txt_detail::__remove_cvref_t<_FromState>, 0>,
+	  private __txt_detail::__state_storage<__txt_detail::__remove_cvref_t<_ToEncoding>,
+	       __txt_detail::__remove_cvref_t<_ToState>, 1> {
+	private:
+		using _UFromEncoding          = __txt_detail::__remove_cvref_t<_FromEncoding>;
+		using _UToEncoding            = __txt_detail::__remove_cvref_t<_ToEncoding>;
+		using _UFromErrorHandler      = __txt_detail::__remove_cvref_t<_FromErrorHandler>;
+		using _UToErrorHandler        = __txt_detail::__remove_cvref_t<_ToErrorHandler>;
+		using _UFromState             = __txt_detail::__remove_cvref_t<_FromState>;
+		using _UToState               = __txt_detail::__remove_cvref_t<_ToState>;
+		using _CodeUnit               = code_unit_t<_UFromEncoding>;
+		using __base_from_encoding_t  = __txt_detail::__ebco<_UFromEncoding, 0>;
+		using __base_to_encoding_t    = __txt_detail::__ebco<_UToEncoding, 1>;
+		using __base_from_error_handler_t = __txt_detail::__ebco<_UFromErrorHandler, 2>;
+		using __base_to_error_handler_t   = __txt_detail::__ebco<_UToErrorHandler, 3>;
+		using __base_from_state_t         = __txt_detail::__state_storage<_UFromEncoding, _UFromState, 0>;
+		using __base_to_state_t           = __txt_detail::__state_storage<_UToEncoding, _UToState, 1>;
+
+		static constexpr ::std::size_t _MaxPending = max_code_units_v<_UFromEncoding>;
+
+		static_assert(__txt_detail::__is_decode_lossless_or_deliberate_v<_UFromEncoding, _UFromErrorHandler>,
+			"The decode (input) portion of this transcode is a lossy, non-injective operation. This means you may "
+			"lose data that you did not intend to lose; specify a 'from' error handler explicitly in order to bypass "
+			"this.");
+		static_assert(__txt_detail::__is_encode_lossless_or_deliberate_v<_UToEncoding, _UToErrorHandler>,
+			"The encode (output) portion of this transcode is a lossy, non-injective operation. This means you may "
+			"lose data that you did not intend to lose; specify a 'to' error handler explicitly in order to bypass "
+			"this.");
+
+	public:
+		//////
+		/// @brief The encoding type used for decoding to intermediate code point storage.
+		///
+		//////
+		using from_encoding_type = _FromEncoding;
+		//////
+		/// @brief The encoding type used for encoding to the final code units storage.
+		///
+		//////
+		using to_encoding_type = _ToEncoding;
+		//////
+		/// @brief The error handler when a decode operation fails.
+		///
+		//////
+		using from_error_handler_type = _FromErrorHandler;
+		//////
+		/// @brief The error handler when an encode operation fails.
+		///
+		//////
+		using to_error_handler_type = _ToErrorHandler;
+		//////
+		/// @brief The state type used for decode operations.
+		///
+		//////
+		using from_state_type = _FromState;
+		//////
+		/// @brief The state type used for encode operations.
+		///
+		//////
+		using to_state_type = _ToState;
+
+		//////
+		/// @brief Constructs a streaming_transcoder with default-constructed encodings and error handlers.
+		///
+		//////
+		constexpr streaming_transcoder() : streaming_transcoder(from_encoding_type {}, to_encoding_type {}) {
+		}
+
+		//////
+		/// @brief Constructs a streaming_transcoder.
+		///
+		/// @param[in] __from_encoding The encoding object to call @c ".decode" or equivalent functionality on.
+		/// @param[in] __to_encoding The encoding object to call @c ".encode" or equivalent functionality on.
+		//////
+		constexpr streaming_transcoder(from_encoding_type __from_encoding, to_encoding_type __to_encoding)
+		: streaming_transcoder(::std::move(__from_encoding), ::std::move(__to_encoding), from_error_handler_type {},
+			to_error_handler_type {}) {
+		}
+
+		//////
+		/// @brief Constructs a streaming_transcoder.
+		///
+		/// @param[in] __from_encoding The encoding object to call @c ".decode" or equivalent functionality on.
+		/// @param[in] __to_encoding The encoding object to call @c ".encode" or equivalent functionality on.
+		/// @param[in] __from_error_handler The error handler for decode operations to store in this object.
+		/// @param[in] __to_error_handler The error handler for encode operations to store in this object.
+		//////
+		constexpr streaming_transcoder(from_encoding_type __from_encoding, to_encoding_type __to_encoding,
+			from_error_handler_type __from_error_handler, to_error_handler_type __to_error_handler)
+		: __base_from_encoding_t(::std::move(__from_encoding))
+		, __base_to_encoding_t(::std::move(__to_encoding))
+		, __base_from_error_handler_t(::std::move(__from_error_handler))
+		, __base_to_error_handler_t(::std::move(__to_error_handler))
+		, __base_from_state_t(this->from_encoding())
+		, __base_to_state_t(this->to_encoding())
+		, _M_pending()
+		, _M_pending_size(0) {
+		}
+
+		//////
+		/// @brief Constructs a streaming_transcoder.
+		///
+		/// @param[in] __from_encoding The encoding object to call @c ".decode" or equivalent functionality on.
+		/// @param[in] __to_encoding The encoding object to call @c ".encode" or equivalent functionality on.
+		/// @param[in] __from_error_handler The error handler for decode operations to store in this object.
+		/// @param[in] __to_error_handler The error handler for encode operations to store in this object.
+		/// @param[in] __from_state The state to use for the decode operations.
+		/// @param[in] __to_state The state to use for the encode operations.
+		//////
+		constexpr streaming_transcoder(from_encoding_type __from_encoding, to_encoding_type __to_encoding,
+			from_error_handler_type __from_error_handler, to_error_handler_type __to_error_handler,
+			from_state_type __from_state, to_state_type __to_state)
+		: __base_from_encoding_t(::std::move(__from_encoding))
+		, __base_to_encoding_t(::std::move(__to_encoding))
+		, __base_from_error_handler_t(::std::move(__from_error_handler))
+		, __base_to_error_handler_t(::std::move(__to_error_handler))
+		, __base_from_state_t(this->from_encoding(), ::std::move(__from_state))
+		, __base_to_state_t(this->to_encoding(), ::std::move(__to_state))
+		, _M_pending()
+		, _M_pending_size(0) {
+		}
+
+		//////
+		/// @brief Transcodes one chunk of input into the output.
+		///
+		/// @param[in] __input An input_view of the next chunk of code units. It can be any size, and can start or end
+		/// in the middle of a sequence.
+		/// @param[in] __output An output_view to write code units to.
+		///
+		/// @returns A ztd::text::stateless_transcode_result. On success, the input is empty, even when its last few
+		/// code units were kept to be completed by the next chunk. If the output runs out of room or an error handler
+		/// does not handle an error, the input starts at the first code unit that was not consumed; pass it in again
+		/// (e.g., with more output space) to continue. @c handled_errors is the number of errors that either error
+		/// handler handled (returned ztd::text::encoding_error::ok for).
+		//////
+		template <typename _Input, typename _Output>
+		constexpr auto transcode_into(_Input&& __input, _Output&& __output) {
+			using _UInput         = __txt_detail::__remove_cvref_t<_Input>;
+			using _UOutput        = __txt_detail::__remove_cvref_t<_Output>;
+			using _InputValueType = __txt_detail::__range_value_type_t<_UInput>;
+			using _WorkingInput   = __txt_detail::__reconstruct_t<::std::conditional_t<::std::is_array_v<_UInput>,
+                    ::std::conditional_t<__txt_detail::__is_character_v<_InputValueType>,
+                         ::std::basic_string_view<_InputValueType>, ::ztd::text::span<const _InputValueType>>,
+                    _UInput>>;
+			using _WorkingOutput  = __txt_detail::__reconstruct_t<_UOutput>;
+			using _Result         = stateless_transcode_result<_WorkingInput, _WorkingOutput>;
+
+			_WorkingInput __working_input(
+				__txt_detail::__reconstruct(::std::in_place_type<_WorkingInput>, ::std::forward<_Input>(__input)));
+			_WorkingOutput __working_output(
+				__txt_detail::__reconstruct(::std::in_place_type<_WorkingOutput>, ::std::forward<_Output>(__output)));
+			__txt_detail::__streaming_progress __progress {};
+			__progress._M_hold_incomplete = true;
+			__txt_detail::__streaming_handler<_UFromErrorHandler, true> __from_error_handler(
+				this->from_handler(), __progress);
+			__txt_detail::__streaming_handler<_UToErrorHandler, false> __to_error_handler(
+				this->to_handler(), __progress);
+
+			if (this->_M_pending_size != 0) {
+				// complete the sequence left over from the last chunk with as many of this chunk's code units as a
+				// sequence can possibly need
+				_CodeUnit __units[_MaxPending] {};
+				::std::size_t __units_size = this->_M_pending_size;
+				for (::std::size_t __index = 0; __index < __units_size; ++__index) {
+					__units[__index] = this->_M_pending[__index];
+				}
+				auto __first = __txt_detail::__adl::__adl_begin(__working_input);
+				auto __last  = __txt_detail::__adl::__adl_end(__working_input);
+				for (; __units_size < _MaxPending && __first != __last; ++__units_size) {
+					__units[__units_size] = static_cast<_CodeUnit>(__txt_detail::__dereference(__first));
+					__first               = __txt_detail::__next(__first);
+				}
+				const bool __input_exhausted = __first == __last;
+				auto __result = ::ztd::text::transcode_into(::ztd::text::span<const _CodeUnit>(__units, __units_size),
+					this->from_encoding(), ::std::move(__working_output), this->to_encoding(), __from_error_handler,
+					__to_error_handler, this->from_state(), this->to_state());
+				this->_M_unwind(__progress, __result);
+				const ::std::size_t __consumed
+					= __units_size - static_cast<::std::size_t>(__txt_detail::__adl::__adl_size(__result.input));
+				__working_output = ::std::move(__result.output);
+				if (__consumed >= this->_M_pending_size) {
+					// the left over sequence is done: anything after it is still in the chunk
+					__working_input = __txt_detail::__reconstruct(::std::in_place_type<_WorkingInput>,
+						__txt_detail::__next(__txt_detail::__adl::__adl_begin(__working_input),
+						     __consumed - this->_M_pending_size),
+						__txt_detail::__adl::__adl_end(__working_input));
+					this->_M_pending_size = 0;
+					if (__result.error_code != encoding_error::ok && !__progress._M_held_incomplete) {
+						return _Result(::std::move(__working_input), ::std::move(__working_output),
+							__result.error_code, __progress._M_handled_errors);
+					}
+					__progress._M_held_incomplete = false;
+				}
+				else if (__progress._M_held_incomplete && __input_exhausted) {
+					// still not enough code units to finish the sequence: keep all of them
+					this->_M_set_pending(__units + __consumed, __units + __units_size);
+					__working_input = __txt_detail::__reconstruct(
+						::std::in_place_type<_WorkingInput>, ::std::move(__first), ::std::move(__last));
+					return _Result(::std::move(__working_input), ::std::move(__working_output), encoding_error::ok,
+						__progress._M_handled_errors);
+				}
+				else {
+					// the left over sequence failed: keep it, and leave the chunk untouched
+					this->_M_set_pending(__units + __consumed, __units + this->_M_pending_size);
+					return _Result(::std::move(__working_input), ::std::move(__working_output),
+						__progress._M_held_incomplete ? encoding_error::incomplete_sequence : __result.error_code,
+						__progress._M_handled_errors);
+				}
+			}
+
+			if (__txt_detail::__adl::__adl_empty(__working_input)) {
+				return _Result(::std::move(__working_input), ::std::move(__working_output), encoding_error::ok,
+					__progress._M_handled_errors);
+			}
+			auto __result = ::ztd::text::transcode_into(::std::move(__working_input), this->from_encoding(),
+				::std::move(__working_output), this->to_encoding(), __from_error_handler, __to_error_handler,
+				this->from_state(), this->to_state());
+			this->_M_unwind(__progress, __result);
+			__working_input  = ::std::move(__result.input);
+			__working_output = ::std::move(__result.output);
+			if (__progress._M_held_incomplete) {
+				// the chunk ends in the middle of a sequence: keep its code units for the next chunk
+				auto __first = __txt_detail::__adl::__adl_begin(__working_input);
+				auto __last  = __txt_detail::__adl::__adl_end(__working_input);
+				this->_M_pending_size = 0;
+				for (; __first != __last; __first = __txt_detail::__next(__first)) {
+					ZTD_TEXT_ASSERT_I_(this->_M_pending_size < _MaxPending);
+					this->_M_pending[this->_M_pending_size]
+						= static_cast<_CodeUnit>(__txt_detail::__dereference(__first));
+					++this->_M_pending_size;
+				}
+				__working_input = __txt_detail::__reconstruct(
+					::std::in_place_type<_WorkingInput>, ::std::move(__first), ::std::move(__last));
+				return _Result(::std::move(__working_input), ::std::move(__working_output), encoding_error::ok,
+					__progress._M_handled_errors);
+			}
+			return _Result(::std::move(__working_input), ::std::move(__working_output), __result.error_code,
+				__progress._M_handled_errors);
+		}
+
+		//////
+		/// @brief Ends the stream, writing out the sequence left over from the last chunk, if any.
+		///
+		/// @param[in] __output An output_view to write code units to.
+		///
+		/// @returns A ztd::text::stateless_transcode_result whose input is the code units still kept by this object.
+		/// If the stream ended in the middle of a sequence, those code units are given to the @c "from" error handler
+		/// as an ztd::text::encoding_error::incomplete_sequence; if the handler does not handle it (or the output runs
+		/// out of room), the error is returned and the code units are kept, so @c finish can be called again.
+		/// Otherwise, the input is empty and this object is ready for a new stream.
+		//////
+		template <typename _Output>
+		constexpr auto finish(_Output&& __output) {
+			using _UOutput       = __txt_detail::__remove_cvref_t<_Output>;
+			using _WorkingOutput = __txt_detail::__reconstruct_t<_UOutput>;
+			using _Result        = stateless_transcode_result<::ztd::text::span<const _CodeUnit>, _WorkingOutput>;
+
+			_WorkingOutput __working_output(
+				__txt_detail::__reconstruct(::std::in_place_type<_WorkingOutput>, ::std::forward<_Output>(__output)));
+			if (this->_M_pending_size == 0) {
+				return _Result(this->pending_code_units(), ::std::move(__working_output), encoding_error::ok, 0);
+			}
+			__txt_detail::__streaming_progress __progress {};
+			__txt_detail::__streaming_handler<_UFromErrorHandler, true> __from_error_handler(
+				this->from_handler(), __progress);
+			__txt_detail::__streaming_handler<_UToErrorHandler, false> __to_error_handler(
+				this->to_handler(), __progress);
+			auto __result = ::ztd::text::transcode_into(this->pending_code_units(), this->from_encoding(),
+				::std::move(__working_output), this->to_encoding(), __from_error_handler, __to_error_handler,
+				this->from_state(), this->to_state());
+			this->_M_unwind(__progress, __result);
+			if (__result.error_code != encoding_error::ok) {
+				const ::std::size_t __consumed = this->_M_pending_size
+					- static_cast<::std::size_t>(__txt_detail::__adl::__adl_size(__result.input));
+				const _CodeUnit* __pending_first = this->_M_pending.data();
+				this->_M_set_pending(__pending_first + __consumed, __pending_first + this->_M_pending_size);
+				return _Result(this->pending_code_units(), ::std::move(__result.output), __result.error_code,
+					__progress._M_handled_errors);
+			}
+			this->_M_pending_size = 0;
+			return _Result(this->pending_code_units(), ::std::move(__result.output), encoding_error::ok,
+				__progress._M_handled_errors);
+		}
+
+		//////
+		/// @brief Drops any kept code units and resets both states, so this object can start a new stream.
+		///
+		//////
+		constexpr void reset() {
+			this->_M_pending_size                      = 0;
+			static_cast<__base_from_state_t&>(*this) = __base_from_state_t(this->from_encoding());
+			static_cast<__base_to_state_t&>(*this)   = __base_to_state_t(this->to_encoding());
+		}
+
+		//////
+		/// @brief The code units of an incomplete sequence at the end of the last chunk, kept until the next chunk
+		/// (or @c finish ) completes them.
+		///
+		//////
+		constexpr ::ztd::text::span<const _CodeUnit> pending_code_units() const noexcept {
+			return ::ztd::text::span<const _CodeUnit>(this->_M_pending.data(), this->_M_pending_size);
+		}
+
+		//////
+		/// @brief The decoding ("from") encoding object.
+		///
+		//////
+		constexpr const from_encoding_type& from_encoding() const {
+			return this->__base_from_encoding_t::get_value();
+		}
+
+		//////
+		/// @brief The decoding ("from") encoding object.
+		///
+		//////
+		constexpr from_encoding_type& from_encoding() {
+			return this->__base_from_encoding_t::get_value();
+		}
+
+		//////
+		/// @brief The encoding ("to") encoding object.
+		///
+		//////
+		constexpr const to_encoding_type& to_encoding() const {
+			return this->__base_to_encoding_t::get_value();
+		}
+
+		//////
+		/// @brief The encoding ("to") encoding object.
+		///
+		//////
+		constexpr to_encoding_type& to_encoding() {
+			return this->__base_to_encoding_t::get_value();
+		}
+
+		//////
+		/// @brief The decoding ("from") state object.
+		///
+		//////
+		constexpr const from_state_type& from_state() const {
+			return this->__base_from_state_t::_M_get_state();
+		}
+
+		//////
+		/// @brief The decoding ("from") state object.
+		///
+		//////
+		constexpr from_state_type& from_state() {
+			return this->__base_from_state_t::_M_get_state();
+		}
+
+		//////
+		/// @brief The encoding ("to") state object.
+		///
+		//////
+		constexpr const to_state_type& to_state() const {
+			return this->__base_to_state_t::_M_get_state();
+		}
+
+		//////
+		/// @brief The encoding ("to") state object.
+		///
+		//////
+		constexpr to_state_type& to_state() {
+			return this->__base_to_state_t::_M_get_state();
+		}
+
+		//////
+		/// @brief The decoding ("from") error handler object.
+		///
+		//////
+		constexpr const from_error_handler_type& from_handler() const {
+			return this->__base_from_error_handler_t::get_value();
+		}
+
+		//////
+		/// @brief The decoding ("from") error handler object.
+		///
+		//////
+		constexpr from_error_handler_type& from_handler() {
+			return this->__base_from_error_handler_t::get_value();
+		}
+
+		//////
+		/// @brief The encoding ("to") error handler object.
+		///
+		//////
+		constexpr const to_error_handler_type& to_handler() const {
+			return this->__base_to_error_handler_t::get_value();
+		}
+
+		//////
+		/// @brief The encoding ("to") error handler object.
+		///
+		//////
+		constexpr to_error_handler_type& to_handler() {
+			return this->__base_to_error_handler_t::get_value();
+		}
+
+	private:
+		template <typename _Result>
+		constexpr void _M_unwind(__txt_detail::__streaming_progress& __progress, const _Result& __result) {
+			if (__result.error_code == encoding_error::ok || __progress._M_held_incomplete
+				|| !__progress._M_last_decode_handled) {
+				return;
+			}
+			// a step that fails (e.g., for output space) after its decode error was handled is done again by the next
+			// call: if the failed step is that one, do not count the error twice
+			code_point_t<_UFromEncoding> __intermediate[max_code_points_v<_UFromEncoding>] {};
+			_UFromState __state = this->from_state();
+			__txt_detail::__pass_through_handler __error_handler {};
+			auto __decode_result = __txt_detail::__basic_decode_one<__txt_detail::__consume::__no>(
+				__result.input, this->from_encoding(), __intermediate, __error_handler, __state);
+			if (__decode_result.error_code != encoding_error::ok) {
+				--__progress._M_handled_errors;
+			}
+		}
+
+		constexpr void _M_set_pending(const _CodeUnit* __first, const _CodeUnit* __last) noexcept {
+			// may overlap with the current pending code units, but only ever moves them towards the front
+			this->_M_pending_size = 0;
+			for (; __first != __last; ++__first) {
+				this->_M_pending[this->_M_pending_size] = *__first;
+				++this->_M_pending_size;
+			}
+		}
+
+		::std::array<_CodeUnit, _MaxPending> _M_pending;
+		::std::size_t _M_pending_size;
+	};
+
+	//////
+	/// @}
+	//////
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#endif // ZTD_TEXT_STREAMING_TRANSCODER_HPP
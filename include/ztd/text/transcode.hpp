@@ -42,9 +42,13 @@
 #include <ztd/text/transcode_result.hpp>
 #include <ztd/text/is_unicode_code_point.hpp>
 #include <ztd/text/unbounded.hpp>
+#include <ztd/text/output_sizing.hpp>
 #include <ztd/text/tag.hpp>
 
 #include <ztd/text/detail/transcode_one.hpp>
+#include <ztd/text/detail/bitwise_transcode.hpp>
+#include <ztd/text/detail/chunked_transcode.hpp>
+#include <ztd/text/detail/sized_output.hpp>
 #include <ztd/text/detail/encoding_range.hpp>
 #include <ztd/text/detail/type_traits.hpp>
 #include <ztd/text/detail/span.hpp>
@@ -187,15 +191,18 @@ namespace ztd { namespace text {
 	/// @remark This function detects whether or not the ADL extension point @c text_transcode can be called with the
 	/// provided parameters. If so, it will use that ADL extension point over the default implementation. Otherwise, it
 	/// will loop over the two encodings and attempt to transcode by first decoding the input code units to code
-	/// points, then encoding the intermediate code points to the desired, output code units.
+	/// points, then encoding the intermediate code points to the desired, output code units. When the encodings are
+	/// bitwise compatible (or the same) and both ranges are contiguous, the input is only validated and then copied.
+	/// Otherwise, when either encoding has a bulk @c text_decode or @c text_encode extension point, a whole chunk of
+	/// code points is decoded and then encoded at a time, so that those extension points are used.
 	//////
 	template <typename _Input, typename _Output, typename _FromEncoding, typename _ToEncoding,
 		typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState, typename _ToState>
 	constexpr auto transcode_into(_Input&& __input, _FromEncoding&& __from_encoding, _Output&& __output,
 		_ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler,
 		_FromState& __from_state, _ToState& __to_state) {
-		if constexpr (__txt_detail::__is_detected_v<__txt_detail::__detect_adl_text_transcode, _Input, _Output,
-			              _FromEncoding, _ToEncoding, _FromErrorHandler, _ToErrorHandler, _FromState, _ToState>) {
+		if constexpr (__txt_detail::__is_detected_v<__txt_detail::__detect_adl_text_transcode, _Input, _FromEncoding,
+			              _Output, _ToEncoding, _FromErrorHandler, _ToErrorHandler, _FromState, _ToState>) {
 			return text_transcode(
 				tag<__txt_detail::__remove_cvref_t<_FromEncoding>, __txt_detail::__remove_cvref_t<_ToEncoding>> {},
 				::std::forward<_Input>(__input), ::std::forward<_FromEncoding>(__from_encoding),
@@ -213,6 +220,20 @@ namespace ztd { namespace text {
 				::std::forward<_FromErrorHandler>(__from_error_handler),
 				::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state);
 		}
+		else if constexpr (__txt_detail::__is_bitwise_transcodable_v<_Input, _FromEncoding, _Output, _ToEncoding,
+			                   _FromState, _ToState>) {
+			return __txt_detail::__bitwise_transcode_into(::std::forward<_Input>(__input), __from_encoding,
+				::std::forward<_Output>(__output), __to_encoding, __from_error_handler, __to_error_handler,
+				__from_state, __to_state);
+		}
+		else if constexpr (__txt_detail::__is_chunked_transcodable_v<
+			                   __txt_detail::__string_view_or_span_or_reconstruct_t<_Input>, _FromEncoding,
+			                   __txt_detail::__reconstruct_t<__txt_detail::__remove_cvref_t<_Output>>, _ToEncoding,
+			                   _FromState, _ToState>) {
+			return __txt_detail::__chunked_transcode_into(::std::forward<_Input>(__input), __from_encoding,
+				::std::forward<_Output>(__output), __to_encoding, __from_error_handler, __to_error_handler,
+				__from_state, __to_state);
+		}
 		else {
 			return basic_transcode_into(::std::forward<_Input>(__input),
 				::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_Output>(__output),
@@ -258,7 +279,8 @@ namespace ztd { namespace text {
 
 		auto __stateful_result
 			= transcode_into(::std::forward<_Input>(__input), ::std::forward<_FromEncoding>(__from_encoding),
-			     ::std::forward<_ToEncoding>(__to_encoding), ::std::forward<_FromErrorHandler>(__from_error_handler),
+			     ::std::forward<_Output>(__output), ::std::forward<_ToEncoding>(__to_encoding),
+			     ::std::forward<_FromErrorHandler>(__from_error_handler),
 			     ::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state);
 
 		return __txt_detail::__slice_to_stateless(::std::move(__stateful_result));
@@ -295,7 +317,8 @@ namespace ztd { namespace text {
 		_FromState __from_state = make_decode_state(__from_encoding);
 
 		return transcode_into(::std::forward<_Input>(__input), ::std::forward<_FromEncoding>(__from_encoding),
-			::std::forward<_ToEncoding>(__to_encoding), ::std::forward<_FromErrorHandler>(__from_error_handler),
+			::std::forward<_Output>(__output), ::std::forward<_ToEncoding>(__to_encoding),
+			::std::forward<_FromErrorHandler>(__from_error_handler),
 			::std::forward<_ToErrorHandler>(__to_error_handler), __from_state);
 	}
 
@@ -409,19 +432,48 @@ namespace ztd { namespace text {
 	/// @param[in]     __to_error_handler The error handler for the @p __to_encoding 's encode step.
 	/// @param[in,out] __from_state A reference to the associated state for the @p __from_encoding 's decode step.
 	/// @param[in,out] __to_state A reference to the associated state for the @p __to_encoding 's encode step.
+	/// @param[in]     __sizing How to size the output container before writing into it. See ztd::text::output_sizing.
 	///
 	/// @returns A ztd::text::transcode_result object that contains references to @p __from_state and @p __to_state and
-	/// an @c ".output" parameter that contains the @p _OutputContainer specified. If the container has a @c ".reserve"
-	/// function, it is and some multiple of the input's size is used to pre-size the container, to aid with @c
-	/// "push_back"/@c "insert" reallocation pains.
+	/// an @c ".output" parameter that contains the @p _OutputContainer specified. If the container can be resized and
+	/// written into through its @c ".data()" and the input has a size, the container is sized according to @p
+	/// __sizing and written into directly. Otherwise, if the container has a @c ".reserve" function, it is and some
+	/// multiple of the input's size is used to pre-size the container, to aid with @c "push_back"/@c "insert"
+	/// reallocation pains.
 	//////
 	template <typename _OutputContainer, typename _Input, typename _FromEncoding, typename _ToEncoding,
 		typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState, typename _ToState>
 	constexpr auto transcode_to(_Input&& __input, _FromEncoding&& __from_encoding, _ToEncoding&& __to_encoding,
 		_FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler, _FromState& __from_state,
-		_ToState& __to_state) {
+		_ToState& __to_state, output_sizing __sizing = output_sizing::automatic) {
+		using _UFromEncoding = __txt_detail::__remove_cvref_t<_FromEncoding>;
+		using _UToEncoding   = __txt_detail::__remove_cvref_t<_ToEncoding>;
 
 		_OutputContainer __output {};
+		if constexpr (__txt_detail::__is_sized_output_v<_OutputContainer, _Input>) {
+			const ::std::size_t __upper_bound_size
+				= static_cast<::std::size_t>(__txt_detail::__adl::__adl_size(__input))
+				* max_code_points_v<_UFromEncoding> * max_code_units_v<_UToEncoding>;
+			::std::size_t __output_size = 0;
+			if (__txt_detail::__pick_output_size(
+				     __output_size, __sizing, __upper_bound_size, [&](::std::size_t& __exact_size) {
+					     return __txt_detail::__transcode_exact_size<_OutputContainer>(
+					          __exact_size, __input, __from_encoding, __to_encoding, __from_state, __to_state);
+				     })) {
+				auto __stateful_result
+					= __txt_detail::__sized_output_into(__output, __output_size, [&](auto __output_view) {
+					       return transcode_into(::std::forward<_Input>(__input),
+					            ::std::forward<_FromEncoding>(__from_encoding), ::std::move(__output_view),
+					            ::std::forward<_ToEncoding>(__to_encoding),
+					            ::std::forward<_FromErrorHandler>(__from_error_handler),
+					            ::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state);
+				       });
+				return __txt_detail::__replace_result_output(::std::move(__stateful_result), ::std::move(__output));
+			}
+		}
+		else {
+			(void)__sizing;
+		}
 		if constexpr (__txt_detail::__is_detected_v<__txt_detail::__detect_adl_size, _Input>) {
 			using _SizeType = decltype(__txt_detail::__adl::__adl_size(__input));
 			if constexpr (__txt_detail::__is_detected_v<__txt_detail::__detect_reserve_with_size_type,
@@ -431,11 +483,13 @@ namespace ztd { namespace text {
 			}
 		}
 
-		auto __insert_view     = unbounded_view(::std::back_inserter(__output));
+		__txt_detail::__container_output_t<_OutputContainer> __container_output(__output);
+		auto __insert_view     = unbounded_view(__container_output.__begin());
 		auto __stateful_result = transcode_into(::std::forward<_Input>(__input),
 			::std::forward<_FromEncoding>(__from_encoding), ::std::move(__insert_view),
 			::std::forward<_ToEncoding>(__to_encoding), ::std::forward<_FromErrorHandler>(__from_error_handler),
 			::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state);
+		__container_output.__finish();
 		return __txt_detail::__replace_result_output(::std::move(__stateful_result), ::std::move(__output));
 	}
 
@@ -635,6 +689,7 @@ namespace ztd { namespace text {
 	/// @param[in]     __to_error_handler The error handler for the @p __to_encoding 's encode step.
 	/// @param[in,out] __from_state A reference to the associated state for the @p __from_encoding 's decode step.
 	/// @param[in,out] __to_state A reference to the associated state for the @p __to_encoding 's encode step.
+	/// @param[in]     __sizing How to size the output container before writing into it. See ztd::text::output_sizing.
 	///
 	/// @returns An @p _OutputContainer with the result, regardless of whether an error occurs or not. If you are
 	/// looking for error information and not just a quick one-off conversion function, please use
@@ -644,9 +699,36 @@ namespace ztd { namespace text {
 		typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState, typename _ToState>
 	constexpr auto transcode(_Input&& __input, _FromEncoding&& __from_encoding, _ToEncoding&& __to_encoding,
 		_FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler, _FromState& __from_state,
-		_ToState& __to_state) {
+		_ToState& __to_state, output_sizing __sizing = output_sizing::automatic) {
+		using _UFromEncoding = __txt_detail::__remove_cvref_t<_FromEncoding>;
+		using _UToEncoding   = __txt_detail::__remove_cvref_t<_ToEncoding>;
 
 		_OutputContainer __output {};
+		if constexpr (__txt_detail::__is_sized_output_v<_OutputContainer, _Input>) {
+			const ::std::size_t __upper_bound_size
+				= static_cast<::std::size_t>(__txt_detail::__adl::__adl_size(__input))
+				* max_code_points_v<_UFromEncoding> * max_code_units_v<_UToEncoding>;
+			::std::size_t __output_size = 0;
+			if (__txt_detail::__pick_output_size(
+				     __output_size, __sizing, __upper_bound_size, [&](::std::size_t& __exact_size) {
+					     return __txt_detail::__transcode_exact_size<_OutputContainer>(
+					          __exact_size, __input, __from_encoding, __to_encoding, __from_state, __to_state);
+				     })) {
+				auto __stateful_result
+					= __txt_detail::__sized_output_into(__output, __output_size, [&](auto __output_view) {
+					       return transcode_into(::std::forward<_Input>(__input),
+					            ::std::forward<_FromEncoding>(__from_encoding), ::std::move(__output_view),
+					            ::std::forward<_ToEncoding>(__to_encoding),
+					            ::std::forward<_FromErrorHandler>(__from_error_handler),
+					            ::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state);
+				       });
+				(void)__stateful_result;
+				return __output;
+			}
+		}
+		else {
+			(void)__sizing;
+		}
 		if constexpr (__txt_detail::__is_detected_v<__txt_detail::__detect_adl_size, _Input>) {
 			using _SizeType = decltype(__txt_detail::__adl::__adl_size(__input));
 			if constexpr (__txt_detail::__is_detected_v<__txt_detail::__detect_reserve_with_size_type,
@@ -656,11 +738,13 @@ namespace ztd { namespace text {
 			}
 		}
 
-		auto __insert_view     = unbounded_view(::std::back_inserter(__output));
+		__txt_detail::__container_output_t<_OutputContainer> __container_output(__output);
+		auto __insert_view     = unbounded_view(__container_output.__begin());
 		auto __stateful_result = transcode_into(::std::forward<_Input>(__input),
 			::std::forward<_FromEncoding>(__from_encoding), ::std::move(__insert_view),
 			::std::forward<_ToEncoding>(__to_encoding), ::std::forward<_FromErrorHandler>(__from_error_handler),
 			::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state);
+		__container_output.__finish();
 		// We are explicitly discard the stateful result here;
 		// use the transcode_to and transcode_into functions for more information
 		(void)__stateful_result;
@@ -859,6 +943,7 @@ namespace ztd { namespace text {
 	/// @param[in]     __to_error_handler The error handler for the @p __to_encoding 's encode step.
 	/// @param[in,out] __from_state A reference to the associated state for the @p __from_encoding 's decode step.
 	/// @param[in,out] __to_state A reference to the associated state for the @p __to_encoding 's encode step.
+	/// @param[in]     __sizing How to size the output container before writing into it. See ztd::text::output_sizing.
 	///
 	/// @returns A @c std::basic_string or @c std::vector with an element type of @c
 	/// ztd::text::code_unit<_ToEncoding> with the result, regardless of whether an error occurs or not. If
@@ -869,7 +954,7 @@ namespace ztd { namespace text {
 		typename _ToErrorHandler, typename _FromState, typename _ToState>
 	constexpr auto transcode(_Input&& __input, _FromEncoding&& __from_encoding, _ToEncoding&& __to_encoding,
 		_FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler, _FromState& __from_state,
-		_ToState& __to_state) {
+		_ToState& __to_state, output_sizing __sizing = output_sizing::automatic) {
 		using _UToEncoding = __txt_detail::__remove_cvref_t<_ToEncoding>;
 		using _CodeUnit    = code_unit_t<_UToEncoding>;
 		using _OutputContainer
@@ -879,7 +964,7 @@ namespace ztd { namespace text {
 		return transcode<_OutputContainer>(::std::forward<_Input>(__input),
 			::std::forward<_FromEncoding>(__from_encoding), ::std::forward<_ToEncoding>(__to_encoding),
 			::std::forward<_FromErrorHandler>(__from_error_handler),
-			::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state);
+			::std::forward<_ToErrorHandler>(__to_error_handler), __from_state, __to_state, __sizing);
 	}
 
 	//////
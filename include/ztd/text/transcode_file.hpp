@@ -0,0 +1,669 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+#pragma once
+
+#ifndef ZTD_TEXT_TRANSCODE_FILE_HPP
+#define ZTD_TEXT_TRANSCODE_FILE_HPP
+
+#include <ztd/text/version.hpp>
+
+#include <ztd/text/c_string_view.hpp>
+#include <ztd/text/code_point.hpp>
+#include <ztd/text/code_unit.hpp>
+#include <ztd/text/decode.hpp>
+#include <ztd/text/encode.hpp>
+#include <ztd/text/encoding_error.hpp>
+#include <ztd/text/error_handler.hpp>
+#include <ztd/text/is_unicode_code_point.hpp>
+#include <ztd/text/state.hpp>
+#include <ztd/text/streaming_transcoder.hpp>
+#include <ztd/text/transcode.hpp>
+
+#include <ztd/text/detail/adl.hpp>
+#include <ztd/text/detail/file.hpp>
+#include <ztd/text/detail/is_lossless.hpp>
+#include <ztd/text/detail/sized_output.hpp>
+#include <ztd/text/detail/span.hpp>
+#include <ztd/text/detail/type_traits.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ztd { namespace text {
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
+
+	//////
+	/// @addtogroup ztd_text_transcode_file ztd::text::transcode_file
+	/// @{
+	//////
+
+	//////
+	/// @brief Options for ztd::text::transcode_file.
+	//////
+	struct transcode_file_options {
+		//////
+		/// @brief The number of bytes of input mapped into memory at a time when the whole input file cannot be
+		/// mapped at once.
+		//////
+		static constexpr ::std::size_t default_window_size = static_cast<::std::size_t>(64) * 1024 * 1024;
+
+		//////
+		/// @brief Whether to skip a byte order mark (an encoded U+FEFF) at the start of the input.
+		//////
+		bool skip_input_bom = false;
+		//////
+		/// @brief Whether to write a byte order mark (an encoded U+FEFF) at the start of the output.
+		//////
+		bool write_output_bom = false;
+		//////
+		/// @brief The number of bytes of input to map into memory (or read) at a time. If it is @c 0 , the whole
+		/// input file is mapped at once, or @c default_window_size bytes at a time if that does not work.
+		//////
+		::std::size_t window_size = 0;
+	};
+
+	//////
+	/// @brief The result of ztd::text::transcode_file.
+	//////
+	struct transcode_file_result {
+		//////
+		/// @brief The kind of error that occured, if any.
+		//////
+		encoding_error error_code;
+		//////
+		/// @brief The error from the operating system, if opening, reading, mapping, or writing either of the files
+		/// failed.
+		//////
+		::std::error_code file_error;
+		//////
+		/// @brief The number of bytes of the input file that were transcoded (including a byte order mark that was
+		/// skipped).
+		//////
+		::std::size_t input_size;
+		//////
+		/// @brief The number of bytes written to the output file.
+		//////
+		::std::size_t output_size;
+		//////
+		/// @brief The number of errors that the error handlers handled.
+		//////
+		::std::size_t handled_errors;
+
+		//////
+		/// @brief Whether or not the error handlers handled any errors.
+		///
+		/// @returns Simply checks whether @c handled_errors is greater than 0.
+		//////
+		constexpr bool errors_were_handled() const noexcept {
+			return this->handled_errors > 0;
+		}
+	};
+
+	//////
+	/// @}
+	//////
+
+	namespace __txt_detail {
+
+		//////
+		/// @brief The number of bytes of output transcoded in memory before being written to the output file, when
+		/// the output file is not mapped.
+		//////
+		inline constexpr ::std::size_t __file_output_buffer_size = static_cast<::std::size_t>(256) * 1024;
+
+		//////
+		/// @brief The number of bytes of input read at a time when the input file is not mapped and no window size
+		/// was asked for.
+		//////
+		inline constexpr ::std::size_t __file_read_buffer_size = static_cast<::std::size_t>(1024) * 1024;
+
+		//////
+		/// @brief The smallest number of bytes of input read at a time when the input file is not mapped, which is
+		/// room enough for several of the longest sequences.
+		//////
+		inline constexpr ::std::size_t __file_minimum_read_buffer_size = 4096;
+
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_MEMORY_MAPPED_FILES_I_)
+		//////
+		/// @brief Hands out the bytes of a regular file by mapping it into memory, a window at a time.
+		//////
+		class __mapped_file_input {
+		public:
+			static constexpr bool __is_mapped = true;
+
+			__mapped_file_input(const __file& __file, ::std::size_t __file_size, ::std::size_t __window_size) noexcept
+			: _M_file(::std::addressof(__file))
+			, _M_file_size(__file_size)
+			, _M_window_size(__window_size)
+			, _M_window_offset(0)
+			, _M_mapping() {
+			}
+
+			//////
+			/// @brief Gets the bytes of the file from @p __position up to the end of the current window, moving the
+			/// window if fewer than @p __minimum bytes are left in it.
+			///
+			/// @param[in]  __position Where in the file to start.
+			/// @param[in]  __minimum The number of bytes that must be handed out, unless the file ends first.
+			/// @param[out] __data The bytes starting at @p __position .
+			/// @param[out] __size The number of bytes at @p __data .
+			/// @param[out] __last Whether @p __data runs to the end of the file.
+			/// @param[out] __error The error from the operating system, if the window could not be mapped.
+			//////
+			bool __at(::std::size_t __position, ::std::size_t __minimum, const ::std::byte*& __data,
+				::std::size_t& __size, bool& __last, ::std::error_code& __error) noexcept {
+				if (__position >= this->_M_file_size) {
+					__data = nullptr;
+					__size = 0;
+					__last = true;
+					return true;
+				}
+				::std::size_t __window_last = this->_M_window_offset + this->_M_mapping.__size();
+				if (this->_M_mapping.__data() == nullptr || __position < this->_M_window_offset
+					|| __position >= __window_last
+					|| (__window_last - __position < __minimum && __window_last != this->_M_file_size)) {
+					if (!this->_M_map(__position, __error)) {
+						return false;
+					}
+					__window_last = this->_M_window_offset + this->_M_mapping.__size();
+				}
+				__data = static_cast<const ::std::byte*>(this->_M_mapping.__data())
+					+ (__position - this->_M_window_offset);
+				__size = __window_last - __position;
+				__last = __window_last == this->_M_file_size;
+				return true;
+			}
+
+		private:
+			bool _M_map(::std::size_t __position, ::std::error_code& __error) noexcept {
+				const ::std::size_t __page_size = __file_page_size();
+				// a window of at least two pages always gets past a sequence that runs off the end of the last one
+				::std::size_t __window_size
+					= ::std::max((this->_M_window_size / __page_size) * __page_size, __page_size * 2);
+				if (__window_size < this->_M_window_size) {
+					__window_size += __page_size;
+				}
+				const ::std::size_t __offset = __position - (__position % __page_size);
+				if (!this->_M_mapping.__map(*this->_M_file, __offset,
+					     ::std::min(__window_size, this->_M_file_size - __offset), false, __error)) {
+					if (this->_M_window_size <= transcode_file_options::default_window_size) {
+						return false;
+					}
+					// there is no room for a window that big (e.g., the whole of a large file): use smaller ones
+					this->_M_window_size = transcode_file_options::default_window_size;
+					__error.clear();
+					return this->_M_map(__position, __error);
+				}
+				this->_M_window_offset = __offset;
+				return true;
+			}
+
+			const __file* _M_file;
+			::std::size_t _M_file_size;
+			::std::size_t _M_window_size;
+			::std::size_t _M_window_offset;
+			__file_mapping _M_mapping;
+		};
+#endif
+
+		//////
+		/// @brief Hands out the bytes of a file by reading them into a buffer, a buffer at a time.
+		//////
+		class __read_file_input {
+		public:
+			static constexpr bool __is_mapped = false;
+
+			__read_file_input(__file& __file, ::std::size_t __buffer_size)
+			: _M_file(::std::addressof(__file))
+			, _M_buffer(::std::max(__buffer_size, __file_minimum_read_buffer_size))
+			, _M_buffer_offset(0)
+			, _M_buffer_size(0)
+			, _M_end_of_file(false) {
+			}
+
+			//////
+			/// @brief Gets the bytes of the file from @p __position up to the end of the buffer, reading more into the
+			/// buffer if fewer than @p __minimum bytes are left in it. See
+			/// ztd::text::__txt_detail::__mapped_file_input::__at.
+			//////
+			bool __at(::std::size_t __position, ::std::size_t __minimum, const ::std::byte*& __data,
+				::std::size_t& __size, bool& __last, ::std::error_code& __error) noexcept {
+				::std::size_t __buffer_last = this->_M_buffer_offset + this->_M_buffer_size;
+				if (!this->_M_end_of_file && __buffer_last - __position < __minimum) {
+					// keep what is left at the front of the buffer, and fill up the rest
+					const ::std::size_t __kept = __buffer_last - __position;
+					::std::memmove(this->_M_buffer.data(),
+						this->_M_buffer.data() + (__position - this->_M_buffer_offset), __kept);
+					::std::size_t __read = 0;
+					if (!this->_M_file->__read(
+						     this->_M_buffer.data() + __kept, this->_M_buffer.size() - __kept, __read, __error)) {
+						return false;
+					}
+					this->_M_end_of_file = __kept + __read < this->_M_buffer.size();
+					this->_M_buffer_offset = __position;
+					this->_M_buffer_size   = __kept + __read;
+					__buffer_last          = __position + this->_M_buffer_size;
+				}
+				__data = this->_M_buffer.data() + (__position - this->_M_buffer_offset);
+				__size = __buffer_last - __position;
+				__last = this->_M_end_of_file;
+				return true;
+			}
+
+		private:
+			__file* _M_file;
+			::std::vector<::std::byte> _M_buffer;
+			::std::size_t _M_buffer_offset;
+			::std::size_t _M_buffer_size;
+			bool _M_end_of_file;
+		};
+
+		//////
+		/// @brief Returns the number of code units taken up by a byte order mark at the start of @p __input , or @c 0
+		/// if there is none.
+		//////
+		template <typename _Encoding, typename _CodeUnit>
+		::std::size_t __input_bom_size(::ztd::text::span<const _CodeUnit> __input, const _Encoding& __encoding) {
+			using _CodePoint = code_point_t<_Encoding>;
+			if constexpr (is_unicode_code_point_v<_CodePoint>) {
+				// decode just the first code point: anything after it runs out of output space
+				_CodePoint __intermediate[1] {};
+				decode_state_t<_Encoding> __state = make_decode_state(__encoding);
+				auto __result = decode_into(__input, __encoding, ::ztd::text::span<_CodePoint>(__intermediate),
+					pass_handler {}, __state);
+				if ((__result.error_code == encoding_error::ok
+					    || __result.error_code == encoding_error::insufficient_output_space)
+					&& __adl::__adl_empty(__result.output)
+					&& __intermediate[0] == static_cast<_CodePoint>(U'\xFEFF')) {
+					return static_cast<::std::size_t>(__input.size())
+						- static_cast<::std::size_t>(__adl::__adl_size(__result.input));
+				}
+			}
+			else {
+				(void)__input;
+				(void)__encoding;
+			}
+			return 0;
+		}
+
+		//////
+		/// @brief Encodes a byte order mark into @p __output , setting @p __size to the number of code units it
+		/// took up. Encodings whose code points are not Unicode get no byte order mark.
+		//////
+		template <typename _Encoding, typename _ErrorHandler, typename _State, typename _CodeUnit, ::std::size_t _Size>
+		encoding_error __output_bom(const _Encoding& __encoding, _ErrorHandler& __error_handler, _State& __state,
+			_CodeUnit (&__output)[_Size], ::std::size_t& __size) {
+			using _CodePoint = code_point_t<_Encoding>;
+			if constexpr (is_unicode_code_point_v<_CodePoint>) {
+				const _CodePoint __bom[1] = { static_cast<_CodePoint>(U'\xFEFF') };
+				auto __result = encode_into(::ztd::text::span<const _CodePoint>(__bom), __encoding,
+					::ztd::text::span<_CodeUnit>(__output), __error_handler, __state);
+				__size = _Size - static_cast<::std::size_t>(__adl::__adl_size(__result.output));
+				return __result.error_code;
+			}
+			else {
+				(void)__encoding;
+				(void)__error_handler;
+				(void)__state;
+				(void)__output;
+				__size = 0;
+				return encoding_error::ok;
+			}
+		}
+
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_MEMORY_MAPPED_FILES_I_)
+		//////
+		/// @brief Transcodes the whole of @p __input straight into the mapped output file, if the size of the output
+		/// can be counted up-front.
+		///
+		/// @returns @c false if the output should be written out a buffer at a time instead.
+		//////
+		template <typename _FromEncoding, typename _ToEncoding, typename _FromErrorHandler, typename _ToErrorHandler,
+			typename _FromState, typename _ToState, typename _FromCodeUnit, typename _ToCodeUnit>
+		bool __transcode_file_mapped(transcode_file_result& __result,
+			::ztd::text::span<const _FromCodeUnit> __input, __file& __output,
+			::ztd::text::span<const _ToCodeUnit> __bom, const _FromEncoding& __from_encoding,
+			const _ToEncoding& __to_encoding, _FromErrorHandler& __from_error_handler,
+			_ToErrorHandler& __to_error_handler, _FromState& __from_state, _ToState& __to_state) {
+			::std::size_t __exact_size = 0;
+			if (!__transcode_exact_size<::std::vector<_ToCodeUnit>>(
+				    __exact_size, __input, __from_encoding, __to_encoding, __from_state, __to_state)) {
+				return false;
+			}
+			const ::std::size_t __bom_size   = static_cast<::std::size_t>(__bom.size());
+			const ::std::size_t __total_size = __bom_size + __exact_size;
+			if (__total_size == 0) {
+				return true;
+			}
+			if (!__output.__reserve(__total_size, __result.file_error)) {
+				return true;
+			}
+			__file_mapping __mapping;
+			::std::error_code __map_error;
+			if (!__mapping.__map(__output, 0, __total_size, true, __map_error)) {
+				// not enough address space for all of the output: write it out a buffer at a time instead
+				__output.__resize(0, __result.file_error);
+				return static_cast<bool>(__result.file_error);
+			}
+			_ToCodeUnit* __output_data = static_cast<_ToCodeUnit*>(__mapping.__data());
+			::std::copy(__bom.begin(), __bom.end(), __output_data);
+			auto __transcode_result = transcode_into(__input, __from_encoding,
+				::ztd::text::span<_ToCodeUnit>(__output_data + __bom_size, __exact_size), __to_encoding,
+				__from_error_handler, __to_error_handler, __from_state, __to_state);
+			__mapping.__unmap();
+			const ::std::size_t __written
+				= __total_size - static_cast<::std::size_t>(__adl::__adl_size(__transcode_result.output));
+			__result.error_code = __transcode_result.error_code;
+			__result.input_size += static_cast<::std::size_t>(__input.size())
+				- static_cast<::std::size_t>(__adl::__adl_size(__transcode_result.input));
+			__result.output_size = __written;
+			if (__written != __total_size) {
+				__output.__resize(__written, __result.file_error);
+			}
+			return true;
+		}
+#endif
+
+		//////
+		/// @brief Transcodes the input a piece at a time into a buffer, writing the buffer out after each piece.
+		///
+		/// @remarks Each piece is small enough that its output fits in the buffer, for all but encodings with a
+		/// very large ztd::text::max_code_units_v or ztd::text::max_code_points_v. A sequence that runs off
+		/// the end of a piece is held back by the ztd::text::__txt_detail::__streaming_handler and started over at
+		/// the beginning of the next one.
+		//////
+		template <typename _Source, typename _FromEncoding, typename _ToEncoding, typename _FromErrorHandler,
+			typename _ToErrorHandler, typename _FromState, typename _ToState>
+		void __transcode_file_buffered(transcode_file_result& __result, _Source& __source, ::std::size_t __position,
+			__file& __output, const _FromEncoding& __from_encoding, const _ToEncoding& __to_encoding,
+			__streaming_progress& __progress, _FromErrorHandler& __from_error_handler,
+			_ToErrorHandler& __to_error_handler, _FromState& __from_state, _ToState& __to_state) {
+			using _FromCodeUnit = code_unit_t<_FromEncoding>;
+			using _ToCodeUnit   = code_unit_t<_ToEncoding>;
+			// the worst case of some encodings (e.g., ztd::text::any_encoding) is far off from what they really
+			// produce: do not let it shrink the pieces down to nothing, and pick up after a full buffer instead
+			constexpr ::std::size_t __piece_size = ::std::max(
+				__file_output_buffer_size / (max_code_points_v<_FromEncoding> * max_code_units_v<_ToEncoding>),
+				static_cast<::std::size_t>(4096));
+
+			static_assert(max_code_units_v<_FromEncoding> * 2 <= __file_minimum_read_buffer_size,
+				"the sequences of the input file's encoding are too long to be read a buffer at a time");
+
+			::std::vector<_ToCodeUnit> __buffer(__file_output_buffer_size);
+			for (;;) {
+				const ::std::byte* __data = nullptr;
+				::std::size_t __available = 0;
+				bool __last               = false;
+				if (!__source.__at(__position, max_code_units_v<_FromEncoding>, __data, __available, __last,
+					    __result.file_error)) {
+					return;
+				}
+				if (__available == 0) {
+					return;
+				}
+				const ::std::size_t __size    = ::std::min(__available, __piece_size);
+				__progress._M_hold_incomplete = !__last || __size != __available;
+				__progress._M_held_incomplete = false;
+				auto __piece_result = transcode_into(
+					::ztd::text::span<const _FromCodeUnit>(reinterpret_cast<const _FromCodeUnit*>(__data), __size),
+					__from_encoding, ::ztd::text::span<_ToCodeUnit>(__buffer), __to_encoding, __from_error_handler,
+					__to_error_handler, __from_state, __to_state);
+				const ::std::size_t __written
+					= __buffer.size() - static_cast<::std::size_t>(__adl::__adl_size(__piece_result.output));
+				if (!__output.__write(__buffer.data(), __written, __result.file_error)) {
+					return;
+				}
+				const ::std::size_t __consumed
+					= __size - static_cast<::std::size_t>(__adl::__adl_size(__piece_result.input));
+				__position += __consumed;
+				__result.input_size = __position;
+				__result.output_size += __written;
+				if (__piece_result.error_code != encoding_error::ok) {
+					// encodings that never call their error handler (e.g., ztd::text::any_encoding) report a
+					// sequence that runs off the end of the piece straight away
+					const bool __held = __progress._M_held_incomplete
+						|| (__progress._M_hold_incomplete
+						     && __piece_result.error_code == encoding_error::incomplete_sequence
+						     && __size - __consumed < max_code_units_v<_FromEncoding>);
+					if (__held
+						|| (__piece_result.error_code == encoding_error::insufficient_output_space
+						     && __consumed != 0)) {
+						// pick up where this piece left off
+						continue;
+					}
+					__result.error_code = __piece_result.error_code;
+					return;
+				}
+			}
+		}
+
+		template <typename _Source, typename _FromEncoding, typename _ToEncoding, typename _FromErrorHandler,
+			typename _ToErrorHandler, typename _FromState, typename _ToState>
+		void __transcode_file_from(transcode_file_result& __result, _Source& __source, __file& __output,
+			const transcode_file_options& __options, const _FromEncoding& __from_encoding,
+			const _ToEncoding& __to_encoding, __streaming_progress& __progress,
+			_FromErrorHandler& __from_error_handler, _ToErrorHandler& __to_error_handler, _FromState& __from_state,
+			_ToState& __to_state) {
+			using _FromCodeUnit = code_unit_t<_FromEncoding>;
+			using _ToCodeUnit   = code_unit_t<_ToEncoding>;
+
+			const ::std::byte* __data = nullptr;
+			::std::size_t __available = 0;
+			bool __last               = false;
+			if (!__source.__at(
+				    0, max_code_units_v<_FromEncoding>, __data, __available, __last, __result.file_error)) {
+				return;
+			}
+			::ztd::text::span<const _FromCodeUnit> __input(
+				reinterpret_cast<const _FromCodeUnit*>(__data), __available);
+			::std::size_t __position = 0;
+			if (__options.skip_input_bom) {
+				__position = __input_bom_size(__input, __from_encoding);
+				__input    = __input.subspan(__position);
+			}
+			__result.input_size = __position;
+
+			_ToCodeUnit __bom[max_code_units_v<_ToEncoding>] {};
+			::std::size_t __bom_size = 0;
+			if (__options.write_output_bom) {
+				__result.error_code
+					= __output_bom(__to_encoding, __to_error_handler, __to_state, __bom, __bom_size);
+				if (__result.error_code != encoding_error::ok) {
+					return;
+				}
+			}
+
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_MEMORY_MAPPED_FILES_I_)
+			if constexpr (_Source::__is_mapped) {
+				if (__last
+					&& __transcode_file_mapped(__result, __input, __output,
+					     ::ztd::text::span<const _ToCodeUnit>(__bom, __bom_size), __from_encoding, __to_encoding,
+					     __from_error_handler, __to_error_handler, __from_state, __to_state)) {
+					return;
+				}
+			}
+#endif
+			if (!__output.__write(__bom, __bom_size, __result.file_error)) {
+				return;
+			}
+			__result.output_size = __bom_size;
+			__transcode_file_buffered(__result, __source, __position, __output, __from_encoding, __to_encoding,
+				__progress, __from_error_handler, __to_error_handler, __from_state, __to_state);
+		}
+
+	} // namespace __txt_detail
+
+	//////
+	/// @addtogroup ztd_text_transcode_file ztd::text::transcode_file
+	/// @{
+	//////
+
+	//////
+	/// @brief Transcodes the contents of one file into another file.
+	///
+	/// @param[in] __input_path The path of the file to read.
+	/// @param[in] __from_encoding The encoding of the input file. Its code units must be a single byte: use a
+	/// ztd::text::encoding_scheme (e.g., ztd::text::utf16_le) for encodings with wider code units.
+	/// @param[in] __output_path The path of the file to write. It is created, or emptied if it already exists.
+	/// @param[in] __to_encoding The encoding of the output file. Its code units must be a single byte.
+	/// @param[in] __from_error_handler The error handler for the @p __from_encoding 's decode step.
+	/// @param[in] __to_error_handler The error handler for the @p __to_encoding 's encode step.
+	/// @param[in] __options Byte order mark handling, and how much of the input to map at a time.
+	///
+	/// @returns A ztd::text::transcode_file_result describing how much was transcoded, and any error (from
+	/// transcoding, or from the operating system) that stopped it.
+	///
+	/// @remarks Where memory-mapped files are available (see @c ZTD_TEXT_MEMORY_MAPPED_FILES ), a regular input
+	/// file is mapped into memory, all at once or a window at a time. If it is mapped all at once and the size of
+	/// the output can be counted up-front (see ztd::text::output_sizing::exact), the output file is allocated at
+	/// that size, mapped, and transcoded straight into. Otherwise, the output is transcoded into a buffer and
+	/// written out a buffer at a time. Sequences that cross the boundary of a window or a buffer are put back
+	/// together. If an error stops the transcoding, the output file holds everything written before the error.
+	/// The input file must not be changed by anything else while it is mapped. If the output file is the input file
+	/// (under the same name or another one), it is left as it is and the ztd::text::transcode_file_result::file_error
+	/// is @c std::errc::invalid_argument .
+	//////
+	template <typename _FromEncoding, typename _ToEncoding, typename _FromErrorHandler, typename _ToErrorHandler>
+	transcode_file_result transcode_file(c_string_view __input_path, _FromEncoding&& __from_encoding,
+		c_string_view __output_path, _ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler,
+		_ToErrorHandler&& __to_error_handler, const transcode_file_options& __options) {
+		using _UFromEncoding     = __txt_detail::__remove_cvref_t<_FromEncoding>;
+		using _UToEncoding       = __txt_detail::__remove_cvref_t<_ToEncoding>;
+		using _UFromErrorHandler = __txt_detail::__remove_cvref_t<_FromErrorHandler>;
+		using _UToErrorHandler   = __txt_detail::__remove_cvref_t<_ToErrorHandler>;
+
+		static_assert(sizeof(code_unit_t<_UFromEncoding>) == 1,
+			"the code units of the input file's encoding must be bytes: use a ztd::text::encoding_scheme (e.g., "
+			"ztd::text::utf16_le) for encodings with wider code units");
+		static_assert(sizeof(code_unit_t<_UToEncoding>) == 1,
+			"the code units of the output file's encoding must be bytes: use a ztd::text::encoding_scheme (e.g., "
+			"ztd::text::utf16_le) for encodings with wider code units");
+		static_assert(__txt_detail::__is_decode_lossless_or_deliberate_v<_UFromEncoding, _UFromErrorHandler>,
+			"The decode (input) portion of this transcode is a lossy, non-injective operation. This means you may "
+			"lose data that you did not intend to lose; specify a 'from' error handler explicitly in order to bypass "
+			"this.");
+		static_assert(__txt_detail::__is_encode_lossless_or_deliberate_v<_UToEncoding, _UToErrorHandler>,
+			"The encode (output) portion of this transcode is a lossy, non-injective operation. This means you may "
+			"lose data that you did not intend to lose; specify a 'to' error handler explicitly in order to bypass "
+			"this.");
+
+		transcode_file_result __result { encoding_error::ok, {}, 0, 0, 0 };
+		__txt_detail::__file __input;
+		if (!__input.__open_read(__input_path.c_str(), __result.file_error)) {
+			return __result;
+		}
+		__txt_detail::__file __output;
+		if (!__output.__open_write(__output_path.c_str(), __result.file_error)) {
+			return __result;
+		}
+		if (__output.__is_same_file(__input)) {
+			// the output would be written over the input while it is still being read
+			__result.file_error = ::std::make_error_code(::std::errc::invalid_argument);
+			return __result;
+		}
+		if (!__output.__clear(__output_path.c_str(), __result.file_error)) {
+			return __result;
+		}
+
+		__txt_detail::__streaming_progress __progress {};
+		__txt_detail::__streaming_handler<::std::remove_reference_t<_FromErrorHandler>, true>
+			__counting_from_error_handler(__from_error_handler, __progress);
+		__txt_detail::__streaming_handler<::std::remove_reference_t<_ToErrorHandler>, false>
+			__counting_to_error_handler(__to_error_handler, __progress);
+		decode_state_t<_UFromEncoding> __from_state = make_decode_state(__from_encoding);
+		encode_state_t<_UToEncoding> __to_state     = make_encode_state(__to_encoding);
+
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_MEMORY_MAPPED_FILES_I_)
+		::std::size_t __input_size = 0;
+		if (__input.__regular_size(__input_size)) {
+			__txt_detail::__mapped_file_input __source(
+				__input, __input_size, __options.window_size == 0 ? __input_size : __options.window_size);
+			__txt_detail::__transcode_file_from(__result, __source, __output, __options, __from_encoding,
+				__to_encoding, __progress, __counting_from_error_handler, __counting_to_error_handler,
+				__from_state, __to_state);
+		}
+		else
+#endif
+		{
+			__txt_detail::__read_file_input __source(
+				__input, __options.window_size == 0 ? __txt_detail::__file_read_buffer_size : __options.window_size);
+			__txt_detail::__transcode_file_from(__result, __source, __output, __options, __from_encoding,
+				__to_encoding, __progress, __counting_from_error_handler, __counting_to_error_handler,
+				__from_state, __to_state);
+		}
+		::std::error_code __close_error;
+		if (!__output.__close(__close_error) && !__result.file_error) {
+			__result.file_error = __close_error;
+		}
+		__result.handled_errors = __progress._M_handled_errors;
+		return __result;
+	}
+
+	//////
+	/// @brief Transcodes the contents of one file into another file, with the default options.
+	///
+	/// @remarks See the other overload of ztd::text::transcode_file.
+	//////
+	template <typename _FromEncoding, typename _ToEncoding, typename _FromErrorHandler, typename _ToErrorHandler>
+	transcode_file_result transcode_file(c_string_view __input_path, _FromEncoding&& __from_encoding,
+		c_string_view __output_path, _ToEncoding&& __to_encoding, _FromErrorHandler&& __from_error_handler,
+		_ToErrorHandler&& __to_error_handler) {
+		return transcode_file(__input_path, ::std::forward<_FromEncoding>(__from_encoding), __output_path,
+			::std::forward<_ToEncoding>(__to_encoding), ::std::forward<_FromErrorHandler>(__from_error_handler),
+			::std::forward<_ToErrorHandler>(__to_error_handler), transcode_file_options {});
+	}
+
+	//////
+	/// @brief Transcodes the contents of one file into another file, with the default error handlers and options.
+	///
+	/// @remarks See the other overloads of ztd::text::transcode_file.
+	//////
+	template <typename _FromEncoding, typename _ToEncoding>
+	transcode_file_result transcode_file(c_string_view __input_path, _FromEncoding&& __from_encoding,
+		c_string_view __output_path, _ToEncoding&& __to_encoding) {
+		default_handler __from_error_handler {};
+		default_handler __to_error_handler {};
+		return transcode_file(__input_path, ::std::forward<_FromEncoding>(__from_encoding), __output_path,
+			::std::forward<_ToEncoding>(__to_encoding), __from_error_handler, __to_error_handler);
+	}
+
+	//////
+	/// @}
+	//////
+
+	ZTD_TEXT_INLINE_ABI_NAMESPACE_CLOSE_I_
+}} // namespace ztd::text
+
+#endif // ZTD_TEXT_TRANSCODE_FILE_HPP
@@ -41,6 +41,7 @@
 #include <ztd/text/detail/encoding_iterator.hpp>
 #include <ztd/text/detail/blackhole_iterator.hpp>
 #include <ztd/text/detail/encoding_iterator_storage.hpp>
+#include <ztd/text/detail/encoding_iterator_buffer.hpp>
 #include <ztd/text/detail/encoding_range.hpp>
 #include <ztd/text/detail/ebco.hpp>
 #include <ztd/text/detail/adl.hpp>
@@ -72,6 +73,8 @@ namespace ztd { namespace text {
 	/// @tparam _ToErrorHandler The error handler for any encode-step failures.
 	/// @tparam _FromState The state type to use for the decode operations to intermediate code points.
 	/// @tparam _ToState The state type to use for the encode operations to intermediate code points.
+	/// @tparam _BufferSize The number of code units to transcode ahead of time and keep in the iterator. The default,
+	/// 0, does one transcode step at a time.
 	///
 	/// @remarks This type produces proxies as their reference type, and are only readable, not writable iterators. The
 	/// type will also try many different shortcuts for decoding the input and encoding the intermediates,
@@ -84,7 +87,7 @@ namespace ztd { namespace text {
 	/// interfaces.
 	//////
 	template <typename _FromEncoding, typename _ToEncoding, typename _Range, typename _FromErrorHandler,
-		typename _ToErrorHandler, typename _FromState, typename _ToState>
+		typename _ToErrorHandler, typename _FromState, typename _ToState, ::std::size_t _BufferSize = 0>
 	class transcode_iterator : private __txt_detail::__ebco<__txt_detail::__remove_cvref_t<_FromEncoding>, 0>,
 		                      private __txt_detail::__ebco<__txt_detail::__remove_cvref_t<_ToEncoding>, 1>,
 		                      private __txt_detail::__ebco<__txt_detail::__remove_cvref_t<_FromErrorHandler>, 2>,
@@ -93,8 +96,7 @@ namespace ztd { namespace text {
 		                           __txt_detail::__remove_cvref_t<_FromState>, 0>,
 		                      private __txt_detail::__state_storage<__txt_detail::__remove_cvref_t<_ToEncoding>,
 		                           __txt_detail::__remove_cvref_t<_ToState>, 1>,
-		                      private __txt_detail::__cache_cursor<
-		                           max_code_units_v<__txt_detail::__remove_cvref_t<__txt_detail::__unwrap_t<_ToEncoding>>>>,
+		                      private __txt_detail::__encoding_cache_cursor_t<_ToEncoding, _BufferSize>,
 		                      private __txt_detail::__ebco<_Range, 4> {
 	private:
 		using _URange                = __txt_detail::__remove_cvref_t<__txt_detail::__unwrap_t<_Range>>;
@@ -106,9 +108,11 @@ namespace ztd { namespace text {
 		using _UToState              = __txt_detail::__remove_cvref_t<__txt_detail::__unwrap_t<_ToState>>;
 		using _BaseIterator          = __txt_detail::__range_iterator_t<_URange>;
 		using _IntermediateCodePoint = code_point_t<_UToEncoding>;
-		static constexpr ::std::size_t _MaxValues = max_code_units_v<_UToEncoding>;
-		static constexpr bool _IsSingleValueType  = _MaxValues == 1;
-		using __base_cursor_t                     = __txt_detail::__cache_cursor<_MaxValues>;
+		static constexpr bool _IsBuffered = _BufferSize != 0;
+		static constexpr ::std::size_t _MaxValues
+			= __txt_detail::__cache_size_v<max_code_units_v<_UToEncoding>, _BufferSize>;
+		static constexpr bool _IsSingleValueType  = !_IsBuffered && _MaxValues == 1;
+		using __base_cursor_t                     = __txt_detail::__encoding_cache_cursor_t<_ToEncoding, _BufferSize>;
 		using __base_from_encoding_t              = __txt_detail::__ebco<__txt_detail::__remove_cvref_t<_FromEncoding>, 0>;
 		using __base_to_encoding_t                = __txt_detail::__ebco<__txt_detail::__remove_cvref_t<_ToEncoding>, 1>;
 		using __base_from_error_handler_t = __txt_detail::__ebco<__txt_detail::__remove_cvref_t<_FromErrorHandler>, 2>;
@@ -287,7 +291,7 @@ namespace ztd { namespace text {
 		, __base_cursor_t()
 		, __base_range_t(::std::move(__range))
 		, _M_cache() {
-			this->_M_read_one();
+			this->_M_start();
 		}
 
 		//////
@@ -424,12 +428,11 @@ namespace ztd { namespace text {
 		///
 		//////
 		constexpr bool empty() const noexcept {
-			if constexpr (__txt_detail::__is_detected_v<__txt_detail::__detect_adl_empty, _Range>) {
-				return __txt_detail::__adl::__adl_empty(this->__base_range_t::get_value());
+			if constexpr (_IsBuffered) {
+				return this->_M_position == this->_M_size;
 			}
 			else {
-				return __txt_detail::__adl::__adl_cbegin(this->__base_range_t::get_value())
-					== __txt_detail::__adl::__adl_cend(this->__base_range_t::get_value());
+				return this->_M_base_empty();
 			}
 		}
 
@@ -455,6 +458,12 @@ namespace ztd { namespace text {
 			if constexpr (_IsSingleValueType) {
 				this->_M_next_one();
 			}
+			else if constexpr (_IsBuffered) {
+				++this->_M_position;
+				if (this->_M_position == this->_M_size) {
+					this->_M_fill();
+				}
+			}
 			else {
 				++this->_M_position;
 				if (this->_M_position == this->_M_size) {
@@ -526,6 +535,38 @@ namespace ztd { namespace text {
 			this->_M_read_one();
 		}
 
+		constexpr void _M_fill() noexcept {
+			using _SizeType   = __txt_detail::__remove_cvref_t<decltype(this->_M_size)>;
+			this->_M_position = 0;
+			this->_M_size     = 0;
+			// keep going past steps that produce nothing, until there is something to look at or nothing left
+			while (this->_M_size == 0 && !this->_M_base_empty()) {
+				this->_M_size = static_cast<_SizeType>(
+					__txt_detail::__fill_transcode_buffer<_MaxValues>(this->__base_range_t::get_value(),
+					     this->from_encoding(), this->to_encoding(), this->_M_cache.data(), this->from_handler(),
+					     this->to_handler(), this->from_state(), this->to_state()));
+			}
+		}
+
+		constexpr void _M_start() noexcept {
+			if constexpr (_IsBuffered) {
+				this->_M_fill();
+			}
+			else {
+				this->_M_read_one();
+			}
+		}
+
+		constexpr bool _M_base_empty() const noexcept {
+			if constexpr (__txt_detail::__is_detected_v<__txt_detail::__detect_adl_empty, _Range>) {
+				return __txt_detail::__adl::__adl_empty(this->__base_range_t::get_value());
+			}
+			else {
+				return __txt_detail::__adl::__adl_cbegin(this->__base_range_t::get_value())
+					== __txt_detail::__adl::__adl_cend(this->__base_range_t::get_value());
+			}
+		}
+
 		template <__txt_detail::__consume _Consume>
 		constexpr void _M_consume_one() noexcept {
 			auto __result = __txt_detail::__basic_transcode_one<_Consume>(this->__base_range_t::get_value(),
@@ -65,6 +65,9 @@ namespace ztd { namespace text {
 	/// @tparam _ToErrorHandler The error handler for any encode-step failures.
 	/// @tparam _FromState The state type to use for the decode operations to intermediate code points.
 	/// @tparam _ToState The state type to use for the encode operations to intermediate code points.
+	/// @tparam _BufferSize The number of code units the iterators transcode ahead of time and keep. The default, 0,
+	/// does one transcode step per increment. Something like 64 lets the iterators use the bulk decode and encode
+	/// functions (and any fast paths they have), which is a lot faster for plain loops over the view.
 	///
 	/// @remarks This type produces proxies as their reference type, and are only readable, not writable iterators. The
 	/// type will also try many different shortcuts for decoding the input and encoding the intermediates,
@@ -80,7 +83,7 @@ namespace ztd { namespace text {
 		typename _Range            = ::std::basic_string_view<code_unit_t<_FromEncoding>>,
 		typename _FromErrorHandler = __txt_detail::__careless_handler,
 		typename _ToErrorHandler = __txt_detail::__careless_handler, typename _FromState = decode_state_t<_FromEncoding>,
-		typename _ToState = encode_state_t<_ToEncoding>>
+		typename _ToState = encode_state_t<_ToEncoding>, ::std::size_t _BufferSize = 0>
 	class transcode_view {
 	public:
 		//////
@@ -88,7 +91,7 @@ namespace ztd { namespace text {
 		///
 		//////
 		using iterator = transcode_iterator<_FromEncoding, _ToEncoding, _Range, _FromErrorHandler, _ToErrorHandler,
-			_FromState, _ToState>;
+			_FromState, _ToState, _BufferSize>;
 		//////
 		/// @brief The sentinel type for this view.
 		///
@@ -42,9 +42,17 @@
 #include <ztd/text/error_handler.hpp>
 #include <ztd/text/forward.hpp>
 #include <ztd/text/is_ignorable_error_handler.hpp>
+#include <ztd/text/tag.hpp>
 
 #include <ztd/text/detail/empty_state.hpp>
 #include <ztd/text/detail/range.hpp>
+#include <ztd/text/detail/type_traits.hpp>
+#include <ztd/text/detail/reconstruct.hpp>
+#include <ztd/text/detail/one_backward.hpp>
+#include <ztd/text/detail/bulk_transcode.hpp>
+#include <ztd/text/detail/bulk_count.hpp>
+#include <ztd/text/detail/count_utf8.hpp>
+#include <ztd/text/detail/transcode_utf8_utf16.hpp>
 
 namespace ztd { namespace text {
 	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
@@ -345,6 +353,104 @@ namespace ztd { namespace text {
 					__txt_detail::__reconstruct(::std::in_place_type<_UOutputRange>, __outit, __outlast), __s,
 					encoding_error::ok);
 			}
+
+			//////
+			/// @brief Decodes the last complete unit of information in @p __input as code points and produces a
+			/// result with the input range shortened to everything before it and the output range moved past what
+			/// was written; or, produces an error.
+			///
+			/// @param[in] __input The input view to read code units from, from the back.
+			/// @param[in] __output The output view to write code points into.
+			/// @param[in] __error_handler The error handler to invoke if decoding fails.
+			/// @param[in, out] __s The necessary state information. For this encoding, the state is empty and means
+			/// very little.
+			///
+			/// @returns A ztd::text::decode_result object that contains the reconstructed input range (without the
+			/// last unit of information), reconstructed output range, error handler, and a reference to the
+			/// passed-in state.
+			///
+			/// @remarks Gives the same code points and errors as decoding forward. A lead surrogate takes the code
+			/// unit after it whatever that is, so this steps back over the lead surrogates before the last code
+			/// unit, to one that certainly starts a code point, then decodes forward from there to the end. For
+			/// well-formed input that is at most the last two code units.
+			//////
+			template <typename _InputRange, typename _OutputRange, typename _ErrorHandler>
+			static constexpr auto decode_one_backward(
+				_InputRange&& __input, _OutputRange&& __output, _ErrorHandler&& __error_handler, state& __s) {
+				using _UInputRange  = __txt_detail::__remove_cvref_t<_InputRange>;
+				using _UOutputRange = __txt_detail::__remove_cvref_t<_OutputRange>;
+				using _Result
+					= __txt_detail::__reconstruct_decode_result_t<_UInputRange, _UOutputRange, state>;
+
+				auto __init   = __txt_detail::__adl::__adl_cbegin(__input);
+				auto __inlast = __txt_detail::__adl::__adl_cend(__input);
+				if (__init == __inlast) {
+					// the empty sequence is an OK sequence
+					return _Result(::std::forward<_InputRange>(__input),
+						::std::forward<_OutputRange>(__output), __s, encoding_error::ok);
+				}
+
+				// UTF-16 is self-synchronizing: a code unit starts a code point unless the one before it is a lead
+				// surrogate which itself starts a code point
+				auto __sync_first = __txt_detail::__prev(__inlast);
+				while (__sync_first != __init) {
+					auto __lead = __txt_detail::__prev(__sync_first);
+					if (!__txt_detail::__is_lead_surrogate(
+						     static_cast<char16_t>(__txt_detail::__dereference(__lead)))) {
+						break;
+					}
+					__sync_first = __lead;
+				}
+				__self_t __self {};
+				auto __tail_first = __txt_detail::__one_backward_first<code_point, max_code_points>(
+					__self, ::std::in_place_type<_UInputRange>, __sync_first, __inlast, __s);
+				auto __tail_result = decode_one(
+					__txt_detail::__reconstruct(::std::in_place_type<_UInputRange>, __tail_first, __inlast),
+					::std::forward<_OutputRange>(__output), __txt_detail::__one_backward_probe_handler {}, __s);
+				return __txt_detail::__finish_one_backward<code_unit, max_code_units>(__self,
+					::std::in_place_type<_UInputRange>, __init, __tail_first, __inlast, ::std::move(__tail_result),
+					::std::forward<_ErrorHandler>(__error_handler), __s);
+			}
+
+			//////
+			/// @brief Encodes the last code point in @p __input as code units and produces a result with the input
+			/// range shortened to everything before it and the output range moved past what was written; or,
+			/// produces an error.
+			///
+			/// @param[in] __input The input view to read code points from, from the back.
+			/// @param[in] __output The output view to write code units into.
+			/// @param[in] __error_handler The error handler to invoke if encoding fails.
+			/// @param[in, out] __s The necessary state information. For this encoding, the state is empty and means
+			/// very little.
+			///
+			/// @returns A ztd::text::encode_result object that contains the reconstructed input range (without the
+			/// last code point), reconstructed output range, error handler, and a reference to the passed-in state.
+			//////
+			template <typename _InputRange, typename _OutputRange, typename _ErrorHandler>
+			static constexpr auto encode_one_backward(
+				_InputRange&& __input, _OutputRange&& __output, _ErrorHandler&& __error_handler, state& __s) {
+				using _UInputRange  = __txt_detail::__remove_cvref_t<_InputRange>;
+				using _UOutputRange = __txt_detail::__remove_cvref_t<_OutputRange>;
+				using _Result
+					= __txt_detail::__reconstruct_encode_result_t<_UInputRange, _UOutputRange, state>;
+
+				auto __init   = __txt_detail::__adl::__adl_cbegin(__input);
+				auto __inlast = __txt_detail::__adl::__adl_cend(__input);
+				if (__init == __inlast) {
+					// the empty sequence is an OK sequence
+					return _Result(::std::forward<_InputRange>(__input),
+						::std::forward<_OutputRange>(__output), __s, encoding_error::ok);
+				}
+
+				auto __tail_first = __txt_detail::__prev(__inlast);
+				__self_t __self {};
+				auto __tail_result = encode_one(
+					__txt_detail::__reconstruct(::std::in_place_type<_UInputRange>, __tail_first, __inlast),
+					::std::forward<_OutputRange>(__output), __txt_detail::__one_backward_probe_handler {}, __s);
+				return __txt_detail::__finish_one_backward<code_point, max_code_points>(__self,
+					::std::in_place_type<_UInputRange>, __init, __tail_first, __inlast, ::std::move(__tail_result),
+					::std::forward<_ErrorHandler>(__error_handler), __s);
+			}
 		};
 	} // namespace __impl
 
@@ -363,7 +469,75 @@ namespace ztd { namespace text {
 	/// @remarks This is a strict UTF-16 implementation that does not allow lone, unpaired surrogates either in or out.
 	//////
 	template <typename _CodeUnit, typename _CodePoint = unicode_code_point>
-	class basic_utf16 : public __impl::__utf16_with<basic_utf16<_CodeUnit, _CodePoint>, _CodeUnit, _CodePoint> { };
+	class basic_utf16 : public __impl::__utf16_with<basic_utf16<_CodeUnit, _CodePoint>, _CodeUnit, _CodePoint> {
+	public:
+		//////
+		/// @internal
+		///
+		/// @brief Extension point hooks for the implementation-side only.
+		///
+		/// @remarks Finds the first position at or after @p __candidate that does not come right after a leading
+		/// surrogate, which is the only code unit that makes @c decode_one read the one after it. The code units on
+		/// either side of that position can be decoded separately with the exact same results. Returns @p __last if
+		/// there is no such position.
+		//////
+		template <typename _CodeUnitType>
+		constexpr friend const _CodeUnitType* __text_code_unit_boundary(tag<basic_utf16>,
+			const _CodeUnitType* __first, const _CodeUnitType* __candidate, const _CodeUnitType* __last) noexcept {
+			while (__candidate != __first && __candidate != __last
+				&& __txt_detail::__is_lead_surrogate(static_cast<char16_t>(*(__candidate - 1)))) {
+				++__candidate;
+			}
+			return __candidate;
+		}
+
+		//////
+		/// @internal
+		///
+		/// @brief Extension point hooks for the implementation-side only.
+		///
+		/// @remarks Converts contiguous UTF-8 into contiguous UTF-16 in bulk. Anything the bulk conversion cannot
+		/// handle (invalid or incomplete input, not enough room in the output) goes through the usual one code point
+		/// at a time path, so error handlers and the result are the same as with ztd::text::basic_transcode_into.
+		//////
+		template <typename _Input, typename _UTF8CodeUnit, typename _UTF8CodePoint, typename _Output,
+			typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState, typename _ToState,
+			::std::enable_if_t<__txt_detail::__is_bulk_transcodable_v<_Input, sizeof(uchar8_t), _Output,
+			     sizeof(char16_t)>>* = nullptr>
+		constexpr friend auto __text_transcode(tag<basic_utf8<_UTF8CodeUnit, _UTF8CodePoint>, basic_utf16>,
+			_Input&& __input,
+			__txt_detail::__type_identity_t<const basic_utf8<_UTF8CodeUnit, _UTF8CodePoint>&> __from_encoding,
+			_Output&& __output, __txt_detail::__type_identity_t<const basic_utf16&> __to_encoding,
+			_FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler, _FromState& __from_state,
+			_ToState& __to_state) {
+			return __txt_detail::__bulk_transcode_into(
+				[](auto*& __in, auto* __in_last, auto*& __out, auto* __out_last) constexpr noexcept {
+					__txt_detail::__utf8_to_utf16(__in, __in_last, __out, __out_last);
+				},
+				::std::forward<_Input>(__input), __from_encoding, ::std::forward<_Output>(__output), __to_encoding,
+				__from_error_handler, __to_error_handler, __from_state, __to_state);
+		}
+
+		//////
+		/// @internal
+		///
+		/// @brief Extension point hooks for the implementation-side only.
+		///
+		/// @remarks Counts the UTF-16 code units that transcoding the leading valid part of contiguous UTF-8 input
+		/// produces, without calling any error handler.
+		//////
+		template <typename _Input, typename _UTF8CodeUnit, typename _UTF8CodePoint,
+			::std::enable_if_t<__txt_detail::__is_bulk_countable_v<_Input, sizeof(uchar8_t)>>* = nullptr>
+		constexpr friend auto __text_count_transcoded(tag<basic_utf8<_UTF8CodeUnit, _UTF8CodePoint>, basic_utf16>,
+			_Input&& __input, __txt_detail::__type_identity_t<const basic_utf8<_UTF8CodeUnit, _UTF8CodePoint>&>,
+			__txt_detail::__type_identity_t<const basic_utf16&>) {
+			return __txt_detail::__bulk_count_prefix(
+				[](auto*& __in, auto* __in_last) constexpr noexcept {
+					return __txt_detail::__utf8_count_utf16(__in, __in_last);
+				},
+				::std::forward<_Input>(__input));
+		}
+	};
 
 	//////
 	/// @brief A UTF-16 Encoding that traffics in char16_t. See ztd::text::basic_utf16 for more details.
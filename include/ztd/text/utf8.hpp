@@ -41,12 +41,24 @@
 #include <ztd/text/unicode_code_point.hpp>
 #include <ztd/text/is_ignorable_error_handler.hpp>
 #include <ztd/text/is_transcoding_compatible.hpp>
+#include <ztd/text/validate_result.hpp>
+#include <ztd/text/forward.hpp>
+#include <ztd/text/tag.hpp>
 
 #include <ztd/text/detail/unicode.hpp>
 #include <ztd/text/detail/empty_state.hpp>
 #include <ztd/text/detail/range.hpp>
 #include <ztd/text/detail/type_traits.hpp>
 #include <ztd/text/detail/cast.hpp>
+#include <ztd/text/detail/reconstruct.hpp>
+#include <ztd/text/detail/one_backward.hpp>
+#include <ztd/text/detail/memory.hpp>
+#include <ztd/text/detail/validate_utf8.hpp>
+#include <ztd/text/detail/bulk_transcode.hpp>
+#include <ztd/text/detail/bulk_count.hpp>
+#include <ztd/text/detail/count_utf8.hpp>
+#include <ztd/text/detail/transcode_utf8_utf16.hpp>
+#include <ztd/text/detail/transcode_utf8_utf32.hpp>
 
 #include <array>
 
@@ -466,6 +478,116 @@ namespace ztd { namespace text {
 				return _Result(__txt_detail::__reconstruct(::std::in_place_type<_UInputRange>, __init, __inlast),
 					__txt_detail::__reconstruct(::std::in_place_type<_UOutputRange>, __outit, __outlast), __s);
 			}
+
+			//////
+			/// @brief Decodes the last complete unit of information in @p __input as code points and produces a
+			/// result with the input range shortened to everything before it and the output range moved past what
+			/// was written; or, produces an error.
+			///
+			/// @param[in] __input The input view to read code units from, from the back.
+			/// @param[in] __output The output view to write code points into.
+			/// @param[in] __error_handler The error handler to invoke if decoding fails.
+			/// @param[in, out] __s The necessary state information. For this encoding, the state is empty and means
+			/// very little.
+			///
+			/// @returns A ztd::text::decode_result object that contains the reconstructed input range (without the
+			/// last unit of information), reconstructed output range, error handler, and a reference to the
+			/// passed-in state.
+			///
+			/// @remarks Gives the same code points and errors as decoding forward. A sequence that is cut short also
+			/// takes the code unit that cut it short, so this steps back over every lead byte that could have taken
+			/// the one after it, to one that certainly starts a sequence, then decodes forward from there to the
+			/// end. For well-formed input that is the start of the last sequence; ill-formed input made of nothing
+			/// but lead bytes can go back all the way to the start.
+			//////
+			template <typename _InputRange, typename _OutputRange, typename _ErrorHandler>
+			static constexpr auto decode_one_backward(
+				_InputRange&& __input, _OutputRange&& __output, _ErrorHandler&& __error_handler, state& __s) {
+				using _UInputRange  = __txt_detail::__remove_cvref_t<_InputRange>;
+				using _UOutputRange = __txt_detail::__remove_cvref_t<_OutputRange>;
+				using _Result
+					= __txt_detail::__reconstruct_decode_result_t<_UInputRange, _UOutputRange, state>;
+
+				auto __init   = __txt_detail::__adl::__adl_cbegin(__input);
+				auto __inlast = __txt_detail::__adl::__adl_cend(__input);
+				if (__init == __inlast) {
+					// the empty sequence is an OK sequence
+					return _Result(::std::forward<_InputRange>(__input),
+						::std::forward<_OutputRange>(__output), __s, encoding_error::ok);
+				}
+
+				// UTF-8 is self-synchronizing: a code unit starts a sequence unless the closest lead byte before
+				// it (past nothing but continuation bytes) is close enough to take it, and that lead byte itself
+				// starts a sequence
+				auto __sync_first = __txt_detail::__prev(__inlast);
+				while (__sync_first != __init) {
+					auto __lead                = __txt_detail::__prev(__sync_first);
+					::std::size_t __lead_reach = 1;
+					for (; __lead_reach < max_code_units && __lead != __init
+					     && __txt_detail::__utf8_is_continuation(
+					          static_cast<uchar8_t>(__txt_detail::__dereference(__lead)));
+					     ++__lead_reach) {
+						__lead = __txt_detail::__prev(__lead);
+					}
+					const uchar8_t __lead_unit = static_cast<uchar8_t>(__txt_detail::__dereference(__lead));
+					if (__txt_detail::__utf8_is_continuation(__lead_unit)
+						|| __txt_detail::__utf8_is_invalid(__lead_unit)
+						|| static_cast<::std::size_t>(__txt_detail::__sequence_length(__lead_unit))
+						     <= __lead_reach) {
+						break;
+					}
+					__sync_first = __lead;
+				}
+				__self_t __self {};
+				auto __tail_first = __txt_detail::__one_backward_first<code_point, max_code_points>(
+					__self, ::std::in_place_type<_UInputRange>, __sync_first, __inlast, __s);
+				auto __tail_result = decode_one(
+					__txt_detail::__reconstruct(::std::in_place_type<_UInputRange>, __tail_first, __inlast),
+					::std::forward<_OutputRange>(__output), __txt_detail::__one_backward_probe_handler {}, __s);
+				return __txt_detail::__finish_one_backward<code_unit, max_code_units>(__self,
+					::std::in_place_type<_UInputRange>, __init, __tail_first, __inlast, ::std::move(__tail_result),
+					::std::forward<_ErrorHandler>(__error_handler), __s);
+			}
+
+			//////
+			/// @brief Encodes the last code point in @p __input as code units and produces a result with the input
+			/// range shortened to everything before it and the output range moved past what was written; or,
+			/// produces an error.
+			///
+			/// @param[in] __input The input view to read code points from, from the back.
+			/// @param[in] __output The output view to write code units into.
+			/// @param[in] __error_handler The error handler to invoke if encoding fails.
+			/// @param[in, out] __s The necessary state information. For this encoding, the state is empty and means
+			/// very little.
+			///
+			/// @returns A ztd::text::encode_result object that contains the reconstructed input range (without the
+			/// last code point), reconstructed output range, error handler, and a reference to the passed-in state.
+			//////
+			template <typename _InputRange, typename _OutputRange, typename _ErrorHandler>
+			static constexpr auto encode_one_backward(
+				_InputRange&& __input, _OutputRange&& __output, _ErrorHandler&& __error_handler, state& __s) {
+				using _UInputRange  = __txt_detail::__remove_cvref_t<_InputRange>;
+				using _UOutputRange = __txt_detail::__remove_cvref_t<_OutputRange>;
+				using _Result
+					= __txt_detail::__reconstruct_encode_result_t<_UInputRange, _UOutputRange, state>;
+
+				auto __init   = __txt_detail::__adl::__adl_cbegin(__input);
+				auto __inlast = __txt_detail::__adl::__adl_cend(__input);
+				if (__init == __inlast) {
+					// the empty sequence is an OK sequence
+					return _Result(::std::forward<_InputRange>(__input),
+						::std::forward<_OutputRange>(__output), __s, encoding_error::ok);
+				}
+
+				auto __tail_first = __txt_detail::__prev(__inlast);
+				__self_t __self {};
+				auto __tail_result = encode_one(
+					__txt_detail::__reconstruct(::std::in_place_type<_UInputRange>, __tail_first, __inlast),
+					::std::forward<_OutputRange>(__output), __txt_detail::__one_backward_probe_handler {}, __s);
+				return __txt_detail::__finish_one_backward<code_point, max_code_points>(__self,
+					::std::in_place_type<_UInputRange>, __init, __tail_first, __inlast, ::std::move(__tail_result),
+					::std::forward<_ErrorHandler>(__error_handler), __s);
+			}
 		};
 	} // namespace __impl
 
@@ -489,7 +611,199 @@ namespace ztd { namespace text {
 	/// Java UTF-8 implementations) and other quirks, see ztd::text::basic_mutf8 or ztd::text::basic_wtf8 .
 	//////
 	template <typename _CodeUnit, typename _CodePoint = unicode_code_point>
-	class basic_utf8 : public __impl::__utf8_with<basic_utf8<_CodeUnit, _CodePoint>, _CodeUnit, _CodePoint> { };
+	class basic_utf8 : public __impl::__utf8_with<basic_utf8<_CodeUnit, _CodePoint>, _CodeUnit, _CodePoint> {
+	public:
+		//////
+		/// @internal
+		///
+		/// @brief Extension point hooks for the implementation-side only.
+		///
+		/// @remarks Validates contiguous input in bulk rather than one code point at a time. The failing position is
+		/// the same as the one given by decoding and re-encoding each code point in turn.
+		//////
+		template <typename _Input, typename _DecodeState,
+			::std::enable_if_t<__txt_detail::__is_contiguous_byte_range_v<
+			     __txt_detail::__string_view_or_span_or_reconstruct_t<_Input>>>* = nullptr>
+		constexpr friend auto __text_validate_code_units(tag<basic_utf8>, _Input&& __input,
+			__txt_detail::__type_identity_t<const basic_utf8&>, _DecodeState& __state) {
+			using _WorkingInput = __txt_detail::__string_view_or_span_or_reconstruct_t<_Input>;
+			using _Result       = validate_result<_WorkingInput, _DecodeState>;
+
+			_WorkingInput __working_input(
+				__txt_detail::__reconstruct(::std::in_place_type<_WorkingInput>, ::std::forward<_Input>(__input)));
+			auto __first         = __txt_detail::__adl::__adl_begin(__working_input);
+			auto __last          = __txt_detail::__adl::__adl_end(__working_input);
+			const auto* __pfirst = __txt_detail::__adl::__adl_to_address(__first);
+			const auto* __plast  = __pfirst + (__last - __first);
+			const auto* __pfail  = __txt_detail::__utf8_validate(__pfirst, __plast);
+			__first += (__pfail - __pfirst);
+			return _Result(__txt_detail::__reconstruct(::std::in_place_type<_WorkingInput>, ::std::move(__first),
+				               ::std::move(__last)),
+				__pfail == __plast, __state);
+		}
+
+		//////
+		/// @internal
+		///
+		/// @brief Extension point hooks for the implementation-side only.
+		///
+		/// @remarks Decodes contiguous input into contiguous output, copying runs of ASCII in bulk. The result is the
+		/// same as with ztd::text::basic_decode_into.
+		//////
+		template <typename _Input, typename _Output, typename _ErrorHandler, typename _State,
+			::std::enable_if_t<__txt_detail::__is_bulk_transcodable_v<_Input, sizeof(uchar8_t), _Output,
+			     sizeof(char32_t)>>* = nullptr>
+		constexpr friend auto __text_decode(tag<basic_utf8>, _Input&& __input,
+			__txt_detail::__type_identity_t<const basic_utf8&> __encoding, _Output&& __output,
+			_ErrorHandler&& __error_handler, _State& __state) {
+			return __txt_detail::__bulk_decode_into(
+				[](auto*& __in, auto* __in_last, auto*& __out, auto* __out_last) constexpr noexcept {
+					__txt_detail::__utf8_to_utf32(__in, __in_last, __out, __out_last);
+				},
+				::std::forward<_Input>(__input), __encoding, ::std::forward<_Output>(__output), __error_handler,
+				__state);
+		}
+
+		//////
+		/// @internal
+		///
+		/// @brief Extension point hooks for the implementation-side only.
+		///
+		/// @remarks Counts the code points in contiguous input, skipping over runs of ASCII in bulk. The result is
+		/// the same as with ztd::text::basic_count_code_units.
+		//////
+		template <typename _Input, typename _ErrorHandler, typename _State,
+			::std::enable_if_t<__txt_detail::__is_bulk_countable_v<_Input, sizeof(uchar8_t)>>* = nullptr>
+		constexpr friend auto __text_count_code_units(tag<basic_utf8>, _Input&& __input,
+			__txt_detail::__type_identity_t<const basic_utf8&> __encoding, _ErrorHandler&& __error_handler,
+			_State& __state) {
+			return __txt_detail::__bulk_count_code_units(
+				[](auto*& __in, auto* __in_last) constexpr noexcept {
+					return __txt_detail::__utf8_count_decoded(__in, __in_last);
+				},
+				::std::forward<_Input>(__input), __encoding, __error_handler, __state);
+		}
+
+		//////
+		/// @internal
+		///
+		/// @brief Extension point hooks for the implementation-side only.
+		///
+		/// @remarks Counts the code units needed for contiguous input, skipping over runs of ASCII in bulk. The
+		/// result is the same as with ztd::text::basic_count_code_points.
+		//////
+		template <typename _Input, typename _ErrorHandler, typename _State,
+			::std::enable_if_t<__txt_detail::__is_bulk_countable_v<_Input, sizeof(char32_t)>>* = nullptr>
+		constexpr friend auto __text_count_code_points(tag<basic_utf8>, _Input&& __input,
+			__txt_detail::__type_identity_t<const basic_utf8&> __encoding, _ErrorHandler&& __error_handler,
+			_State& __state) {
+			return __txt_detail::__bulk_count_code_points(
+				[](auto*& __in, auto* __in_last) constexpr noexcept {
+					return __txt_detail::__utf8_count_encoded(__in, __in_last);
+				},
+				::std::forward<_Input>(__input), __encoding, __error_handler, __state);
+		}
+
+		//////
+		/// @internal
+		///
+		/// @brief Extension point hooks for the implementation-side only.
+		///
+		/// @remarks Finds the first position at or after @p __candidate that no single call to @c decode_one
+		/// started before it can read, so that the code units on either side of it can be decoded separately with
+		/// the exact same results. A sequence is never longer than 4 code units, so only the 3 code units before a
+		/// position need to be looked at. Returns @p __last if there is no such position.
+		//////
+		template <typename _CodeUnitType>
+		constexpr friend const _CodeUnitType* __text_code_unit_boundary(tag<basic_utf8>,
+			const _CodeUnitType* __first, const _CodeUnitType* __candidate, const _CodeUnitType* __last) noexcept {
+			for (; __candidate != __last; ++__candidate) {
+				const _CodeUnitType* __lookback_first = __candidate - __first > 3 ? __candidate - 3 : __first;
+				bool __straddled                      = false;
+				for (const _CodeUnitType* __it = __lookback_first; __it != __candidate; ++__it) {
+					const uchar8_t __unit = static_cast<uchar8_t>(*__it);
+					if (__txt_detail::__utf8_is_continuation(__unit)) {
+						continue;
+					}
+					if (__txt_detail::__sequence_length(__unit) > __candidate - __it) {
+						__straddled = true;
+						break;
+					}
+				}
+				if (!__straddled) {
+					break;
+				}
+			}
+			return __candidate;
+		}
+
+		//////
+		/// @internal
+		///
+		/// @brief Extension point hooks for the implementation-side only.
+		///
+		/// @remarks Converts contiguous UTF-16 into contiguous UTF-8 in bulk. Unpaired surrogates and a lack of room
+		/// in the output go through the usual one code point at a time path, so error handlers and the result are the
+		/// same as with ztd::text::basic_transcode_into.
+		//////
+		template <typename _Input, typename _UTF16CodeUnit, typename _UTF16CodePoint, typename _Output,
+			typename _FromErrorHandler, typename _ToErrorHandler, typename _FromState, typename _ToState,
+			::std::enable_if_t<__txt_detail::__is_bulk_transcodable_v<_Input, sizeof(char16_t), _Output,
+			     sizeof(uchar8_t)>>* = nullptr>
+		constexpr friend auto __text_transcode(tag<basic_utf16<_UTF16CodeUnit, _UTF16CodePoint>, basic_utf8>,
+			_Input&& __input,
+			__txt_detail::__type_identity_t<const basic_utf16<_UTF16CodeUnit, _UTF16CodePoint>&> __from_encoding,
+			_Output&& __output, __txt_detail::__type_identity_t<const basic_utf8&> __to_encoding,
+			_FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler, _FromState& __from_state,
+			_ToState& __to_state) {
+			return __txt_detail::__bulk_transcode_into(
+				[](auto*& __in, auto* __in_last, auto*& __out, auto* __out_last) constexpr noexcept {
+					__txt_detail::__utf16_to_utf8(__in, __in_last, __out, __out_last);
+				},
+				::std::forward<_Input>(__input), __from_encoding, ::std::forward<_Output>(__output), __to_encoding,
+				__from_error_handler, __to_error_handler, __from_state, __to_state);
+		}
+
+		//////
+		/// @internal
+		///
+		/// @brief Extension point hooks for the implementation-side only.
+		///
+		/// @remarks Counts the UTF-8 code units that transcoding the leading valid part of contiguous UTF-16 input
+		/// produces, without calling any error handler.
+		//////
+		template <typename _Input, typename _UTF16CodeUnit, typename _UTF16CodePoint,
+			::std::enable_if_t<__txt_detail::__is_bulk_countable_v<_Input, sizeof(char16_t)>>* = nullptr>
+		constexpr friend auto __text_count_transcoded(tag<basic_utf16<_UTF16CodeUnit, _UTF16CodePoint>, basic_utf8>,
+			_Input&& __input, __txt_detail::__type_identity_t<const basic_utf16<_UTF16CodeUnit, _UTF16CodePoint>&>,
+			__txt_detail::__type_identity_t<const basic_utf8&>) {
+			return __txt_detail::__bulk_count_prefix(
+				[](auto*& __in, auto* __in_last) constexpr noexcept {
+					return __txt_detail::__utf16_count_utf8(__in, __in_last);
+				},
+				::std::forward<_Input>(__input));
+		}
+
+		//////
+		/// @internal
+		///
+		/// @brief Extension point hooks for the implementation-side only.
+		///
+		/// @remarks Counts the UTF-8 code units that transcoding the leading valid part of contiguous UTF-32 input
+		/// produces, without calling any error handler.
+		//////
+		template <typename _Input, typename _UTF32CodeUnit, typename _UTF32CodePoint,
+			::std::enable_if_t<__txt_detail::__is_bulk_countable_v<_Input, sizeof(char32_t)>>* = nullptr>
+		constexpr friend auto __text_count_transcoded(tag<basic_utf32<_UTF32CodeUnit, _UTF32CodePoint>, basic_utf8>,
+			_Input&& __input, __txt_detail::__type_identity_t<const basic_utf32<_UTF32CodeUnit, _UTF32CodePoint>&>,
+			__txt_detail::__type_identity_t<const basic_utf8&>) {
+			return __txt_detail::__bulk_count_prefix(
+				[](auto*& __in, auto* __in_last) constexpr noexcept {
+					return __txt_detail::__utf8_count_encoded(__in, __in_last);
+				},
+				::std::forward<_Input>(__input));
+		}
+	};
 
 	//////
 	/// @brief A UTF-8 Encoding that traffics in uchar8_t. See ztd::text::basic_utf8 for more details.
@@ -556,11 +870,10 @@ namespace ztd { namespace text {
 		: std::integral_constant<bool,
 			  (sizeof(_UTF8Unit) == sizeof(_WTF8Unit)) && (alignof(_UTF8Unit) == alignof(_WTF8Unit))> { };
 
-		template <typename _UTF8Unit, typename _UTF8Point, typename _MUTF8Unit, typename _MUTF8Point>
-		struct __is_bitwise_transcoding_compatible<basic_utf8<_UTF8Unit, _UTF8Point>,
-			basic_mutf8<_MUTF8Unit, _MUTF8Point>>
-		: std::integral_constant<bool,
-			  (sizeof(_UTF8Unit) == sizeof(_MUTF8Unit)) && (alignof(_UTF8Unit) == alignof(_MUTF8Unit))> { };
+		// Modified UTF-8 writes U+0000 as the overlong 0xC0 0x80, so nothing but itself copies bit for bit into it
+		template <typename _From, typename _MUTF8Unit, typename _MUTF8Point>
+		struct __is_bitwise_transcoding_compatible<_From, basic_mutf8<_MUTF8Unit, _MUTF8Point>>
+		: std::is_same<_From, basic_mutf8<_MUTF8Unit, _MUTF8Point>> { };
 
 	} // namespace __txt_detail
 
@@ -149,8 +149,8 @@ namespace ztd { namespace text {
 	template <typename _Input, typename _Encoding, typename _EncodeState, typename _DecodeState>
 	constexpr auto validate_code_points(
 		_Input&& __input, _Encoding&& __encoding, _EncodeState& __encode_state, _DecodeState& __decode_state) {
-		if constexpr (__txt_detail::__is_detected_v<__txt_detail::__detect_adl_text_validate_code_points, _Encoding,
-			              _Input, _EncodeState>) {
+		if constexpr (__txt_detail::__is_detected_v<__txt_detail::__detect_adl_text_validate_code_points, _Input,
+			              _Encoding, _EncodeState>) {
 			(void)__decode_state;
 			return text_validate_code_points(tag<__txt_detail::__remove_cvref_t<_Encoding>> {},
 				::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding), __encode_state);
@@ -162,7 +162,7 @@ namespace ztd { namespace text {
 				__decode_state);
 		}
 		else if constexpr (__txt_detail::__is_detected_v<
-			                   __txt_detail::__detect_adl_internal_text_validate_code_points, _Encoding, _Input,
+			                   __txt_detail::__detect_adl_internal_text_validate_code_points, _Input, _Encoding,
 			                   _EncodeState>) {
 			(void)__decode_state;
 			return __text_validate_code_points(tag<__txt_detail::__remove_cvref_t<_Encoding>> {},
@@ -195,13 +195,13 @@ namespace ztd { namespace text {
 	template <typename _Input, typename _Encoding, typename _EncodeState>
 	constexpr auto validate_code_points(_Input&& __input, _Encoding&& __encoding, _EncodeState& __encode_state) {
 		using _UEncoding = __txt_detail::__remove_cvref_t<_Encoding>;
-		if constexpr (__txt_detail::__is_detected_v<__txt_detail::__detect_adl_text_validate_code_points, _Encoding,
-			              _Input, _EncodeState>) {
+		if constexpr (__txt_detail::__is_detected_v<__txt_detail::__detect_adl_text_validate_code_points, _Input,
+			              _Encoding, _EncodeState>) {
 			return text_validate_code_points(tag<__txt_detail::__remove_cvref_t<_Encoding>> {},
 				::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding), __encode_state);
 		}
 		else if constexpr (__txt_detail::__is_detected_v<
-			                   __txt_detail::__detect_adl_internal_text_validate_code_points, _Encoding, _Input,
+			                   __txt_detail::__detect_adl_internal_text_validate_code_points, _Input, _Encoding,
 			                   _EncodeState>) {
 			return __text_validate_code_points(tag<__txt_detail::__remove_cvref_t<_Encoding>> {},
 				::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding), __encode_state);
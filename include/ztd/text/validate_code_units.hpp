@@ -147,26 +147,26 @@ namespace ztd { namespace text {
 	template <typename _Input, typename _Encoding, typename _DecodeState, typename _EncodeState>
 	constexpr auto validate_code_units(
 		_Input&& __input, _Encoding&& __encoding, _DecodeState& __decode_state, _EncodeState& __encode_state) {
-		if constexpr (__txt_detail::__is_detected_v<__txt_detail::__detect_adl_text_validate_code_units, _Encoding,
-			              _Input, _DecodeState>) {
+		if constexpr (__txt_detail::__is_detected_v<__txt_detail::__detect_adl_text_validate_code_units, _Input,
+			              _Encoding, _DecodeState>) {
 			(void)__encode_state;
 			return text_validate_code_units(tag<__txt_detail::__remove_cvref_t<_Encoding>> {},
 				::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding), __decode_state);
 		}
 		else if constexpr (__txt_detail::__is_detected_v<__txt_detail::__detect_adl_text_validate_code_units,
-			                   _Encoding, _Input, _DecodeState>) {
+			                   _Input, _Encoding, _DecodeState>) {
 			return text_validate_code_units(tag<__txt_detail::__remove_cvref_t<_Encoding>> {},
 				::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding), __decode_state,
 				__encode_state);
 		}
 		else if constexpr (__txt_detail::__is_detected_v<__txt_detail::__detect_adl_internal_text_validate_code_units,
-			                   _Encoding, _Input, _DecodeState>) {
+			                   _Input, _Encoding, _DecodeState>) {
 			(void)__encode_state;
 			return __text_validate_code_units(tag<__txt_detail::__remove_cvref_t<_Encoding>> {},
 				::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding), __decode_state);
 		}
 		else if constexpr (__txt_detail::__is_detected_v<__txt_detail::__detect_adl_internal_text_validate_code_units,
-			                   _Encoding, _Input, _DecodeState>) {
+			                   _Input, _Encoding, _DecodeState>) {
 			return __text_validate_code_units(tag<__txt_detail::__remove_cvref_t<_Encoding>> {},
 				::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding), __decode_state,
 				__encode_state);
@@ -245,13 +245,13 @@ namespace ztd { namespace text {
 	template <typename _Input, typename _Encoding, typename _DecodeState>
 	constexpr auto validate_code_units(_Input&& __input, _Encoding&& __encoding, _DecodeState& __decode_state) {
 		using _UEncoding = __txt_detail::__remove_cvref_t<_Encoding>;
-		if constexpr (__txt_detail::__is_detected_v<__txt_detail::__detect_adl_text_validate_code_units, _Encoding,
-			              _Input, _DecodeState>) {
+		if constexpr (__txt_detail::__is_detected_v<__txt_detail::__detect_adl_text_validate_code_units, _Input,
+			              _Encoding, _DecodeState>) {
 			return text_validate_code_units(tag<__txt_detail::__remove_cvref_t<_Encoding>> {},
 				::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding), __decode_state);
 		}
 		else if constexpr (__txt_detail::__is_detected_v<__txt_detail::__detect_adl_internal_text_validate_code_units,
-			                   _Encoding, _Input, _DecodeState>) {
+			                   _Input, _Encoding, _DecodeState>) {
 			return __text_validate_code_units(tag<__txt_detail::__remove_cvref_t<_Encoding>> {},
 				::std::forward<_Input>(__input), ::std::forward<_Encoding>(__encoding), __decode_state);
 		}
@@ -338,6 +338,35 @@
 	#endif
 #endif // nl_langinfo POSIX
 
+#if defined(ZTD_TEXT_EXECUTION_ICONV)
+	#if (ZTD_TEXT_EXECUTION_ICONV != 0)
+		#define ZTD_TEXT_EXECUTION_ICONV_I_ ZTD_TEXT_ON
+	#else
+		#define ZTD_TEXT_EXECUTION_ICONV_I_ ZTD_TEXT_OFF
+	#endif
+#else
+	#if ZTD_TEXT_IS_ON(ZTD_TEXT_PLATFORM_LINUX_I_) && ZTD_TEXT_HAS_INCLUDE_I_(<iconv.h>)
+		// the C library itself provides iconv here: nothing extra to link
+		#define ZTD_TEXT_EXECUTION_ICONV_I_ ZTD_TEXT_DEFAULT_ON
+	#else
+		#define ZTD_TEXT_EXECUTION_ICONV_I_ ZTD_TEXT_DEFAULT_OFF
+	#endif
+#endif // iconv from the C library, for the execution encodings
+
+#if defined(ZTD_TEXT_MEMORY_MAPPED_FILES)
+	#if (ZTD_TEXT_MEMORY_MAPPED_FILES != 0)
+		#define ZTD_TEXT_MEMORY_MAPPED_FILES_I_ ZTD_TEXT_ON
+	#else
+		#define ZTD_TEXT_MEMORY_MAPPED_FILES_I_ ZTD_TEXT_OFF
+	#endif
+#else
+	#if ZTD_TEXT_IS_ON(ZTD_TEXT_PLATFORM_UNIX_I_) && ZTD_TEXT_HAS_INCLUDE_I_(<sys/mman.h>)
+		#define ZTD_TEXT_MEMORY_MAPPED_FILES_I_ ZTD_TEXT_DEFAULT_ON
+	#else
+		#define ZTD_TEXT_MEMORY_MAPPED_FILES_I_ ZTD_TEXT_DEFAULT_OFF
+	#endif
+#endif // mmap for the file conversion functions
+
 #if defined(ZTD_TEXT_DEFAULT_HANDLER_THROWS)
 	#if (ZTD_TEXT_DEFAULT_HANDLER_THROWS != 0)
 		#define ZTD_TEXT_DEFAULT_HANDLER_THROWS_I_ ZTD_TEXT_ON
@@ -397,6 +426,42 @@
 	#endif // MSVC vs. others
 #endif // Intermediate buffer sizing
 
+#if defined(ZTD_TEXT_ANY_ENCODING_INLINE_SIZE)
+	#define ZTD_TEXT_ANY_ENCODING_INLINE_SIZE_I_ ZTD_TEXT_ANY_ENCODING_INLINE_SIZE
+#else
+	// room for the erased wrapper's virtual table pointer plus a few pointers' worth of
+	// encoding or state, which covers the Unicode encodings and most locale-based states
+	#define ZTD_TEXT_ANY_ENCODING_INLINE_SIZE_I_ (sizeof(void*) * 4)
+#endif // any_encoding inline storage sizing
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+	#define ZTD_TEXT_ARCHITECTURE_X86_I_ ZTD_TEXT_ON
+#else
+	#define ZTD_TEXT_ARCHITECTURE_X86_I_ ZTD_TEXT_OFF
+#endif // x86 and x86_64 architectures
+
+#if defined(ZTD_TEXT_SIMD)
+	#if (ZTD_TEXT_SIMD != 0)
+		#define ZTD_TEXT_SIMD_I_ ZTD_TEXT_ON
+	#else
+		#define ZTD_TEXT_SIMD_I_ ZTD_TEXT_OFF
+	#endif
+#elif ZTD_TEXT_IS_ON(ZTD_TEXT_ARCHITECTURE_X86_I_) && ZTD_TEXT_IS_ON(ZTD_TEXT_COMPILER_GCC_I_)
+	#define ZTD_TEXT_SIMD_I_ ZTD_TEXT_DEFAULT_ON
+#else
+	#define ZTD_TEXT_SIMD_I_ ZTD_TEXT_DEFAULT_OFF
+#endif // Vectorized bulk kernels
+
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_SIMD_I_) && ZTD_TEXT_IS_ON(ZTD_TEXT_ARCHITECTURE_X86_I_) && ZTD_TEXT_IS_ON(ZTD_TEXT_COMPILER_GCC_I_)
+	// Per-function instruction set selection, so that kernels can be compiled for
+	// wider instruction sets than the rest of the translation unit and picked at run time
+	#define ZTD_TEXT_SIMD_X86_I_ ZTD_TEXT_ON
+	#define ZTD_TEXT_TARGET_I_(...) __attribute__((target(__VA_ARGS__)))
+#else
+	#define ZTD_TEXT_SIMD_X86_I_ ZTD_TEXT_OFF
+	#define ZTD_TEXT_TARGET_I_(...)
+#endif // x86 vector kernels
+
 #if defined (__has_cpp_attribute) && (__has_cpp_attribute(nodiscard) != 0L)
 	#if __has_cpp_attribute(nodiscard) >= 201907L
 		#define ZTD_TEXT_NODISCARD_MESSAGE_I_(__message) [[nodiscard(__message)]]
@@ -591,6 +656,17 @@
 	#define ZTD_TEXT_STD_LIBRARY_SPAN_I_ ZTD_TEXT_DEFAULT_OFF
 #endif
 
+#if defined(ZTD_TEXT_STD_LIBRARY_EXECUTION)
+	#if (ZTD_TEXT_STD_LIBRARY_EXECUTION != 0)
+		#define ZTD_TEXT_STD_LIBRARY_EXECUTION_I_ ZTD_TEXT_ON
+	#else
+		#define ZTD_TEXT_STD_LIBRARY_EXECUTION_I_ ZTD_TEXT_OFF
+	#endif
+#else
+	// opt-in only: <execution> can need a library (e.g. TBB for libstdc++) linked into every program that includes it
+	#define ZTD_TEXT_STD_LIBRARY_EXECUTION_I_ ZTD_TEXT_DEFAULT_OFF
+#endif
+
 #if defined (ZTD_TEXT_UNICODE_CODE_POINT_DISTINCT_TYPE)
 	#if (ZTD_TEXT_UNICODE_CODE_POINT_DISTINCT_TYPE != 0)
 		#define ZTD_TEXT_UNICODE_CODE_POINT_DISTINCT_TYPE_I_ ZTD_TEXT_ON
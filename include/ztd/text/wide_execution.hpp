@@ -36,12 +36,14 @@
 #include <ztd/text/version.hpp>
 
 #include <ztd/text/execution.hpp>
+#include <ztd/text/utf32.hpp>
 #include <ztd/text/c_string_view.hpp>
 #include <ztd/text/encode_result.hpp>
 #include <ztd/text/decode_result.hpp>
 #include <ztd/text/error_handler.hpp>
 #include <ztd/text/unicode_code_point.hpp>
 #include <ztd/text/is_ignorable_error_handler.hpp>
+#include <ztd/text/tag.hpp>
 
 #include <ztd/text/detail/empty_state.hpp>
 #include <ztd/text/detail/windows.hpp>
@@ -49,6 +51,8 @@
 #include <ztd/text/detail/type_traits.hpp>
 #include <ztd/text/detail/span.hpp>
 #include <ztd/text/detail/progress_handler.hpp>
+#include <ztd/text/detail/unicode.hpp>
+#include <ztd/text/detail/bulk_transcode.hpp>
 
 #include <cuchar>
 #include <cwchar>
@@ -58,6 +62,87 @@
 namespace ztd { namespace text {
 	ZTD_TEXT_INLINE_ABI_NAMESPACE_OPEN_I_
 
+	namespace __txt_detail {
+		//////
+		/// @brief Whether @c wchar_t always holds ISO 10646 code points, whatever the locale. Wide execution text is
+		/// then the code points themselves, limited to those the locale can represent.
+		//////
+		inline constexpr bool __is_wide_execution_iso10646_v =
+#if ZTD_TEXT_IS_OFF(ZTD_TEXT_PLATFORM_WINDOWS_I_) && ZTD_TEXT_IS_OFF(ZTD_TEXT_LOCALE_DEPENDENT_WIDE_EXECUTION_I_) \
+     && ZTD_TEXT_IS_ON(ZTD_TEXT_WCHAR_T_UTF32_COMPATIBLE_I_) && (WCHAR_MAX > 0x001FFFFF)
+			true;
+#else
+			false;
+#endif
+
+		//////
+		/// @brief Whether wide execution text is plain UTF-32 right now: @c wchar_t holds ISO 10646 code points
+		/// and the locale is UTF-8, so every code point converts to and from it.
+		//////
+		inline bool __is_active_wide_code_page_utf32() noexcept {
+			return __is_wide_execution_iso10646_v && __is_active_code_page_utf8();
+		}
+
+		//////
+		/// @brief The bulk conversions the wide execution encoding can use for the current locale, looked up once
+		/// per call of a bulk extension point.
+		//////
+		class __wide_execution_bulk {
+		public:
+			//////
+			/// @brief Converts code points into @c wchar_t or back. In a UTF-8 locale that is a copy which stops at
+			/// the first value that is not a Unicode scalar value; otherwise the values go through the locale's
+			/// encoding just like one-at-a-time conversion does.
+			//////
+			template <typename _InUnit, typename _OutUnit>
+			void __copy(const _InUnit*& __in, const _InUnit* __in_last, _OutUnit*& __out,
+				_OutUnit* __out_last) const noexcept {
+				if constexpr (__is_wide_execution_iso10646_v) {
+					if (!_M_execution.__is_utf8()) {
+						_M_execution.__round_trip(__in, __in_last, __out, __out_last);
+						return;
+					}
+					if ((__out_last - __out) < (__in_last - __in)) {
+						__in_last = __in + (__out_last - __out);
+					}
+					for (; __in != __in_last; ++__in, ++__out) {
+						const char32_t __code_point = static_cast<char32_t>(*__in);
+						if (__code_point > __last_code_point || __is_surrogate(__code_point)) {
+							return;
+						}
+						*__out = static_cast<_OutUnit>(__code_point);
+					}
+				}
+				else {
+					(void)__in;
+					(void)__in_last;
+					(void)__out;
+					(void)__out_last;
+				}
+			}
+
+			//////
+			/// @brief Converts execution text into @c wchar_t directly, as that is the same as decoding it.
+			//////
+			template <typename _InUnit, typename _OutUnit>
+			void __from_execution(const _InUnit*& __in, const _InUnit* __in_last, _OutUnit*& __out,
+				_OutUnit* __out_last) const noexcept {
+				if constexpr (__is_wide_execution_iso10646_v) {
+					_M_execution.__decode(__in, __in_last, __out, __out_last);
+				}
+				else {
+					(void)__in;
+					(void)__in_last;
+					(void)__out;
+					(void)__out_last;
+				}
+			}
+
+		private:
+			__execution_bulk _M_execution;
+		};
+	} // namespace __txt_detail
+
 	//////
 	/// @addtogroup ztd_text_encodings Encodings
 	/// @{
@@ -70,7 +155,9 @@ namespace ztd { namespace text {
 	/// not defined, this object may use the C Standard Library to perform transcoding if certain platform facilities
 	/// are disabled or not available. If this is the case, the C Standard Library has fundamental limitations which
 	/// may treat your UTF-16 data like UCS-2, and result in broken input/output. This object uses UTF-16 directly on
-	/// Windows when possible to avoid some of the platform-specific shenanigans.
+	/// Windows when possible to avoid some of the platform-specific shenanigans. Elsewhere, when @c wchar_t holds
+	/// ISO 10646 code points and the locale is UTF-8, this object treats wide text as UTF-32 directly. As with
+	/// ztd::text::execution, call ztd::text::refresh_execution_encoding after changing the locale.
 	//////
 	class wide_execution {
 	public:
@@ -188,7 +275,7 @@ namespace ztd { namespace text {
 			// When we do, it'll go in the detail/posix.hpp !
 			return false;
 #else
-			return false;
+			return __txt_detail::__is_active_wide_code_page_utf32();
 #endif
 		}
 
@@ -242,6 +329,29 @@ namespace ztd { namespace text {
 			}
 			return _Result(::std::move(__result.input), ::std::move(__result.output), __s, __result.error_code);
 #else
+			if (__txt_detail::__is_active_wide_code_page_utf32()) {
+				// wchar_t holds the code points themselves: go straight to UTF-32
+				using __wide_utf32 = __impl::__utf32_with<void, code_unit, code_point>;
+				__wide_utf32 __u32enc {};
+				encode_state_t<__wide_utf32> __intermediate_s {};
+				__txt_detail::__progress_handler<!__call_error_handler, wide_execution> __intermediate_handler {};
+				auto __intermediate_result = __u32enc.encode_one(::std::forward<_InputRange>(__input),
+					::std::forward<_OutputRange>(__output), __intermediate_handler, __intermediate_s);
+				if constexpr (__call_error_handler) {
+					if (__intermediate_result.error_code != encoding_error::ok) {
+						wide_execution __self {};
+						return __error_handler(__self,
+							_Result(::std::move(__intermediate_result.input),
+							     ::std::move(__intermediate_result.output), __s,
+							     __intermediate_result.error_code),
+							::ztd::text::span<code_point>(__intermediate_handler._M_code_points.data(),
+							     __intermediate_handler._M_code_points_size));
+					}
+				}
+				return _Result(::std::move(__intermediate_result.input), ::std::move(__intermediate_result.output),
+					__s, __intermediate_result.error_code);
+			}
+
 			auto __init   = __txt_detail::__adl::__adl_cbegin(__input);
 			auto __inlast = __txt_detail::__adl::__adl_cend(__input);
 
@@ -254,6 +364,16 @@ namespace ztd { namespace text {
 			auto __outit   = __txt_detail::__adl::__adl_begin(__output);
 			auto __outlast = __txt_detail::__adl::__adl_end(__output);
 
+			if constexpr (__call_error_handler) {
+				if (__outit == __outlast) {
+					wide_execution __self {};
+					return __error_handler(__self,
+						_Result(::std::forward<_InputRange>(__input), ::std::forward<_OutputRange>(__output), __s,
+						     encoding_error::insufficient_output_space),
+						::ztd::text::span<code_point, 0>());
+				}
+			}
+
 			constexpr const ::std::size_t __state_max = 32;
 			char __pray_for_state[__state_max + 1] {};
 			char* __pray_start = &__pray_for_state[0];
@@ -367,6 +487,28 @@ namespace ztd { namespace text {
 			return _Result(::std::move(__result.input), ::std::move(__result.output), __s, __result.error_code,
 				__result.handled_errors);
 #else
+			if (__txt_detail::__is_active_wide_code_page_utf32()) {
+				// wchar_t holds the code points themselves: go straight to UTF-32
+				using __wide_utf32 = __impl::__utf32_with<void, code_unit, code_point>;
+				__wide_utf32 __u32enc {};
+				decode_state_t<__wide_utf32> __intermediate_s {};
+				__txt_detail::__progress_handler<!__call_error_handler, wide_execution> __intermediate_handler {};
+				auto __intermediate_result = __u32enc.decode_one(::std::forward<_InputRange>(__input),
+					::std::forward<_OutputRange>(__output), __intermediate_handler, __intermediate_s);
+				if constexpr (__call_error_handler) {
+					if (__intermediate_result.error_code != encoding_error::ok) {
+						wide_execution __self {};
+						return __error_handler(__self,
+							_Result(::std::move(__intermediate_result.input),
+							     ::std::move(__intermediate_result.output), __s,
+							     __intermediate_result.error_code),
+							::ztd::text::span<code_unit>(__intermediate_handler._M_code_units.data(),
+							     __intermediate_handler._M_code_units_size));
+					}
+				}
+				return _Result(::std::move(__intermediate_result.input), ::std::move(__intermediate_result.output),
+					__s, __intermediate_result.error_code);
+			}
 
 			auto __init   = __txt_detail::__adl::__adl_cbegin(__input);
 			auto __inlast = __txt_detail::__adl::__adl_cend(__input);
@@ -481,6 +623,85 @@ namespace ztd { namespace text {
 				::std::move(__result.output), __s, __result.error_code);
 #endif
 		}
+
+		//////
+		/// @internal
+		///
+		/// @brief Extension point hooks for the implementation-side only.
+		///
+		/// @remarks When @c wchar_t holds ISO 10646 code points, decodes contiguous input into contiguous output in
+		/// bulk: a plain copy in a UTF-8 locale, or a round trip of whole buffers through the locale's encoding with
+		/// @c iconv otherwise (if available). The result is the same as with ztd::text::basic_decode_into.
+		//////
+		template <typename _Input, typename _Output, typename _ErrorHandler, typename _State,
+			::std::enable_if_t<(sizeof(code_unit) == sizeof(char32_t))
+			     && __txt_detail::__is_bulk_transcodable_v<_Input, sizeof(code_unit), _Output,
+			          sizeof(char32_t)>>* = nullptr>
+		friend auto __text_decode(tag<wide_execution>, _Input&& __input,
+			__txt_detail::__type_identity_t<const wide_execution&> __encoding, _Output&& __output,
+			_ErrorHandler&& __error_handler, _State& __state) {
+			const __txt_detail::__wide_execution_bulk __bulk {};
+			return __txt_detail::__bulk_decode_into(
+				[&__bulk](auto*& __in, auto* __in_last, auto*& __out, auto* __out_last) noexcept {
+					__bulk.__copy(__in, __in_last, __out, __out_last);
+				},
+				::std::forward<_Input>(__input), __encoding, ::std::forward<_Output>(__output), __error_handler,
+				__state);
+		}
+
+		//////
+		/// @internal
+		///
+		/// @brief Extension point hooks for the implementation-side only.
+		///
+		/// @remarks When @c wchar_t holds ISO 10646 code points, encodes contiguous input into contiguous output in
+		/// bulk: a plain copy in a UTF-8 locale, or a round trip of whole buffers through the locale's encoding with
+		/// @c iconv otherwise (if available). The result is the same as with ztd::text::basic_encode_into.
+		//////
+		template <typename _Input, typename _Output, typename _ErrorHandler, typename _State,
+			::std::enable_if_t<(sizeof(code_unit) == sizeof(char32_t))
+			     && __txt_detail::__is_bulk_transcodable_v<_Input, sizeof(char32_t), _Output,
+			          sizeof(code_unit)>>* = nullptr>
+		friend auto __text_encode(tag<wide_execution>, _Input&& __input,
+			__txt_detail::__type_identity_t<const wide_execution&> __encoding, _Output&& __output,
+			_ErrorHandler&& __error_handler, _State& __state) {
+			const __txt_detail::__wide_execution_bulk __bulk {};
+			return __txt_detail::__bulk_encode_into(
+				[&__bulk](auto*& __in, auto* __in_last, auto*& __out, auto* __out_last) noexcept {
+					__bulk.__copy(__in, __in_last, __out, __out_last);
+				},
+				::std::forward<_Input>(__input), __encoding, ::std::forward<_Output>(__output), __error_handler,
+				__state);
+		}
+
+		//////
+		/// @internal
+		///
+		/// @brief Extension point hooks for the implementation-side only.
+		///
+		/// @remarks When @c wchar_t holds ISO 10646 code points, converts contiguous execution input into contiguous
+		/// wide execution output with the execution encoding's bulk decoding, as every code point it produces can be
+		/// stored as is. Anything else goes through the usual one code point at a time path, so error handlers and
+		/// the result are the same as with ztd::text::basic_transcode_into.
+		//////
+		template <typename _Input, typename _Output, typename _FromErrorHandler, typename _ToErrorHandler,
+			typename _FromState, typename _ToState,
+			::std::enable_if_t<(sizeof(code_unit) == sizeof(char32_t))
+			     && __txt_detail::__is_bulk_transcodable_v<_Input, sizeof(char), _Output,
+			          sizeof(code_unit)>>* = nullptr>
+		friend auto __text_transcode(tag<execution, wide_execution>, _Input&& __input,
+			__txt_detail::__type_identity_t<const execution&> __from_encoding, _Output&& __output,
+			__txt_detail::__type_identity_t<const wide_execution&> __to_encoding,
+			_FromErrorHandler&& __from_error_handler, _ToErrorHandler&& __to_error_handler, _FromState& __from_state,
+			_ToState& __to_state) {
+			const __txt_detail::__wide_execution_bulk __bulk {};
+			return __txt_detail::__bulk_transcode_into(
+				[&__bulk](auto*& __in, auto* __in_last, auto*& __out, auto* __out_last) noexcept {
+					__bulk.__from_execution(__in, __in_last, __out, __out_last);
+				},
+				::std::forward<_Input>(__input), __from_encoding, ::std::forward<_Output>(__output), __to_encoding,
+				__from_error_handler, __to_error_handler, __from_state, __to_state);
+		}
 	};
 
 	//////
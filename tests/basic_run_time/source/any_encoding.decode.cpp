@@ -31,6 +31,9 @@
 #include <ztd/text/encoding_scheme.hpp>
 #include <ztd/text/any_encoding.hpp>
 #include <ztd/text/decode.hpp>
+#include <ztd/text/validate_code_units.hpp>
+#include <ztd/text/count_code_units.hpp>
+#include <ztd/text/transcode.hpp>
 #include <ztd/text/c_string_view.hpp>
 
 #include <catch2/catch.hpp>
@@ -38,6 +41,8 @@
 #include <ztd/text/tests/basic_unicode_strings.hpp>
 
 #include <algorithm>
+#include <string>
+#include <vector>
 
 TEST_CASE("text/decode/any_encoding/encoding_scheme", "decode from byte arrays with specific endianness") {
 	const auto& expected0 = ztd::text::tests::u32_basic_source_character_set;
@@ -246,3 +251,158 @@ TEST_CASE("text/decode/any_encoding/encoding_scheme", "decode from byte arrays w
 		}
 	}
 }
+
+TEST_CASE("text/decode/any_encoding/bulk",
+	"decode, validate, count, and transcode through an any_encoding give the same results as going one at a time") {
+	using ztd::text::uchar8_t;
+	const auto& truth = ztd::text::tests::u8_unicode_sequence_truth_native_endian;
+	const std::basic_string<uchar8_t> valid(truth.begin(), truth.end());
+	std::basic_string<uchar8_t> invalid = valid;
+	invalid.insert(invalid.size() / 2, 1, static_cast<uchar8_t>(0xFF));
+
+	const std::basic_string<uchar8_t>* const inputs[] = { &valid, &invalid };
+
+	ztd::text::any_encoding encoding(ztd::text::utf8 {});
+	for (const std::basic_string<uchar8_t>* input_storage : inputs) {
+		ztd::text::span<const std::byte> input(
+		     reinterpret_cast<const std::byte*>(input_storage->data()), input_storage->size());
+		for (std::size_t output_size : { input.size(), input.size() / 3 }) {
+			std::vector<char32_t> output_storage(output_size, char32_t {});
+			std::vector<char32_t> expected_output_storage(output_size, char32_t {});
+			ztd::text::any_encoding::decode_state state(encoding);
+			ztd::text::any_encoding::decode_state expected_state(encoding);
+			auto result   = ztd::text::decode_into(input, encoding, ztd::text::span<char32_t>(output_storage),
+                    ztd::text::replacement_handler {}, state);
+			auto expected = ztd::text::basic_decode_into(input, encoding,
+			     ztd::text::span<char32_t>(expected_output_storage), ztd::text::replacement_handler {},
+			     expected_state);
+			REQUIRE(result.error_code == expected.error_code);
+			REQUIRE(result.input.size() == expected.input.size());
+			REQUIRE(result.output.size() == expected.output.size());
+			REQUIRE(output_storage == expected_output_storage);
+		}
+		{
+			ztd::text::any_encoding::decode_state state(encoding);
+			auto result   = ztd::text::validate_code_units(input, encoding, state);
+			auto expected = ztd::text::validate_code_units(
+			     std::basic_string_view<uchar8_t>(*input_storage), ztd::text::utf8 {});
+			REQUIRE(result.valid == (input_storage == &valid));
+			REQUIRE(result.valid == expected.valid);
+			REQUIRE(result.input.size() == expected.input.size());
+		}
+		{
+			ztd::text::any_encoding::decode_state state(encoding);
+			ztd::text::utf8 expected_encoding {};
+			auto expected_state = ztd::text::make_decode_state(expected_encoding);
+			auto result   = ztd::text::count_code_units(input, encoding, ztd::text::pass_handler {}, state);
+			auto expected = ztd::text::count_code_units(std::basic_string_view<uchar8_t>(*input_storage),
+			     expected_encoding, ztd::text::pass_handler {}, expected_state);
+			REQUIRE(result.error_code == expected.error_code);
+			REQUIRE(result.count == expected.count);
+			REQUIRE(result.input.size() == expected.input.size());
+		}
+	}
+	// transcoding works a chunk at a time with copies of the type-erased states, and redoes a chunk one step at a
+	// time when the output runs out
+	ztd::text::utf16 to_encoding {};
+	const std::u16string expected_output = ztd::text::transcode(
+	     std::basic_string_view<uchar8_t>(valid), ztd::text::utf8 {}, to_encoding);
+	ztd::text::span<const std::byte> input(reinterpret_cast<const std::byte*>(valid.data()), valid.size());
+	for (std::size_t output_size : { expected_output.size(), expected_output.size() / 3 }) {
+		std::u16string output(output_size, u'\0');
+		ztd::text::any_encoding::decode_state from_state(encoding);
+		auto to_state = ztd::text::make_encode_state(to_encoding);
+		auto result   = ztd::text::transcode_into(input, encoding, ztd::text::span<char16_t>(output), to_encoding,
+               ztd::text::replacement_handler {}, ztd::text::replacement_handler {}, from_state, to_state);
+		const std::size_t written = output_size - result.output.size();
+		REQUIRE(written + 1 >= output_size);
+		REQUIRE(output.substr(0, written) == expected_output.substr(0, written));
+		REQUIRE(result.error_code
+		     == (output_size == expected_output.size() ? ztd::text::encoding_error::ok
+		                                               : ztd::text::encoding_error::insufficient_output_space));
+	}
+}
+
+TEST_CASE("text/transcode/any_encoding/direct",
+	"transcoding between two any_encodings gives the same results as going one at a time, whether or not the "
+	"wrapped encodings can transcode into one another directly") {
+	using ztd::text::uchar8_t;
+	const auto& truth = ztd::text::tests::u8_unicode_sequence_truth_native_endian;
+	const std::basic_string<uchar8_t> valid(truth.begin(), truth.end());
+	std::basic_string<uchar8_t> invalid = valid;
+	invalid.insert(invalid.size() / 2, 1, static_cast<uchar8_t>(0xFF));
+	const std::u16string valid16 = ztd::text::transcode(
+	     std::basic_string_view<uchar8_t>(valid), ztd::text::utf8 {}, ztd::text::utf16 {});
+	const auto& basic_source     = ztd::text::tests::u8_basic_source_character_set;
+	const std::basic_string<uchar8_t> ascii(basic_source.begin(), basic_source.end());
+
+	auto check = [](ztd::text::span<const std::byte> input, ztd::text::any_encoding& from_encoding,
+	                  ztd::text::any_encoding& to_encoding) {
+		// output sizes are kept to a whole number of UTF-32 code units
+		const std::size_t full_size = input.size() * 4;
+		for (std::size_t output_size : { full_size, (input.size() / 3) & ~std::size_t(3), std::size_t(0) }) {
+			std::vector<std::byte> output_storage(full_size, std::byte {});
+			std::vector<std::byte> expected_output_storage(full_size, std::byte {});
+			ztd::text::any_encoding::decode_state from_state(from_encoding);
+			ztd::text::any_encoding::encode_state to_state(to_encoding);
+			ztd::text::any_encoding::decode_state expected_from_state(from_encoding);
+			ztd::text::any_encoding::encode_state expected_to_state(to_encoding);
+			auto result   = ztd::text::transcode_into(input, from_encoding,
+                    ztd::text::span<std::byte>(output_storage.data(), output_size), to_encoding,
+                    ztd::text::replacement_handler {}, ztd::text::pass_handler {}, from_state, to_state);
+			auto expected = ztd::text::basic_transcode_into(input, from_encoding,
+			     ztd::text::span<std::byte>(expected_output_storage.data(), output_size), to_encoding,
+			     ztd::text::replacement_handler {}, ztd::text::pass_handler {}, expected_from_state,
+			     expected_to_state);
+			REQUIRE(result.error_code == expected.error_code);
+			REQUIRE(result.handled_errors == expected.handled_errors);
+			REQUIRE(result.input.size() == expected.input.size());
+			REQUIRE(result.output.size() == expected.output.size());
+			const std::size_t written = output_size - result.output.size();
+			REQUIRE(std::equal(
+			     output_storage.data(), output_storage.data() + written, expected_output_storage.data()));
+		}
+	};
+
+	ztd::text::span<const std::byte> valid_input(reinterpret_cast<const std::byte*>(valid.data()), valid.size());
+	ztd::text::span<const std::byte> invalid_input(
+	     reinterpret_cast<const std::byte*>(invalid.data()), invalid.size());
+	ztd::text::span<const std::byte> valid16_input(
+	     reinterpret_cast<const std::byte*>(valid16.data()), valid16.size() * sizeof(char16_t));
+	ztd::text::span<const std::byte> ascii_input(reinterpret_cast<const std::byte*>(ascii.data()), ascii.size());
+	SECTION("utf8 to utf16") {
+		ztd::text::any_encoding from_encoding(ztd::text::utf8 {});
+		ztd::text::any_encoding to_encoding(ztd::text::utf16 {});
+		check(valid_input, from_encoding, to_encoding);
+		check(invalid_input, from_encoding, to_encoding);
+	}
+	SECTION("utf16 to utf8") {
+		ztd::text::any_encoding from_encoding(ztd::text::utf16 {});
+		ztd::text::any_encoding to_encoding(ztd::text::utf8 {});
+		check(valid16_input, from_encoding, to_encoding);
+	}
+	SECTION("utf8 to utf32") {
+		ztd::text::any_encoding from_encoding(ztd::text::utf8 {});
+		ztd::text::any_encoding to_encoding(ztd::text::utf32 {});
+		check(valid_input, from_encoding, to_encoding);
+		check(invalid_input, from_encoding, to_encoding);
+	}
+	SECTION("utf8 to utf8") {
+		ztd::text::any_encoding from_encoding(ztd::text::utf8 {});
+		ztd::text::any_encoding to_encoding(ztd::text::utf8 {});
+		check(valid_input, from_encoding, to_encoding);
+		check(invalid_input, from_encoding, to_encoding);
+	}
+	SECTION("ascii to utf8") {
+		ztd::text::any_encoding from_encoding(ztd::text::ascii {});
+		ztd::text::any_encoding to_encoding(ztd::text::utf8 {});
+		check(ascii_input, from_encoding, to_encoding);
+		check(valid_input, from_encoding, to_encoding);
+	}
+	SECTION("utf8 to ascii (no direct transcode)") {
+		ztd::text::any_encoding from_encoding(ztd::text::utf8 {});
+		ztd::text::any_encoding to_encoding(ztd::text::ascii {});
+		check(ascii_input, from_encoding, to_encoding);
+		check(valid_input, from_encoding, to_encoding);
+	}
+}
@@ -31,12 +31,16 @@
 #include <ztd/text/encoding_scheme.hpp>
 #include <ztd/text/any_encoding.hpp>
 #include <ztd/text/encode.hpp>
+#include <ztd/text/validate_code_points.hpp>
+#include <ztd/text/count_code_points.hpp>
 
 #include <catch2/catch.hpp>
 
 #include <ztd/text/tests/basic_unicode_strings.hpp>
 
 #include <algorithm>
+#include <string>
+#include <vector>
 
 TEST_CASE("text/encode/any_encoding/encoding_scheme", "encode to byte arrays through any_encoding interface") {
 	const auto& input0 = ztd::text::tests::u32_basic_source_character_set;
@@ -176,3 +180,56 @@ TEST_CASE("text/encode/any_encoding/encoding_scheme", "encode to byte arrays thr
 		}
 	}
 }
+
+TEST_CASE("text/encode/any_encoding/bulk",
+	"encode, validate, and count through an any_encoding give the same results as going one at a time") {
+	const auto& truth = ztd::text::tests::u32_unicode_sequence_truth_native_endian;
+	const std::u32string valid(truth.begin(), truth.end());
+	std::u32string invalid = valid;
+	invalid.insert(invalid.size() / 2, 1, static_cast<char32_t>(0xD800));
+
+	const std::u32string* const inputs[] = { &valid, &invalid };
+
+	ztd::text::any_encoding encoding(ztd::text::utf16 {});
+	for (const std::u32string* input_storage : inputs) {
+		ztd::text::span<const char32_t> input(input_storage->data(), input_storage->size());
+		{
+			const std::size_t output_size = input.size() * 4;
+			std::vector<std::byte> output_storage(output_size, std::byte {});
+			std::vector<std::byte> expected_output_storage(output_size, std::byte {});
+			ztd::text::any_encoding::encode_state state(encoding);
+			ztd::text::any_encoding::encode_state expected_state(encoding);
+			auto result   = ztd::text::encode_into(input, encoding, ztd::text::span<std::byte>(output_storage),
+                    ztd::text::replacement_handler {}, state);
+			auto expected = ztd::text::basic_encode_into(input, encoding,
+			     ztd::text::span<std::byte>(expected_output_storage), ztd::text::replacement_handler {},
+			     expected_state);
+			REQUIRE(result.error_code == expected.error_code);
+			REQUIRE(result.input.size() == expected.input.size());
+			REQUIRE(result.output.size() == expected.output.size());
+			REQUIRE(output_storage == expected_output_storage);
+		}
+		{
+			ztd::text::any_encoding::encode_state state(encoding);
+			auto result   = ztd::text::validate_code_points(input, encoding, state);
+			auto expected = ztd::text::validate_code_points(input, ztd::text::utf16 {});
+			REQUIRE(result.valid == (input_storage == &valid));
+			REQUIRE(result.valid == expected.valid);
+			REQUIRE(result.input.data() == expected.input.data());
+			REQUIRE(result.input.size() == expected.input.size());
+		}
+		{
+			ztd::text::any_encoding::encode_state state(encoding);
+			ztd::text::utf16 expected_encoding {};
+			auto expected_state = ztd::text::make_encode_state(expected_encoding);
+			auto result   = ztd::text::count_code_points(input, encoding, ztd::text::pass_handler {}, state);
+			auto expected = ztd::text::count_code_points(
+			     input, expected_encoding, ztd::text::pass_handler {}, expected_state);
+			REQUIRE(result.error_code == expected.error_code);
+			// the any_encoding counts bytes, not UTF-16 code units
+			REQUIRE(result.count == expected.count * sizeof(char16_t));
+			REQUIRE(result.input.data() == expected.input.data());
+			REQUIRE(result.input.size() == expected.input.size());
+		}
+	}
+}
@@ -0,0 +1,143 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+#include <ztd/text/basic_transcoding_streambuf.hpp>
+#include <ztd/text/transcode.hpp>
+#include <ztd/text/encoding.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+TEST_CASE("text/basic_transcoding_streambuf",
+	"a transcoding stream buffer reads and writes the same text as transcoding all at once, for any buffer size") {
+	const std::string_view utf8_input = "Hello, \xC3\xA9\xC3\xA8! \xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82 "
+	                                    "\xE4\xBD\xA0\xE5\xA5\xBD \xF0\x9F\x98\x80\xF0\x9F\x91\x8D end";
+	const std::u16string expected     = ztd::text::transcode_to<std::u16string>(utf8_input, ztd::text::utf8 {},
+          ztd::text::utf16 {}, ztd::text::replacement_handler {}, ztd::text::replacement_handler {})
+	                                    .output;
+
+	SECTION("get") {
+		for (std::size_t buffer_size : { 1, 7, 64, 8192 }) {
+			for (std::size_t read_size : { 1, 3, 100 }) {
+				std::stringbuf bytes { std::string(utf8_input) };
+				ztd::text::basic_transcoding_streambuf<ztd::text::utf8, ztd::text::utf16> streambuf(&bytes,
+					ztd::text::utf8 {}, ztd::text::utf16 {}, ztd::text::default_handler {}, buffer_size);
+				std::u16string output;
+				char16_t read_buffer[100] {};
+				for (;;) {
+					std::streamsize read = streambuf.sgetn(read_buffer, static_cast<std::streamsize>(read_size));
+					output.append(read_buffer, static_cast<std::size_t>(read));
+					if (read < static_cast<std::streamsize>(read_size)) {
+						break;
+					}
+				}
+				REQUIRE(output == expected);
+			}
+		}
+	}
+	SECTION("put") {
+		for (std::size_t buffer_size : { 1, 7, 64, 8192 }) {
+			for (std::size_t write_size : { 1, 3, 100 }) {
+				std::stringbuf bytes;
+				{
+					ztd::text::basic_transcoding_streambuf<ztd::text::utf8, ztd::text::utf16> streambuf(&bytes,
+						ztd::text::utf8 {}, ztd::text::utf16 {}, ztd::text::default_handler {}, buffer_size);
+					for (std::size_t position = 0; position < expected.size(); position += write_size) {
+						std::size_t size = std::min(write_size, expected.size() - position);
+						REQUIRE(streambuf.sputn(expected.data() + position, static_cast<std::streamsize>(size))
+							== static_cast<std::streamsize>(size));
+						// flushing in the middle of a surrogate pair holds it back until the rest of it arrives
+						REQUIRE(streambuf.pubsync() == 0);
+					}
+				}
+				REQUIRE(bytes.str() == utf8_input);
+			}
+		}
+	}
+	SECTION("invalid input") {
+		const std::string_view bad_input  = "a\xFF"
+		                                    "b\xE2\x82";
+		const std::u16string bad_expected = ztd::text::transcode_to<std::u16string>(bad_input, ztd::text::utf8 {},
+			ztd::text::utf16 {}, ztd::text::replacement_handler {}, ztd::text::replacement_handler {})
+		                                        .output;
+		{
+			std::stringbuf bytes { std::string(bad_input) };
+			ztd::text::basic_transcoding_streambuf<ztd::text::utf8, ztd::text::utf16, char16_t,
+				std::char_traits<char16_t>, ztd::text::replacement_handler>
+				streambuf(&bytes, ztd::text::utf8 {}, ztd::text::utf16 {}, ztd::text::replacement_handler {}, 1);
+			std::u16string output;
+			for (auto ch = streambuf.sbumpc(); ch != std::char_traits<char16_t>::eof(); ch = streambuf.sbumpc()) {
+				output.push_back(std::char_traits<char16_t>::to_char_type(ch));
+			}
+			REQUIRE(output == bad_expected);
+		}
+		{
+			std::stringbuf bytes { std::string(bad_input) };
+			ztd::text::basic_transcoding_streambuf<ztd::text::utf8, ztd::text::utf16, char16_t,
+				std::char_traits<char16_t>, ztd::text::pass_handler>
+				streambuf(&bytes);
+			REQUIRE(streambuf.sbumpc() == u'a');
+			REQUIRE(streambuf.sbumpc() == std::char_traits<char16_t>::eof());
+		}
+	}
+	SECTION("execution to wide_execution with iostreams") {
+		std::stringbuf bytes { "hello 42 world\nsecond line\n" };
+		ztd::text::basic_transcoding_streambuf<ztd::text::execution, ztd::text::wide_execution> streambuf(
+			&bytes, ztd::text::execution {}, ztd::text::wide_execution {}, ztd::text::default_handler {}, 4);
+		std::wistream input(&streambuf);
+		std::wstring word;
+		int number = 0;
+		input >> word >> number;
+		REQUIRE(word == L"hello");
+		REQUIRE(number == 42);
+		input >> std::ws;
+		std::getline(input, word);
+		REQUIRE(word == L"world");
+		std::getline(input, word);
+		REQUIRE(word == L"second line");
+
+		std::stringbuf output_bytes;
+		{
+			ztd::text::basic_transcoding_streambuf<ztd::text::execution, ztd::text::wide_execution> output_streambuf(
+				&output_bytes);
+			std::wostream output(&output_streambuf);
+			output << L"hello " << 42 << L" world" << std::endl;
+			REQUIRE(output_bytes.str() == "hello 42 world\n");
+			output << L"unflushed";
+		}
+		REQUIRE(output_bytes.str() == "hello 42 world\nunflushed");
+	}
+}
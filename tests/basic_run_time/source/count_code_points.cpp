@@ -34,6 +34,9 @@
 
 #include <ztd/text/tests/basic_unicode_strings.hpp>
 
+#include <string>
+#include <string_view>
+
 TEST_CASE("text/count_code_points/core", "basic usages of count_code_points function do not explode") {
 	SECTION("execution") {
 		ztd::text::execution encoding {};
@@ -135,3 +138,31 @@ TEST_CASE("text/count_code_points/core", "basic usages of count_code_points func
 		REQUIRE(result1.count == expected1);
 	}
 }
+
+TEST_CASE("text/count_code_points/utf8 ascii runs", "counting UTF-8 with ASCII runs matches one-by-one counting") {
+	const char32_t non_ascii[] = {
+		U'\xE9',     // 2 code units
+		U'\x20AC',   // 3 code units
+		U'\x1F600',  // 4 code units
+		U'\xD800',   // surrogate
+		U'\x110000', // too large
+	};
+	for (std::size_t run_size = 0; run_size < 80; ++run_size) {
+		const std::u32string run(run_size, U'a');
+		for (char32_t middle : non_ascii) {
+			std::u32string input = run;
+			input += middle;
+			input += run;
+			ztd::text::compat_utf8 encoding {};
+			ztd::text::replacement_handler handler {};
+			auto expected_state = ztd::text::make_encode_state(encoding);
+			auto result_state   = ztd::text::make_encode_state(encoding);
+			auto expected
+			     = ztd::text::basic_count_code_points(std::u32string_view(input), encoding, handler, expected_state);
+			auto result = ztd::text::count_code_points(std::u32string_view(input), encoding, handler, result_state);
+			REQUIRE(result.error_code == expected.error_code);
+			REQUIRE(result.count == expected.count);
+			REQUIRE(result.input.data() == expected.input.data());
+		}
+	}
+}
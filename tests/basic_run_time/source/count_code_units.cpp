@@ -34,6 +34,9 @@
 
 #include <ztd/text/tests/basic_unicode_strings.hpp>
 
+#include <string>
+#include <string_view>
+
 TEST_CASE("text/count_code_units/core", "basic usages of count_code_units function do not explode") {
 	std::size_t expected0 = std::size(ztd::text::tests::u32_basic_source_character_set);
 	std::size_t expected1 = std::size(ztd::text::tests::u32_unicode_sequence_truth_native_endian);
@@ -123,3 +126,31 @@ TEST_CASE("text/count_code_units/core", "basic usages of count_code_units functi
 		REQUIRE(result1.count == expected1);
 	}
 }
+
+TEST_CASE("text/count_code_units/utf8 ascii runs", "counting UTF-8 with ASCII runs matches one-by-one counting") {
+	const std::string_view non_ascii[] = {
+		"\xC3\xA9",         // 2 bytes
+		"\xF0\x9F\x98\x80", // 4 bytes
+		"\x80",             // lone continuation
+		"\xE2\x82",         // missing continuation
+		"\xFF",             // invalid lead
+	};
+	for (std::size_t run_size = 0; run_size < 80; ++run_size) {
+		const std::string run(run_size, 'a');
+		for (const std::string_view& middle : non_ascii) {
+			std::string input = run;
+			input += middle;
+			input += run;
+			ztd::text::compat_utf8 encoding {};
+			ztd::text::replacement_handler handler {};
+			auto expected_state = ztd::text::make_decode_state(encoding);
+			auto result_state   = ztd::text::make_decode_state(encoding);
+			auto expected
+			     = ztd::text::basic_count_code_units(std::string_view(input), encoding, handler, expected_state);
+			auto result = ztd::text::count_code_units(std::string_view(input), encoding, handler, result_state);
+			REQUIRE(result.error_code == expected.error_code);
+			REQUIRE(result.count == expected.count);
+			REQUIRE(result.input.data() == expected.input.data());
+		}
+	}
+}
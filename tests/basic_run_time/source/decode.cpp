@@ -36,6 +36,33 @@
 
 #include <ztd/text/tests/basic_unicode_strings.hpp>
 
+#include <string>
+#include <string_view>
+#include <vector>
+
+inline namespace ztd_text_tests_basic_run_time_decode {
+	template <typename Encoding, typename Char>
+	void decode_position_check(std::basic_string_view<Char> input, std::size_t output_size) {
+		Encoding encoding {};
+		ztd::text::replacement_handler handler {};
+		std::vector<char32_t> expected_storage(output_size);
+		std::vector<char32_t> result_storage(output_size);
+		auto expected_state = ztd::text::make_decode_state(encoding);
+		auto result_state   = ztd::text::make_decode_state(encoding);
+
+		auto expected = ztd::text::basic_decode_into(
+		     input, encoding, ztd::text::span<char32_t>(expected_storage), handler, expected_state);
+		auto result = ztd::text::decode_into(
+		     input, encoding, ztd::text::span<char32_t>(result_storage), handler, result_state);
+		REQUIRE(result.error_code == expected.error_code);
+		REQUIRE(result.handled_errors == expected.handled_errors);
+		REQUIRE(result.input.data() == expected.input.data());
+		REQUIRE(result.input.size() == expected.input.size());
+		REQUIRE(result.output.size() == expected.output.size());
+		REQUIRE(result_storage == expected_storage);
+	}
+} // namespace ztd_text_tests_basic_run_time_decode
+
 TEST_CASE("text/decode/core", "basic usages of decode function do not explode") {
 	SECTION("execution") {
 		ztd::text::execution encoding {};
@@ -123,3 +150,49 @@ TEST_CASE("text/decode/core", "basic usages of decode function do not explode")
 		REQUIRE(result1 == ztd::text::tests::u32_unicode_sequence_truth_native_endian);
 	}
 }
+
+TEST_CASE("text/decode/utf8 ascii runs", "decoding UTF-8 with ASCII runs matches one-by-one decoding") {
+	const std::string_view non_ascii[] = {
+		"\xC3\xA9",         // 2 bytes
+		"\xF0\x9F\x98\x80", // 4 bytes
+		"\x80",             // lone continuation
+		"\xE2\x82",         // missing continuation
+		"\xFF",             // invalid lead
+	};
+	for (std::size_t run_size = 0; run_size < 80; ++run_size) {
+		const std::string run(run_size, 'a');
+		for (const std::string_view& middle : non_ascii) {
+			std::string input = run;
+			input += middle;
+			input += run;
+			for (std::size_t output_size : { input.size(), run_size / 2, run_size + 1 }) {
+				decode_position_check<ztd::text::compat_utf8>(std::string_view(input), output_size);
+				decode_position_check<ztd::text::execution>(std::string_view(input), output_size);
+			}
+		}
+	}
+}
+
+TEST_CASE("text/decode/output sizing",
+	"every output sizing strategy for container-returning decodes produces the same result") {
+	const std::string_view inputs[] = { "", "abc", "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80z", "ab\xC3(cd",
+		"abc\xF0\x9F", "\xFF\xFE" };
+	ztd::text::compat_utf8 encoding {};
+	ztd::text::replacement_handler handler {};
+	for (const std::string_view& input : inputs) {
+		auto expected_state = ztd::text::make_decode_state(encoding);
+		auto expected       = ztd::text::decode_to<std::u32string>(
+		     input, encoding, handler, expected_state, ztd::text::output_sizing::incremental);
+		for (ztd::text::output_sizing sizing : { ztd::text::output_sizing::automatic,
+		          ztd::text::output_sizing::exact, ztd::text::output_sizing::upper_bound }) {
+			auto result_state = ztd::text::make_decode_state(encoding);
+			auto result = ztd::text::decode_to<std::u32string>(input, encoding, handler, result_state, sizing);
+			REQUIRE(result.error_code == expected.error_code);
+			REQUIRE(result.input.size() == expected.input.size());
+			REQUIRE(result.output == expected.output);
+			auto plain_state     = ztd::text::make_decode_state(encoding);
+			std::u32string plain = ztd::text::decode(input, encoding, handler, plain_state, sizing);
+			REQUIRE(plain == expected.output);
+		}
+	}
+}
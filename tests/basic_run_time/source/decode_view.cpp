@@ -29,11 +29,100 @@
 // ============================================================================>
 
 #include <ztd/text/decode_view.hpp>
+#include <ztd/text/decode.hpp>
 
 #include <catch2/catch.hpp>
 
 #include <ztd/text/tests/basic_unicode_strings.hpp>
 
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+
+struct counting_replacement_handler {
+	std::size_t* calls;
+
+	template <typename... Args>
+	constexpr auto operator()(Args&&... args) const {
+		++*calls;
+		return ztd::text::replacement_handler {}(std::forward<Args>(args)...);
+	}
+};
+
+template <typename Encoding, typename Input, typename Expected>
+void check_reverse_decode_view(const Input& input, const Expected& expected_output) {
+	ztd::text::decode_view<Encoding> result0_view(input);
+	auto result0_it         = result0_view.rbegin();
+	const auto result0_last = result0_view.rend();
+	auto truth0_it          = std::crbegin(expected_output);
+	const auto truth0_last  = std::crend(expected_output);
+	for (; result0_it != result0_last; ++result0_it, (void)++truth0_it) {
+		REQUIRE(truth0_it != truth0_last);
+		const auto truth0_val  = *truth0_it;
+		const auto result0_val = *result0_it;
+		REQUIRE(truth0_val == result0_val);
+	}
+	REQUIRE(truth0_it == truth0_last);
+}
+
+template <typename Encoding, typename Input>
+void check_reverse_matches_forward(Input input) {
+	ztd::text::decode_view<Encoding, Input> input_view(input);
+	std::u32string forward;
+	for (auto it = input_view.begin(); it != input_view.end(); ++it) {
+		forward.push_back(*it);
+	}
+	std::u32string reverse;
+	for (auto it = input_view.rbegin(); it != input_view.rend(); ++it) {
+		reverse.push_back(*it);
+	}
+	REQUIRE(std::u32string(forward.crbegin(), forward.crend()) == reverse);
+	// stepping forward then back again from any position gives back what was there
+	auto it = input_view.begin();
+	for (std::size_t index = 0; index < forward.size(); ++index, ++it) {
+		REQUIRE(*std::prev(std::next(it)) == forward[index]);
+	}
+}
+
+template <typename Encoding, typename Input, std::size_t PieceCount>
+void check_reverse_matches_forward_pieces(const Input (&pieces)[PieceCount], std::size_t max_pieces) {
+	using Char = typename Input::value_type;
+	// every way of putting up to max_pieces pieces together
+	std::size_t combinations = 1;
+	for (std::size_t piece_count = 0; piece_count <= max_pieces; ++piece_count, combinations *= PieceCount) {
+		for (std::size_t combination = 0; combination < combinations; ++combination) {
+			std::basic_string<Char> input;
+			for (std::size_t index = 0, rest = combination; index < piece_count; ++index, rest /= PieceCount) {
+				input += pieces[rest % PieceCount];
+			}
+			check_reverse_matches_forward<Encoding>(Input(input));
+		}
+	}
+}
+
+template <std::size_t BufferSize>
+void check_buffered_decode_view(std::string_view input) {
+	using Encoding = ztd::text::compat_utf8;
+	std::size_t expected_calls = 0;
+	std::u32string expected = ztd::text::decode(input, Encoding {}, counting_replacement_handler { &expected_calls });
+	std::size_t calls       = 0;
+	using DecodeRange       = ztd::text::decode_view<Encoding, std::string_view, counting_replacement_handler,
+	     ztd::text::decode_state_t<Encoding>, BufferSize>;
+	DecodeRange result_view(input, Encoding {}, counting_replacement_handler { &calls });
+	std::u32string result;
+	auto result_it = result_view.begin();
+	for (const auto result_last = result_view.end(); result_it != result_last; ++result_it) {
+		result.push_back(*result_it);
+		// the underlying range never lags behind what has been read so far
+		REQUIRE(static_cast<std::size_t>(result_it.base().data() - input.data()) >= result.size());
+	}
+	REQUIRE(result == expected);
+	REQUIRE(calls == expected_calls);
+	REQUIRE(result_it.base().empty());
+}
+
 template <typename Encoding, typename Input, typename Expected>
 void check_decode_view(const Input& input, const Expected& expected_output) {
 	ztd::text::decode_view<Encoding> result0_view(input);
@@ -109,3 +198,74 @@ TEST_CASE("text/decode_view/basic", "basic usages of decode_view type do not exp
 		     ztd::text::tests::u32_unicode_sequence_truth_native_endian);
 	}
 }
+
+TEST_CASE("text/decode_view/buffered", "buffered decode_views produce the same code points and errors") {
+	const std::string_view pieces[]
+	     = { "a", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80", "\x80", "\xE2\x82", "\xFF" };
+	for (std::size_t length : { 0, 1, 7, 63, 64, 65, 300 }) {
+		std::string input;
+		for (std::size_t index = 0; index < length; ++index) {
+			input += pieces[(index * 5 + length) % 7];
+		}
+		check_buffered_decode_view<1>(input);
+		check_buffered_decode_view<5>(input);
+		check_buffered_decode_view<64>(input);
+	}
+}
+
+TEST_CASE("text/decode_view/reverse", "decode_views over the UTF encodings can be gone through backwards") {
+	SECTION("utf8") {
+		check_reverse_decode_view<ztd::text::utf8>(
+		     ztd::text::tests::u8_basic_source_character_set, ztd::text::tests::u32_basic_source_character_set);
+		check_reverse_decode_view<ztd::text::utf8>(ztd::text::tests::u8_unicode_sequence_truth_native_endian,
+		     ztd::text::tests::u32_unicode_sequence_truth_native_endian);
+	}
+	SECTION("utf16") {
+		check_reverse_decode_view<ztd::text::utf16>(
+		     ztd::text::tests::u16_basic_source_character_set, ztd::text::tests::u32_basic_source_character_set);
+		check_reverse_decode_view<ztd::text::utf16>(ztd::text::tests::u16_unicode_sequence_truth_native_endian,
+		     ztd::text::tests::u32_unicode_sequence_truth_native_endian);
+	}
+	SECTION("utf32") {
+		check_reverse_decode_view<ztd::text::utf32>(
+		     ztd::text::tests::u32_basic_source_character_set, ztd::text::tests::u32_basic_source_character_set);
+		check_reverse_decode_view<ztd::text::utf32>(ztd::text::tests::u32_unicode_sequence_truth_native_endian,
+		     ztd::text::tests::u32_unicode_sequence_truth_native_endian);
+	}
+	SECTION("ill-formed") {
+		check_reverse_decode_view<ztd::text::compat_utf8>(
+		     std::string_view("a\x80" "b\xC3"), std::u32string_view(U"a\uFFFDb\uFFFD"));
+		check_reverse_decode_view<ztd::text::utf16>(
+		     std::u16string_view(u"\xDC00" "a\xD800"), std::u32string_view(U"\uFFFDa\uFFFD"));
+		// a sequence cut short takes the code unit that cut it short with it, going either way
+		check_reverse_decode_view<ztd::text::compat_utf8>(
+		     std::string_view("\x1E\xE4\xB8\x12\x41"), std::u32string_view(U"\x1E\uFFFD\x41"));
+		check_reverse_decode_view<ztd::text::utf16>(std::u16string_view(u"\x0041\xD800\x0042\xDC00\x0043"),
+		     std::u32string_view(U"\x41\uFFFD\uFFFD\x43"));
+	}
+	SECTION("ill-formed, same as forward") {
+		const std::string_view u8_pieces[]
+		     = { "a", "\x12", "\xC3", "\xA9", "\xE4", "\xB8", "\xF0", "\x9F", "\xFF", "\xE2\x82\xAC" };
+		check_reverse_matches_forward_pieces<ztd::text::compat_utf8>(u8_pieces, 4);
+		const std::u16string_view u16_pieces[]
+		     = { u"a", u"\xD800", u"\xDBFF", u"\xDC00", u"\xDFFF", u"\xD83D\xDE00" };
+		check_reverse_matches_forward_pieces<ztd::text::utf16>(u16_pieces, 5);
+		// nothing but lead bytes: the first one decides how all the rest group together
+		check_reverse_matches_forward<ztd::text::compat_utf8>(std::string_view("\xE4\xE4\xE4\xE4\xE4\xE4\xE4"));
+		check_reverse_matches_forward<ztd::text::compat_utf8>(
+		     std::string_view("a\xF0\xE4\xC3\xE4\xF0\xC3\xE4\xB8"));
+		check_reverse_matches_forward<ztd::text::utf16>(std::u16string_view(u"\xD800\xD800\xD800\xD800\xDC00"));
+	}
+	SECTION("trailing whitespace") {
+		std::u8string_view input = u8"héllo, w\U0001F30Drld \t \n";
+		ztd::text::decode_view<ztd::text::utf8> input_view(input);
+		auto it = input_view.rbegin();
+		for (; it != input_view.rend() && (*it == U' ' || *it == U'\t' || *it == U'\n'); ++it) {
+		}
+		REQUIRE(*it == U'd');
+		REQUIRE(it.base().base() == input.substr(input.size() - 4));
+		auto before_end = std::prev(it.base());
+		REQUIRE(*before_end == U'd');
+		REQUIRE(*std::next(before_end, 1) == U' ');
+	}
+}
@@ -0,0 +1,157 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#include <ztd/text/detail/cpu_dispatch.hpp>
+#include <ztd/text/detail/skip_ascii.hpp>
+#include <ztd/text/detail/validate_utf8.hpp>
+#include <ztd/text/detail/transcode_utf8_utf16.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+inline namespace ztd_text_tests_basic_run_time_detail_cpu_dispatch {
+	// mostly ASCII, with some 2, 3 and 4 byte sequences, and the occasional invalid byte
+	std::string make_utf8(std::mt19937& rng, std::size_t size, bool invalid) {
+		const std::string pieces[] = { "a", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80" };
+		std::string result;
+		while (result.size() < size) {
+			const std::size_t choice = rng() % 16;
+			result += pieces[choice < 10 ? 0 : (choice % 4)];
+		}
+		if (invalid && !result.empty()) {
+			result[rng() % result.size()] = static_cast<char>(0x80 | (rng() % 0x80));
+		}
+		return result;
+	}
+
+	std::u16string make_utf16(std::mt19937& rng, std::size_t size, bool invalid) {
+		const std::u16string pieces[] = { u"a", u"é", u"€", u"\U0001F600" };
+		std::u16string result;
+		while (result.size() < size) {
+			const std::size_t choice = rng() % 16;
+			result += pieces[choice < 10 ? 0 : (choice % 4)];
+		}
+		if (invalid && !result.empty()) {
+			result[rng() % result.size()] = static_cast<char16_t>(0xD800 + (rng() % 0x800));
+		}
+		return result;
+	}
+} // namespace ztd_text_tests_basic_run_time_detail_cpu_dispatch
+
+TEST_CASE("text/detail/cpu_dispatch/names", "tiers can be named for the ZTD_TEXT_FORCE_ISA override") {
+	using ztd::text::__txt_detail::__isa;
+	__isa value = __isa::__scalar;
+	REQUIRE(ztd::text::__txt_detail::__isa_from_name("avx2", value));
+	REQUIRE(value == __isa::__avx2);
+	REQUIRE(ztd::text::__txt_detail::__isa_from_name("sse4.2", value));
+	REQUIRE(value == __isa::__sse4_2);
+	REQUIRE(ztd::text::__txt_detail::__isa_from_name("sse2", value));
+	REQUIRE(value == __isa::__sse2);
+	REQUIRE(ztd::text::__txt_detail::__isa_from_name("scalar", value));
+	REQUIRE(value == __isa::__scalar);
+	REQUIRE_FALSE(ztd::text::__txt_detail::__isa_from_name("avx512", value));
+	REQUIRE(value == __isa::__scalar);
+	REQUIRE(ztd::text::__txt_detail::__cpu_isa() <= ztd::text::__txt_detail::__detect_isa());
+}
+
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_SIMD_X86_I_)
+TEST_CASE("text/detail/cpu_dispatch/kernels", "every kernel tier this processor supports matches the scalar code") {
+	namespace txt_detail = ztd::text::__txt_detail;
+	const std::size_t supported = static_cast<std::size_t>(txt_detail::__detect_isa());
+	std::mt19937 rng(0x5EED);
+	for (std::size_t tier = 0; tier <= supported; ++tier) {
+		for (std::size_t size = 0; size < 300; size += 7) {
+			for (int invalid = 0; invalid < 2; ++invalid) {
+				const std::string utf8                = make_utf8(rng, size, invalid != 0);
+				const unsigned char* const utf8_first = reinterpret_cast<const unsigned char*>(utf8.data());
+				const unsigned char* const utf8_last  = utf8_first + utf8.size();
+
+				const unsigned char* const skipped
+				     = txt_detail::__skip_ascii_kernels<1>[tier](utf8_first, utf8_last);
+				REQUIRE(txt_detail::__skip_ascii_scalar(utf8_first, skipped) == skipped);
+				REQUIRE(txt_detail::__skip_ascii_scalar(skipped, utf8_last)
+				     == txt_detail::__skip_ascii_scalar(utf8_first, utf8_last));
+
+				REQUIRE(txt_detail::__utf8_validate_kernels[tier](utf8_first, utf8_last)
+				     == txt_detail::__utf8_validate_scalar(utf8_first, utf8_last));
+
+				{
+					std::vector<char16_t> output(utf8.size() + 1);
+					std::vector<char16_t> expected_output(utf8.size() + 1);
+					const unsigned char* in = utf8_first;
+					char16_t* out           = output.data();
+					txt_detail::__utf8_to_utf16_kernels[tier](in, utf8_last, out, output.data() + output.size());
+					const unsigned char* expected_in = utf8_first;
+					char16_t* expected_out           = expected_output.data();
+					REQUIRE(txt_detail::__utf8_to_utf16_scalar(expected_in, in, utf8_last, expected_out,
+					     expected_output.data() + expected_output.size()));
+					REQUIRE(expected_in == in);
+					REQUIRE(std::u16string(output.data(), out)
+					     == std::u16string(expected_output.data(), expected_out));
+				}
+
+				const std::u16string utf16        = make_utf16(rng, size, invalid != 0);
+				const char16_t* const utf16_first = utf16.data();
+				const char16_t* const utf16_last  = utf16_first + utf16.size();
+				const unsigned char* const utf16_bytes_first
+				     = reinterpret_cast<const unsigned char*>(utf16_first);
+				const unsigned char* const utf16_bytes_last = reinterpret_cast<const unsigned char*>(utf16_last);
+
+				const unsigned char* const skipped16
+				     = txt_detail::__skip_ascii_kernels<2>[tier](utf16_bytes_first, utf16_bytes_last);
+				REQUIRE((skipped16 - utf16_bytes_first) % 2 == 0);
+				const char16_t* const skipped16_units = utf16_first + (skipped16 - utf16_bytes_first) / 2;
+				REQUIRE(txt_detail::__skip_ascii_scalar(utf16_first, skipped16_units) == skipped16_units);
+				REQUIRE(txt_detail::__skip_ascii_scalar(skipped16_units, utf16_last)
+				     == txt_detail::__skip_ascii_scalar(utf16_first, utf16_last));
+
+				{
+					std::vector<unsigned char> output(utf16.size() * 3 + 1);
+					std::vector<unsigned char> expected_output(utf16.size() * 3 + 1);
+					const char16_t* in = utf16_first;
+					unsigned char* out = output.data();
+					txt_detail::__utf16_to_utf8_kernels[tier](in, utf16_last, out, output.data() + output.size());
+					const char16_t* expected_in = utf16_first;
+					unsigned char* expected_out = expected_output.data();
+					REQUIRE(txt_detail::__utf16_to_utf8_scalar(expected_in, in, utf16_last, expected_out,
+					     expected_output.data() + expected_output.size()));
+					REQUIRE(expected_in == in);
+					REQUIRE(std::vector<unsigned char>(output.data(), out)
+					     == std::vector<unsigned char>(expected_output.data(), expected_out));
+				}
+			}
+		}
+	}
+}
+#endif
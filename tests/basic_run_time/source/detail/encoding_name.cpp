@@ -32,6 +32,85 @@
 
 #include <catch2/catch.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+
+inline namespace ztd_text_tests_basic_run_time_detail_encoding_name {
+	// hash-and-displace, as described on __encoding_alias_seeds: each name is hashed once, the names are spread
+	// into buckets with seed 0, and then each bucket (largest first) searches for the seed which sends all of its
+	// names to free slots
+	inline bool build_alias_hash_tables(
+		std::size_t table_size, std::vector<std::uint_least16_t>& seeds, std::vector<std::size_t>& slots) {
+		constexpr std::size_t max_seed = 1u << 16;
+		const std::size_t name_count   = ztd::text::__txt_detail::__encoding_aliases_size;
+		const std::size_t mask         = table_size - 1;
+		std::vector<std::uint_least64_t> hashes(name_count);
+		std::vector<std::vector<std::size_t>> buckets(table_size);
+		for (std::size_t index = 0; index < name_count; ++index) {
+			hashes[index] = ztd::text::__txt_detail::__encoding_name_hash(
+				ztd::text::__txt_detail::__encoding_aliases[index]._M_name);
+			buckets[ztd::text::__txt_detail::__encoding_name_index(hashes[index], 0, mask)].push_back(index);
+		}
+		std::vector<std::size_t> bucket_order(table_size);
+		for (std::size_t bucket = 0; bucket < table_size; ++bucket) {
+			bucket_order[bucket] = bucket;
+		}
+		std::stable_sort(bucket_order.begin(), bucket_order.end(), [&buckets](std::size_t left, std::size_t right) {
+			return buckets[left].size() > buckets[right].size();
+		});
+		seeds.assign(table_size, 0);
+		slots.assign(table_size, name_count);
+		for (std::size_t bucket : bucket_order) {
+			const std::vector<std::size_t>& names = buckets[bucket];
+			if (names.empty()) {
+				break;
+			}
+			std::size_t seed = 1;
+			for (; seed < max_seed; ++seed) {
+				std::size_t placed = 0;
+				for (; placed < names.size(); ++placed) {
+					std::size_t slot = ztd::text::__txt_detail::__encoding_name_index(
+						hashes[names[placed]], static_cast<std::uint_least32_t>(seed), mask);
+					if (slots[slot] != name_count) {
+						break;
+					}
+					slots[slot] = names[placed];
+				}
+				if (placed == names.size()) {
+					break;
+				}
+				// undo what this seed managed to place before running into a taken slot
+				for (std::size_t undo = 0; undo < placed; ++undo) {
+					slots[ztd::text::__txt_detail::__encoding_name_index(
+						hashes[names[undo]], static_cast<std::uint_least32_t>(seed), mask)]
+						= name_count;
+				}
+			}
+			if (seed == max_seed) {
+				return false;
+			}
+			seeds[bucket] = static_cast<std::uint_least16_t>(seed);
+		}
+		return true;
+	}
+
+	template <typename _Value>
+	inline std::string format_alias_hash_table(const std::vector<_Value>& values) {
+		std::string text = "{";
+		for (std::size_t index = 0; index < values.size(); ++index) {
+			text += (index % 16 == 0) ? "\n\t\t\t" : " ";
+			text += std::to_string(values[index]);
+			text += ",";
+		}
+		text += "\n\t\t}";
+		return text;
+	}
+} // namespace ztd_text_tests_basic_run_time_detail_encoding_name
+
 TEST_CASE("text/detail/encoding_name", "Ensure that basic usages of the encoding_name comparison works") {
 	REQUIRE(ztd::text::__txt_detail::__is_unicode_encoding_name("UTF-8"));
 	REQUIRE(ztd::text::__txt_detail::__is_unicode_encoding_name("UTF-16"));
@@ -63,4 +142,54 @@ TEST_CASE("text/detail/encoding_name", "Ensure that basic usages of the encoding
 	REQUIRE(ztd::text::__txt_detail::__is_unicode_encoding_name("g    B     18  ____0 30"));
 	REQUIRE(ztd::text::__txt_detail::__is_unicode_encoding_name("cesu8"));
 	REQUIRE(ztd::text::__txt_detail::__is_unicode_encoding_name("UTF---------1"));
+	REQUIRE_FALSE(ztd::text::__txt_detail::__is_unicode_encoding_name("ASCII"));
+	REQUIRE_FALSE(ztd::text::__txt_detail::__is_unicode_encoding_name("UTF-8-but-not-really"));
+	REQUIRE_FALSE(ztd::text::__txt_detail::__is_unicode_encoding_name(""));
+}
+
+TEST_CASE("text/detail/encoding_name/id", "names and their aliases all find the right encoding id") {
+	using ztd::text::__txt_detail::__encoding_id;
+	using ztd::text::__txt_detail::__to_encoding_id;
+	SECTION("every alias") {
+		for (const auto& alias : ztd::text::__txt_detail::__encoding_aliases) {
+			REQUIRE(__to_encoding_id(alias._M_name) == alias._M_id);
+		}
+	}
+	SECTION("spelling") {
+		REQUIRE(__to_encoding_id("utf8") == __encoding_id::__utf8);
+		REQUIRE(__to_encoding_id(" Utf_8 ") == __encoding_id::__utf8);
+		REQUIRE(__to_encoding_id("us-ascii") == __encoding_id::__ascii);
+		REQUIRE(__to_encoding_id("ucs-2le") == __encoding_id::__utf16le);
+		REQUIRE(__to_encoding_id("UTF-32be") == __encoding_id::__utf32be);
+		REQUIRE(__to_encoding_id("zwxyv") == __encoding_id::__unknown);
+	}
+	SECTION("no prefixes") {
+		REQUIRE(__to_encoding_id("UTF-16") == __encoding_id::__utf16);
+		REQUIRE(__to_encoding_id("UTF-16LE") == __encoding_id::__utf16le);
+		REQUIRE(__to_encoding_id("UTF-7") == __encoding_id::__utf7);
+		REQUIRE(__to_encoding_id("UTF-7-IMAP") == __encoding_id::__utf7imap);
+		REQUIRE(__to_encoding_id("UTF") == __encoding_id::__unknown);
+		REQUIRE(__to_encoding_id("UTF-8X") == __encoding_id::__unknown);
+		REQUIRE(__to_encoding_id("") == __encoding_id::__unknown);
+		REQUIRE(__to_encoding_id("--") == __encoding_id::__unknown);
+	}
+	SECTION("compile-time") {
+		static_assert(__to_encoding_id("UTF-8") == __encoding_id::__utf8);
+		static_assert(__to_encoding_id("ANSI_X3.4-1968") == __encoding_id::__ascii);
+		static_assert(__to_encoding_id("not an encoding") == __encoding_id::__unknown);
+	}
+}
+TEST_CASE("text/detail/encoding_name/hash", "the checked-in alias hash tables are the ones the aliases generate") {
+	std::vector<std::uint_least16_t> seeds;
+	std::vector<std::size_t> slots;
+	REQUIRE(build_alias_hash_tables(ztd::text::__txt_detail::__encoding_alias_table_size, seeds, slots));
+	std::vector<std::uint_least16_t> checked_in_seeds(std::begin(ztd::text::__txt_detail::__encoding_alias_seeds),
+		std::end(ztd::text::__txt_detail::__encoding_alias_seeds));
+	std::vector<std::size_t> checked_in_slots(std::begin(ztd::text::__txt_detail::__encoding_alias_slots),
+		std::end(ztd::text::__txt_detail::__encoding_alias_slots));
+	if (seeds != checked_in_seeds || slots != checked_in_slots) {
+		FAIL("the alias hash tables are out of date; the new seeds are\n"
+			<< format_alias_hash_table(seeds) << "\nand the new slots are\n"
+			<< format_alias_hash_table(slots));
+	}
 }
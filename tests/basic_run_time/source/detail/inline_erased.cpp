@@ -0,0 +1,188 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+#include <ztd/text/detail/inline_erased.hpp>
+#include <ztd/text/any_encoding.hpp>
+#include <ztd/text/encoding.hpp>
+#include <ztd/text/decode.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <string_view>
+#include <utility>
+
+inline namespace ztd_text_tests_basic_run_time_detail_inline_erased {
+	struct counted_interface {
+		static inline int live = 0;
+
+		counted_interface() noexcept {
+			++live;
+		}
+
+		counted_interface(const counted_interface&) noexcept {
+			++live;
+		}
+
+		virtual counted_interface* __move_into(void* destination) noexcept = 0;
+		virtual int value() const noexcept                                  = 0;
+
+		virtual ~counted_interface() {
+			--live;
+		}
+	};
+
+	template <std::size_t Size>
+	struct counted : counted_interface {
+		unsigned char payload[Size];
+		int stored;
+
+		counted(int value) noexcept : counted_interface(), payload(), stored(value) {
+		}
+
+		counted(counted&& other) noexcept : counted_interface(other), payload(), stored(other.stored) {
+			other.stored = -1;
+		}
+
+		virtual counted_interface* __move_into(void* destination) noexcept override {
+			return ::new (destination) counted(std::move(*this));
+		}
+
+		virtual int value() const noexcept override {
+			return stored;
+		}
+	};
+
+	struct other_interface {
+		virtual int other_value() const noexcept {
+			return 0;
+		}
+
+		virtual ~other_interface() {
+		}
+	};
+
+	// the interface is the second polymorphic base, so it does not start where the object does
+	struct offset_counted : other_interface, counted_interface {
+		int stored;
+
+		offset_counted(int value) noexcept : other_interface(), counted_interface(), stored(value) {
+		}
+
+		offset_counted(offset_counted&& other) noexcept
+		: other_interface(), counted_interface(other), stored(other.stored) {
+			other.stored = -1;
+		}
+
+		virtual counted_interface* __move_into(void* destination) noexcept override {
+			return ::new (destination) offset_counted(std::move(*this));
+		}
+
+		virtual int value() const noexcept override {
+			return stored;
+		}
+	};
+
+	using storage = ztd::text::__txt_detail::__inline_erased<counted_interface, 32>;
+} // namespace ztd_text_tests_basic_run_time_detail_inline_erased
+
+TEST_CASE("text/detail/inline_erased", "small objects are stored inline, large ones on the heap, and both move") {
+	SECTION("inline") {
+		{
+			storage first;
+			first._M_emplace<counted<4>>(1);
+			REQUIRE(first._M_stored_inline());
+			REQUIRE(counted_interface::live == 1);
+			storage second(std::move(first));
+			REQUIRE(first._M_get() == nullptr);
+			REQUIRE(second._M_stored_inline());
+			REQUIRE(second->value() == 1);
+			REQUIRE(counted_interface::live == 1);
+			storage third;
+			third._M_emplace<counted<4>>(3);
+			third = std::move(second);
+			REQUIRE(third->value() == 1);
+			REQUIRE(counted_interface::live == 1);
+		}
+		REQUIRE(counted_interface::live == 0);
+	}
+	SECTION("heap") {
+		{
+			storage first;
+			first._M_emplace<counted<64>>(2);
+			REQUIRE_FALSE(first._M_stored_inline());
+			counted_interface* object = first._M_get();
+			storage second(std::move(first));
+			REQUIRE(second._M_get() == object);
+			REQUIRE(second->value() == 2);
+			REQUIRE(counted_interface::live == 1);
+			second._M_emplace<counted<4>>(4);
+			REQUIRE(second._M_stored_inline());
+			REQUIRE(counted_interface::live == 1);
+		}
+		REQUIRE(counted_interface::live == 0);
+	}
+	SECTION("interface not at the start of the object") {
+		{
+			storage first;
+			offset_counted& object = first._M_emplace<offset_counted>(5);
+			REQUIRE(static_cast<void*>(static_cast<counted_interface*>(&object)) != static_cast<void*>(&object));
+			REQUIRE(first._M_stored_inline());
+			storage second(std::move(first));
+			REQUIRE(first._M_get() == nullptr);
+			REQUIRE(second._M_stored_inline());
+			REQUIRE(second->value() == 5);
+			REQUIRE(counted_interface::live == 1);
+			storage third;
+			third._M_emplace<counted<64>>(6);
+			third = std::move(second);
+			REQUIRE(third._M_stored_inline());
+			REQUIRE(third->value() == 5);
+			REQUIRE(counted_interface::live == 1);
+			third._M_reset();
+			REQUIRE(counted_interface::live == 0);
+		}
+		REQUIRE(counted_interface::live == 0);
+	}
+}
+
+TEST_CASE("text/detail/inline_erased/any_encoding", "a moved any_encoding and its moved states keep working") {
+	const std::string_view input = "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80";
+	const std::u32string_view expected(U"aé€\U0001F600");
+	ztd::text::any_encoding original(ztd::text::utf8 {});
+	ztd::text::any_encoding::decode_state original_state(original);
+	ztd::text::any_encoding encoding(std::move(original));
+	ztd::text::any_encoding::decode_state state(std::move(original_state));
+	char32_t output[16] {};
+	auto result = ztd::text::decode_into(
+		ztd::text::span<const std::byte>(reinterpret_cast<const std::byte*>(input.data()), input.size()), encoding,
+		ztd::text::span<char32_t>(output), ztd::text::replacement_handler {}, state);
+	REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+	REQUIRE(std::u32string_view(output, static_cast<std::size_t>(result.output.data() - output)) == expected);
+}
@@ -0,0 +1,65 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#include <ztd/text/execution.hpp>
+#include <ztd/text/detail/posix.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <clocale>
+#include <string>
+
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_PLATFORM_UNIX_I_)
+
+TEST_CASE("text/detail/posix/active code page", "the cached locale encoding follows setlocale once refreshed") {
+	const char* current = std::setlocale(LC_CTYPE, nullptr);
+	REQUIRE(current != nullptr);
+	const std::string original(current);
+	ztd::text::refresh_execution_encoding();
+	const ztd::text::__txt_detail::__encoding_id original_id
+		= ztd::text::__txt_detail::__posix::__determine_active_code_page();
+	REQUIRE(ztd::text::__txt_detail::__posix::__determine_active_code_page() == original_id);
+
+	REQUIRE(std::setlocale(LC_CTYPE, "C") != nullptr);
+	// not looked up again until it is refreshed
+	REQUIRE(ztd::text::__txt_detail::__posix::__determine_active_code_page() == original_id);
+	ztd::text::refresh_execution_encoding();
+	REQUIRE(ztd::text::__txt_detail::__posix::__determine_active_code_page()
+		!= ztd::text::__txt_detail::__encoding_id::__utf8);
+	REQUIRE_FALSE(ztd::text::__txt_detail::__is_active_code_page_utf8());
+
+	REQUIRE(std::setlocale(LC_CTYPE, original.c_str()) != nullptr);
+	ztd::text::refresh_execution_encoding();
+	REQUIRE(ztd::text::__txt_detail::__posix::__determine_active_code_page() == original_id);
+	REQUIRE(ztd::text::__txt_detail::__is_active_code_page_utf8()
+		== (original_id == ztd::text::__txt_detail::__encoding_id::__utf8));
+}
+
+#endif
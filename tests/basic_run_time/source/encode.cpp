@@ -35,6 +35,56 @@
 
 #include <ztd/text/tests/basic_unicode_strings.hpp>
 
+#include <clocale>
+#include <string>
+#include <string_view>
+#include <vector>
+
+inline namespace ztd_text_tests_basic_run_time_encode {
+	template <typename Encoding>
+	void encode_position_check(std::u32string_view input, std::size_t output_size) {
+		using CodeUnit = ztd::text::code_unit_t<Encoding>;
+		Encoding encoding {};
+		ztd::text::replacement_handler handler {};
+		std::vector<CodeUnit> expected_storage(output_size);
+		std::vector<CodeUnit> result_storage(output_size);
+		auto expected_state = ztd::text::make_encode_state(encoding);
+		auto result_state   = ztd::text::make_encode_state(encoding);
+
+		auto expected = ztd::text::basic_encode_into(
+		     input, encoding, ztd::text::span<CodeUnit>(expected_storage), handler, expected_state);
+		auto result = ztd::text::encode_into(
+		     input, encoding, ztd::text::span<CodeUnit>(result_storage), handler, result_state);
+		REQUIRE(result.error_code == expected.error_code);
+		REQUIRE(result.handled_errors == expected.handled_errors);
+		REQUIRE(result.input.data() == expected.input.data());
+		REQUIRE(result.input.size() == expected.input.size());
+		REQUIRE(result.output.size() == expected.output.size());
+		REQUIRE(result_storage == expected_storage);
+	}
+
+	void execution_encode_position_checks() {
+		const std::u32string_view non_ascii[] = {
+			U"\u00E9",     // 2 bytes in UTF-8
+			U"\U0001F600", // 4 bytes in UTF-8
+			U"\xD800",     // surrogate
+			U"\x110000",   // too large
+		};
+		for (std::size_t run_size = 0; run_size < 80; run_size += 3) {
+			const std::u32string run(run_size, U'a');
+			for (const std::u32string_view& middle : non_ascii) {
+				std::u32string input = run;
+				input += middle;
+				input += run;
+				for (std::size_t output_size : { input.size() * 4, run_size / 2, run_size + 1 }) {
+					encode_position_check<ztd::text::execution>(input, output_size);
+					encode_position_check<ztd::text::wide_execution>(input, output_size);
+				}
+			}
+		}
+	}
+} // namespace ztd_text_tests_basic_run_time_encode
+
 TEST_CASE("text/encode/core", "basic usages of encode function do not explode") {
 	SECTION("execution") {
 		ztd::text::execution encoding {};
@@ -112,3 +162,45 @@ TEST_CASE("text/encode/core", "basic usages of encode function do not explode")
 		REQUIRE(result1 == ztd::text::tests::u32_unicode_sequence_truth_native_endian);
 	}
 }
+
+TEST_CASE("text/encode/execution bulk", "bulk execution and wide execution encoding matches one-by-one encoding") {
+	SECTION("current locale") {
+		execution_encode_position_checks();
+	}
+	SECTION("C locale") {
+		const char* current = std::setlocale(LC_CTYPE, nullptr);
+		REQUIRE(current != nullptr);
+		const std::string original(current);
+		REQUIRE(std::setlocale(LC_CTYPE, "C") != nullptr);
+		ztd::text::refresh_execution_encoding();
+		execution_encode_position_checks();
+		REQUIRE(std::setlocale(LC_CTYPE, original.c_str()) != nullptr);
+		ztd::text::refresh_execution_encoding();
+	}
+}
+
+TEST_CASE("text/encode/output sizing",
+	"every output sizing strategy for container-returning encodes produces the same result") {
+	const std::u32string_view inputs[] = { U"", U"abc", U"a\u00E9\u20AC\U0001F600z", U"ab\xD800cd",
+		U"abc\x110000", U"\xDFFF" };
+	ztd::text::utf8 encoding {};
+	ztd::text::replacement_handler handler {};
+	for (const std::u32string_view& input : inputs) {
+		auto expected_state = ztd::text::make_encode_state(encoding);
+		auto expected       = ztd::text::encode_to<std::basic_string<ztd::text::uchar8_t>>(
+		     input, encoding, handler, expected_state, ztd::text::output_sizing::incremental);
+		for (ztd::text::output_sizing sizing : { ztd::text::output_sizing::automatic,
+		          ztd::text::output_sizing::exact, ztd::text::output_sizing::upper_bound }) {
+			auto result_state = ztd::text::make_encode_state(encoding);
+			auto result       = ztd::text::encode_to<std::basic_string<ztd::text::uchar8_t>>(
+			     input, encoding, handler, result_state, sizing);
+			REQUIRE(result.error_code == expected.error_code);
+			REQUIRE(result.input.size() == expected.input.size());
+			REQUIRE(result.output == expected.output);
+			auto plain_state = ztd::text::make_encode_state(encoding);
+			std::vector<ztd::text::uchar8_t> plain = ztd::text::encode<std::vector<ztd::text::uchar8_t>>(
+			     input, encoding, handler, plain_state, sizing);
+			REQUIRE(std::basic_string<ztd::text::uchar8_t>(plain.cbegin(), plain.cend()) == expected.output);
+		}
+	}
+}
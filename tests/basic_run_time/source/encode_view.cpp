@@ -49,6 +49,22 @@ void check_encode_view(const Input& input, const Expected& expected_output) {
 	}
 }
 
+template <typename Encoding, typename Input, typename Expected>
+void check_reverse_encode_view(const Input& input, const Expected& expected_output) {
+	ztd::text::encode_view<Encoding> result0_view(input);
+	auto result0_it         = result0_view.rbegin();
+	const auto result0_last = result0_view.rend();
+	auto truth0_it          = std::crbegin(expected_output);
+	const auto truth0_last  = std::crend(expected_output);
+	for (; result0_it != result0_last; ++result0_it, (void)++truth0_it) {
+		REQUIRE(truth0_it != truth0_last);
+		const auto truth0_val  = *truth0_it;
+		const auto result0_val = *result0_it;
+		REQUIRE(truth0_val == result0_val);
+	}
+	REQUIRE(truth0_it == truth0_last);
+}
+
 TEST_CASE("text/encode_view/basic", "basic usages of encode_view type do not explode") {
 	SECTION("execution") {
 		ztd::text::execution encoding {};
@@ -113,3 +129,18 @@ TEST_CASE("text/encode_view/basic", "basic usages of encode_view type do not exp
 		     ztd::text::tests::u32_unicode_sequence_truth_native_endian);
 	}
 }
+
+TEST_CASE("text/encode_view/reverse", "encode_views over the UTF encodings can be gone through backwards") {
+	SECTION("utf8") {
+		check_reverse_encode_view<ztd::text::utf8>(ztd::text::tests::u32_unicode_sequence_truth_native_endian,
+		     ztd::text::tests::u8_unicode_sequence_truth_native_endian);
+	}
+	SECTION("utf16") {
+		check_reverse_encode_view<ztd::text::utf16>(ztd::text::tests::u32_unicode_sequence_truth_native_endian,
+		     ztd::text::tests::u16_unicode_sequence_truth_native_endian);
+	}
+	SECTION("utf32") {
+		check_reverse_encode_view<ztd::text::utf32>(ztd::text::tests::u32_unicode_sequence_truth_native_endian,
+		     ztd::text::tests::u32_unicode_sequence_truth_native_endian);
+	}
+}
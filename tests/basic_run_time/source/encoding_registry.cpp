@@ -0,0 +1,146 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#include <ztd/text/encoding_registry.hpp>
+#include <ztd/text/decode.hpp>
+#include <ztd/text/encode.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <string_view>
+#include <utility>
+
+TEST_CASE("text/encoding_registry/find", "the built-in encodings are found under all of their names") {
+	const ztd::text::encoding_registry& registry = ztd::text::default_encoding_registry();
+	SECTION("aliases") {
+		const ztd::text::any_encoding* utf8 = registry.find("UTF-8");
+		REQUIRE(utf8 != nullptr);
+		REQUIRE(registry.find("utf8") == utf8);
+		REQUIRE(registry.find(" Utf_8 ") == utf8);
+		REQUIRE(registry.find("unicode-1-1-utf-8") == utf8);
+		REQUIRE(registry.find("UTF-16") != nullptr);
+		REQUIRE(registry.find("UTF-16") != registry.find("UTF-16LE"));
+		REQUIRE(registry.find("UTF-16LE") == registry.find("ucs-2le"));
+		REQUIRE(registry.find("UTF-32BE") == registry.find("csUTF32BE"));
+		REQUIRE(registry.find("US-ASCII") == registry.find("ANSI_X3.4-1968"));
+		REQUIRE(registry.contains("WTF-8"));
+		REQUIRE(registry.contains("MUTF-8"));
+	}
+	SECTION("unknown") {
+		REQUIRE(registry.find("ISO-8859-1") == nullptr);
+		REQUIRE(registry.find("UTF-8X") == nullptr);
+		REQUIRE(registry.find("") == nullptr);
+		REQUIRE_FALSE(registry.contains("UTF-7"));
+	}
+	SECTION("pair") {
+		auto pair = registry.find_pair("utf-8", "utf-16le");
+		REQUIRE(static_cast<bool>(pair));
+		REQUIRE(pair.from == registry.find("UTF-8"));
+		REQUIRE(pair.to == registry.find("UTF-16LE"));
+		auto missing = registry.find_pair("utf-8", "koi8-r");
+		REQUIRE_FALSE(static_cast<bool>(missing));
+		REQUIRE(missing.from == pair.from);
+		REQUIRE(missing.to == nullptr);
+	}
+	SECTION("use") {
+		const ztd::text::any_encoding& utf16be = *registry.find("UTF-16BE");
+		const std::byte input[] = { std::byte { 0x00 }, std::byte { 0x61 }, std::byte { 0xD8 }, std::byte { 0x3D },
+			std::byte { 0xDE }, std::byte { 0x00 } };
+		char32_t output[4] {};
+		auto result = ztd::text::decode_into(ztd::text::span<const std::byte>(input, sizeof(input)), utf16be,
+			ztd::text::span<char32_t>(output, 4));
+		REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(result.input.empty());
+		REQUIRE(result.output.size() == 2);
+		REQUIRE(output[0] == U'a');
+		REQUIRE(output[1] == U'\U0001F600');
+	}
+}
+
+TEST_CASE("text/encoding_registry/add", "user encodings can be added and aliased") {
+	ztd::text::encoding_registry registry;
+	const ztd::text::any_encoding* builtin_utf8 = registry.find("UTF-8");
+	REQUIRE(builtin_utf8 != nullptr);
+	SECTION("new name") {
+		const ztd::text::any_encoding& added = registry.add("x-my-utf16", ztd::text::utf16 {});
+		REQUIRE(registry.find("X_MY_UTF16") == &added);
+		REQUIRE(registry.find("UTF-8") == builtin_utf8);
+		REQUIRE(registry.add_alias("my utf16", "x-my-utf16"));
+		REQUIRE(registry.find("MYUTF16") == &added);
+		REQUIRE_FALSE(registry.add_alias("other", "x-not-registered"));
+		REQUIRE(registry.find("other") == nullptr);
+	}
+	SECTION("taking over a name") {
+		const ztd::text::any_encoding& added = registry.add("utf8", ztd::text::compat_utf8 {});
+		REQUIRE(&added != builtin_utf8);
+		REQUIRE(registry.find("UTF-8") == &added);
+		REQUIRE(registry.find("csUTF8") == builtin_utf8);
+		REQUIRE(registry.add_alias("csUTF8", "UTF-8"));
+		REQUIRE(registry.find("csUTF8") == &added);
+	}
+	SECTION("many names") {
+		const ztd::text::any_encoding& added = registry.add("x-user-0", ztd::text::utf32 {});
+		const char* const names[] = { "x-user-1", "x-user-2", "x-user-3", "x-user-4", "x-user-5", "x-user-6",
+			"x-user-7", "x-user-8", "x-user-9", "x-user-10", "x-user-11", "x-user-12", "x-user-13", "x-user-14",
+			"x-user-15", "x-user-16", "x-user-17", "x-user-18", "x-user-19", "x-user-20", "x-user-21", "x-user-22",
+			"x-user-23", "x-user-24", "x-user-25", "x-user-26", "x-user-27", "x-user-28", "x-user-29", "x-user-30",
+			"x-user-31", "x-user-32", "x-user-33", "x-user-34", "x-user-35", "x-user-36", "x-user-37", "x-user-38",
+			"x-user-39", "x-user-40", "x-user-41", "x-user-42", "x-user-43", "x-user-44", "x-user-45", "x-user-46",
+			"x-user-47", "x-user-48", "x-user-49", "x-user-50", "x-user-51", "x-user-52", "x-user-53", "x-user-54",
+			"x-user-55", "x-user-56", "x-user-57", "x-user-58", "x-user-59", "x-user-60", "x-user-61", "x-user-62",
+			"x-user-63", "x-user-64" };
+		for (const char* name : names) {
+			REQUIRE(registry.add_alias(name, "x-user-0"));
+		}
+		for (const char* name : names) {
+			REQUIRE(registry.find(name) == &added);
+		}
+		REQUIRE(registry.find("x-user-65") == nullptr);
+		REQUIRE(registry.find("UTF-16BE") != nullptr);
+	}
+	SECTION("moved") {
+		ztd::text::encoding_registry moved(std::move(registry));
+		REQUIRE(moved.find("UTF-8") == builtin_utf8);
+		// the moved-from registry finds nothing, and can be used again
+		REQUIRE(registry.find("UTF-8") == nullptr);
+		REQUIRE_FALSE(registry.contains("utf8"));
+		REQUIRE_FALSE(registry.add_alias("x-my-utf8", "UTF-8"));
+		const ztd::text::any_encoding& added = registry.add("x-my-utf8", ztd::text::utf8 {});
+		REQUIRE(registry.find("X_MY_UTF8") == &added);
+		REQUIRE(registry.find("UTF-8") == nullptr);
+
+		ztd::text::encoding_registry assigned;
+		assigned = std::move(moved);
+		REQUIRE(assigned.find("UTF-8") == builtin_utf8);
+		REQUIRE(moved.find("UTF-8") == nullptr);
+		REQUIRE(moved.find_pair("UTF-8", "UTF-16").from == nullptr);
+	}
+}
@@ -30,12 +30,86 @@
 
 #include <ztd/text/encoding_scheme.hpp>
 #include <ztd/text/decode.hpp>
+#include <ztd/text/validate_code_units.hpp>
 
 #include <catch2/catch.hpp>
 
 #include <ztd/text/tests/basic_unicode_strings.hpp>
 
 #include <algorithm>
+#include <cstddef>
+#include <vector>
+
+inline namespace ztd_text_tests_basic_run_time_encoding_scheme_decode {
+	void push_word(std::vector<std::byte>& bytes, char32_t word, std::size_t word_size, ztd::text::endian order) {
+		for (std::size_t index = 0; index < word_size; ++index) {
+			std::size_t shift = order == ztd::text::endian::big ? (word_size - 1 - index) * 8 : index * 8;
+			bytes.push_back(static_cast<std::byte>((word >> shift) & 0xFF));
+		}
+	}
+
+	template <typename Encoding>
+	void decode_scheme_check(const std::vector<std::byte>& bytes, std::size_t output_size) {
+		Encoding encoding {};
+		ztd::text::replacement_handler handler {};
+		ztd::text::span<const std::byte> input(bytes.data(), bytes.size());
+		std::vector<char32_t> expected_storage(output_size);
+		std::vector<char32_t> result_storage(output_size);
+		auto expected_state = ztd::text::make_decode_state(encoding);
+		auto result_state   = ztd::text::make_decode_state(encoding);
+
+		auto expected = ztd::text::basic_decode_into(
+		     input, encoding, ztd::text::span<char32_t>(expected_storage), handler, expected_state);
+		auto result = ztd::text::decode_into(
+		     input, encoding, ztd::text::span<char32_t>(result_storage), handler, result_state);
+		REQUIRE(result.error_code == expected.error_code);
+		REQUIRE(result.handled_errors == expected.handled_errors);
+		REQUIRE(result.input.data() == expected.input.data());
+		REQUIRE(result.input.size() == expected.input.size());
+		REQUIRE(result.output.size() == expected.output.size());
+		REQUIRE(result_storage == expected_storage);
+
+		auto expected_validate_state        = ztd::text::make_decode_state(encoding);
+		auto expected_validate_encode_state = ztd::text::make_encode_state(encoding);
+		auto result_validate_state          = ztd::text::make_decode_state(encoding);
+		auto expected_validate              = ztd::text::basic_validate_code_units(
+		     input, encoding, expected_validate_state, expected_validate_encode_state);
+		auto result_validate = ztd::text::validate_code_units(input, encoding, result_validate_state);
+		REQUIRE(result_validate.valid == expected_validate.valid);
+		REQUIRE(result_validate.input.data() == expected_validate.input.data());
+		REQUIRE(result_validate.input.size() == expected_validate.input.size());
+	}
+
+	template <typename Encoding>
+	void decode_scheme_checks(std::size_t word_size, ztd::text::endian order) {
+		// a lone surrogate, an out-of-range value (UTF-32 only), and a supplementary code point
+		const char32_t middles[] = { 0xD800, static_cast<char32_t>(word_size == 4 ? 0x110000 : 0xDFFF), 0x1F600 };
+		for (std::size_t run_size = 0; run_size < 40; ++run_size) {
+			for (char32_t middle : middles) {
+				std::vector<std::byte> bytes;
+				for (std::size_t index = 0; index < run_size; ++index) {
+					push_word(bytes, static_cast<char32_t>(0x41 + (index * 0x3B) % 0x700), word_size, order);
+				}
+				if (middle > 0xFFFF && word_size == 2) {
+					push_word(bytes, 0xD83D, word_size, order);
+					push_word(bytes, 0xDE00, word_size, order);
+				}
+				else {
+					push_word(bytes, middle, word_size, order);
+				}
+				for (std::size_t index = 0; index < run_size; ++index) {
+					push_word(bytes, static_cast<char32_t>(0x61 + index % 26), word_size, order);
+				}
+				for (std::size_t output_size : { bytes.size(), run_size / 2, run_size + 1 }) {
+					decode_scheme_check<Encoding>(bytes, output_size);
+				}
+				// a trailing partial word
+				bytes.push_back(std::byte { 0x20 });
+				decode_scheme_check<Encoding>(bytes, bytes.size());
+			}
+		}
+	}
+} // namespace ztd_text_tests_basic_run_time_encoding_scheme_decode
 
 TEST_CASE("text/decode/encoding_scheme", "decode from byte arrays with specific endianness") {
 	SECTION("endian::native") {
@@ -169,3 +243,19 @@ TEST_CASE("text/decode/encoding_scheme", "decode from byte arrays with specific
 		}
 	}
 }
+
+TEST_CASE("text/decode/encoding_scheme bulk",
+	"decoding and validating byte-swapped UTF-16 and UTF-32 in bulk matches one-by-one decoding") {
+	SECTION("utf16_le") {
+		decode_scheme_checks<ztd::text::utf16_le>(2, ztd::text::endian::little);
+	}
+	SECTION("utf16_be") {
+		decode_scheme_checks<ztd::text::utf16_be>(2, ztd::text::endian::big);
+	}
+	SECTION("utf32_le") {
+		decode_scheme_checks<ztd::text::utf32_le>(4, ztd::text::endian::little);
+	}
+	SECTION("utf32_be") {
+		decode_scheme_checks<ztd::text::utf32_be>(4, ztd::text::endian::big);
+	}
+}
@@ -36,6 +36,53 @@
 #include <ztd/text/tests/basic_unicode_strings.hpp>
 
 #include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+inline namespace ztd_text_tests_basic_run_time_encoding_scheme_encode {
+	template <typename Encoding>
+	void encode_scheme_check(std::u32string_view input, std::size_t output_size) {
+		Encoding encoding {};
+		ztd::text::replacement_handler handler {};
+		std::vector<std::byte> expected_storage(output_size);
+		std::vector<std::byte> result_storage(output_size);
+		auto expected_state = ztd::text::make_encode_state(encoding);
+		auto result_state   = ztd::text::make_encode_state(encoding);
+
+		auto expected = ztd::text::basic_encode_into(
+		     input, encoding, ztd::text::span<std::byte>(expected_storage), handler, expected_state);
+		auto result = ztd::text::encode_into(
+		     input, encoding, ztd::text::span<std::byte>(result_storage), handler, result_state);
+		REQUIRE(result.error_code == expected.error_code);
+		REQUIRE(result.handled_errors == expected.handled_errors);
+		REQUIRE(result.input.data() == expected.input.data());
+		REQUIRE(result.input.size() == expected.input.size());
+		REQUIRE(result.output.size() == expected.output.size());
+		REQUIRE(result_storage == expected_storage);
+	}
+
+	template <typename Encoding>
+	void encode_scheme_checks(std::size_t word_size) {
+		// a lone surrogate, an out-of-range value, and a supplementary code point
+		const char32_t middles[] = { 0xD800, 0x110000, 0x1F600 };
+		for (std::size_t run_size = 0; run_size < 40; ++run_size) {
+			for (char32_t middle : middles) {
+				std::u32string input;
+				for (std::size_t index = 0; index < run_size; ++index) {
+					input.push_back(static_cast<char32_t>(0x41 + (index * 0x3B) % 0x700));
+				}
+				input.push_back(middle);
+				input.append(run_size, U'z');
+				// whole outputs, outputs ending in the middle of the input, and outputs ending mid-word
+				for (std::size_t output_size :
+				     { input.size() * 4, run_size * word_size, run_size * word_size + word_size + 1 }) {
+					encode_scheme_check<Encoding>(input, output_size);
+				}
+			}
+		}
+	}
+} // namespace ztd_text_tests_basic_run_time_encoding_scheme_encode
 
 TEST_CASE("text/encode/encoding_scheme", "encode to byte arrays with specific endianness") {
 	SECTION("endian::native") {
@@ -165,3 +212,19 @@ TEST_CASE("text/encode/encoding_scheme", "encode to byte arrays with specific en
 		}
 	}
 }
+
+TEST_CASE("text/encode/encoding_scheme bulk",
+	"encoding byte-swapped UTF-16 and UTF-32 in bulk matches one-by-one encoding") {
+	SECTION("utf16_le") {
+		encode_scheme_checks<ztd::text::utf16_le>(2);
+	}
+	SECTION("utf16_be") {
+		encode_scheme_checks<ztd::text::utf16_be>(2);
+	}
+	SECTION("utf32_le") {
+		encode_scheme_checks<ztd::text::utf32_le>(4);
+	}
+	SECTION("utf32_be") {
+		encode_scheme_checks<ztd::text::utf32_be>(4);
+	}
+}
@@ -0,0 +1,138 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#include <ztd/text/parallel_count_code_units.hpp>
+#include <ztd/text/parallel_count_code_points.hpp>
+#include <ztd/text/count_code_units.hpp>
+#include <ztd/text/count_code_points.hpp>
+#include <ztd/text/transcode.hpp>
+#include <ztd/text/encoding.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <ztd/text/tests/parallel.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_STD_LIBRARY_EXECUTION_I_)
+#include <execution>
+#endif
+
+inline namespace ztd_text_tests_basic_run_time_parallel_count {
+	template <typename Expected, typename Result>
+	void parallel_count_compare(const Expected& expected, const Result& result) {
+		REQUIRE(result.count == expected.count);
+		REQUIRE(result.error_code == expected.error_code);
+		REQUIRE(result.handled_errors == expected.handled_errors);
+		REQUIRE(result.input.data() == expected.input.data());
+		REQUIRE(result.input.size() == expected.input.size());
+	}
+
+	template <typename Executor, typename Input, typename Encoding, typename Handler>
+	void parallel_count_check(Executor&& executor, const Input& input, Encoding encoding, Handler handler) {
+		parallel_count_compare(ztd::text::count_code_units(input, encoding, handler),
+			ztd::text::parallel_count_code_units(executor, input, encoding, handler));
+		auto expected_state = ztd::text::make_encode_state(encoding);
+		auto result_state   = ztd::text::make_encode_state(encoding);
+		std::u32string code_points = ztd::text::transcode_to<std::u32string>(input, encoding, ztd::text::utf32 {},
+			ztd::text::replacement_handler {}, ztd::text::replacement_handler {})
+		                                  .output;
+		if (!code_points.empty()) {
+			code_points[code_points.size() / 3] = static_cast<char32_t>(0x110000);
+		}
+		const std::u32string_view code_point_input(code_points);
+		parallel_count_compare(ztd::text::count_code_points(code_point_input, encoding, handler, expected_state),
+			ztd::text::parallel_count_code_points(executor, code_point_input, encoding, handler, result_state));
+	}
+
+	template <typename Input, typename Encoding>
+	void parallel_count_checks(const Input& input, Encoding encoding) {
+		parallel_count_check(
+			ztd::text::tests::thread_executor {}, input, encoding, ztd::text::replacement_handler {});
+		parallel_count_check(ztd::text::tests::thread_executor {}, input, encoding, ztd::text::pass_handler {});
+		parallel_count_check(
+			ztd::text::tests::backwards_executor {}, input, encoding, ztd::text::replacement_handler {});
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_STD_LIBRARY_EXECUTION_I_)
+		parallel_count_check(std::execution::seq, input, encoding, ztd::text::pass_handler {});
+#endif
+	}
+} // namespace ztd_text_tests_basic_run_time_parallel_count
+
+TEST_CASE("text/count/parallel", "parallel counting gives the same results as serial counting") {
+	for (bool with_errors : { false, true }) {
+		const std::string utf8_storage = ztd::text::tests::large_utf8_input(with_errors);
+		const std::string_view utf8_input(utf8_storage);
+		std::u16string utf16_storage = ztd::text::transcode_to<std::u16string>(utf8_input, ztd::text::utf8 {},
+			ztd::text::utf16 {}, ztd::text::replacement_handler {}, ztd::text::replacement_handler {})
+		                                    .output;
+		if (with_errors) {
+			utf16_storage[utf16_storage.size() / 2 + 1] = u'\xDC00';
+		}
+		const std::u16string_view utf16_input(utf16_storage);
+
+		SECTION("utf8") {
+			parallel_count_checks(utf8_input, ztd::text::utf8 {});
+			parallel_count_checks(utf8_input.substr(0, 0), ztd::text::utf8 {});
+		}
+		SECTION("utf16") {
+			parallel_count_checks(utf16_input, ztd::text::utf16 {});
+		}
+	}
+}
+
+TEST_CASE("text/count/parallel/error handler calls",
+	"the error handler is called as many times as for serial counting, and only on the calling thread") {
+	const std::string input_storage = ztd::text::tests::large_utf8_input(true);
+	const std::string_view input(input_storage);
+	std::atomic<std::size_t> serial_calls(0), parallel_calls(0);
+	std::atomic<bool> other_thread(false);
+	ztd::text::tests::counting_handler serial_handler { &serial_calls, &other_thread };
+	ztd::text::tests::counting_handler parallel_handler { &parallel_calls, &other_thread };
+	SECTION("code units") {
+		parallel_count_compare(ztd::text::count_code_units(input, ztd::text::utf8 {}, serial_handler),
+			ztd::text::parallel_count_code_units(
+			     ztd::text::tests::thread_executor {}, input, ztd::text::utf8 {}, parallel_handler));
+	}
+	SECTION("code points") {
+		const std::u32string code_point_storage = ztd::text::transcode_to<std::u32string>(input,
+			ztd::text::utf8 {}, ztd::text::utf32 {}, ztd::text::replacement_handler {},
+			ztd::text::replacement_handler {})
+		                                               .output;
+		const std::u32string_view code_points(code_point_storage);
+		parallel_count_compare(ztd::text::count_code_points(code_points, ztd::text::ascii {}, serial_handler),
+			ztd::text::parallel_count_code_points(
+			     ztd::text::tests::thread_executor {}, code_points, ztd::text::ascii {}, parallel_handler));
+	}
+	REQUIRE(serial_calls > 0);
+	REQUIRE(parallel_calls == serial_calls);
+	REQUIRE_FALSE(other_thread);
+}
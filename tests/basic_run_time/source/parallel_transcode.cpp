@@ -0,0 +1,166 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#include <ztd/text/parallel_transcode.hpp>
+#include <ztd/text/transcode.hpp>
+#include <ztd/text/encoding.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <ztd/text/tests/parallel.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+inline namespace ztd_text_tests_basic_run_time_parallel_transcode {
+
+	template <typename Output, typename Input, typename From, typename To, typename Handler>
+	void parallel_transcode_check(
+		const Input& input, From from, To to, Handler handler, std::size_t output_size) {
+		using OutputValue = typename Output::value_type;
+		Output expected_storage(output_size, OutputValue());
+		Output result_storage(output_size, OutputValue());
+		auto expected = ztd::text::transcode_into(input, from,
+			ztd::text::span<OutputValue>(expected_storage.data(), expected_storage.size()), to, handler, handler);
+		auto result   = ztd::text::parallel_transcode_into(ztd::text::tests::thread_executor {}, input, from,
+			ztd::text::span<OutputValue>(result_storage.data(), result_storage.size()), to, handler, handler);
+		REQUIRE(result.error_code == expected.error_code);
+		REQUIRE(result.handled_errors == expected.handled_errors);
+		REQUIRE(result.input.data() == expected.input.data());
+		REQUIRE(result.input.size() == expected.input.size());
+		REQUIRE(result.output.size() == expected.output.size());
+		const std::size_t written_size = output_size - expected.output.size();
+		REQUIRE(Output(result_storage.data(), written_size) == Output(expected_storage.data(), written_size));
+
+		auto expected_to = ztd::text::transcode_to<Output>(input, from, to, handler, handler);
+		auto result_to   = ztd::text::parallel_transcode_to<Output>(
+			ztd::text::tests::backwards_executor {}, input, from, to, handler, handler);
+		REQUIRE(result_to.error_code == expected_to.error_code);
+		REQUIRE(result_to.handled_errors == expected_to.handled_errors);
+		REQUIRE(result_to.input.data() == expected_to.input.data());
+		REQUIRE(result_to.input.size() == expected_to.input.size());
+		REQUIRE(result_to.output == expected_to.output);
+	}
+
+	template <typename Output, typename Input, typename From, typename To>
+	void parallel_transcode_checks(const Input& input, From from, To to) {
+		const std::size_t output_sizes[] = { input.size() * 4, input.size() / 2, 100, 0 };
+		for (std::size_t output_size : output_sizes) {
+			parallel_transcode_check<Output>(input, from, to, ztd::text::replacement_handler {}, output_size);
+			parallel_transcode_check<Output>(input, from, to, ztd::text::pass_handler {}, output_size);
+		}
+	}
+} // namespace ztd_text_tests_basic_run_time_parallel_transcode
+
+TEST_CASE("text/transcode/parallel", "parallel transcoding gives the same results as serial transcoding") {
+	for (bool with_errors : { false, true }) {
+		const std::string utf8_storage = ztd::text::tests::large_utf8_input(with_errors);
+		const std::string_view utf8_input(utf8_storage);
+		const std::u16string utf16_storage
+			= ztd::text::transcode_to<std::u16string>(utf8_input, ztd::text::utf8 {}, ztd::text::utf16 {},
+			     ztd::text::replacement_handler {}, ztd::text::replacement_handler {})
+			       .output;
+		std::u32string utf32_storage = ztd::text::transcode_to<std::u32string>(utf8_input, ztd::text::utf8 {},
+			ztd::text::utf32 {}, ztd::text::replacement_handler {}, ztd::text::replacement_handler {})
+		                                    .output;
+		std::u16string broken_utf16_storage = utf16_storage;
+		if (with_errors) {
+			for (std::size_t index = 1; index < broken_utf16_storage.size(); index += 70001) {
+				broken_utf16_storage[index] = u'\xD800';
+			}
+			for (std::size_t index = 3; index < utf32_storage.size(); index += 50003) {
+				utf32_storage[index] = static_cast<char32_t>(0xDFFF);
+			}
+		}
+		const std::u16string_view utf16_input(broken_utf16_storage);
+		const std::u32string_view utf32_input(utf32_storage);
+
+		SECTION("utf8 -> utf16") {
+			parallel_transcode_checks<std::u16string>(utf8_input, ztd::text::utf8 {}, ztd::text::utf16 {});
+		}
+		SECTION("utf8 -> utf32") {
+			parallel_transcode_checks<std::u32string>(utf8_input, ztd::text::utf8 {}, ztd::text::utf32 {});
+		}
+		SECTION("utf16 -> utf8") {
+			parallel_transcode_checks<std::string>(utf16_input, ztd::text::utf16 {}, ztd::text::utf8 {});
+		}
+		SECTION("utf32 -> utf8") {
+			parallel_transcode_checks<std::string>(utf32_input, ztd::text::utf32 {}, ztd::text::utf8 {});
+		}
+		SECTION("utf8 -> ascii") {
+			parallel_transcode_checks<std::string>(utf8_input, ztd::text::utf8 {}, ztd::text::ascii {});
+		}
+	}
+}
+
+TEST_CASE("text/transcode/parallel/error handler calls",
+	"error handlers are called as many times as for serial transcoding, and only on the calling thread") {
+	const std::string input_storage = ztd::text::tests::large_utf8_input(true);
+	const std::string_view input(input_storage);
+	std::atomic<std::size_t> serial_decode_calls(0), serial_encode_calls(0);
+	std::atomic<std::size_t> parallel_decode_calls(0), parallel_encode_calls(0);
+	std::atomic<bool> other_thread(false);
+	ztd::text::tests::counting_handler serial_decode_handler { &serial_decode_calls, &other_thread };
+	ztd::text::tests::counting_handler serial_encode_handler { &serial_encode_calls, &other_thread };
+	ztd::text::tests::counting_handler parallel_decode_handler { &parallel_decode_calls, &other_thread };
+	ztd::text::tests::counting_handler parallel_encode_handler { &parallel_encode_calls, &other_thread };
+	SECTION("into") {
+		for (std::size_t output_size : { input.size(), input.size() / 2 }) {
+			std::string expected_storage(output_size, '\0');
+			std::string result_storage(output_size, '\0');
+			auto expected = ztd::text::transcode_into(input, ztd::text::utf8 {},
+				ztd::text::span<char>(expected_storage.data(), expected_storage.size()), ztd::text::ascii {},
+				serial_decode_handler, serial_encode_handler);
+			auto result   = ztd::text::parallel_transcode_into(ztd::text::tests::thread_executor {}, input,
+				ztd::text::utf8 {}, ztd::text::span<char>(result_storage.data(), result_storage.size()),
+				ztd::text::ascii {}, parallel_decode_handler, parallel_encode_handler);
+			REQUIRE(result.error_code == expected.error_code);
+			REQUIRE(result.handled_errors == expected.handled_errors);
+			REQUIRE(result.input.size() == expected.input.size());
+			REQUIRE(result.output.size() == expected.output.size());
+			REQUIRE(result_storage == expected_storage);
+		}
+	}
+	SECTION("to") {
+		auto expected = ztd::text::transcode_to<std::string>(
+			input, ztd::text::utf8 {}, ztd::text::ascii {}, serial_decode_handler, serial_encode_handler);
+		auto result   = ztd::text::parallel_transcode_to<std::string>(ztd::text::tests::thread_executor {},
+			input, ztd::text::utf8 {}, ztd::text::ascii {}, parallel_decode_handler, parallel_encode_handler);
+		REQUIRE(result.error_code == expected.error_code);
+		REQUIRE(result.handled_errors == expected.handled_errors);
+		REQUIRE(result.output == expected.output);
+	}
+	REQUIRE(serial_decode_calls > 0);
+	REQUIRE(parallel_decode_calls == serial_decode_calls);
+	REQUIRE(parallel_encode_calls == serial_encode_calls);
+	REQUIRE_FALSE(other_thread);
+}
@@ -0,0 +1,92 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#include <ztd/text/parallel_validate_code_units.hpp>
+#include <ztd/text/validate_code_units.hpp>
+#include <ztd/text/transcode.hpp>
+#include <ztd/text/encoding.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <ztd/text/tests/parallel.hpp>
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_STD_LIBRARY_EXECUTION_I_)
+#include <execution>
+#endif
+
+inline namespace ztd_text_tests_basic_run_time_parallel_validate_code_units {
+	template <typename Executor, typename Input, typename Encoding>
+	void parallel_validate_check(Executor&& executor, const Input& input, Encoding encoding) {
+		auto expected = ztd::text::validate_code_units(input, encoding);
+		auto result   = ztd::text::parallel_validate_code_units(executor, input, encoding);
+		REQUIRE(result.valid == expected.valid);
+		REQUIRE(result.input.data() == expected.input.data());
+		REQUIRE(result.input.size() == expected.input.size());
+	}
+
+	template <typename Input, typename Encoding>
+	void parallel_validate_checks(const Input& input, Encoding encoding) {
+		parallel_validate_check(ztd::text::tests::thread_executor {}, input, encoding);
+		parallel_validate_check(ztd::text::tests::backwards_executor {}, input, encoding);
+#if ZTD_TEXT_IS_ON(ZTD_TEXT_STD_LIBRARY_EXECUTION_I_)
+		parallel_validate_check(std::execution::seq, input, encoding);
+#endif
+	}
+} // namespace ztd_text_tests_basic_run_time_parallel_validate_code_units
+
+TEST_CASE("text/validate_code_units/parallel",
+	"parallel validation gives the same results as serial validation") {
+	for (bool with_errors : { false, true }) {
+		const std::string utf8_storage = ztd::text::tests::large_utf8_input(with_errors);
+		const std::string_view utf8_input(utf8_storage);
+		std::u16string utf16_storage = ztd::text::transcode_to<std::u16string>(utf8_input, ztd::text::utf8 {},
+			ztd::text::utf16 {}, ztd::text::replacement_handler {}, ztd::text::replacement_handler {})
+		                                    .output;
+		if (with_errors) {
+			utf16_storage[utf16_storage.size() / 2 + 1] = u'\xDC00';
+		}
+		const std::u16string_view utf16_input(utf16_storage);
+
+		SECTION("utf8") {
+			parallel_validate_checks(utf8_input, ztd::text::utf8 {});
+			parallel_validate_checks(utf8_input.substr(0, 70000), ztd::text::utf8 {});
+			parallel_validate_checks(utf8_input.substr(0, 0), ztd::text::utf8 {});
+		}
+		SECTION("utf16") {
+			parallel_validate_checks(utf16_input, ztd::text::utf16 {});
+		}
+		SECTION("ascii") {
+			parallel_validate_checks(utf8_input, ztd::text::ascii {});
+		}
+	}
+}
@@ -0,0 +1,162 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#include <ztd/text/streaming_transcoder.hpp>
+#include <ztd/text/transcode.hpp>
+#include <ztd/text/encoding.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+inline namespace ztd_text_tests_basic_run_time_streaming_transcoder {
+	template <typename Transcoder, typename InputCodeUnit, typename Output>
+	ztd::text::encoding_error stream_transcode(Transcoder& transcoder, ztd::text::span<const InputCodeUnit> input,
+		std::size_t chunk_size, std::size_t output_size, Output& output) {
+		using CodeUnit = typename Output::value_type;
+		std::vector<CodeUnit> buffer(output_size);
+		auto write = [&](const auto& result) {
+			std::size_t written = buffer.size() - static_cast<std::size_t>(result.output.size());
+			output.insert(output.end(), buffer.data(), buffer.data() + written);
+		};
+		for (std::size_t position = 0; position < static_cast<std::size_t>(input.size());) {
+			std::size_t size = std::min(chunk_size, static_cast<std::size_t>(input.size()) - position);
+			ztd::text::span<const InputCodeUnit> chunk(input.data() + position, size);
+			position += size;
+			for (;;) {
+				auto result = transcoder.transcode_into(chunk, ztd::text::span<CodeUnit>(buffer));
+				write(result);
+				if (result.error_code == ztd::text::encoding_error::ok) {
+					REQUIRE(result.input.empty());
+					break;
+				}
+				if (result.error_code != ztd::text::encoding_error::insufficient_output_space) {
+					return result.error_code;
+				}
+				chunk = result.input;
+			}
+		}
+		for (;;) {
+			auto result = transcoder.finish(ztd::text::span<CodeUnit>(buffer));
+			write(result);
+			if (result.error_code != ztd::text::encoding_error::insufficient_output_space) {
+				return result.error_code;
+			}
+		}
+	}
+
+	inline ztd::text::span<const char> as_span(std::string_view input) {
+		return ztd::text::span<const char>(input.data(), input.size());
+	}
+} // namespace ztd_text_tests_basic_run_time_streaming_transcoder
+
+TEST_CASE("text/transcode/streaming",
+	"streaming transcoding gives the same results as transcoding all at once, no matter how the input is split") {
+	const std::string_view utf8_input = "Hello, \xC3\xA9\xC3\xA8! \xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82 "
+	                                    "\xE4\xBD\xA0\xE5\xA5\xBD \xF0\x9F\x98\x80\xF0\x9F\x91\x8D end";
+	const std::u16string expected     = ztd::text::transcode_to<std::u16string>(utf8_input, ztd::text::utf8 {},
+          ztd::text::utf16 {}, ztd::text::replacement_handler {}, ztd::text::replacement_handler {})
+	                                    .output;
+
+	SECTION("utf8 to utf16") {
+		for (std::size_t chunk_size = 1; chunk_size <= utf8_input.size(); ++chunk_size) {
+			for (std::size_t output_size : { 2, 64 }) {
+				ztd::text::streaming_transcoder<ztd::text::utf8, ztd::text::utf16> transcoder;
+				std::u16string output;
+				auto error_code = stream_transcode(transcoder, as_span(utf8_input), chunk_size, output_size, output);
+				REQUIRE(error_code == ztd::text::encoding_error::ok);
+				REQUIRE(output == expected);
+				REQUIRE(transcoder.pending_code_units().empty());
+			}
+		}
+	}
+	SECTION("utf16 bytes to utf8") {
+		std::vector<std::byte> bytes;
+		for (char16_t code_unit : expected) {
+			bytes.push_back(static_cast<std::byte>(code_unit & 0xFF));
+			bytes.push_back(static_cast<std::byte>(code_unit >> 8));
+		}
+		const ztd::text::span<const std::byte> byte_input(bytes.data(), bytes.size());
+		for (std::size_t chunk_size = 1; chunk_size <= 7; ++chunk_size) {
+			ztd::text::streaming_transcoder<ztd::text::utf16_le, ztd::text::utf8> transcoder;
+			std::basic_string<ztd::text::uchar8_t> output;
+			auto error_code = stream_transcode(transcoder, byte_input, chunk_size, 64, output);
+			REQUIRE(error_code == ztd::text::encoding_error::ok);
+			REQUIRE(std::equal(output.begin(), output.end(), utf8_input.begin(), utf8_input.end(),
+				[](ztd::text::uchar8_t left, char right) { return left == static_cast<ztd::text::uchar8_t>(right); }));
+		}
+	}
+	SECTION("invalid and incomplete input") {
+		const std::string_view bad_input  = "a\xFF"
+		                                    "b\xE2\x82";
+		const std::u16string bad_expected = ztd::text::transcode_to<std::u16string>(bad_input, ztd::text::utf8 {},
+			ztd::text::utf16 {}, ztd::text::replacement_handler {}, ztd::text::replacement_handler {})
+		                                        .output;
+		for (std::size_t chunk_size = 1; chunk_size <= bad_input.size(); ++chunk_size) {
+			ztd::text::streaming_transcoder<ztd::text::utf8, ztd::text::utf16, ztd::text::replacement_handler,
+				ztd::text::replacement_handler>
+				transcoder;
+			std::u16string output;
+			auto error_code = stream_transcode(transcoder, as_span(bad_input), chunk_size, 64, output);
+			REQUIRE(error_code == ztd::text::encoding_error::ok);
+			REQUIRE(output == bad_expected);
+		}
+	}
+	SECTION("trailing incomplete sequence") {
+		ztd::text::streaming_transcoder<ztd::text::utf8, ztd::text::utf16, ztd::text::pass_handler,
+			ztd::text::pass_handler>
+			transcoder;
+		char16_t buffer[8] {};
+		auto result = transcoder.transcode_into(as_span("a\xF0\x9F"), ztd::text::span<char16_t>(buffer));
+		REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(result.input.empty());
+		REQUIRE(result.output.size() == 7);
+		REQUIRE(transcoder.pending_code_units().size() == 2);
+		result = transcoder.transcode_into(as_span("\x98"), ztd::text::span<char16_t>(buffer));
+		REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(result.output.size() == 8);
+		REQUIRE(transcoder.pending_code_units().size() == 3);
+
+		auto finish_result = transcoder.finish(ztd::text::span<char16_t>(buffer));
+		REQUIRE(finish_result.error_code == ztd::text::encoding_error::incomplete_sequence);
+		REQUIRE(finish_result.input.size() == 3);
+		REQUIRE(transcoder.pending_code_units().size() == 3);
+
+		transcoder.reset();
+		REQUIRE(transcoder.pending_code_units().empty());
+		finish_result = transcoder.finish(ztd::text::span<char16_t>(buffer));
+		REQUIRE(finish_result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(finish_result.output.size() == 8);
+	}
+}
@@ -29,11 +29,79 @@
 // ============================================================================>
 
 #include <ztd/text/text_view.hpp>
+#include <ztd/text/text.hpp>
+#include <ztd/text/code_point_index.hpp>
 
 #include <catch2/catch.hpp>
 
 #include <ztd/text/tests/basic_unicode_strings.hpp>
 
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+inline namespace ztd_text_tests_basic_run_time_text_view {
+	template <typename Text>
+	void check_code_point_index(const Text& txt) {
+		using Encoding  = typename Text::encoding_type;
+		using CodeUnit  = ztd::text::code_unit_t<Encoding>;
+		using CodePoint = ztd::text::code_point_t<Encoding>;
+
+		std::vector<CodePoint> expected_code_points;
+		std::vector<std::size_t> expected_offsets;
+		std::basic_string_view<CodeUnit> whole(txt.base());
+		std::basic_string_view<CodeUnit> input = whole;
+		auto error_handler                     = txt.error_handler();
+		auto state                             = ztd::text::make_decode_state(txt.encoding());
+		while (!input.empty()) {
+			CodePoint code_points[ztd::text::max_code_points_v<Encoding>] {};
+			auto result = txt.encoding().decode_one(
+				input, ztd::text::span<CodePoint>(code_points), error_handler, state);
+			for (CodePoint* code_point = code_points; code_point != result.output.data(); ++code_point) {
+				expected_code_points.push_back(*code_point);
+				expected_offsets.push_back(static_cast<std::size_t>(input.data() - whole.data()));
+			}
+			input = result.input;
+		}
+
+		ztd::text::code_point_index<Text> index(txt);
+		ztd::text::code_point_index<Text, 7> small_index(txt);
+		REQUIRE(index.size() == expected_code_points.size());
+		REQUIRE(small_index.size() == expected_code_points.size());
+		for (std::size_t code_point_index = 0; code_point_index < expected_code_points.size(); ++code_point_index) {
+			REQUIRE(index.code_point_at(code_point_index) == expected_code_points[code_point_index]);
+			REQUIRE(index.offset_of(code_point_index) == expected_offsets[code_point_index]);
+			REQUIRE(small_index.code_point_at(code_point_index) == expected_code_points[code_point_index]);
+			REQUIRE(small_index.offset_of(code_point_index) == expected_offsets[code_point_index]);
+		}
+		REQUIRE(index.offset_of(index.size()) == whole.size());
+		REQUIRE(small_index.offset_of(small_index.size()) == whole.size());
+	}
+
+	template <typename Encoding, typename CodeUnit>
+	void check_code_point_index_repeated(
+		std::basic_string_view<CodeUnit> piece, std::basic_string_view<CodeUnit> bad) {
+		using Text = ztd::text::basic_text_view<Encoding, ztd::text::nfkc, std::basic_string_view<CodeUnit>,
+			ztd::text::replacement_handler>;
+		for (std::size_t repetitions : { 0, 1, 3, 40 }) {
+			std::basic_string<CodeUnit> storage;
+			for (std::size_t repetition = 0; repetition < repetitions; ++repetition) {
+				storage += piece;
+			}
+			check_code_point_index(Text(storage));
+			if (storage.empty()) {
+				continue;
+			}
+			for (std::size_t position : { std::size_t(0), storage.size() / 3, storage.size() / 2, storage.size() }) {
+				std::basic_string<CodeUnit> ill_formed = storage;
+				ill_formed.insert(position, bad);
+				check_code_point_index(Text(ill_formed));
+			}
+		}
+	}
+} // namespace ztd_text_tests_basic_run_time_text_view
+
 TEST_CASE("text/text_view/basic", "basic usages of text_view do not explode") {
 	SECTION("execution") {
 		ztd::text::text_view txt;
@@ -56,3 +124,54 @@ TEST_CASE("text/text_view/basic", "basic usages of text_view do not explode") {
 		(void)txt;
 	}
 }
+
+TEST_CASE("text/text_view/code_point_index", "a code point index finds the same code points as decoding does") {
+	SECTION("utf8") {
+		const ztd::text::uchar8_t bad[] = { 0xE2, 0x82, 0x41, 0x80, 0xF0, 0x9F };
+		check_code_point_index_repeated<ztd::text::utf8>(ztd::text::tests::u8_unicode_sequence_truth_native_endian,
+			std::basic_string_view<ztd::text::uchar8_t>(bad, sizeof(bad)));
+		check_code_point_index_repeated<ztd::text::utf8>(ztd::text::tests::u8_basic_source_character_set,
+			std::basic_string_view<ztd::text::uchar8_t>(bad, 1));
+	}
+	SECTION("compat_utf8") {
+		check_code_point_index_repeated<ztd::text::compat_utf8>(
+			std::string_view("a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80"), std::string_view("\xC0\xAF\xED\xA0\x80"));
+	}
+	SECTION("utf16") {
+		const char16_t bad[] = { 0xDC00, 0x41, 0xD800 };
+		check_code_point_index_repeated<ztd::text::utf16>(
+			ztd::text::tests::u16_unicode_sequence_truth_native_endian, std::u16string_view(bad, 3));
+	}
+	SECTION("utf32") {
+		const char32_t bad[] = { 0xD800, 0x110000 };
+		check_code_point_index_repeated<ztd::text::utf32>(
+			ztd::text::tests::u32_unicode_sequence_truth_native_endian, std::u32string_view(bad, 2));
+	}
+	SECTION("text") {
+		using Text = ztd::text::basic_text<ztd::text::compat_utf8, ztd::text::nfkc, std::string,
+			ztd::text::replacement_handler>;
+		std::string storage;
+		for (std::size_t repetition = 0; repetition < 100; ++repetition) {
+			storage += "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80";
+		}
+		Text txt(storage);
+		ztd::text::code_point_index<Text, 16> index(txt);
+		REQUIRE(index.size() == 400);
+		REQUIRE(index.code_point_at(399) == U'\U0001F600');
+		REQUIRE(index.offset_of(256) == 640);
+
+		txt.base().replace(641, 2, "\x80" "b");
+		index.invalidate_from(641);
+		check_code_point_index(txt);
+		REQUIRE(index.size() == 401);
+		REQUIRE(index.code_point_at(257) == U'\uFFFD');
+		REQUIRE(index.code_point_at(258) == U'b');
+		REQUIRE(index.offset_of(259) == 643);
+
+		txt.base().erase(0, 1);
+		index.invalidate();
+		check_code_point_index(txt);
+		REQUIRE(index.size() == 400);
+		REQUIRE(index.code_point_at(0) == U'\u00E9');
+	}
+}
@@ -35,6 +35,120 @@
 
 #include <catch2/catch.hpp>
 
+#include <clocale>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+inline namespace ztd_text_tests_basic_run_time_transcode {
+	template <typename FromEncoding, typename ToEncoding, typename Char>
+	void transcode_position_check(std::basic_string_view<Char> input, std::size_t output_size) {
+		using ToCodeUnit = ztd::text::code_unit_t<ToEncoding>;
+		FromEncoding from_encoding {};
+		ToEncoding to_encoding {};
+		ztd::text::replacement_handler handler {};
+		// filled with something the conversion never writes, so bytes written past the output position show up
+		std::vector<ToCodeUnit> expected_storage(output_size, static_cast<ToCodeUnit>(0x55));
+		std::vector<ToCodeUnit> result_storage(output_size, static_cast<ToCodeUnit>(0x55));
+		auto expected_from_state = ztd::text::make_decode_state(from_encoding);
+		auto expected_to_state   = ztd::text::make_encode_state(to_encoding);
+		auto result_from_state   = ztd::text::make_decode_state(from_encoding);
+		auto result_to_state     = ztd::text::make_encode_state(to_encoding);
+
+		auto expected = ztd::text::basic_transcode_into(input, from_encoding,
+		     ztd::text::span<ToCodeUnit>(expected_storage), to_encoding, handler, handler, expected_from_state,
+		     expected_to_state);
+		auto result = ztd::text::transcode_into(input, from_encoding, ztd::text::span<ToCodeUnit>(result_storage),
+		     to_encoding, handler, handler, result_from_state, result_to_state);
+		REQUIRE(result.error_code == expected.error_code);
+		REQUIRE(result.handled_errors == expected.handled_errors);
+		REQUIRE(result.input.data() == expected.input.data());
+		REQUIRE(result.input.size() == expected.input.size());
+		REQUIRE(result.output.size() == expected.output.size());
+		REQUIRE(result_storage == expected_storage);
+	}
+
+	template <typename FromEncoding, typename ToEncoding, typename Char>
+	void transcode_sizing_check(std::basic_string_view<Char> input) {
+		using ToCodeUnit = ztd::text::code_unit_t<ToEncoding>;
+		using Container  = std::basic_string<ToCodeUnit>;
+		FromEncoding from_encoding {};
+		ToEncoding to_encoding {};
+		ztd::text::replacement_handler handler {};
+		auto expected_from_state = ztd::text::make_decode_state(from_encoding);
+		auto expected_to_state   = ztd::text::make_encode_state(to_encoding);
+		auto expected = ztd::text::transcode_to<Container>(input, from_encoding, to_encoding, handler, handler,
+		     expected_from_state, expected_to_state, ztd::text::output_sizing::incremental);
+		for (ztd::text::output_sizing sizing : { ztd::text::output_sizing::automatic,
+		          ztd::text::output_sizing::exact, ztd::text::output_sizing::upper_bound }) {
+			auto result_from_state = ztd::text::make_decode_state(from_encoding);
+			auto result_to_state   = ztd::text::make_encode_state(to_encoding);
+			auto result = ztd::text::transcode_to<Container>(input, from_encoding, to_encoding, handler, handler,
+			     result_from_state, result_to_state, sizing);
+			REQUIRE(result.error_code == expected.error_code);
+			REQUIRE(result.handled_errors == expected.handled_errors);
+			REQUIRE(result.input.data() == expected.input.data());
+			REQUIRE(result.input.size() == expected.input.size());
+			REQUIRE(result.output == expected.output);
+			auto plain_from_state = ztd::text::make_decode_state(from_encoding);
+			auto plain_to_state   = ztd::text::make_encode_state(to_encoding);
+			Container plain       = ztd::text::transcode(
+			     input, from_encoding, to_encoding, handler, handler, plain_from_state, plain_to_state, sizing);
+			REQUIRE(plain == expected.output);
+		}
+	}
+	// the same as compat_utf8, but without any of its bulk extension points
+	struct one_by_one_compat_utf8 : ztd::text::compat_utf8 { };
+
+	class counting_handler {
+	public:
+		counting_handler(std::size_t& count) : m_count(&count) {
+		}
+
+		template <typename Encoding, typename Result, typename Progress>
+		auto operator()(const Encoding& encoding, Result result, const Progress& progress) const {
+			++*m_count;
+			return ztd::text::replacement_handler {}(encoding, std::move(result), progress);
+		}
+
+	private:
+		std::size_t* m_count;
+	};
+
+	template <typename ToEncoding>
+	void transcode_chunked_check(std::string_view input, std::size_t output_size) {
+		using ToCodeUnit = ztd::text::code_unit_t<ToEncoding>;
+		one_by_one_compat_utf8 expected_from_encoding {};
+		ztd::text::compat_utf8 result_from_encoding {};
+		ToEncoding to_encoding {};
+		std::vector<ToCodeUnit> expected_storage(output_size);
+		std::vector<ToCodeUnit> result_storage(output_size);
+		std::size_t expected_count = 0;
+		std::size_t result_count   = 0;
+		counting_handler expected_handler(expected_count);
+		counting_handler result_handler(result_count);
+		auto expected_from_state = ztd::text::make_decode_state(expected_from_encoding);
+		auto expected_to_state   = ztd::text::make_encode_state(to_encoding);
+		auto result_from_state   = ztd::text::make_decode_state(result_from_encoding);
+		auto result_to_state     = ztd::text::make_encode_state(to_encoding);
+
+		auto expected = ztd::text::transcode_into(input, expected_from_encoding,
+		     ztd::text::span<ToCodeUnit>(expected_storage), to_encoding, expected_handler, expected_handler,
+		     expected_from_state, expected_to_state);
+		auto result = ztd::text::transcode_into(input, result_from_encoding,
+		     ztd::text::span<ToCodeUnit>(result_storage), to_encoding, result_handler, result_handler,
+		     result_from_state, result_to_state);
+		REQUIRE(result.error_code == expected.error_code);
+		REQUIRE(result.handled_errors == expected.handled_errors);
+		REQUIRE(result_count == expected_count);
+		REQUIRE(result.input.data() == expected.input.data());
+		REQUIRE(result.input.size() == expected.input.size());
+		REQUIRE(result.output.size() == expected.output.size());
+		REQUIRE(result_storage == expected_storage);
+	}
+} // namespace ztd_text_tests_basic_run_time_transcode
+
 TEST_CASE("text/transcode/roundtrip", "transcode can roundtrip") {
 	SECTION("execution") {
 		ztd::text::execution encoding {};
@@ -112,3 +226,372 @@ TEST_CASE("text/transcode/roundtrip", "transcode can roundtrip") {
 		REQUIRE(result1 == ztd::text::tests::u32_unicode_sequence_truth_native_endian);
 	}
 }
+
+TEST_CASE("text/transcode/utf8 to utf16 bulk", "bulk UTF-8 to UTF-16 transcoding matches one-by-one transcoding") {
+	const std::string_view code_points[] = { "a", "\xD0\x96", "\xE2\x82\xAC", "\xF0\x9F\x98\x80" };
+	const std::string_view invalids[]    = {
+          "\x80",             // lone continuation
+          "\xC3",             // missing continuation
+          "\xE2\x82",         // missing continuation
+          "\xC3\xC3\xA9",     // lead instead of continuation
+          "\xC0\xAF",         // invalid lead / overlong
+          "\xE0\x80\xAF",     // overlong
+          "\xED\xA0\x80",     // surrogate
+          "\xF4\x90\x80\x80", // too large
+          "\xFF",             // invalid lead
+	};
+	SECTION("roundtrip") {
+		std::u16string result(ztd::text::tests::u16_unicode_sequence_truth_native_endian.size(), u'\0');
+		auto transcode_result = ztd::text::transcode_into(ztd::text::tests::u8_unicode_sequence_truth_native_endian,
+		     ztd::text::utf8 {}, ztd::text::span<char16_t>(result), ztd::text::utf16 {});
+		REQUIRE(transcode_result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(transcode_result.input.empty());
+		REQUIRE(transcode_result.output.empty());
+		REQUIRE(result == ztd::text::tests::u16_unicode_sequence_truth_native_endian);
+	}
+	SECTION("failure position") {
+		for (std::size_t mix = 0; mix < 3; ++mix) {
+			for (std::size_t prefix_size = 0; prefix_size < 72; prefix_size += 3) {
+				std::string prefix;
+				for (std::size_t index = 0; prefix.size() < prefix_size; ++index) {
+					prefix += code_points[mix == 0 ? 0 : mix == 1 ? (index % 2) : (index % 4)];
+				}
+				for (std::size_t suffix_size : { 0, 1, 40 }) {
+					std::string suffix;
+					for (std::size_t index = 0; suffix.size() < suffix_size; ++index) {
+						suffix += code_points[mix == 0 ? 0 : mix == 1 ? ((index + 1) % 2) : ((index + 1) % 4)];
+					}
+					for (const std::string_view& invalid : invalids) {
+						std::string input = prefix;
+						input += invalid;
+						input += suffix;
+						for (std::size_t output_size : { input.size(), prefix.size() / 2, prefix.size() + 1 }) {
+							transcode_position_check<ztd::text::compat_utf8, ztd::text::utf16>(
+							     std::string_view(input), output_size);
+						}
+						std::basic_string<ztd::text::uchar8_t> u8input(input.cbegin(), input.cend());
+						transcode_position_check<ztd::text::utf8, ztd::text::utf16>(
+						     std::basic_string_view<ztd::text::uchar8_t>(u8input), input.size());
+						transcode_position_check<ztd::text::compat_utf8, ztd::text::utf32>(
+						     std::string_view(input), input.size());
+						transcode_position_check<ztd::text::compat_utf8, ztd::text::utf32>(
+						     std::string_view(input), prefix.size() / 2);
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST_CASE("text/transcode/execution to wide_execution bulk",
+	"bulk execution to wide execution transcoding matches one-by-one transcoding") {
+	const std::string_view non_ascii[] = {
+		"\xC3\xA9",         // 2 bytes
+		"\xF0\x9F\x98\x80", // 4 bytes
+		"\x80",             // lone continuation
+		"\xE2\x82",         // missing continuation
+		"\xED\xA0\x80",     // surrogate
+		"\xFF",             // invalid lead
+	};
+	const char* current = std::setlocale(LC_CTYPE, nullptr);
+	REQUIRE(current != nullptr);
+	const std::string original(current);
+	for (const char* locale_name : { original.c_str(), "C" }) {
+		REQUIRE(std::setlocale(LC_CTYPE, locale_name) != nullptr);
+		ztd::text::refresh_execution_encoding();
+		for (std::size_t run_size = 0; run_size < 80; run_size += 3) {
+			const std::string run(run_size, 'a');
+			for (const std::string_view& middle : non_ascii) {
+				std::string input = run;
+				input += middle;
+				input += run;
+				for (std::size_t output_size : { input.size(), run_size / 2, run_size + 1 }) {
+					transcode_position_check<ztd::text::execution, ztd::text::wide_execution>(
+					     std::string_view(input), output_size);
+				}
+			}
+		}
+	}
+	REQUIRE(std::setlocale(LC_CTYPE, original.c_str()) != nullptr);
+	ztd::text::refresh_execution_encoding();
+}
+
+TEST_CASE("text/transcode/utf16 to utf8 bulk", "bulk UTF-16 to UTF-8 transcoding matches one-by-one transcoding") {
+	const std::u16string_view code_points[] = { u"a", u"Ж", u"€", u"\U0001F600" };
+	const std::u16string_view invalids[]    = {
+          u"\xDC00",        // lone trail surrogate
+          u"\xD83D",        // lone lead surrogate
+          u"\xD83D\xD83D",  // lead surrogate instead of trail surrogate
+          u"\xD83D\x0041",  // lead surrogate followed by a non-surrogate
+          u"\xDE00\xD83D",  // trail surrogate before lead surrogate
+	};
+	SECTION("roundtrip") {
+		std::basic_string<ztd::text::uchar8_t> result(
+		     ztd::text::tests::u8_unicode_sequence_truth_native_endian.size(), u8'\0');
+		auto transcode_result = ztd::text::transcode_into(ztd::text::tests::u16_unicode_sequence_truth_native_endian,
+		     ztd::text::utf16 {}, ztd::text::span<ztd::text::uchar8_t>(result), ztd::text::utf8 {});
+		REQUIRE(transcode_result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(transcode_result.input.empty());
+		REQUIRE(transcode_result.output.empty());
+		REQUIRE(result == ztd::text::tests::u8_unicode_sequence_truth_native_endian);
+	}
+	SECTION("throw_handler") {
+		std::u16string input(40, u'a');
+		input += u"\xD83D";
+		std::string result(input.size() * 3, '\0');
+		ztd::text::utf16 from_encoding {};
+		ztd::text::compat_utf8 to_encoding {};
+		ztd::text::throw_handler handler {};
+		auto from_state = ztd::text::make_decode_state(from_encoding);
+		auto to_state   = ztd::text::make_encode_state(to_encoding);
+		REQUIRE_THROWS_AS(ztd::text::transcode_into(std::u16string_view(input), from_encoding,
+		                       ztd::text::span<char>(result), to_encoding, handler, handler, from_state, to_state),
+		     ztd::text::encoding_error);
+	}
+	SECTION("failure position") {
+		for (std::size_t mix = 0; mix < 3; ++mix) {
+			for (std::size_t prefix_size = 0; prefix_size < 40; prefix_size += 3) {
+				std::u16string prefix;
+				for (std::size_t index = 0; prefix.size() < prefix_size; ++index) {
+					prefix += code_points[mix == 0 ? 0 : mix == 1 ? (index % 3) : (index % 4)];
+				}
+				for (std::size_t suffix_size : { 0, 1, 24 }) {
+					std::u16string suffix;
+					for (std::size_t index = 0; suffix.size() < suffix_size; ++index) {
+						suffix += code_points[mix == 0 ? 0 : mix == 1 ? ((index + 1) % 3) : ((index + 1) % 4)];
+					}
+					for (const std::u16string_view& invalid : invalids) {
+						std::u16string input = prefix;
+						input += invalid;
+						input += suffix;
+						const std::size_t output_sizes[]
+						     = { input.size() * 3, prefix.size(), prefix.size() * 2 + 1 };
+						for (std::size_t output_size : output_sizes) {
+							transcode_position_check<ztd::text::utf16, ztd::text::compat_utf8>(
+							     std::u16string_view(input), output_size);
+						}
+						transcode_position_check<ztd::text::utf16, ztd::text::utf8>(
+						     std::u16string_view(input), input.size() * 3);
+					}
+				}
+			}
+		}
+	}
+	SECTION("output past the end") {
+		// blocks of 8 that encode to fewer than 16 bytes, the last right before a surrogate pair: what is past the
+		// output position must be left exactly as one-by-one transcoding leaves it
+		const std::u16string_view input = u"\xE27F\x004C\x05C9\x0456\x0025\x0011\xD94F\xDC2F\x0071\x005B\x5ECD\x952B"
+		                                  u"\x0034\x3025\x0065\x0053\x0056\x0063\x0232";
+		for (std::size_t prefix_size = 0; prefix_size < 24; ++prefix_size) {
+			std::u16string prefixed_storage(prefix_size, u'\x00E9');
+			prefixed_storage += input;
+			const std::u16string_view prefixed_input(prefixed_storage);
+			for (std::size_t output_size = 0; output_size <= prefixed_input.size() * 3; ++output_size) {
+				std::vector<ztd::text::uchar8_t> expected_storage(
+				     output_size, static_cast<ztd::text::uchar8_t>(0x55));
+				std::vector<ztd::text::uchar8_t> result_storage = expected_storage;
+				ztd::text::utf16 from_encoding {};
+				ztd::text::utf8 to_encoding {};
+				ztd::text::replacement_handler handler {};
+				auto from_state = ztd::text::make_decode_state(from_encoding);
+				auto to_state   = ztd::text::make_encode_state(to_encoding);
+				auto expected   = ztd::text::basic_transcode_into(prefixed_input, from_encoding,
+				       ztd::text::span<ztd::text::uchar8_t>(expected_storage), to_encoding, handler, handler,
+				       from_state, to_state);
+				auto result = ztd::text::transcode_into(prefixed_input, ztd::text::utf16 {},
+				     ztd::text::span<ztd::text::uchar8_t>(result_storage), ztd::text::utf8 {},
+				     ztd::text::replacement_handler {}, ztd::text::replacement_handler {});
+				REQUIRE(result.output.size() == expected.output.size());
+				REQUIRE(result_storage == expected_storage);
+			}
+			std::vector<ztd::text::uchar8_t> roomy_storage(
+			     prefixed_input.size() * 3 + 16, static_cast<ztd::text::uchar8_t>(0x55));
+			auto roomy = ztd::text::transcode_into(prefixed_input, ztd::text::utf16 {},
+			     ztd::text::span<ztd::text::uchar8_t>(roomy_storage), ztd::text::utf8 {},
+			     ztd::text::replacement_handler {}, ztd::text::replacement_handler {});
+			REQUIRE(roomy.input.empty());
+			for (std::size_t index = roomy_storage.size() - roomy.output.size(); index < roomy_storage.size();
+			     ++index) {
+				REQUIRE(roomy_storage[index] == 0x55);
+			}
+		}
+	}
+}
+
+TEST_CASE("text/transcode/bitwise copy",
+	"transcoding between bitwise compatible encodings validates and copies, matching one-by-one transcoding") {
+	STATIC_REQUIRE(ztd::text::is_bitwise_transcoding_compatible_v<ztd::text::compat_utf8, ztd::text::compat_utf8>);
+	STATIC_REQUIRE(ztd::text::is_bitwise_transcoding_compatible_v<ztd::text::ascii, ztd::text::compat_utf8>);
+	STATIC_REQUIRE_FALSE(ztd::text::is_bitwise_transcoding_compatible_v<ztd::text::ascii, ztd::text::mutf8>);
+	STATIC_REQUIRE_FALSE(ztd::text::is_bitwise_transcoding_compatible_v<ztd::text::utf8, ztd::text::mutf8>);
+
+	const std::string_view code_points[]
+	     = { "a", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80", std::string_view("\0", 1) };
+	const std::string_view invalids[]    = { "\x80", "\xC3", "\xE2\x82", "\xC0\xAF", "\xED\xA0\x80", "\xFF" };
+	SECTION("sanitize") {
+		for (std::size_t prefix_size = 0; prefix_size < 72; prefix_size += 5) {
+			std::string prefix;
+			for (std::size_t index = 0; prefix.size() < prefix_size; ++index) {
+				prefix += code_points[index % 5];
+			}
+			for (const std::string_view& invalid : invalids) {
+				std::string input = prefix;
+				input += invalid;
+				input += prefix;
+				const std::size_t output_sizes[] = { input.size() + 3, prefix.size() + 1, prefix.size() / 2 };
+				for (std::size_t output_size : output_sizes) {
+					transcode_position_check<ztd::text::compat_utf8, ztd::text::compat_utf8>(
+					     std::string_view(input), output_size);
+					transcode_position_check<ztd::text::compat_utf8, ztd::text::utf8>(
+					     std::string_view(input), output_size);
+					transcode_position_check<ztd::text::compat_utf8, ztd::text::basic_wtf8<char>>(
+					     std::string_view(input), output_size);
+					transcode_position_check<ztd::text::compat_utf8, ztd::text::basic_mutf8<char>>(
+					     std::string_view(input), output_size);
+				}
+			}
+		}
+	}
+	SECTION("ascii") {
+		for (std::size_t prefix_size = 0; prefix_size < 72; prefix_size += 5) {
+			std::string prefix;
+			for (std::size_t index = 0; prefix.size() < prefix_size; ++index) {
+				prefix += code_points[(index % 2) * 4];
+			}
+			for (const std::string_view& invalid : invalids) {
+				std::string input = prefix;
+				input += invalid;
+				input += prefix;
+				const std::size_t output_sizes[] = { input.size() * 2, prefix.size() / 2 };
+				for (std::size_t output_size : output_sizes) {
+					transcode_position_check<ztd::text::ascii, ztd::text::compat_utf8>(
+					     std::string_view(input), output_size);
+					transcode_position_check<ztd::text::ascii, ztd::text::basic_mutf8<char>>(
+					     std::string_view(input), output_size);
+				}
+			}
+		}
+	}
+	SECTION("in place") {
+		std::string input("ab\xC3\xA9" "cd\xE2\x82\xAC");
+		const std::string original = input;
+		ztd::text::compat_utf8 encoding {};
+		ztd::text::replacement_handler handler {};
+		auto from_state = ztd::text::make_decode_state(encoding);
+		auto to_state   = ztd::text::make_encode_state(encoding);
+		auto result     = ztd::text::transcode_into(std::string_view(input), encoding, ztd::text::span<char>(input),
+		     encoding, handler, handler, from_state, to_state);
+		REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(result.handled_errors == 0);
+		REQUIRE(result.input.empty());
+		REQUIRE(result.output.empty());
+		REQUIRE(input == original);
+	}
+}
+
+TEST_CASE("text/transcode/output sizing",
+	"every output sizing strategy for container-returning transcodes produces the same result") {
+	const std::string_view code_points[] = { "a", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80" };
+	const std::string_view invalids[]    = { "", "\x80", "\xC3", "\xE2\x82", "\xED\xA0\x80", "\xFF" };
+	for (std::size_t prefix_size = 0; prefix_size < 48; prefix_size += 7) {
+		std::string prefix;
+		for (std::size_t index = 0; prefix.size() < prefix_size; ++index) {
+			prefix += code_points[index % 4];
+		}
+		for (const std::string_view& invalid : invalids) {
+			std::string input = prefix;
+			input += invalid;
+			input += prefix;
+			std::basic_string<ztd::text::uchar8_t> u8input(input.cbegin(), input.cend());
+			std::basic_string_view<ztd::text::uchar8_t> u8view(u8input);
+			transcode_sizing_check<ztd::text::compat_utf8, ztd::text::utf16>(std::string_view(input));
+			transcode_sizing_check<ztd::text::compat_utf8, ztd::text::utf32>(std::string_view(input));
+			transcode_sizing_check<ztd::text::compat_utf8, ztd::text::compat_utf8>(std::string_view(input));
+			transcode_sizing_check<ztd::text::utf8, ztd::text::utf16>(u8view);
+			transcode_sizing_check<ztd::text::utf8, ztd::text::utf8>(u8view);
+			transcode_sizing_check<ztd::text::compat_utf8, ztd::text::ascii>(std::string_view(input));
+
+			ztd::text::utf8 from_encoding {};
+			ztd::text::utf16 to_encoding {};
+			ztd::text::replacement_handler handler {};
+			auto from_state = ztd::text::make_decode_state(from_encoding);
+			auto to_state   = ztd::text::make_encode_state(to_encoding);
+			std::u16string utf16_output
+			     = ztd::text::transcode(u8view, from_encoding, to_encoding, handler, handler, from_state, to_state);
+			std::u16string_view utf16_view(utf16_output);
+			transcode_sizing_check<ztd::text::utf16, ztd::text::utf8>(utf16_view);
+			transcode_sizing_check<ztd::text::utf16, ztd::text::utf32>(utf16_view);
+			if (!utf16_output.empty()) {
+				utf16_output[utf16_output.size() / 2] = u'\xD800';
+				transcode_sizing_check<ztd::text::utf16, ztd::text::utf8>(utf16_view);
+			}
+		}
+	}
+}
+
+TEST_CASE("text/transcode/incremental growth",
+	"filling in a container one step at a time grows it correctly past its initial size") {
+	std::u16string input;
+	for (std::size_t index = 0; input.size() < 5000; ++index) {
+		input += (index % 3 == 0) ? u"\u00E9\U0001F600" : u"abc";
+	}
+	std::u16string_view input_view(input);
+	ztd::text::utf16 from_encoding {};
+	ztd::text::utf32 to_encoding {};
+	ztd::text::replacement_handler handler {};
+
+	std::u32string expected;
+	auto expected_from_state = ztd::text::make_decode_state(from_encoding);
+	auto expected_to_state   = ztd::text::make_encode_state(to_encoding);
+	ztd::text::transcode_into(input_view, from_encoding, ztd::text::unbounded_view(std::back_inserter(expected)),
+	     to_encoding, handler, handler, expected_from_state, expected_to_state);
+
+	auto string_from_state = ztd::text::make_decode_state(from_encoding);
+	auto string_to_state   = ztd::text::make_encode_state(to_encoding);
+	std::u32string string_result = ztd::text::transcode(input_view, from_encoding, to_encoding, handler, handler,
+	     string_from_state, string_to_state, ztd::text::output_sizing::incremental);
+	REQUIRE(string_result == expected);
+
+	auto vector_from_state = ztd::text::make_decode_state(from_encoding);
+	auto vector_to_state   = ztd::text::make_encode_state(to_encoding);
+	auto vector_result     = ztd::text::transcode_to<std::vector<char32_t>>(input_view, from_encoding,
+	     to_encoding, handler, handler, vector_from_state, vector_to_state, ztd::text::output_sizing::incremental);
+	REQUIRE(vector_result.error_code == ztd::text::encoding_error::ok);
+	REQUIRE(vector_result.input.empty());
+	REQUIRE(std::u32string(vector_result.output.cbegin(), vector_result.output.cend()) == expected);
+}
+
+TEST_CASE("text/transcode/chunked",
+	"transcoding a chunk of code points at a time matches transcoding one code point at a time") {
+	const std::string_view code_points[] = { "a", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80" };
+	const std::string_view invalids[]    = { "", "\x80", "\xC3", "\xE2\x82", "\xC0\xAF", "\xFF" };
+	for (std::size_t mixed = 0; mixed < 2; ++mixed) {
+		for (std::size_t prefix_size : { 0, 1, 255, 256, 257, 700 }) {
+			std::string prefix;
+			for (std::size_t index = 0; prefix.size() < prefix_size; ++index) {
+				prefix += code_points[mixed == 0 ? 0 : (index % 7 == 3 ? index % 4 : 0)];
+			}
+			for (const std::string_view& invalid : invalids) {
+				std::string input = prefix;
+				input += invalid;
+				input += prefix;
+				const std::size_t output_sizes[]
+				     = { input.size() + 1, prefix.size() + 1, prefix.size() / 2, prefix.size() * 2 };
+				for (std::size_t output_size : output_sizes) {
+					transcode_chunked_check<ztd::text::ascii>(std::string_view(input), output_size);
+				}
+			}
+		}
+	}
+	for (std::size_t error_every : { 1, 2, 5, 100 }) {
+		std::string input;
+		for (std::size_t index = 0; index < 700; ++index) {
+			input += index % error_every == 0 ? invalids[1 + (index / error_every) % 5] : code_points[index % 4];
+		}
+		const std::size_t output_sizes[] = { input.size() + 1, input.size() / 3 };
+		for (std::size_t output_size : output_sizes) {
+			transcode_chunked_check<ztd::text::ascii>(std::string_view(input), output_size);
+			transcode_chunked_check<ztd::text::utf16>(std::string_view(input), output_size);
+		}
+	}
+}
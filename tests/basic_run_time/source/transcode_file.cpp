@@ -0,0 +1,197 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+#include <ztd/text/transcode_file.hpp>
+#include <ztd/text/transcode.hpp>
+#include <ztd/text/encoding.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+inline namespace ztd_text_tests_basic_run_time_transcode_file {
+	// the tests may run in several processes at once: give each its own files
+	inline std::string file_name(std::string_view name) {
+		static const std::string suffix = std::to_string(std::random_device {}());
+		return "ztd.text.tests.transcode_file." + std::string(name) + "." + suffix;
+	}
+
+	inline void write_file(const std::string& path, std::string_view contents) {
+		std::ofstream file(path, std::ios::binary);
+		file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+	}
+
+	inline std::string read_file(const std::string& path) {
+		std::ifstream file(path, std::ios::binary);
+		return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	}
+
+	inline std::string utf16_le_bytes(const std::u16string& input) {
+		std::string bytes;
+		for (char16_t code_unit : input) {
+			bytes.push_back(static_cast<char>(code_unit & 0xFF));
+			bytes.push_back(static_cast<char>(code_unit >> 8));
+		}
+		return bytes;
+	}
+} // namespace ztd_text_tests_basic_run_time_transcode_file
+
+TEST_CASE("text/transcode/file", "transcoding a file gives the same results as transcoding its contents in memory") {
+	const std::string input_path  = file_name("input");
+	const std::string output_path = file_name("output");
+	const std::string_view utf8_piece
+		= "Hello, \xC3\xA9\xC3\xA8! \xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82 \xE4\xBD\xA0\xE5\xA5\xBD "
+		  "\xF0\x9F\x98\x80\xF0\x9F\x91\x8D end\n";
+	std::string utf8_input;
+	for (int i = 0; i < 1000; ++i) {
+		utf8_input.append(utf8_piece);
+	}
+	const std::string utf16_le_input = utf16_le_bytes(ztd::text::transcode_to<std::u16string>(utf8_input,
+		ztd::text::utf8 {}, ztd::text::utf16 {}, ztd::text::replacement_handler {}, ztd::text::replacement_handler {})
+		                                                  .output);
+
+	SECTION("whole files and windows") {
+		// a window size of 1 is rounded up to the smallest window, a couple of pages
+		for (std::size_t window_size : { 0, 1, 10000 }) {
+			ztd::text::transcode_file_options options {};
+			options.window_size = window_size;
+
+			write_file(input_path, utf8_input);
+			auto result = ztd::text::transcode_file(input_path, ztd::text::utf8 {}, output_path,
+				ztd::text::utf16_le {}, ztd::text::replacement_handler {}, ztd::text::replacement_handler {},
+				options);
+			REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+			REQUIRE_FALSE(result.file_error);
+			REQUIRE_FALSE(result.errors_were_handled());
+			REQUIRE(result.input_size == utf8_input.size());
+			REQUIRE(result.output_size == utf16_le_input.size());
+			REQUIRE(read_file(output_path) == utf16_le_input);
+
+			write_file(input_path, utf16_le_input);
+			result = ztd::text::transcode_file(input_path, ztd::text::utf16_le {}, output_path, ztd::text::utf8 {},
+				ztd::text::replacement_handler {}, ztd::text::replacement_handler {}, options);
+			REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+			REQUIRE(result.input_size == utf16_le_input.size());
+			REQUIRE(read_file(output_path) == utf8_input);
+
+			result = ztd::text::transcode_file(input_path, ztd::text::utf16_le {}, output_path,
+				ztd::text::utf16_le {}, ztd::text::replacement_handler {}, ztd::text::replacement_handler {},
+				options);
+			REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+			REQUIRE(read_file(output_path) == utf16_le_input);
+		}
+	}
+	SECTION("empty file") {
+		write_file(input_path, "");
+		auto result = ztd::text::transcode_file(input_path, ztd::text::utf8 {}, output_path, ztd::text::utf16_be {});
+		REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE_FALSE(result.file_error);
+		REQUIRE(result.output_size == 0);
+		REQUIRE(read_file(output_path).empty());
+	}
+	SECTION("byte order marks") {
+		write_file(input_path, "\xEF\xBB\xBF"
+		                       "abc");
+		ztd::text::transcode_file_options options {};
+		options.skip_input_bom   = true;
+		options.write_output_bom = true;
+		auto result = ztd::text::transcode_file(input_path, ztd::text::utf8 {}, output_path, ztd::text::utf16_be {},
+			ztd::text::replacement_handler {}, ztd::text::replacement_handler {}, options);
+		REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+		REQUIRE(result.input_size == 6);
+		REQUIRE(read_file(output_path) == std::string_view("\xFE\xFF\0a\0b\0c", 8));
+
+		options.write_output_bom = false;
+		result = ztd::text::transcode_file(input_path, ztd::text::utf8 {}, output_path, ztd::text::utf16_be {},
+			ztd::text::replacement_handler {}, ztd::text::replacement_handler {}, options);
+		REQUIRE(read_file(output_path) == std::string_view("\0a\0b\0c", 6));
+
+		result = ztd::text::transcode_file(input_path, ztd::text::utf8 {}, output_path, ztd::text::utf16_be {});
+		REQUIRE(read_file(output_path) == std::string_view("\xFE\xFF\0a\0b\0c", 8));
+	}
+	SECTION("errors") {
+		// in the middle of a window, on the 'e' of "Hello"
+		const std::size_t bad_position = utf8_piece.size() * 300 + 1;
+		std::string bad_input          = utf8_input;
+		bad_input[bad_position]        = '\xFF';
+		bad_input.append("\xE2\x82");
+		write_file(input_path, bad_input);
+		const std::string_view bad_view(bad_input);
+		const std::string passed_output = utf16_le_bytes(ztd::text::transcode_to<std::u16string>(
+			bad_view.substr(0, bad_position), ztd::text::utf8 {}, ztd::text::utf16 {}, ztd::text::pass_handler {},
+			ztd::text::pass_handler {})
+			                                                 .output);
+		const std::string replaced_output
+			= utf16_le_bytes(ztd::text::transcode_to<std::u16string>(bad_view, ztd::text::utf8 {}, ztd::text::utf16 {},
+				ztd::text::replacement_handler {}, ztd::text::replacement_handler {})
+			                     .output);
+		for (std::size_t window_size : { 0, 1 }) {
+			ztd::text::transcode_file_options options {};
+			options.window_size = window_size;
+
+			auto result = ztd::text::transcode_file(input_path, ztd::text::utf8 {}, output_path,
+				ztd::text::utf16_le {}, ztd::text::pass_handler {}, ztd::text::pass_handler {}, options);
+			REQUIRE(result.error_code == ztd::text::encoding_error::invalid_sequence);
+			REQUIRE(result.input_size == bad_position);
+			REQUIRE(read_file(output_path) == passed_output);
+
+			result = ztd::text::transcode_file(input_path, ztd::text::utf8 {}, output_path, ztd::text::utf16_le {},
+				ztd::text::replacement_handler {}, ztd::text::replacement_handler {}, options);
+			REQUIRE(result.error_code == ztd::text::encoding_error::ok);
+			REQUIRE(result.handled_errors == 2);
+			REQUIRE(result.input_size == bad_input.size());
+			REQUIRE(read_file(output_path) == replaced_output);
+		}
+	}
+	SECTION("same file") {
+		write_file(input_path, utf8_input);
+		auto result = ztd::text::transcode_file(input_path, ztd::text::utf8 {}, input_path, ztd::text::utf16_le {},
+			ztd::text::replacement_handler {}, ztd::text::replacement_handler {});
+		REQUIRE(result.file_error == std::make_error_code(std::errc::invalid_argument));
+		REQUIRE(result.input_size == 0);
+		REQUIRE(result.output_size == 0);
+		REQUIRE(read_file(input_path) == utf8_input);
+	}
+	SECTION("missing file") {
+		auto result = ztd::text::transcode_file(
+			file_name("missing"), ztd::text::utf8 {}, output_path, ztd::text::utf16_le {});
+		REQUIRE(result.file_error);
+		REQUIRE(result.input_size == 0);
+	}
+
+	std::remove(input_path.c_str());
+	std::remove(output_path.c_str());
+}
@@ -29,11 +29,16 @@
 // ============================================================================>
 
 #include <ztd/text/transcode_view.hpp>
+#include <ztd/text/transcode.hpp>
 
 #include <catch2/catch.hpp>
 
 #include <ztd/text/tests/basic_unicode_strings.hpp>
 
+#include <cstddef>
+#include <string>
+#include <string_view>
+
 inline namespace ztd_text_tests_basic_run_time_transcode_view {
 	template <typename FromEncoding, typename ToEncoding, typename Input, typename Expected>
 	void check_transcode_view(
@@ -53,6 +58,26 @@ inline namespace ztd_text_tests_basic_run_time_transcode_view {
 			REQUIRE(truth0_val == result0_val);
 		}
 	}
+
+	template <std::size_t BufferSize>
+	void check_buffered_transcode_view(std::string_view input) {
+		using FromEncoding = ztd::text::compat_utf8;
+		using ToEncoding   = ztd::text::utf16;
+		using TranscodeRange
+		     = ztd::text::transcode_view<FromEncoding, ToEncoding, std::string_view, ztd::text::replacement_handler,
+		          ztd::text::replacement_handler, ztd::text::decode_state_t<FromEncoding>,
+		          ztd::text::encode_state_t<ToEncoding>, BufferSize>;
+		std::u16string expected = ztd::text::transcode(input, FromEncoding {}, ToEncoding {},
+		     ztd::text::replacement_handler {}, ztd::text::replacement_handler {});
+		TranscodeRange result_view(input);
+		std::u16string result;
+		auto result_it = result_view.begin();
+		for (const auto result_last = result_view.end(); result_it != result_last; ++result_it) {
+			result.push_back(*result_it);
+		}
+		REQUIRE(result == expected);
+		REQUIRE(result_it.base().empty());
+	}
 } // namespace ztd_text_tests_basic_run_time_transcode_view
 
 TEST_CASE("text/transcode_view/basic", "basic usages of encode_view type do not explode") {
@@ -437,3 +462,17 @@ TEST_CASE("text/transcode_view/basic", "basic usages of encode_view type do not
 		}
 	}
 }
+
+TEST_CASE("text/transcode_view/buffered", "buffered transcode_views produce the same code units") {
+	const std::string_view pieces[]
+	     = { "a", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80", "\x80", "\xE2\x82", "\xFF" };
+	for (std::size_t length : { 0, 1, 7, 63, 64, 65, 300 }) {
+		std::string input;
+		for (std::size_t index = 0; index < length; ++index) {
+			input += pieces[(index * 5 + length) % 7];
+		}
+		check_buffered_transcode_view<2>(input);
+		check_buffered_transcode_view<5>(input);
+		check_buffered_transcode_view<64>(input);
+	}
+}
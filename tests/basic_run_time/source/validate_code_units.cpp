@@ -35,6 +35,9 @@
 
 #include <ztd/text/tests/basic_unicode_strings.hpp>
 
+#include <string>
+#include <string_view>
+
 inline namespace ztd_text_tests_basic_run_time_validate_code_units {
 	template <typename Input, typename Encoding>
 	void validate_check(Input& input, Encoding& encoding) {
@@ -43,6 +46,18 @@ inline namespace ztd_text_tests_basic_run_time_validate_code_units {
 		auto result1 = ztd::text::validate_code_units(input, encoding);
 		REQUIRE(result1);
 	}
+
+	template <typename Encoding, typename Char>
+	void validate_position_check(std::basic_string_view<Char> input) {
+		Encoding encoding {};
+		auto decode_state   = ztd::text::make_decode_state(encoding);
+		auto encode_state   = ztd::text::make_encode_state(encoding);
+		auto expected       = ztd::text::basic_validate_code_units(input, encoding, decode_state, encode_state);
+		auto result         = ztd::text::validate_code_units(input, encoding);
+		REQUIRE(result.valid == expected.valid);
+		REQUIRE(result.input.data() == expected.input.data());
+		REQUIRE(result.input.size() == expected.input.size());
+	}
 } // namespace ztd_text_tests_basic_run_time_validate_code_units
 
 TEST_CASE("text/validate_code_units/basic", "basic usages of validate_code_units function do not explode") {
@@ -96,3 +111,47 @@ TEST_CASE("text/validate_code_units/basic", "basic usages of validate_code_units
 		validate_check(ztd::text::tests::u32_unicode_sequence_truth_native_endian, encoding);
 	}
 }
+
+TEST_CASE("text/validate_code_units/utf8 failure position",
+	"bulk validation of UTF-8 fails at the same position as one-by-one validation") {
+	const std::string_view code_points[] = { "a", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80" };
+	const std::string_view invalids[]    = {
+          "\x80",                 // lone continuation
+          "\xBF\x80",             // two continuations
+          "\xC3",                 // missing continuation
+          "\xE2\x82",             // missing continuation
+          "\xF0\x9F\x98",         // missing continuation
+          "\xC3\xC3\xA9",         // lead instead of continuation
+          "\xC0\xAF",             // invalid lead / overlong
+          "\xE0\x80\xAF",         // overlong
+          "\xF0\x80\x80\xAF",     // overlong
+          "\xED\xA0\x80",         // surrogate
+          "\xF4\x90\x80\x80",     // too large
+          "\xF5\x80\x80\x80",     // invalid lead
+          "\xFF",                 // invalid lead
+	};
+	for (std::size_t mixed = 0; mixed < 2; ++mixed) {
+		for (std::size_t prefix_size = 0; prefix_size < 72; ++prefix_size) {
+			std::string prefix;
+			for (std::size_t index = 0; prefix.size() < prefix_size; ++index) {
+				prefix += code_points[mixed == 0 ? 0 : (index % 4)];
+			}
+			for (std::size_t suffix_size : { 0, 1, 40 }) {
+				std::string suffix;
+				for (std::size_t index = 0; suffix.size() < suffix_size; ++index) {
+					suffix += code_points[mixed == 0 ? 0 : ((index + 1) % 4)];
+				}
+				std::string valid = prefix + suffix;
+				validate_position_check<ztd::text::compat_utf8>(std::string_view(valid));
+				for (const std::string_view& invalid : invalids) {
+					std::string input = prefix;
+					input += invalid;
+					input += suffix;
+					validate_position_check<ztd::text::compat_utf8>(std::string_view(input));
+					std::basic_string<ztd::text::uchar8_t> u8input(input.cbegin(), input.cend());
+					validate_position_check<ztd::text::utf8>(std::basic_string_view<ztd::text::uchar8_t>(u8input));
+				}
+			}
+		}
+	}
+}
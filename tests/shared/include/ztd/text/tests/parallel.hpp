@@ -0,0 +1,119 @@
+// =============================================================================
+//
+// ztd.text
+// Copyright © 2021 JeanHeyd "ThePhD" Meneide and Shepherd's Oasis, LLC
+// Contact: opensource@soasis.org
+//
+// Commercial License Usage
+// Licensees holding valid commercial ztd.text licenses may use this file in
+// accordance with the commercial license agreement provided with the
+// Software or, alternatively, in accordance with the terms contained in
+// a written agreement between you and Shepherd's Oasis, LLC.
+// For licensing terms and conditions see your agreement. For
+// further information contact opensource@soasis.org.
+//
+// Apache License Version 2 Usage
+// Alternatively, this file may be used under the terms of Apache License
+// Version 2.0 (the "License") for non-commercial use; you may not use this
+// file except in compliance with the License. You may obtain a copy of the
+// License at
+//
+//		http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// ============================================================================>
+
+#pragma once
+
+#ifndef ZTD_TEXT_TESTS_PARALLEL_HPP
+#define ZTD_TEXT_TESTS_PARALLEL_HPP
+
+#include <ztd/text/encoding.hpp>
+#include <ztd/text/error_handler.hpp>
+#include <ztd/text/transcode.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ztd { namespace text { namespace tests {
+
+	// runs the tasks on a handful of threads, in whatever order they get to them
+	struct thread_executor {
+		template <typename Task>
+		void operator()(std::size_t count, const Task& task) const {
+			std::atomic<std::size_t> next_index(0);
+			std::vector<std::thread> threads;
+			for (std::size_t thread_index = 0; thread_index < 4; ++thread_index) {
+				threads.emplace_back([&]() {
+					for (std::size_t index = next_index++; index < count; index = next_index++) {
+						task(index);
+					}
+				});
+			}
+			for (std::thread& thread : threads) {
+				thread.join();
+			}
+		}
+	};
+
+	// replaces like ztd::text::replacement_handler, counting its calls and noting any made on another thread
+	class counting_handler {
+	public:
+		std::atomic<std::size_t>* calls;
+		std::atomic<bool>* other_thread;
+		std::thread::id thread = std::this_thread::get_id();
+
+		template <typename Encoding, typename Result, typename Progress>
+		auto operator()(const Encoding& encoding, Result result, const Progress& progress) const {
+			++*calls;
+			if (std::this_thread::get_id() != thread) {
+				*other_thread = true;
+			}
+			return ztd::text::replacement_handler {}(encoding, std::move(result), progress);
+		}
+	};
+
+	// runs the tasks on the calling thread, last one first
+	struct backwards_executor {
+		template <typename Task>
+		void operator()(std::size_t count, const Task& task) const {
+			for (std::size_t index = count; index-- > 0;) {
+				task(index);
+			}
+		}
+	};
+
+	// a few hundred thousand code units of everything from ASCII to 4-byte sequences, with some broken
+	// sequences every so often (including runs of lead bytes that a split could land in the middle of)
+	inline std::string large_utf8_input(bool with_errors) {
+		const char32_t code_points[] = { U'a', U'Z', U'é', U'Ω', U'☃', U'가', U'\U0001f600', U'\U00010348',
+			U' ', U'\n' };
+		std::string input;
+		for (std::size_t index = 0; input.size() < 300000; ++index) {
+			char32_t code_point = code_points[(index * 7 + index / 13) % std::size(code_points)];
+			auto result         = ztd::text::transcode_to<std::string>(std::u32string_view(&code_point, 1),
+			             ztd::text::utf32 {}, ztd::text::utf8 {}, ztd::text::replacement_handler {},
+			             ztd::text::replacement_handler {});
+			input += result.output;
+			if (with_errors && index % 40000 == 39999) {
+				input += std::string(5000, '\xE2');
+				input += "\xF0\x9F\x98";
+			}
+		}
+		return input;
+	}
+
+}}} // namespace ztd::text::tests
+
+#endif // ZTD_TEXT_TESTS_PARALLEL_HPP